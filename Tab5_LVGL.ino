@@ -8,12 +8,17 @@
 
 #include "src/core/display_manager.h"
 #include "src/core/power_manager.h"
+#include "src/core/config_store.h"
 #include "src/ui/ui_manager.h"
 #include "src/ui/sensor_popup.h"
 #include "src/ui/image_popup.h"
+#include "src/ui/image_cache.h"
+#include "src/ui/image_rle.h"
+#include "src/ui/sd_image_index.h"
 #include "src/network/network_manager.h"
 #include "src/network/mqtt_handlers.h"
 #include "src/network/mqtt_topics.h"
+#include "src/network/entity_snapshot.h"
 #include "src/web/web_config.h"
 #include "src/web/web_admin.h"
 #include "src/ui/tab_settings.h"
@@ -23,6 +28,9 @@
 #include "src/tiles/tile_config.h"
 #include "src/tiles/tile_renderer.h"  // Für process_sensor_update_queue()
 #include "src/tiles/mdi_icons.h"      // MDI Icon Mapping
+#include "src/tiles/tile_render_bench.h"
+#include "src/tiles/tile_thumb.h"
+#include "src/core/ui_loop.h"
 
 // MDI Icons Font (48px, 4bpp) - definiert in mdi_icons_48.c
 LV_FONT_DECLARE(mdi_icons_48);
@@ -37,10 +45,17 @@ static uint32_t ap_mode_disable_block_until = 0;
 static TaskHandle_t ui_build_waiter = nullptr;
 static scene_publish_cb_t ui_scene_cb = nullptr;
 static hotspot_start_cb_t ui_hotspot_cb = nullptr;
+static uint32_t last_render_stats = 0;
+static const uint32_t RENDER_STATS_INTERVAL_MS = 30000;
+static uint32_t loop_last_us = 0;
+static uint32_t loop_max_us = 0;
 
 static void build_ui_task(void* param) {
   (void)param;
-  uiManager.buildUI(ui_scene_cb, ui_hotspot_cb);
+  {
+    LvglLock lock;  // UI-Build laeuft in eigenem Task
+    uiManager.buildUI(ui_scene_cb, ui_hotspot_cb);
+  }
   if (ui_build_waiter) {
     xTaskNotifyGive(ui_build_waiter);
   }
@@ -128,6 +143,9 @@ void setup() {
   }
   Serial.println("[Setup] Display OK");
   Serial.flush();
+  image_rle_decoder_init();
+  image_cache_init();  // vor allen Bild-Workern
+  image_popup_init();
 
   Serial.println("[Setup] powerManager.init()...");
   Serial.flush();
@@ -137,10 +155,8 @@ void setup() {
 
   Serial.println("[Setup] Loading configs...");
   Serial.flush();
-  bool has_config = configManager.load();
-  haBridgeConfig.load();
-  gameControlsConfig.load();
-  tileConfig.load();
+  bool has_config = configStore.load();  // ein Blob fuer alle Module
+  entity_snapshot_restore();  // letzte Zustaende fuer den ersten Frame (stale)
   Serial.println("[Setup] Configs OK");
   Serial.flush();
 
@@ -155,6 +171,7 @@ void setup() {
 
   Serial.println("[Setup] Building UI...");
   Serial.flush();
+  ui_loop_init();  // Auftraege aus dem Web-Task laufen im Loop
   ui_scene_cb = mqttPublishScene;
   ui_hotspot_cb = set_hotspot_mode;
   ui_build_waiter = xTaskGetCurrentTaskHandle();
@@ -221,7 +238,10 @@ void loop() {
   last = now;
 
   if (first_run) Serial.println("[Loop] powerManager.update()...");
-  powerManager.update(displayManager.getLastActivityTime());
+  {
+    LvglLock lock;
+    powerManager.update(displayManager.getLastActivityTime());
+  }
 
   if (first_run) Serial.println("[Loop] Nach powerManager.update()!");
 
@@ -230,13 +250,19 @@ void loop() {
     if (!was_asleep) {
       Serial.println("[Loop] SLEEP MODE AKTIV!");
       was_asleep = true;
+      loop_last_us = 0;
     }
     if (configManager.isConfigured()) networkManager.update();
-    process_sensor_update_queue();  // Sensor-Warteschlange auch im Sleep leeren
-    process_switch_update_queue();
-    process_sensor_popup_queue();
+    {
+      LvglLock lock;
+      process_sensor_update_queue();  // Sensor-Warteschlange auch im Sleep leeren
+      process_switch_update_queue();
+      process_sensor_popup_queue();
+      ui_loop_process();
+    }
     lgfx::touch_point_t tp;
     if (M5.Display.getTouch(&tp)) {
+      LvglLock lock;
       powerManager.wakeFromDisplaySleep();
       was_asleep = false;
       return; 
@@ -247,15 +273,31 @@ void loop() {
   // Zurück im aktiven Modus
   was_asleep = false;
 
+  // Laengste Loop-Iteration (Abstand zwischen zwei aktiven Durchlaeufen)
+  {
+    uint32_t now_us = micros();
+    if (loop_last_us != 0) {
+      uint32_t gap_us = now_us - loop_last_us;
+      if (gap_us > loop_max_us) loop_max_us = gap_us;
+      ui_loop_note_iteration(gap_us);
+    }
+    loop_last_us = now_us;
+  }
+
   // --- ACTIVE ---
   if (first_run) Serial.println("[Loop] M5.update()...");
   M5.update();
 
   if (first_run) Serial.println("[Loop] process_sensor_update_queue()...");
-  process_sensor_update_queue();  // WICHTIG: VOR lv_timer_handler()!
-  process_switch_update_queue();
-  process_sensor_popup_queue();
-  tiles_process_reload_requests();
+  {
+    LvglLock lock;
+    process_sensor_update_queue();  // WICHTIG: VOR lv_timer_handler()!
+    process_switch_update_queue();
+    process_sensor_popup_queue();
+    ui_loop_process();  // Web-Admin-Handler (Tiles speichern, MQTT, ...)
+    tiles_process_reload_requests();
+    tile_render_bench_process();
+  }
 
   if (first_run) {
     Serial.println("[Loop] lv_timer_handler()...");
@@ -263,6 +305,7 @@ void loop() {
   }
   yield();  // Watchdog füttern
   lv_timer_handler();
+  entity_snapshot_note_frame();
   yield();  // Watchdog füttern
   if (first_run) {
     Serial.println("[Loop] lv_timer_handler() KOMPLETT!");
@@ -276,13 +319,17 @@ void loop() {
   if (webConfigServer.isRunning()) {
     if (webAdminServer.isRunning()) webAdminServer.stop();
     webConfigServer.handle();
-    settings_update_ap_mode(true);
-    settings_update_wifi_status_ap("Tab5_Config", "12345678");
-    settings_update_power_status();
+    {
+      LvglLock lock;
+      settings_update_ap_mode(true);
+      settings_update_wifi_status_ap("Tab5_Config", "12345678");
+      settings_update_power_status();
+    }
 
     if (webConfigServer.hasNewConfig()) { delay(1000); ESP.restart(); }
 
     if (ap_mode_started_at != 0 && (uint32_t)(now - ap_mode_started_at) > AP_MODE_TIMEOUT_MS) {
+      LvglLock lock;
       set_hotspot_mode(false);
     }
 
@@ -292,7 +339,9 @@ void loop() {
   }
 
   if (first_run) Serial.println("[Loop] webAdminServer.handle()...");
-  if (webAdminServer.isRunning()) webAdminServer.handle();
+  if (webAdminServer.isRunning()) webAdminServer.handle();  // HTTP im eigenen Task, hier nur Live-WS
+  configStore.service();  // Write-Behind der Web-Admin-Aenderungen
+  entity_snapshot_service();
 
   if (first_run) Serial.println("[Loop] gameWSServer.handle()...");
   // WebSocket Server fÃ¼r Game Controls
@@ -308,8 +357,11 @@ void loop() {
   }
 
   image_popup_service_url_cache();
+  sd_image_index_service();
+  tile_thumb_service();
 
   if (now - last_status_update > 2000UL) {
+    LvglLock lock;
     last_status_update = now;
     settings_update_power_status();
     if (configManager.isConfigured()) {
@@ -324,6 +376,13 @@ void loop() {
     }
   }
 
+  if (now - last_render_stats > RENDER_STATS_INTERVAL_MS) {
+    last_render_stats = now;
+    displayManager.logRenderStats();
+    Serial.printf("[Loop] Laengste Iteration: %lu us\n", (unsigned long)loop_max_us);
+    loop_max_us = 0;
+  }
+
   if (first_run) {
     Serial.println("[Loop] === ERSTE ITERATION KOMPLETT ===");
     Serial.flush();
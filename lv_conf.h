@@ -97,6 +97,20 @@
 /*=================
  * OPERATING SYSTEM
  *=================*/
+/** Tab5: Multi-Core-Rendering (opt-in).
+ *  1 = FreeRTOS-OS-Layer + 2 Software-Draw-Units (Rasterisierung auf beiden Kernen).
+ *  Dann gilt: jeder LVGL-Zugriff ausserhalb von lv_timer_handler() laeuft ueber
+ *  LvglLock / lvgl_lock() (siehe src/core/display_manager.h). */
+#ifndef TAB5_LVGL_MULTICORE
+    #define TAB5_LVGL_MULTICORE 0
+#endif
+
+/** Host-Build (tests/host, Render-Benchmark): pthread-OS-Layer statt FreeRTOS,
+ *  Anzahl der Draw-Units ueber TAB5_LVGL_DRAW_UNITS, kein Arduino-SD-Treiber. */
+#ifndef TAB5_LVGL_HOST
+    #define TAB5_LVGL_HOST 0
+#endif
+
 /** Select operating system to use. Possible options:
  * - LV_OS_NONE
  * - LV_OS_PTHREAD
@@ -107,7 +121,13 @@
  * - LV_OS_MQX
  * - LV_OS_SDL2
  * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_NONE
+#if TAB5_LVGL_HOST
+    #define LV_USE_OS   LV_OS_PTHREAD
+#elif TAB5_LVGL_MULTICORE
+    #define LV_USE_OS   LV_OS_FREERTOS
+#else
+    #define LV_USE_OS   LV_OS_NONE
+#endif
 
 #if LV_USE_OS == LV_OS_CUSTOM
     #define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -197,7 +217,13 @@
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
      *  - > 1 means multiple threads will render the screen in parallel. */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #if TAB5_LVGL_HOST && defined(TAB5_LVGL_DRAW_UNITS)
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    TAB5_LVGL_DRAW_UNITS
+    #elif TAB5_LVGL_MULTICORE
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    2
+    #else
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #endif
 
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -919,7 +945,7 @@
 #endif
 
 /** API for Arduino Sd. */
-#define LV_USE_FS_ARDUINO_SD 1
+#define LV_USE_FS_ARDUINO_SD (!TAB5_LVGL_HOST)
 #if LV_USE_FS_ARDUINO_SD
     #define LV_FS_ARDUINO_SD_LETTER 'S'  /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
     #define LV_FS_ARDUINO_SD_PATH ""      /**< Set the working directory. File/directory paths will be appended to it. */
@@ -1043,7 +1069,7 @@
 /* Documentation for several of the below items can be found here: https://docs.lvgl.io/master/details/auxiliary-modules/index.html . */
 
 /** 1: Enable API to take snapshot for object */
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1  /* Render-Benchmark (Golden-Vergleich) */
 
 /** 1: Enable system monitor component */
 #define LV_USE_SYSMON   0
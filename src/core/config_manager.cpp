@@ -1,11 +1,13 @@
 #include "src/core/config_manager.h"
+#include "src/core/config_store.h"
 #include <Preferences.h>
 
 // Globale Instanz
 ConfigManager configManager;
 
-// Preferences namespace
+// Preferences namespace (Altbestand vor dem Config-Image)
 static const char* PREF_NAMESPACE = "tab5_config";
+static constexpr uint8_t kImageSectionVersion = 1;
 
 static uint16_t normalize_sleep_seconds(uint16_t seconds) {
   uint16_t closest = kSleepOptionsSec[0];
@@ -21,6 +23,19 @@ static uint16_t normalize_sleep_seconds(uint16_t seconds) {
   return closest;
 }
 
+// Fehlende/ungueltige Werte auf Defaults (gilt fuer Altbestand und Image)
+static void sanitize_config(DeviceConfig& config) {
+  if (config.display_brightness < 75 || config.display_brightness > 255) {
+    config.display_brightness = 200;
+  }
+  if (config.mqtt_base_topic[0] == '\0') {
+    strncpy(config.mqtt_base_topic, "tab5", CONFIG_MQTT_BASE_MAX - 1);
+  }
+  if (config.ha_prefix[0] == '\0') {
+    strncpy(config.ha_prefix, "ha/statestream", CONFIG_HA_PREFIX_MAX - 1);
+  }
+}
+
 ConfigManager::ConfigManager() {
   memset(&config, 0, sizeof(config));
   config.configured = false;
@@ -36,7 +51,7 @@ ConfigManager::ConfigManager() {
   config.auto_sleep_battery_seconds = config.auto_sleep_seconds;
 }
 
-bool ConfigManager::load() {
+bool ConfigManager::loadLegacy() {
   Preferences prefs;
 
   if (!prefs.begin(PREF_NAMESPACE, true)) {  // readonly
@@ -92,17 +107,7 @@ bool ConfigManager::load() {
   }
   config.auto_sleep_battery_seconds = normalize_sleep_seconds(sleep_bat_seconds);
 
-  if (config.display_brightness < 75 || config.display_brightness > 255) {
-    config.display_brightness = 200;
-  }
-
-  // Fallback: 0 Minuten korrigieren (kann durch ungültige Speicherung entstehen)
-  if (config.mqtt_base_topic[0] == '\0') {
-    strncpy(config.mqtt_base_topic, "tab5", CONFIG_MQTT_BASE_MAX - 1);
-  }
-  if (config.ha_prefix[0] == '\0') {
-    strncpy(config.ha_prefix, "ha/statestream", CONFIG_HA_PREFIX_MAX - 1);
-  }
+  sanitize_config(config);
 
   prefs.end();
 
@@ -114,51 +119,55 @@ bool ConfigManager::load() {
   return true;
 }
 
-bool ConfigManager::save(const DeviceConfig& cfg) {
-  Preferences prefs;
-
-  if (!prefs.begin(PREF_NAMESPACE, false)) {  // read/write
-    Serial.println("⚠️ ConfigManager: Preferences öffnen fehlgeschlagen");
-    return false;
-  }
-
-  // Speichere alle Felder
-  prefs.putString("wifi_ssid", cfg.wifi_ssid);
-  prefs.putString("wifi_pass", cfg.wifi_pass);
-  prefs.putString("mqtt_host", cfg.mqtt_host);
-  prefs.putUShort("mqtt_port", cfg.mqtt_port);
-  prefs.putString("mqtt_user", cfg.mqtt_user);
-  prefs.putString("mqtt_pass", cfg.mqtt_pass);
-  prefs.putString("mqtt_base", cfg.mqtt_base_topic);
-  prefs.putString("ha_prefix", cfg.ha_prefix);
-
-  // Display & Power Settings speichern
-  prefs.putUChar("disp_bright", cfg.display_brightness);
-  prefs.putBool("sleep_en", cfg.auto_sleep_enabled);
-  prefs.putUShort("sleep_sec", cfg.auto_sleep_seconds);
-  prefs.putBool("sleep_bat_en", cfg.auto_sleep_battery_enabled);
-  prefs.putUShort("sleep_bat_sec", cfg.auto_sleep_battery_seconds);
-
-  uint16_t sleep_minutes = (cfg.auto_sleep_seconds + 59) / 60;
-  if (sleep_minutes == 0) {
-    sleep_minutes = 1;
-  }
-  prefs.putUShort("sleep_min", sleep_minutes);
-
-  uint16_t sleep_bat_minutes = (cfg.auto_sleep_battery_seconds + 59) / 60;
-  if (sleep_bat_minutes == 0) {
-    sleep_bat_minutes = 1;
-  }
-  prefs.putUShort("sleep_bat_min", sleep_bat_minutes);
-
-  prefs.putBool("configured", true);
+void ConfigManager::writeImage(ConfigImageWriter& out) const {
+  out.beginSection(CFG_SECTION_DEVICE, kImageSectionVersion);
+  out.u8(config.configured ? 1 : 0);
+  out.str(config.wifi_ssid);
+  out.str(config.wifi_pass);
+  out.str(config.mqtt_host);
+  out.u16(config.mqtt_port);
+  out.str(config.mqtt_user);
+  out.str(config.mqtt_pass);
+  out.str(config.mqtt_base_topic);
+  out.str(config.ha_prefix);
+  out.u8(config.display_brightness);
+  out.u8(config.auto_sleep_enabled ? 1 : 0);
+  out.u16(config.auto_sleep_seconds);
+  out.u8(config.auto_sleep_battery_enabled ? 1 : 0);
+  out.u16(config.auto_sleep_battery_seconds);
+  out.endSection();
+}
 
-  prefs.end();
+void ConfigManager::readImage(ConfigImageReader& in) {
+  config.configured = in.u8() != 0;
+  in.str(config.wifi_ssid, sizeof(config.wifi_ssid));
+  in.str(config.wifi_pass, sizeof(config.wifi_pass));
+  in.str(config.mqtt_host, sizeof(config.mqtt_host));
+  config.mqtt_port = in.u16();
+  in.str(config.mqtt_user, sizeof(config.mqtt_user));
+  in.str(config.mqtt_pass, sizeof(config.mqtt_pass));
+  in.str(config.mqtt_base_topic, sizeof(config.mqtt_base_topic));
+  in.str(config.ha_prefix, sizeof(config.ha_prefix));
+  config.display_brightness = in.u8();
+  config.auto_sleep_enabled = in.u8() != 0;
+  config.auto_sleep_seconds = normalize_sleep_seconds(in.u16());
+  config.auto_sleep_battery_enabled = in.u8() != 0;
+  config.auto_sleep_battery_seconds = normalize_sleep_seconds(in.u16());
+  if (config.mqtt_port == 0) config.mqtt_port = 1883;
+  sanitize_config(config);
+}
 
-  // Update lokale Kopie
+bool ConfigManager::save(const DeviceConfig& cfg) {
+  const DeviceConfig prev = config;
   config = cfg;
   config.configured = true;
 
+  if (!configStore.commit()) {
+    config = prev;
+    Serial.println("⚠️ ConfigManager: Speichern fehlgeschlagen");
+    return false;
+  }
+
   Serial.println("✓ ConfigManager: Konfiguration gespeichert");
   Serial.printf("  WiFi SSID: %s\n", config.wifi_ssid);
   Serial.printf("  MQTT Host: %s:%u\n", config.mqtt_host, config.mqtt_port);
@@ -171,64 +180,33 @@ bool ConfigManager::saveDisplaySettings(uint8_t brightness,
                                         uint16_t sleep_seconds,
                                         bool sleep_battery_enabled,
                                         uint16_t sleep_battery_seconds) {
-  Preferences prefs;
-
-  if (!prefs.begin(PREF_NAMESPACE, false)) {
-    Serial.println("⚠️ ConfigManager: Preferences öffnen fehlgeschlagen");
-    return false;
-  }
-
-  // Speichere nur Display-Settings
-  uint16_t normalized_sleep_seconds = normalize_sleep_seconds(sleep_seconds);
-  uint16_t normalized_bat_seconds = normalize_sleep_seconds(sleep_battery_seconds);
-
-  prefs.putUChar("disp_bright", brightness);
-  prefs.putBool("sleep_en", sleep_enabled);
-  prefs.putUShort("sleep_sec", normalized_sleep_seconds);
-  prefs.putBool("sleep_bat_en", sleep_battery_enabled);
-  prefs.putUShort("sleep_bat_sec", normalized_bat_seconds);
-
-  uint16_t sleep_minutes = (normalized_sleep_seconds + 59) / 60;
-  if (sleep_minutes == 0) {
-    sleep_minutes = 1;
-  }
-  prefs.putUShort("sleep_min", sleep_minutes);
-
-  uint16_t sleep_bat_minutes = (normalized_bat_seconds + 59) / 60;
-  if (sleep_bat_minutes == 0) {
-    sleep_bat_minutes = 1;
-  }
-  prefs.putUShort("sleep_bat_min", sleep_bat_minutes);
-
-  prefs.end();
-
-  // Update lokale Kopie
   config.display_brightness = brightness;
   config.auto_sleep_enabled = sleep_enabled;
-  config.auto_sleep_seconds = normalized_sleep_seconds;
+  config.auto_sleep_seconds = normalize_sleep_seconds(sleep_seconds);
   config.auto_sleep_battery_enabled = sleep_battery_enabled;
-  config.auto_sleep_battery_seconds = normalized_bat_seconds;
+  config.auto_sleep_battery_seconds = normalize_sleep_seconds(sleep_battery_seconds);
 
-  Serial.println("✓ ConfigManager: Display-Einstellungen gespeichert");
+  // Slider/Dropdown: verzoegert schreiben, mehrere Aenderungen = ein Flash-Zugriff
+  configStore.markDirty();
   return true;
 }
 
 void ConfigManager::clear() {
-  Preferences prefs;
-
-  if (!prefs.begin(PREF_NAMESPACE, false)) {
-    Serial.println("⚠️ ConfigManager: Preferences öffnen fehlgeschlagen");
-    return;
-  }
-
-  prefs.clear();
-  prefs.end();
-
   memset(&config, 0, sizeof(config));
   config.configured = false;
   config.mqtt_port = 1883;
   strncpy(config.mqtt_base_topic, "tab5", CONFIG_MQTT_BASE_MAX - 1);
   strncpy(config.ha_prefix, "ha/statestream", CONFIG_HA_PREFIX_MAX - 1);
+  config.display_brightness = 200;
+  config.auto_sleep_enabled = true;
+  config.auto_sleep_seconds = 60;
+  config.auto_sleep_battery_enabled = true;
+  config.auto_sleep_battery_seconds = config.auto_sleep_seconds;
+
+  if (!configStore.commit()) {
+    Serial.println("⚠️ ConfigManager: Loeschen nicht gespeichert");
+    return;
+  }
 
   Serial.println("✓ ConfigManager: Konfiguration gelöscht");
 }
@@ -3,8 +3,11 @@
 
 #include <Arduino.h>
 
+class ConfigImageWriter;
+class ConfigImageReader;
+
 // WiFi/MQTT Configuration Manager
-// Speichert und lädt Verbindungsdaten aus dem Flash-Speicher (Preferences)
+// Verbindungsdaten liegen im gemeinsamen Config-Image (config_store)
 
 #define CONFIG_WIFI_SSID_MAX     32
 #define CONFIG_WIFI_PASS_MAX     64
@@ -40,13 +43,17 @@ class ConfigManager {
 public:
   ConfigManager();
 
-  // Lädt Konfiguration aus Flash-Speicher
-  bool load();
+  // Alte Einzel-Keys (Preferences) - nur noch fuer die Migration ins Config-Image
+  bool loadLegacy();
+
+  // Config-Image (Sektion CFG_SECTION_DEVICE)
+  void writeImage(ConfigImageWriter& out) const;
+  void readImage(ConfigImageReader& in);
 
-  // Speichert Konfiguration in Flash-Speicher
+  // Speichert Konfiguration (Config-Image)
   bool save(const DeviceConfig& cfg);
 
-  // Speichert nur Display-Einstellungen
+  // Speichert nur Display-Einstellungen (Write-Behind, siehe ConfigStore::markDirty)
   bool saveDisplaySettings(uint8_t brightness,
                            bool sleep_enabled,
                            uint16_t sleep_seconds,
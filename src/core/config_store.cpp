@@ -0,0 +1,412 @@
+#include "src/core/config_store.h"
+#include "src/core/config_manager.h"
+#include "src/network/ha_bridge_config.h"
+#include "src/game/game_controls_config.h"
+#include "src/tiles/tile_config.h"
+#include <Preferences.h>
+#include "esp_rom_crc.h"
+
+// Globale Instanz
+ConfigStore configStore;
+
+static const char* PREF_NAMESPACE = "tab5_store";
+static const char* PREF_SLOT_KEYS[2] = {"image", "image_b"};
+static constexpr uint32_t kImageMagic = 0x49433554;  // "T5CI"
+static constexpr size_t kHeaderSize = 16;            // magic, version, generation, len, crc
+static constexpr uint32_t kHourBucketMs = 5UL * 60UL * 1000UL;
+static constexpr size_t kImageMaxSize = 64 * 1024;
+
+/* === Writer === */
+ConfigImageWriter::ConfigImageWriter() {
+  buf.reserve(4096);
+}
+
+void ConfigImageWriter::beginSection(uint8_t id, uint8_t version) {
+  u8(id);
+  u8(version);
+  section_start = buf.size();
+  u16(0);  // Laenge, wird in endSection nachgetragen
+}
+
+void ConfigImageWriter::endSection() {
+  const size_t len = buf.size() - section_start - 2;
+  buf[section_start] = static_cast<uint8_t>(len & 0xFF);
+  buf[section_start + 1] = static_cast<uint8_t>((len >> 8) & 0xFF);
+}
+
+void ConfigImageWriter::u8(uint8_t v) {
+  buf.push_back(v);
+}
+
+void ConfigImageWriter::u16(uint16_t v) {
+  buf.push_back(static_cast<uint8_t>(v & 0xFF));
+  buf.push_back(static_cast<uint8_t>(v >> 8));
+}
+
+void ConfigImageWriter::u32(uint32_t v) {
+  u16(static_cast<uint16_t>(v & 0xFFFF));
+  u16(static_cast<uint16_t>(v >> 16));
+}
+
+void ConfigImageWriter::str(const char* s) {
+  size_t n = s ? strlen(s) : 0;
+  if (n > 0xFFFF) n = 0xFFFF;
+  u16(static_cast<uint16_t>(n));
+  if (n) buf.insert(buf.end(), s, s + n);
+}
+
+void ConfigImageWriter::raw(const uint8_t* data, size_t len) {
+  if (len) buf.insert(buf.end(), data, data + len);
+}
+
+/* === Reader === */
+ConfigImageReader::ConfigImageReader(const uint8_t* data, size_t len, uint8_t version)
+    : data(data), len(len), ver(version) {}
+
+bool ConfigImageReader::take(size_t n) {
+  if (overrun || pos + n > len) {
+    overrun = true;
+    return false;
+  }
+  return true;
+}
+
+uint8_t ConfigImageReader::u8() {
+  if (!take(1)) return 0;
+  return data[pos++];
+}
+
+uint16_t ConfigImageReader::u16() {
+  if (!take(2)) return 0;
+  uint16_t v = static_cast<uint16_t>(data[pos] | (data[pos + 1] << 8));
+  pos += 2;
+  return v;
+}
+
+uint32_t ConfigImageReader::u32() {
+  uint32_t lo = u16();
+  uint32_t hi = u16();
+  return lo | (hi << 16);
+}
+
+String ConfigImageReader::str() {
+  const uint16_t n = u16();
+  if (n == 0 || !take(n)) return String();
+  String out;
+  out.reserve(n);
+  out.concat(reinterpret_cast<const char*>(data + pos), n);
+  pos += n;
+  return out;
+}
+
+void ConfigImageReader::str(char* dst, size_t cap) {
+  const uint16_t n = u16();
+  if (!dst || cap == 0) {
+    if (take(n)) pos += n;
+    return;
+  }
+  dst[0] = '\0';
+  if (!take(n)) return;
+  const size_t copy = (n < cap) ? n : cap - 1;
+  memcpy(dst, data + pos, copy);
+  dst[copy] = '\0';
+  pos += n;
+}
+
+/* === Store === */
+static void put_le32(std::vector<uint8_t>& buf, size_t at, uint32_t v) {
+  buf[at] = static_cast<uint8_t>(v & 0xFF);
+  buf[at + 1] = static_cast<uint8_t>((v >> 8) & 0xFF);
+  buf[at + 2] = static_cast<uint8_t>((v >> 16) & 0xFF);
+  buf[at + 3] = static_cast<uint8_t>((v >> 24) & 0xFF);
+}
+
+static uint32_t get_le32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void ConfigStore::buildImage(ConfigImageWriter& out) const {
+  // Header-Platzhalter, wird nach den Sektionen gefuellt
+  for (size_t i = 0; i < kHeaderSize; ++i) out.u8(0);
+  configManager.writeImage(out);
+  haBridgeConfig.writeImage(out);
+  gameControlsConfig.writeImage(out);
+  tileConfig.writeImage(out);
+  out.raw(foreign_sections.data(), foreign_sections.size());
+}
+
+// Liest einen Slot und prueft Header + CRC; Sektionen werden noch nicht ausgewertet
+static bool read_slot(Preferences& prefs, const char* key, std::vector<uint8_t>& image,
+                      uint16_t& generation) {
+  const size_t len = prefs.getBytesLength(key);
+  if (len < kHeaderSize || len > kImageMaxSize) return false;
+  image.resize(len);
+  if (prefs.getBytes(key, image.data(), len) != len) return false;
+
+  const uint8_t* p = image.data();
+  const uint32_t magic = get_le32(p);
+  const uint16_t version = static_cast<uint16_t>(p[4] | (p[5] << 8));
+  const uint32_t payload_len = get_le32(p + 8);
+  const uint32_t crc = get_le32(p + 12);
+  if (magic != kImageMagic || payload_len != len - kHeaderSize) {
+    Serial.printf("[ConfigStore] Slot '%s' ungueltig (Header)\n", key);
+    return false;
+  }
+  if (version > CONFIG_IMAGE_VERSION) {
+    // Header-Aufbau ist versionsfest; bekannte Sektionen laden, unbekannte mitnehmen
+    Serial.printf("[ConfigStore] Slot '%s': Image-Version %u neuer als Firmware (%u)\n", key, version,
+                  static_cast<unsigned>(CONFIG_IMAGE_VERSION));
+  }
+  const uint32_t actual = esp_rom_crc32_le(0, p + kHeaderSize, payload_len);
+  if (actual != crc) {
+    Serial.printf("[ConfigStore] Slot '%s': CRC-Fehler (%08lX != %08lX)\n", key,
+                  static_cast<unsigned long>(actual), static_cast<unsigned long>(crc));
+    return false;
+  }
+  generation = static_cast<uint16_t>(p[6] | (p[7] << 8));
+  return true;
+}
+
+bool ConfigStore::readImage() {
+  Preferences prefs;
+  if (!prefs.begin(PREF_NAMESPACE, true)) return false;
+  std::vector<uint8_t> slots[2];
+  uint16_t gens[2] = {0, 0};
+  bool valid[2];
+  for (uint8_t i = 0; i < 2; ++i) {
+    valid[i] = read_slot(prefs, PREF_SLOT_KEYS[i], slots[i], gens[i]);
+  }
+  prefs.end();
+  if (!valid[0] && !valid[1]) return false;
+
+  // Neuerer Slot gewinnt (Generation mit Ueberlauf verglichen)
+  uint8_t pick = valid[0] ? 0 : 1;
+  if (valid[0] && valid[1] && static_cast<int16_t>(gens[1] - gens[0]) > 0) pick = 1;
+  const std::vector<uint8_t>& image = slots[pick];
+  const uint8_t* p = image.data();
+  const size_t len = image.size();
+
+  foreign_sections.clear();
+  size_t pos = kHeaderSize;
+  while (pos + 4 <= len) {
+    const uint8_t id = p[pos];
+    const uint8_t sec_ver = p[pos + 1];
+    const size_t sec_len = static_cast<size_t>(p[pos + 2] | (p[pos + 3] << 8));
+    pos += 4;
+    if (pos + sec_len > len) {
+      Serial.println("[ConfigStore] Sektion abgeschnitten");
+      foreign_sections.clear();
+      return false;
+    }
+    ConfigImageReader reader(p + pos, sec_len, sec_ver);
+    switch (id) {
+      case CFG_SECTION_DEVICE: configManager.readImage(reader); break;
+      case CFG_SECTION_BRIDGE: haBridgeConfig.readImage(reader); break;
+      case CFG_SECTION_GAME: gameControlsConfig.readImage(reader); break;
+      case CFG_SECTION_TILES: tileConfig.readImage(reader); break;
+      default:
+        // neuere Firmware: ueberspringen, beim naechsten commit() unveraendert zurueckschreiben
+        foreign_sections.insert(foreign_sections.end(), p + pos - 4, p + pos + sec_len);
+        Serial.printf("[ConfigStore] Sektion %u unbekannt (%u Bytes) - bleibt erhalten\n", id,
+                      static_cast<unsigned>(sec_len));
+        break;
+    }
+    if (!reader.ok()) {
+      Serial.printf("[ConfigStore] Sektion %u unvollstaendig\n", id);
+    }
+    pos += sec_len;
+  }
+
+  active_slot = pick;
+  slot_valid = true;
+  generation = gens[pick];
+  stats_.image_bytes = len;
+  last_crc = get_le32(p + 12);
+  last_len = len;
+  if (!valid[pick ^ 1]) {
+    Serial.printf("[ConfigStore] Slot %c aktiv, Slot %c leer/ungueltig\n",
+                  pick ? 'B' : 'A', pick ? 'A' : 'B');
+  }
+  return true;
+}
+
+bool ConfigStore::writeSlot(uint8_t slot, const std::vector<uint8_t>& image) {
+  Preferences prefs;
+  if (!prefs.begin(PREF_NAMESPACE, false)) {
+    Serial.printf("[ConfigStore] Fehler beim Oeffnen von NVS namespace '%s'\n", PREF_NAMESPACE);
+    return false;
+  }
+  const char* key = PREF_SLOT_KEYS[slot];
+  size_t written = prefs.putBytes(key, image.data(), image.size());
+  if (written != image.size()) {
+    // Alter Inhalt des Zielslots belegt noch Platz: freigeben und erneut versuchen
+    prefs.remove(key);
+    written = prefs.putBytes(key, image.data(), image.size());
+  }
+  prefs.end();
+  return written == image.size();
+}
+
+bool ConfigStore::load() {
+  const uint32_t start_us = micros();
+  stats_.from_image = readImage();
+  if (!stats_.from_image) {
+    // Migration: alte Loader fuellen die Module, danach ein Image schreiben
+    Serial.println("[ConfigStore] Kein gueltiges Image - lade Altbestand");
+    configManager.loadLegacy();
+    haBridgeConfig.loadLegacy();
+    gameControlsConfig.loadLegacy();
+    tileConfig.loadLegacy();
+  }
+  stats_.load_us = micros() - start_us;
+  Serial.printf("[ConfigStore] Konfiguration geladen in %lu us (%s, %lu Bytes)\n",
+                static_cast<unsigned long>(stats_.load_us),
+                stats_.from_image ? "Image" : "Altbestand",
+                static_cast<unsigned long>(stats_.image_bytes));
+
+  if (!stats_.from_image) {
+    if (commit()) {
+      // Gepackte Tile-Grids liegen jetzt im Image; NVS-Platz freigeben
+      tileConfig.clearLegacy();
+      Serial.println("[ConfigStore] Migration abgeschlossen");
+    } else {
+      Serial.println("[ConfigStore] WARN: Migration fehlgeschlagen, naechster Boot versucht es erneut");
+    }
+  }
+  return configManager.isConfigured();
+}
+
+bool ConfigStore::commit() {
+  const uint32_t start_us = micros();
+  ConfigImageWriter out;
+  buildImage(out);
+  std::vector<uint8_t> image = out.bytes();
+  const uint32_t payload_len = image.size() - kHeaderSize;
+  const uint32_t crc = esp_rom_crc32_le(0, image.data() + kHeaderSize, payload_len);
+
+  if (slot_valid && crc == last_crc && image.size() == last_len) {
+    stats_.commits_skipped++;
+    dirty = false;
+    return true;
+  }
+  if (image.size() > kImageMaxSize) {
+    Serial.printf("[ConfigStore] Image zu gross (%u Bytes)\n", static_cast<unsigned>(image.size()));
+    return false;
+  }
+
+  // Neues Image in den inaktiven Slot; der aktive bleibt bis zum Erfolg unangetastet
+  const uint8_t target = slot_valid ? (active_slot ^ 1) : active_slot;
+  const uint16_t next_gen = static_cast<uint16_t>(generation + 1);
+  put_le32(image, 0, kImageMagic);
+  image[4] = static_cast<uint8_t>(CONFIG_IMAGE_VERSION & 0xFF);
+  image[5] = static_cast<uint8_t>(CONFIG_IMAGE_VERSION >> 8);
+  image[6] = static_cast<uint8_t>(next_gen & 0xFF);
+  image[7] = static_cast<uint8_t>(next_gen >> 8);
+  put_le32(image, 8, payload_len);
+  put_le32(image, 12, crc);
+
+  bool ok = writeSlot(target, image);
+  if (!ok && !stats_.from_image) {
+    // NVS voll: Altbestand der Tiles ist bereits im RAM, Platz schaffen und erneut schreiben
+    Serial.println("[ConfigStore] Schreiben fehlgeschlagen - entferne alte Tile-Blobs");
+    tileConfig.clearLegacy();
+    ok = writeSlot(target, image);
+  }
+  if (!ok) {
+    Serial.println("[ConfigStore] Fehler beim Speichern des Images");
+    return false;
+  }
+  active_slot = target;
+  slot_valid = true;
+  generation = next_gen;
+  last_crc = crc;
+  last_len = image.size();
+  dirty = false;
+  stats_.image_bytes = image.size();
+  stats_.commits++;
+  const uint32_t took_us = micros() - start_us;
+  stats_.commit_last_us = took_us;
+  stats_.commit_us_total += took_us;
+  noteFlashWrite();
+  Serial.printf("[ConfigStore] Image gespeichert (Slot %c, Gen %u, %u Bytes, CRC %08lX) in %lu us\n",
+                target ? 'B' : 'A', next_gen, static_cast<unsigned>(image.size()),
+                static_cast<unsigned long>(crc), static_cast<unsigned long>(took_us));
+  return true;
+}
+
+void ConfigStore::markDirty() {
+  const uint32_t now = millis();
+  stats_.edits++;
+  if (!dirty) {
+    dirty = true;
+    dirty_since_ms = now;
+  }
+  last_edit_ms = now;
+#if CONFIG_STORE_QUIET_MS == 0
+  flush();
+#endif
+}
+
+bool ConfigStore::flush() {
+  if (!dirty) return true;
+  if (commit()) return true;
+  // Fehlschlag: Aenderung bleibt vorgemerkt, naechster Versuch nach der Ruhezeit
+  last_edit_ms = millis();
+  dirty_since_ms = last_edit_ms;
+  return false;
+}
+
+void ConfigStore::service() {
+  if (!dirty) return;
+  const uint32_t now = millis();
+  if (now - last_edit_ms >= CONFIG_STORE_QUIET_MS || now - dirty_since_ms >= CONFIG_STORE_MAX_DELAY_MS) {
+    flush();
+  }
+}
+
+void ConfigStore::noteFlashWrite() {
+  flashWritesLastHour();  // Buckets auf die aktuelle Zeit schieben
+  write_buckets[bucket_epoch % kHourBuckets]++;
+}
+
+uint32_t ConfigStore::flashWritesLastHour() {
+  const uint32_t epoch = millis() / kHourBucketMs;
+  const uint32_t elapsed = epoch - bucket_epoch;
+  if (elapsed > 0) {
+    const uint32_t clear = elapsed < kHourBuckets ? elapsed : kHourBuckets;
+    for (uint32_t i = 1; i <= clear; ++i) {
+      write_buckets[(bucket_epoch + i) % kHourBuckets] = 0;
+    }
+    bucket_epoch = epoch;
+  }
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < kHourBuckets; ++i) sum += write_buckets[i];
+  return sum;
+}
+
+ConfigStoreStats ConfigStore::stats() {
+  stats_.writes_last_hour = flashWritesLastHour();
+  stats_.generation = generation;
+  stats_.slot = active_slot;
+  stats_.pending = dirty;
+  return stats_;
+}
+
+String ConfigStore::statsJson() {
+  const ConfigStoreStats st = stats();
+  String json = "{";
+  json += "\"load_us\":" + String(st.load_us);
+  json += ",\"from_image\":" + String(st.from_image ? "true" : "false");
+  json += ",\"image_bytes\":" + String(st.image_bytes);
+  json += ",\"commits\":" + String(st.commits);
+  json += ",\"commits_skipped\":" + String(st.commits_skipped);
+  json += ",\"commit_last_us\":" + String(st.commit_last_us);
+  json += ",\"edits\":" + String(st.edits);
+  json += ",\"flash_writes_hour\":" + String(st.writes_last_hour);
+  json += ",\"pending\":" + String(st.pending ? "true" : "false");
+  json += ",\"slot\":\"" + String(st.slot ? "B" : "A") + "\"";
+  json += ",\"generation\":" + String(st.generation);
+  json += "}";
+  return json;
+}
@@ -0,0 +1,143 @@
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Einheitliches Config-Image: Geraete-, Bridge-, Game- und Tile-Konfiguration
+// liegen als ein versionierter, CRC-geschuetzter Blob im NVS und werden beim
+// Boot mit einem einzigen Lesezugriff geladen.
+// Aufbau: Header (Magic, Version, Generation, Laenge, CRC32) + Sektionen
+// [id][version][len][daten]. Zwei Slots (A/B), gueltig ist der mit der hoeheren Generation.
+// Unbekannte Sektionen werden uebersprungen (und beim Schreiben unveraendert
+// mitgenommen), fehlende lassen die Defaults stehen. Ein Image neuerer Firmware
+// wird deshalb ebenfalls geladen statt durch den Altbestand ersetzt.
+// Ohne gueltiges Image laufen einmalig die alten Loader (NVS-Keys, PackedGrid
+// V1-V4, SD-Links unter /_tile_links) und das Ergebnis wird als Image gespeichert.
+#define CONFIG_IMAGE_VERSION 1
+
+// Write-Behind: Aenderungen aus dem Web-Admin liegen sofort im RAM, geschrieben
+// wird erst nach CONFIG_STORE_QUIET_MS ohne weitere Aenderung, spaetestens aber
+// CONFIG_STORE_MAX_DELAY_MS nach der ersten. 0 = jede Aenderung sofort schreiben.
+#ifndef CONFIG_STORE_QUIET_MS
+#define CONFIG_STORE_QUIET_MS 3000
+#endif
+#ifndef CONFIG_STORE_MAX_DELAY_MS
+#define CONFIG_STORE_MAX_DELAY_MS 30000
+#endif
+
+enum ConfigSection : uint8_t {
+  CFG_SECTION_DEVICE = 1,
+  CFG_SECTION_BRIDGE = 2,
+  CFG_SECTION_GAME = 3,
+  CFG_SECTION_TILES = 4
+};
+
+class ConfigImageWriter {
+public:
+  ConfigImageWriter();
+
+  void beginSection(uint8_t id, uint8_t version);
+  void endSection();
+
+  void u8(uint8_t v);
+  void u16(uint16_t v);
+  void u32(uint32_t v);
+  void str(const char* s);
+  void str(const String& s) { str(s.c_str()); }
+  // Fertige Sektion(en) inkl. Kopf uebernehmen
+  void raw(const uint8_t* data, size_t len);
+
+  const std::vector<uint8_t>& bytes() const { return buf; }
+
+private:
+  std::vector<uint8_t> buf;
+  size_t section_start = 0;
+};
+
+// Liest eine Sektion; Lesen ueber das Ende hinaus liefert 0/leer und setzt ok() = false
+class ConfigImageReader {
+public:
+  ConfigImageReader(const uint8_t* data, size_t len, uint8_t version);
+
+  uint8_t version() const { return ver; }
+  bool ok() const { return !overrun; }
+
+  uint8_t u8();
+  uint16_t u16();
+  uint32_t u32();
+  String str();
+  void str(char* dst, size_t cap);
+
+private:
+  bool take(size_t n);
+
+  const uint8_t* data;
+  size_t len;
+  size_t pos = 0;
+  uint8_t ver;
+  bool overrun = false;
+};
+
+struct ConfigStoreStats {
+  uint32_t load_us;        // Boot-Laden inkl. Dekodieren
+  uint32_t image_bytes;
+  uint32_t commits;        // geschriebene Images (= Flash-Schreibvorgaenge)
+  uint32_t commit_last_us;  // Dauer des letzten geschriebenen Images
+  uint64_t commit_us_total;
+  uint32_t commits_skipped;  // Inhalt unveraendert, kein Flash-Zugriff
+  uint32_t edits;          // vorgemerkte Aenderungen (markDirty)
+  uint32_t writes_last_hour;
+  uint16_t generation;     // Zaehler des aktiven Slots
+  uint8_t slot;            // 0 = A, 1 = B
+  bool pending;            // ungeschriebene Aenderungen im RAM
+  bool from_image;         // false = alte Loader (Migration)
+};
+
+class ConfigStore {
+public:
+  // Boot: Image laden bzw. migrieren. Rueckgabe wie ConfigManager: Geraet konfiguriert?
+  bool load();
+
+  // Alle Module serialisieren und sofort als ein Blob speichern. Das neue Image
+  // geht in den inaktiven Slot (A/B), erst danach gilt es als aktuell; ein
+  // Abbruch mitten im Schreiben laesst das vorige Image gueltig.
+  bool commit();
+
+  // RAM ist bereits geaendert, Schreiben verzoegern (Write-Behind)
+  void markDirty();
+  // Vorgemerkte Aenderungen jetzt schreiben (z.B. vor Neustart)
+  bool flush();
+  // Loop: schreibt nach der Ruhezeit
+  void service();
+  bool pending() const { return dirty; }
+
+  ConfigStoreStats stats();
+  String statsJson();
+
+private:
+  bool readImage();
+  void buildImage(ConfigImageWriter& out) const;
+  bool writeSlot(uint8_t slot, const std::vector<uint8_t>& image);
+  void noteFlashWrite();
+  uint32_t flashWritesLastHour();
+
+  static constexpr uint8_t kHourBuckets = 12;  // je 5 Minuten
+
+  ConfigStoreStats stats_{};
+  uint32_t last_crc = 0;
+  uint32_t last_len = 0;
+  uint16_t generation = 0;
+  uint8_t active_slot = 0;
+  bool slot_valid = false;     // aktiver Slot enthaelt ein gueltiges Image
+  bool dirty = false;
+  uint32_t dirty_since_ms = 0;
+  uint32_t last_edit_ms = 0;
+  std::vector<uint8_t> foreign_sections;  // Sektionen neuerer Firmware, roh
+  uint16_t write_buckets[kHourBuckets] = {};
+  uint32_t bucket_epoch = 0;
+};
+
+extern ConfigStore configStore;
+
+#endif // CONFIG_STORE_H
@@ -1,5 +1,6 @@
 #include "src/core/display_manager.h"
 #include "src/core/power_manager.h"
+#include "src/core/metrics.h"
 #include <M5Unified.h>
 #include "esp_heap_caps.h"
 #include <Arduino.h>
@@ -26,6 +27,27 @@ static size_t g_reverse_buf_width = 0;
 static constexpr size_t kReverseStripeWidth = 16;
 static bool g_reverse_flush_once = false;
 static volatile uint32_t g_fullscreen_flush_seq = 0;
+static uint32_t g_refr_start_us = 0;
+static uint32_t g_refr_frames = 0;
+static uint64_t g_refr_total_us = 0;
+static uint32_t g_refr_max_us = 0;
+static const char* g_refr_mark_tag = nullptr;
+static uint32_t g_refr_mark_since_us = 0;
+static const float kFrameBucketsMs[] = {5, 10, 16, 25, 33, 50, 100, 250};
+static MetricHistogram g_frame_hist("tab5_frame_render_ms", "Dauer eines LVGL-Refresh (Rendern + Flush) in ms",
+                                    kFrameBucketsMs, sizeof(kFrameBucketsMs) / sizeof(kFrameBucketsMs[0]));
+
+void lvgl_lock() {
+#if LV_USE_OS != LV_OS_NONE
+  lv_lock();
+#endif
+}
+
+void lvgl_unlock() {
+#if LV_USE_OS != LV_OS_NONE
+  lv_unlock();
+#endif
+}
 
 static bool ensure_reverse_buf() {
   if (g_reverse_buf && g_reverse_buf_width == kReverseStripeWidth) return true;
@@ -147,6 +169,49 @@ uint32_t DisplayManager::getFullScreenFlushSeq() const {
   return g_fullscreen_flush_seq;
 }
 
+// ========== Render-Statistik ==========
+void DisplayManager::refr_event_cb(lv_event_t* e) {
+  lv_event_code_t code = lv_event_get_code(e);
+  if (code == LV_EVENT_REFR_START) {
+    g_refr_start_us = micros();
+    return;
+  }
+  if (code != LV_EVENT_REFR_READY || g_refr_start_us == 0) return;
+  uint32_t dt = micros() - g_refr_start_us;
+  g_refr_start_us = 0;
+  g_refr_frames++;
+  g_refr_total_us += dt;
+  if (dt > g_refr_max_us) g_refr_max_us = dt;
+  g_frame_hist.observe(dt / 1000.0f);
+  if (g_refr_mark_tag) {
+    if (g_refr_mark_since_us) {
+      Serial.printf("[Display] Render '%s': %lu us (seit Ausloeser bis Flush: %lu us)\n", g_refr_mark_tag,
+                    (unsigned long)dt, (unsigned long)(micros() - g_refr_mark_since_us));
+    } else {
+      Serial.printf("[Display] Render '%s': %lu us\n", g_refr_mark_tag, (unsigned long)dt);
+    }
+    g_refr_mark_tag = nullptr;
+    g_refr_mark_since_us = 0;
+  }
+}
+
+void DisplayManager::markNextRender(const char* tag, uint32_t since_us) {
+  g_refr_mark_tag = tag;
+  g_refr_mark_since_us = since_us;
+}
+
+void DisplayManager::logRenderStats() {
+  if (g_refr_frames == 0) return;
+  Serial.printf("[Display] Render: %lu Frames, avg %lu us, max %lu us (Draw-Units: %d)\n",
+                (unsigned long)g_refr_frames,
+                (unsigned long)(g_refr_total_us / g_refr_frames),
+                (unsigned long)g_refr_max_us,
+                LV_DRAW_SW_DRAW_UNIT_CNT);
+  g_refr_frames = 0;
+  g_refr_total_us = 0;
+  g_refr_max_us = 0;
+}
+
 // ========== Display Flush Callback ==========
 // IRAM_ATTR: Diese Funktion wird SEHR oft aufgerufen (jeder Frame!)
 // Durch IRAM wird sie aus schnellem internen RAM ausgefuehrt (keine Cache-Misses)
@@ -258,6 +323,8 @@ bool DisplayManager::init() {
   }
 
   lv_display_set_flush_cb(disp, flush_cb);
+  lv_display_add_event_cb(disp, refr_event_cb, LV_EVENT_REFR_START, nullptr);
+  lv_display_add_event_cb(disp, refr_event_cb, LV_EVENT_REFR_READY, nullptr);
 
   // Farbformat + Anti-Aliasing aus (Performance)
   lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565_SWAPPED);
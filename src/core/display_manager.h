@@ -33,6 +33,11 @@ public:
   lv_display_render_mode_t getRenderMode() const;
   uint32_t getFullScreenFlushSeq() const;
 
+  // Render-Statistik (Refresh-Dauer pro Frame, misst 1 vs. 2 Draw-Units)
+  void logRenderStats();
+  // Dauer des naechsten Refresh loggen; mit since_us zusaetzlich die Latenz ab diesem Zeitpunkt
+  void markNextRender(const char* tag, uint32_t since_us = 0);
+
 private:
   static lv_display_t *disp;
   static lv_indev_t *indev;
@@ -43,6 +48,23 @@ private:
   // LVGL Callbacks
   static void flush_cb(lv_display_t *lv_disp, const lv_area_t *area, uint8_t *px_map);
   static void touch_cb(lv_indev_t* indev_drv, lv_indev_data_t *data);
+  static void refr_event_cb(lv_event_t* e);
+};
+
+// ========== LVGL-Lock ==========
+// Mit TAB5_LVGL_MULTICORE (lv_conf.h) rendern zwei Draw-Units parallel.
+// lv_timer_handler() sperrt selbst; alle anderen LVGL-Zugriffe (Queues,
+// MQTT-Callback, Web-Handler, URL-Cache, UI-Build-Task) muessen den Lock halten.
+// Rekursiv, ohne OS-Layer ein No-Op.
+void lvgl_lock();
+void lvgl_unlock();
+
+class LvglLock {
+public:
+  LvglLock() { lvgl_lock(); }
+  ~LvglLock() { lvgl_unlock(); }
+  LvglLock(const LvglLock&) = delete;
+  LvglLock& operator=(const LvglLock&) = delete;
 };
 
 // Globale Instanz
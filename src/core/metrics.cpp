@@ -0,0 +1,154 @@
+#include "src/core/metrics.h"
+#include <math.h>
+
+Metric* Metric::head_ = nullptr;
+Metric* Metric::tail_ = nullptr;
+
+static constexpr size_t kChunkSize = 1400;
+
+Metric::Metric(const char* name, const char* help, MetricType type, const char* labels)
+    : name_(name), help_(help), labels_(labels), type_(type) {
+  // Statische Initialisierung: laeuft vor setup(), single-threaded. Anhaengen statt
+  // voranstellen, damit Label-Varianten in Quelltext-Reihenfolge erscheinen.
+  if (tail_) tail_->next_ = this;
+  else head_ = this;
+  tail_ = this;
+}
+
+static void append_number(String& out, double value) {
+  char tmp[24];
+  if (isnan(value)) {
+    out += "NaN";
+    return;
+  }
+  if (isinf(value)) {
+    out += value > 0 ? "+Inf" : "-Inf";
+    return;
+  }
+  if (value == floor(value) && fabs(value) < 1e15) {
+    snprintf(tmp, sizeof(tmp), "%.0f", value);
+  } else {
+    snprintf(tmp, sizeof(tmp), "%.6g", value);
+  }
+  out += tmp;
+}
+
+void Metric::appendSample(String& out, const char* suffix, const char* extra_label, double value) const {
+  out += name_;
+  if (suffix) out += suffix;
+  const bool has_labels = labels_ && *labels_;
+  if (has_labels || extra_label) {
+    out += '{';
+    if (has_labels) out += labels_;
+    if (has_labels && extra_label) out += ',';
+    if (extra_label) out += extra_label;
+    out += '}';
+  }
+  out += ' ';
+  append_number(out, value);
+  out += '\n';
+}
+
+void MetricCounter::render(String& out) const {
+  appendSample(out, nullptr, nullptr, value());
+}
+
+void MetricCallback::render(String& out) const {
+  appendSample(out, nullptr, nullptr, read_ ? read_() : NAN);
+}
+
+MetricHistogram::MetricHistogram(const char* name, const char* help, const float* bounds,
+                                 uint8_t bucket_count, const char* labels)
+    : Metric(name, help, MetricType::Histogram, labels),
+      bounds_(bounds),
+      bucket_count_(bucket_count > METRICS_HIST_MAX_BUCKETS ? METRICS_HIST_MAX_BUCKETS : bucket_count) {}
+
+void MetricHistogram::observe(float value) {
+  uint8_t i = 0;
+  while (i < bucket_count_ && value > bounds_[i]) i++;
+  counts_[i]++;
+  count_++;
+  sum_ += value;
+}
+
+void MetricHistogram::render(String& out) const {
+  // Prometheus erwartet kumulierte Buckets
+  uint32_t cumulative = 0;
+  String le;
+  for (uint8_t i = 0; i < bucket_count_; ++i) {
+    cumulative += counts_[i];
+    le = "le=\"";
+    append_number(le, bounds_[i]);
+    le += '"';
+    appendSample(out, "_bucket", le.c_str(), cumulative);
+  }
+  appendSample(out, "_bucket", "le=\"+Inf\"", count_);
+  appendSample(out, "_sum", nullptr, sum_);
+  appendSample(out, "_count", nullptr, count_);
+}
+
+static const char* type_name(MetricType type) {
+  switch (type) {
+    case MetricType::Counter: return "counter";
+    case MetricType::Gauge: return "gauge";
+    case MetricType::Histogram: return "histogram";
+  }
+  return "untyped";
+}
+
+void metrics_render(const std::function<void(const String&)>& sink) {
+  String buf;
+  buf.reserve(kChunkSize + 256);
+  for (const Metric* m = Metric::first(); m; m = m->next()) {
+    // Familie nur beim ersten Auftreten des Namens ausgeben, dann alle Label-Varianten
+    bool seen = false;
+    for (const Metric* p = Metric::first(); p != m; p = p->next()) {
+      if (strcmp(p->name(), m->name()) == 0) {
+        seen = true;
+        break;
+      }
+    }
+    if (seen) continue;
+
+    buf += "# HELP ";
+    buf += m->name();
+    buf += ' ';
+    buf += m->help();
+    buf += "\n# TYPE ";
+    buf += m->name();
+    buf += ' ';
+    buf += type_name(m->type());
+    buf += '\n';
+    for (const Metric* s = m; s; s = s->next()) {
+      if (strcmp(s->name(), m->name()) != 0) continue;
+      s->render(buf);
+      if (buf.length() >= kChunkSize) {
+        sink(buf);
+        buf = "";
+      }
+    }
+  }
+  if (buf.length()) sink(buf);
+}
+
+size_t metrics_count() {
+  size_t n = 0;
+  for (const Metric* m = Metric::first(); m; m = m->next()) n++;
+  return n;
+}
+
+/* === System === */
+static MetricCallback g_heap_free("tab5_heap_free_bytes", "Freier Heap", MetricType::Gauge,
+                                  []() -> double { return ESP.getFreeHeap(); });
+static MetricCallback g_heap_min_free("tab5_heap_min_free_bytes", "Kleinster freier Heap seit Boot",
+                                      MetricType::Gauge, []() -> double { return ESP.getMinFreeHeap(); });
+static MetricCallback g_heap_max_alloc("tab5_heap_max_alloc_bytes", "Groesster allozierbarer Block",
+                                       MetricType::Gauge, []() -> double { return ESP.getMaxAllocHeap(); });
+static MetricCallback g_heap_size("tab5_heap_size_bytes", "Heap gesamt", MetricType::Gauge,
+                                  []() -> double { return ESP.getHeapSize(); });
+static MetricCallback g_psram_free("tab5_psram_free_bytes", "Freier PSRAM", MetricType::Gauge,
+                                   []() -> double { return ESP.getFreePsram(); });
+static MetricCallback g_psram_size("tab5_psram_size_bytes", "PSRAM gesamt", MetricType::Gauge,
+                                   []() -> double { return ESP.getPsramSize(); });
+static MetricCallback g_uptime("tab5_uptime_seconds", "Sekunden seit Boot", MetricType::Gauge,
+                               []() -> double { return millis() / 1000.0; });
@@ -0,0 +1,100 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <functional>
+
+// Metrik-Registry fuer GET /api/metrics (Prometheus-Textformat, zentral gescrapt).
+// Metriken sind statische Objekte in der .cpp des jeweiligen Subsystems und haengen
+// sich bei der statischen Initialisierung in eine verkettete Liste - kein Heap,
+// keine zentrale Tabelle:
+//
+//   static MetricCounter g_msgs("tab5_mqtt_messages_total", "MQTT-Nachrichten", "route=\"sensor\"");
+//   g_msgs.inc();
+//
+// Gleichnamige Metriken mit unterschiedlichen Labels bilden eine Familie
+// (HELP/TYPE werden einmal ausgegeben). Labels als fertiger Text: key="wert",...
+
+#ifndef METRICS_HIST_MAX_BUCKETS
+#define METRICS_HIST_MAX_BUCKETS 12
+#endif
+
+enum class MetricType : uint8_t { Counter, Gauge, Histogram };
+
+class Metric {
+public:
+  Metric(const char* name, const char* help, MetricType type, const char* labels);
+  virtual ~Metric() = default;
+  Metric(const Metric&) = delete;
+  Metric& operator=(const Metric&) = delete;
+
+  const char* name() const { return name_; }
+  const char* help() const { return help_; }
+  MetricType type() const { return type_; }
+  const Metric* next() const { return next_; }
+  static const Metric* first() { return head_; }
+
+  // Sample-Zeilen dieser Metrik (ohne HELP/TYPE)
+  virtual void render(String& out) const = 0;
+
+protected:
+  // name<suffix>{labels[,extra]} value
+  void appendSample(String& out, const char* suffix, const char* extra_label, double value) const;
+
+private:
+  const char* name_;
+  const char* help_;
+  const char* labels_;
+  MetricType type_;
+  Metric* next_ = nullptr;
+  static Metric* head_;
+  static Metric* tail_;
+};
+
+// Zaehler mit eigenem Speicher; inc() ist aus jedem Task erlaubt
+class MetricCounter : public Metric {
+public:
+  MetricCounter(const char* name, const char* help, const char* labels = nullptr)
+      : Metric(name, help, MetricType::Counter, labels) {}
+  void inc(uint32_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+  uint32_t value() const { return value_.load(std::memory_order_relaxed); }
+  void render(String& out) const override;
+
+private:
+  std::atomic<uint32_t> value_{0};
+};
+
+// Wert wird beim Scrapen gelesen (bestehende Zaehler, Heap, Client-Anzahl, ...)
+class MetricCallback : public Metric {
+public:
+  MetricCallback(const char* name, const char* help, MetricType type, double (*read)(),
+                 const char* labels = nullptr)
+      : Metric(name, help, type, labels), read_(read) {}
+  void render(String& out) const override;
+
+private:
+  double (*read_)();
+};
+
+// Histogramm mit festen Grenzen (statisches Array, aufsteigend); observe() aus einem Task
+class MetricHistogram : public Metric {
+public:
+  MetricHistogram(const char* name, const char* help, const float* bounds, uint8_t bucket_count,
+                  const char* labels = nullptr);
+  void observe(float value);
+  void render(String& out) const override;
+
+private:
+  const float* bounds_;
+  uint8_t bucket_count_;
+  uint32_t counts_[METRICS_HIST_MAX_BUCKETS + 1] = {};  // letzter Eintrag: > hoechste Grenze
+  uint32_t count_ = 0;
+  double sum_ = 0.0;
+};
+
+// Alle Metriken im Prometheus-Textformat; sink bekommt Bloecke von ~1,4 KB
+void metrics_render(const std::function<void(const String&)>& sink);
+size_t metrics_count();
+
+#endif // METRICS_H
@@ -0,0 +1,145 @@
+#include "src/core/sd_io.h"
+#include "esp_heap_caps.h"
+#include <freertos/FreeRTOS.h>
+
+static SdIoStats g_sd_io_stats = {};
+static portMUX_TYPE g_sd_io_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint8_t* alloc_io_buf(size_t size) {
+  uint8_t* p = static_cast<uint8_t*>(heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  if (!p) p = static_cast<uint8_t*>(heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+  return p;
+}
+
+void sd_io_record_read(size_t bytes, uint32_t us) {
+  portENTER_CRITICAL(&g_sd_io_mux);
+  g_sd_io_stats.read_bytes += bytes;
+  g_sd_io_stats.read_ops++;
+  g_sd_io_stats.read_us += us;
+  portEXIT_CRITICAL(&g_sd_io_mux);
+}
+
+void sd_io_record_write(size_t bytes, uint32_t us) {
+  portENTER_CRITICAL(&g_sd_io_mux);
+  g_sd_io_stats.write_bytes += bytes;
+  g_sd_io_stats.write_ops++;
+  g_sd_io_stats.write_us += us;
+  portEXIT_CRITICAL(&g_sd_io_mux);
+}
+
+SdIoStats sd_io_get_stats() {
+  portENTER_CRITICAL(&g_sd_io_mux);
+  SdIoStats s = g_sd_io_stats;
+  portEXIT_CRITICAL(&g_sd_io_mux);
+  return s;
+}
+
+String sd_io_stats_json() {
+  SdIoStats s = sd_io_get_stats();
+  // KB/s aus Bytes und Mikrosekunden
+  const uint32_t read_kbps = s.read_us ? static_cast<uint32_t>((s.read_bytes * 1000ULL) / s.read_us) : 0;
+  const uint32_t write_kbps = s.write_us ? static_cast<uint32_t>((s.write_bytes * 1000ULL) / s.write_us) : 0;
+  String json = "{";
+  json += "\"read_bytes\":" + String(static_cast<unsigned long>(s.read_bytes));
+  json += ",\"read_ops\":" + String(s.read_ops);
+  json += ",\"read_ms\":" + String(static_cast<unsigned long>(s.read_us / 1000ULL));
+  json += ",\"read_kbps\":" + String(read_kbps);
+  json += ",\"write_bytes\":" + String(static_cast<unsigned long>(s.write_bytes));
+  json += ",\"write_ops\":" + String(s.write_ops);
+  json += ",\"write_ms\":" + String(static_cast<unsigned long>(s.write_us / 1000ULL));
+  json += ",\"write_kbps\":" + String(write_kbps);
+  json += "}";
+  return json;
+}
+
+// ========== Reader ==========
+SdBufferedReader::SdBufferedReader(File& f, size_t block_size) : file(f) {
+  buf = alloc_io_buf(block_size);
+  if (buf) cap = block_size;
+}
+
+SdBufferedReader::~SdBufferedReader() {
+  if (buf) heap_caps_free(buf);
+}
+
+bool SdBufferedReader::fill() {
+  const uint32_t start = micros();
+  const int got = file.read(buf, cap);
+  sd_io_record_read(got > 0 ? static_cast<size_t>(got) : 0, micros() - start);
+  pos = 0;
+  len = got > 0 ? static_cast<size_t>(got) : 0;
+  return len > 0;
+}
+
+size_t SdBufferedReader::read(uint8_t* dst, size_t want) {
+  if (!buf) {
+    const uint32_t start = micros();
+    const size_t got = file.read(dst, want);
+    sd_io_record_read(got, micros() - start);
+    return got;
+  }
+  size_t done = 0;
+  while (done < want) {
+    if (pos >= len && !fill()) break;
+    size_t n = len - pos;
+    if (n > want - done) n = want - done;
+    memcpy(dst + done, buf + pos, n);
+    pos += n;
+    done += n;
+  }
+  return done;
+}
+
+bool SdBufferedReader::skip(size_t n) {
+  const size_t buffered = len - pos;
+  if (n <= buffered) {
+    pos += n;
+    return true;
+  }
+  // Rest hinter dem Puffer: File steht bereits am Pufferende
+  const uint32_t target = file.position() + static_cast<uint32_t>(n - buffered);
+  pos = len = 0;
+  return file.seek(target);
+}
+
+// ========== Writer ==========
+SdBufferedWriter::SdBufferedWriter(File& f, size_t block_size) : file(f) {
+  buf = alloc_io_buf(block_size);
+  if (buf) cap = block_size;
+}
+
+SdBufferedWriter::~SdBufferedWriter() {
+  flush();
+  if (buf) heap_caps_free(buf);
+}
+
+bool SdBufferedWriter::flush() {
+  if (!buf || len == 0) return !write_error;
+  const uint32_t start = micros();
+  const size_t written = file.write(buf, len);
+  sd_io_record_write(written, micros() - start);
+  if (written != len) write_error = true;
+  len = 0;
+  return !write_error;
+}
+
+size_t SdBufferedWriter::write(const uint8_t* src, size_t n) {
+  if (!buf) {
+    const uint32_t start = micros();
+    const size_t written = file.write(src, n);
+    sd_io_record_write(written, micros() - start);
+    if (written != n) write_error = true;
+    return written;
+  }
+  size_t done = 0;
+  while (done < n) {
+    size_t space = cap - len;
+    size_t chunk = n - done;
+    if (chunk > space) chunk = space;
+    memcpy(buf + len, src + done, chunk);
+    len += chunk;
+    done += chunk;
+    if (len == cap && !flush()) break;
+  }
+  return done;
+}
@@ -0,0 +1,69 @@
+#ifndef SD_IO_H
+#define SD_IO_H
+
+#include <Arduino.h>
+#include <SD.h>
+
+// Gepufferter SD-Zugriff: grosse Bloecke statt vieler kleiner SPI-Transaktionen.
+// Puffer liegen bevorzugt in PSRAM; schlaegt die Allokation fehl, wird direkt
+// auf File gearbeitet (langsamer, aber funktionsfaehig).
+#define SD_IO_BLOCK_SIZE (32 * 1024)
+
+struct SdIoStats {
+  uint64_t read_bytes;
+  uint32_t read_ops;
+  uint64_t read_us;
+  uint64_t write_bytes;
+  uint32_t write_ops;
+  uint64_t write_us;
+};
+
+// Read-Ahead-Puffer vor einem offenen File (z.B. fuer tjpgd)
+class SdBufferedReader {
+public:
+  explicit SdBufferedReader(File& file, size_t block_size = SD_IO_BLOCK_SIZE);
+  ~SdBufferedReader();
+  SdBufferedReader(const SdBufferedReader&) = delete;
+  SdBufferedReader& operator=(const SdBufferedReader&) = delete;
+
+  size_t read(uint8_t* dst, size_t len);
+  bool skip(size_t len);  // innerhalb des Puffers ohne seek
+
+private:
+  bool fill();
+
+  File& file;
+  uint8_t* buf = nullptr;
+  size_t cap = 0;
+  size_t len = 0;
+  size_t pos = 0;
+};
+
+// Sammelt kleine Writes (z.B. HTTP-Stream) und schreibt blockweise
+class SdBufferedWriter {
+public:
+  explicit SdBufferedWriter(File& file, size_t block_size = SD_IO_BLOCK_SIZE);
+  ~SdBufferedWriter();
+  SdBufferedWriter(const SdBufferedWriter&) = delete;
+  SdBufferedWriter& operator=(const SdBufferedWriter&) = delete;
+
+  size_t write(const uint8_t* src, size_t len);
+  bool flush();
+  bool failed() const { return write_error; }
+
+private:
+  File& file;
+  uint8_t* buf = nullptr;
+  size_t cap = 0;
+  size_t len = 0;
+  bool write_error = false;
+};
+
+// Zaehler fuer direkte File-Zugriffe ausserhalb der Puffer-Klassen
+void sd_io_record_read(size_t bytes, uint32_t us);
+void sd_io_record_write(size_t bytes, uint32_t us);
+
+SdIoStats sd_io_get_stats();
+String sd_io_stats_json();
+
+#endif // SD_IO_H
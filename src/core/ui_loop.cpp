@@ -0,0 +1,142 @@
+#include "src/core/ui_loop.h"
+#include "src/core/metrics.h"
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+
+namespace {
+
+enum : uint8_t { kPending, kRunning, kDone, kAbandoned };
+
+// Fire-and-forget-Auftraege gehoeren dem Loop. Bei ui_loop_call entscheidet der
+// Zustandswechsel, wer loescht: Abandoned -> Loop, Done -> wartender Task.
+struct UiJob {
+  std::function<void()> fn;
+  TaskHandle_t waiter = nullptr;
+  std::atomic<uint8_t> state{kPending};
+  uint32_t queued_us = 0;
+};
+
+QueueHandle_t g_jobs = nullptr;
+TaskHandle_t g_loop_task = nullptr;
+UiLoopStats g_stats = {};
+
+const float kIterBucketsMs[] = {5, 10, 20, 33, 50, 100, 250, 500, 1000};
+MetricHistogram g_iter_hist("tab5_loop_iteration_ms", "Abstand zweier aktiver Loop-Durchlaeufe in ms",
+                            kIterBucketsMs, sizeof(kIterBucketsMs) / sizeof(kIterBucketsMs[0]));
+MetricCallback g_jobs_executed("tab5_ui_loop_jobs_total", "UI-Loop-Auftraege", MetricType::Counter,
+                               []() -> double { return g_stats.executed; }, "result=\"executed\"");
+MetricCallback g_jobs_abandoned("tab5_ui_loop_jobs_total", "UI-Loop-Auftraege", MetricType::Counter,
+                                []() -> double { return g_stats.abandoned; }, "result=\"abandoned\"");
+MetricCallback g_jobs_overflow("tab5_ui_loop_jobs_total", "UI-Loop-Auftraege", MetricType::Counter,
+                               []() -> double { return g_stats.overflows; }, "result=\"overflow\"");
+
+bool enqueue(UiJob* job) {
+  job->queued_us = micros();
+  if (!g_jobs || xQueueSend(g_jobs, &job, 0) != pdTRUE) {
+    g_stats.overflows++;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void ui_loop_init() {
+  if (!g_jobs) g_jobs = xQueueCreate(UI_LOOP_QUEUE_LEN, sizeof(UiJob*));
+  g_loop_task = xTaskGetCurrentTaskHandle();
+  if (!g_jobs) Serial.println("[UiLoop] Queue konnte nicht angelegt werden");
+}
+
+bool ui_loop_in_loop_task() {
+  return g_loop_task == nullptr || xTaskGetCurrentTaskHandle() == g_loop_task;
+}
+
+bool ui_loop_post(std::function<void()> fn) {
+  UiJob* job = new UiJob();
+  job->fn = std::move(fn);
+  if (!enqueue(job)) {
+    delete job;
+    return false;
+  }
+  g_stats.posted++;
+  return true;
+}
+
+bool ui_loop_call(std::function<void()> fn, uint32_t timeout_ms) {
+  if (ui_loop_in_loop_task()) {
+    fn();  // schon im Loop (z.B. Web-Admin ohne eigenen Task)
+    return true;
+  }
+  UiJob* job = new UiJob();
+  job->fn = std::move(fn);
+  job->waiter = xTaskGetCurrentTaskHandle();
+  ulTaskNotifyTake(pdTRUE, 0);  // alte Benachrichtigung verwerfen
+  if (!enqueue(job)) {
+    delete job;
+    return false;
+  }
+  g_stats.calls++;
+
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+  if (job->state.load() != kDone) {
+    uint8_t expected = kPending;
+    if (job->state.compare_exchange_strong(expected, kAbandoned)) {
+      g_stats.abandoned++;
+      Serial.printf("[UiLoop] Auftrag nach %lu ms verworfen (Loop blockiert)\n",
+                    static_cast<unsigned long>(timeout_ms));
+      return false;  // Loop loescht ihn beim Abholen
+    }
+    // Laeuft bereits: das Ende abwarten, der Auftrag greift auf unseren Stack zu
+    while (job->state.load() != kDone) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+  }
+  delete job;
+  return true;
+}
+
+void ui_loop_process() {
+  if (!g_jobs) return;
+  // Nur was beim Eintritt schon wartet - neue Auftraege kommen im naechsten Frame dran
+  UBaseType_t n = uxQueueMessagesWaiting(g_jobs);
+  while (n-- > 0) {
+    UiJob* job = nullptr;
+    if (xQueueReceive(g_jobs, &job, 0) != pdTRUE || !job) break;
+    uint8_t expected = kPending;
+    if (!job->state.compare_exchange_strong(expected, kRunning)) {
+      delete job;  // vom Aufrufer zurueckgezogen
+      continue;
+    }
+    const uint32_t start_us = micros();
+    const uint32_t wait_us = start_us - job->queued_us;
+    if (wait_us > g_stats.wait_max_us) g_stats.wait_max_us = wait_us;
+    job->fn();
+    const uint32_t run_us = micros() - start_us;
+    if (run_us > g_stats.job_max_us) g_stats.job_max_us = run_us;
+    g_stats.executed++;
+
+    TaskHandle_t waiter = job->waiter;
+    if (!waiter) {
+      delete job;
+      continue;
+    }
+    job->state.store(kDone);  // ab hier gehoert der Auftrag dem Aufrufer
+    xTaskNotifyGive(waiter);
+  }
+}
+
+void ui_loop_note_iteration(uint32_t gap_us) {
+  g_stats.iterations++;
+  g_iter_hist.observe(gap_us / 1000.0f);
+  if (gap_us > g_stats.iter_max_us) g_stats.iter_max_us = gap_us;
+}
+
+UiLoopStats ui_loop_get_stats() {
+  return g_stats;
+}
+
+void ui_loop_reset_max() {
+  g_stats.wait_max_us = 0;
+  g_stats.job_max_us = 0;
+  g_stats.iter_max_us = 0;
+}
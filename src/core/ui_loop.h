@@ -0,0 +1,52 @@
+#ifndef UI_LOOP_H
+#define UI_LOOP_H
+
+#include <Arduino.h>
+#include <functional>
+
+// Arbeit aus anderen Tasks (Web-Admin) in den UI-Loop verlagern: dort laeuft sie
+// unter LvglLock zwischen zwei Frames, statt von aussen LVGL, MQTT-Client oder
+// Entity-Tabelle anzufassen. Dazu die Messung der laengsten Loop-Iteration.
+
+// Maximal wartende Auftraege; weitere werden abgewiesen (overflows)
+#ifndef UI_LOOP_QUEUE_LEN
+#define UI_LOOP_QUEUE_LEN 16
+#endif
+// ui_loop_call: so lange wartet der Aufrufer, bevor er einen noch nicht
+// gestarteten Auftrag zurueckzieht (z.B. weil der Loop gerade auf ihn wartet)
+#ifndef UI_LOOP_CALL_TIMEOUT_MS
+#define UI_LOOP_CALL_TIMEOUT_MS 2000
+#endif
+
+struct UiLoopStats {
+  uint32_t posted;        // ui_loop_post
+  uint32_t calls;         // ui_loop_call
+  uint32_t executed;
+  uint32_t abandoned;     // Timeout vor dem Start
+  uint32_t overflows;     // Queue voll
+  uint32_t wait_max_us;   // Einreihen bis Start
+  uint32_t job_max_us;    // laengster Auftrag im Loop
+  uint32_t iterations;
+  uint32_t iter_max_us;   // laengste Loop-Iteration seit Boot bzw. Reset
+};
+
+// setup(): Queue anlegen, aufrufender Task gilt als UI-Loop
+void ui_loop_init();
+
+// Auftrag einreihen und sofort zurueckkehren; false = Queue voll
+bool ui_loop_post(std::function<void()> fn);
+// Auftrag im Loop ausfuehren und auf das Ende warten (im Loop selbst: direkt).
+// false = nicht ausgefuehrt (Queue voll oder Timeout vor dem Start)
+bool ui_loop_call(std::function<void()> fn, uint32_t timeout_ms = UI_LOOP_CALL_TIMEOUT_MS);
+bool ui_loop_in_loop_task();
+
+// Loop: wartende Auftraege abarbeiten (unter LvglLock, vor lv_timer_handler)
+void ui_loop_process();
+
+// Loop: Abstand zwischen zwei aktiven Durchlaeufen melden
+void ui_loop_note_iteration(uint32_t gap_us);
+
+UiLoopStats ui_loop_get_stats();
+void ui_loop_reset_max();
+
+#endif // UI_LOOP_H
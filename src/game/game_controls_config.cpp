@@ -1,13 +1,15 @@
 #include "src/game/game_controls_config.h"
+#include "src/core/config_store.h"
 #include <Preferences.h>
 
-static const char* PREF_NAMESPACE = "tab5_config";
+static const char* PREF_NAMESPACE = "tab5_config";  // Altbestand vor dem Config-Image
+static constexpr uint8_t kImageSectionVersion = 1;
 
 GameControlsConfig gameControlsConfig;
 
 GameControlsConfig::GameControlsConfig() = default;
 
-bool GameControlsConfig::load() {
+bool GameControlsConfig::loadLegacy() {
   Preferences prefs;
   if (!prefs.begin(PREF_NAMESPACE, true)) {
     return false;
@@ -33,30 +35,37 @@ bool GameControlsConfig::load() {
   return true;
 }
 
-bool GameControlsConfig::save(const GameControlsConfigData& incoming) {
-  Preferences prefs;
-  if (!prefs.begin(PREF_NAMESPACE, false)) {
-    return false;
-  }
-
+void GameControlsConfig::writeImage(ConfigImageWriter& out) const {
+  out.beginSection(CFG_SECTION_GAME, kImageSectionVersion);
+  out.u8(GAME_BUTTON_COUNT);
   for (size_t i = 0; i < GAME_BUTTON_COUNT; ++i) {
-    char key[16];
-
-    snprintf(key, sizeof(key), "game_name%u", static_cast<unsigned>(i));
-    prefs.putString(key, incoming.buttons[i].name);
-
-    snprintf(key, sizeof(key), "game_key%u", static_cast<unsigned>(i));
-    prefs.putUChar(key, incoming.buttons[i].key_code);
-
-    snprintf(key, sizeof(key), "game_mod%u", static_cast<unsigned>(i));
-    prefs.putUChar(key, incoming.buttons[i].modifier);
+    out.str(data.buttons[i].name);
+    out.u8(data.buttons[i].key_code);
+    out.u8(data.buttons[i].modifier);
+    out.u32(data.buttons[i].color);
+  }
+  out.endSection();
+}
 
-    snprintf(key, sizeof(key), "game_col%u", static_cast<unsigned>(i));
-    prefs.putUInt(key, incoming.buttons[i].color);
+void GameControlsConfig::readImage(ConfigImageReader& in) {
+  const uint8_t count = in.u8();
+  for (size_t i = 0; i < count && in.ok(); ++i) {
+    GameButton button;
+    button.name = in.str();
+    button.key_code = in.u8();
+    button.modifier = in.u8();
+    button.color = in.u32();
+    if (i < GAME_BUTTON_COUNT) data.buttons[i] = button;
   }
+}
 
-  prefs.end();
+bool GameControlsConfig::save(const GameControlsConfigData& incoming) {
+  GameControlsConfigData prev = data;
   data = incoming;
+  if (!configStore.commit()) {
+    data = prev;
+    return false;
+  }
 
   Serial.println("[Game Controls] Konfiguration gespeichert");
   for (size_t i = 0; i < GAME_BUTTON_COUNT; ++i) {
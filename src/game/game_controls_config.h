@@ -3,6 +3,9 @@
 
 #include <Arduino.h>
 
+class ConfigImageWriter;
+class ConfigImageReader;
+
 static constexpr size_t GAME_BUTTON_COUNT = 12;
 
 struct GameButton {
@@ -20,7 +23,12 @@ class GameControlsConfig {
 public:
   GameControlsConfig();
 
-  bool load();
+  // Alte Einzel-Keys (Preferences) - nur noch fuer die Migration ins Config-Image
+  bool loadLegacy();
+  // Config-Image (Sektion CFG_SECTION_GAME)
+  void writeImage(ConfigImageWriter& out) const;
+  void readImage(ConfigImageReader& in);
+
   bool save(const GameControlsConfigData& data);
 
   const GameControlsConfigData& get() const { return data; }
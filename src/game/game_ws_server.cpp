@@ -1,8 +1,12 @@
 #include "src/game/game_ws_server.h"
+#include "src/core/metrics.h"
 #include <ArduinoJson.h>
 
 // Globale Instanz
 GameWSServer gameWSServer;
+static MetricCallback g_game_clients_metric("tab5_websocket_clients", "Verbundene WebSocket-Clients", MetricType::Gauge,
+                                            []() -> double { return gameWSServer.getClientCount(); },
+                                            "server=\"game\"");
 
 // Statische Referenz für Callback
 static GameWSServer* g_instance = nullptr;
@@ -0,0 +1,273 @@
+#include "src/network/entity_snapshot.h"
+#include "src/network/entity_state.h"
+#include "src/network/entity_table.h"
+#include "src/core/config_store.h"
+#include <Preferences.h>
+#include <time.h>
+#include "esp_rom_crc.h"
+
+static const char* PREF_NAMESPACE = "tab5_state";
+static const char* PREF_KEY = "snap";
+static constexpr uint32_t kSnapMagic = 0x53455354;  // "TSES"
+static constexpr uint16_t kSnapVersion = 1;
+static constexpr size_t kHeaderSize = 16;           // magic, version, count, len, crc
+static constexpr uint8_t kFlagSwitch = 0x01;
+
+struct SnapshotStats {
+  uint32_t restored;
+  uint32_t restore_us;
+  uint32_t age_s;            // Alter beim Boot (nur mit NTP-Zeit), 0 = unbekannt
+  uint32_t writes;
+  uint32_t writes_skipped;   // Inhalt unveraendert
+  uint32_t last_bytes;
+  uint32_t last_entries;
+  uint32_t last_write_us;
+  uint32_t first_frame_ms;   // erster Frame mit Werten (auch stale)
+  uint32_t first_live_ms;    // erster Frame mit MQTT-Wert
+};
+
+static SnapshotStats g_snap = {};
+static uint32_t g_last_write_ms = 0;
+static uint32_t g_dirty_since_ms = 0;
+static uint32_t g_parses_written = 0;
+static uint32_t g_last_crc = 0;
+static uint32_t g_last_len = 0;
+static bool g_value_shown = false;
+static bool g_live_shown = false;
+
+static void put_le32(std::vector<uint8_t>& buf, size_t at, uint32_t v) {
+  buf[at] = static_cast<uint8_t>(v & 0xFF);
+  buf[at + 1] = static_cast<uint8_t>((v >> 8) & 0xFF);
+  buf[at + 2] = static_cast<uint8_t>((v >> 16) & 0xFF);
+  buf[at + 3] = static_cast<uint8_t>((v >> 24) & 0xFF);
+}
+
+static uint32_t get_le32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static uint16_t pack_switch_flags(const SwitchState& sw) {
+  return (sw.has_state ? 0x001 : 0) | (sw.is_on ? 0x002 : 0) | (sw.has_color ? 0x004 : 0) |
+         (sw.has_hs ? 0x008 : 0) | (sw.has_brightness ? 0x010 : 0) |
+         (sw.supports_color ? 0x020 : 0) | (sw.supports_brightness ? 0x040 : 0) |
+         (sw.supported_modes_known ? 0x080 : 0) | (sw.supported_onoff_only ? 0x100 : 0);
+}
+
+static void unpack_switch_flags(uint16_t f, SwitchState& sw) {
+  sw.has_state = f & 0x001;
+  sw.is_on = f & 0x002;
+  sw.has_color = f & 0x004;
+  sw.has_hs = f & 0x008;
+  sw.has_brightness = f & 0x010;
+  sw.supports_color = f & 0x020;
+  sw.supports_brightness = f & 0x040;
+  sw.supported_modes_known = f & 0x080;
+  sw.supported_onoff_only = f & 0x100;
+}
+
+static uint32_t wall_clock() {
+  time_t now = time(nullptr);
+  return now > 1600000000 ? static_cast<uint32_t>(now) : 0;  // ohne NTP: unbekannt
+}
+
+// Tabelle serialisieren; liefert die Anzahl gespeicherter Entities
+static uint16_t build_snapshot(std::vector<uint8_t>& image) {
+  ConfigImageWriter out;
+  for (size_t i = 0; i < kHeaderSize; ++i) out.u8(0);
+  out.u32(wall_clock());
+  uint16_t count = 0;
+  bool full = false;
+  entityTable.forEach([&](const EntityEntry& e) {
+    if (full) return;
+    if (e.value.length() == 0 && !e.has_switch) return;
+    const size_t id_len = strlen(e.id);
+    const bool keep_value = e.value.length() <= ENTITY_SNAPSHOT_MAX_VALUE;
+    if (!keep_value && !e.has_switch) return;  // grosses JSON ohne Schalterzustand
+    const size_t need = 2 + id_len + 2 + (keep_value ? e.value.length() : 0) + 1 + (e.has_switch ? 11 : 0);
+    if (out.bytes().size() + need > ENTITY_SNAPSHOT_MAX_BYTES) {
+      full = true;
+      return;
+    }
+    out.str(e.id);
+    out.str(keep_value ? e.value.c_str() : "");
+    out.u8(e.has_switch ? kFlagSwitch : 0);
+    if (e.has_switch) {
+      out.u16(pack_switch_flags(e.sw));
+      out.u32(e.sw.color);
+      out.u8(e.sw.brightness_pct);
+      out.u16(static_cast<uint16_t>(e.sw.hs_h * 100.0f));
+      out.u16(static_cast<uint16_t>(e.sw.hs_s * 100.0f));
+    }
+    count++;
+  });
+  if (full) {
+    Serial.printf("[Snapshot] Limit %u Bytes erreicht, %u Entities gespeichert\n",
+                  static_cast<unsigned>(ENTITY_SNAPSHOT_MAX_BYTES), count);
+  }
+
+  image = out.bytes();
+  const uint32_t payload_len = image.size() - kHeaderSize;
+  put_le32(image, 0, kSnapMagic);
+  image[4] = static_cast<uint8_t>(kSnapVersion & 0xFF);
+  image[5] = static_cast<uint8_t>(kSnapVersion >> 8);
+  image[6] = static_cast<uint8_t>(count & 0xFF);
+  image[7] = static_cast<uint8_t>(count >> 8);
+  put_le32(image, 8, payload_len);
+  // CRC ohne Zeitstempel, damit ein unveraenderter Inhalt als solcher erkannt wird
+  put_le32(image, 12, esp_rom_crc32_le(0, image.data() + kHeaderSize + 4, payload_len - 4));
+  return count;
+}
+
+bool entity_snapshot_restore() {
+  const uint32_t start_us = micros();
+  Preferences prefs;
+  if (!prefs.begin(PREF_NAMESPACE, true)) {
+    Serial.println("[Snapshot] Kein Snapshot vorhanden");
+    return false;
+  }
+  const size_t len = prefs.getBytesLength(PREF_KEY);
+  std::vector<uint8_t> image;
+  if (len >= kHeaderSize + 4 && len <= ENTITY_SNAPSHOT_MAX_BYTES) {
+    image.resize(len);
+    if (prefs.getBytes(PREF_KEY, image.data(), len) != len) image.clear();
+  }
+  prefs.end();
+  if (image.empty()) {
+    Serial.println("[Snapshot] Kein Snapshot vorhanden");
+    return false;
+  }
+
+  const uint8_t* p = image.data();
+  const uint16_t version = static_cast<uint16_t>(p[4] | (p[5] << 8));
+  const uint16_t count = static_cast<uint16_t>(p[6] | (p[7] << 8));
+  const uint32_t payload_len = get_le32(p + 8);
+  const uint32_t crc = get_le32(p + 12);
+  if (get_le32(p) != kSnapMagic || version != kSnapVersion || payload_len != len - kHeaderSize ||
+      esp_rom_crc32_le(0, p + kHeaderSize + 4, payload_len - 4) != crc) {
+    Serial.println("[Snapshot] Snapshot ungueltig (Header/CRC) - verworfen");
+    return false;
+  }
+
+  ConfigImageReader in(p + kHeaderSize, payload_len, static_cast<uint8_t>(version));
+  const uint32_t saved_at = in.u32();
+  uint16_t restored = 0;
+  for (uint16_t i = 0; i < count && in.ok(); ++i) {
+    String id = in.str();
+    String value = in.str();
+    const uint8_t flags = in.u8();
+    SwitchState sw;
+    if (flags & kFlagSwitch) {
+      unpack_switch_flags(in.u16(), sw);
+      sw.color = in.u32();
+      sw.brightness_pct = in.u8();
+      sw.hs_h = in.u16() / 100.0f;
+      sw.hs_s = in.u16() / 100.0f;
+    }
+    if (!in.ok()) break;
+    entity_state_restore(id.c_str(), value.c_str(), (flags & kFlagSwitch) ? &sw : nullptr);
+    restored++;
+  }
+
+  g_last_crc = crc;
+  g_last_len = len;
+  g_parses_written = entity_state_get_stats().parses;
+  const uint32_t now = wall_clock();
+  g_snap.age_s = (saved_at && now > saved_at) ? now - saved_at : 0;
+  g_snap.restored = restored;
+  g_snap.restore_us = micros() - start_us;
+  Serial.printf("[Snapshot] %u Entities wiederhergestellt (%u Bytes) in %lu us\n",
+                restored, static_cast<unsigned>(len), static_cast<unsigned long>(g_snap.restore_us));
+  return restored > 0;
+}
+
+bool entity_snapshot_flush() {
+  const uint32_t start_us = micros();
+  std::vector<uint8_t> image;
+  const uint16_t count = build_snapshot(image);
+  const uint32_t crc = get_le32(image.data() + 12);
+  g_parses_written = entity_state_get_stats().parses;
+  g_dirty_since_ms = 0;
+  g_last_write_ms = millis();
+  if (crc == g_last_crc && image.size() == g_last_len) {
+    g_snap.writes_skipped++;
+    return true;
+  }
+
+  Preferences prefs;
+  if (!prefs.begin(PREF_NAMESPACE, false)) {
+    Serial.printf("[Snapshot] Fehler beim Oeffnen von NVS namespace '%s'\n", PREF_NAMESPACE);
+    return false;
+  }
+  size_t written = prefs.putBytes(PREF_KEY, image.data(), image.size());
+  if (written != image.size()) {
+    prefs.remove(PREF_KEY);
+    written = prefs.putBytes(PREF_KEY, image.data(), image.size());
+  }
+  prefs.end();
+  if (written != image.size()) {
+    Serial.println("[Snapshot] Fehler beim Speichern");
+    return false;
+  }
+
+  g_last_crc = crc;
+  g_last_len = image.size();
+  g_snap.writes++;
+  g_snap.last_bytes = image.size();
+  g_snap.last_entries = count;
+  g_snap.last_write_us = micros() - start_us;
+  Serial.printf("[Snapshot] %u Entities gespeichert (%u Bytes) in %lu us\n",
+                count, static_cast<unsigned>(image.size()), static_cast<unsigned long>(g_snap.last_write_us));
+  return true;
+}
+
+void entity_snapshot_service() {
+#if ENTITY_SNAPSHOT_INTERVAL_MS > 0
+  if (entity_state_get_stats().parses == g_parses_written) return;  // nichts Neues
+  const uint32_t now = millis();
+  if (g_dirty_since_ms == 0) {
+    g_dirty_since_ms = now;
+    return;
+  }
+  // Erster Snapshot kurz nach dem Boot, danach hoechstens einmal pro Intervall
+  const uint32_t wait_ms = g_last_write_ms ? ENTITY_SNAPSHOT_INTERVAL_MS : ENTITY_SNAPSHOT_FIRST_MS;
+  const uint32_t since_ms = g_last_write_ms ? now - g_last_write_ms : now - g_dirty_since_ms;
+  if (since_ms < wait_ms) return;
+  entity_snapshot_flush();
+#endif
+}
+
+void entity_snapshot_note_value(bool stale) {
+  g_value_shown = true;
+  if (!stale) g_live_shown = true;
+}
+
+void entity_snapshot_note_frame() {
+  if (g_snap.first_live_ms) return;
+  if (g_value_shown && !g_snap.first_frame_ms) {
+    g_snap.first_frame_ms = millis();
+    Serial.printf("[Snapshot] Erster Frame mit Werten nach %lu ms (%s)\n",
+                  static_cast<unsigned long>(g_snap.first_frame_ms), g_live_shown ? "live" : "Snapshot");
+  }
+  if (g_live_shown) {
+    g_snap.first_live_ms = millis();
+    Serial.printf("[Snapshot] Erster Frame mit MQTT-Werten nach %lu ms\n",
+                  static_cast<unsigned long>(g_snap.first_live_ms));
+  }
+}
+
+String entity_snapshot_stats_json() {
+  String json = "{\"restored\":" + String(g_snap.restored);
+  json += ",\"restore_us\":" + String(g_snap.restore_us);
+  json += ",\"age_s\":" + String(g_snap.age_s);
+  json += ",\"writes\":" + String(g_snap.writes);
+  json += ",\"writes_skipped\":" + String(g_snap.writes_skipped);
+  json += ",\"last_bytes\":" + String(g_snap.last_bytes);
+  json += ",\"last_entries\":" + String(g_snap.last_entries);
+  json += ",\"last_write_us\":" + String(g_snap.last_write_us);
+  json += ",\"interval_ms\":" + String(static_cast<unsigned long>(ENTITY_SNAPSHOT_INTERVAL_MS));
+  json += ",\"first_frame_ms\":" + String(g_snap.first_frame_ms);
+  json += ",\"first_live_ms\":" + String(g_snap.first_live_ms);
+  json += "}";
+  return json;
+}
@@ -0,0 +1,41 @@
+#ifndef ENTITY_SNAPSHOT_H
+#define ENTITY_SNAPSHOT_H
+
+#include <Arduino.h>
+
+// Letzte bekannte Entity-Zustaende ueberleben den Neustart: die Entity-Tabelle wird
+// gedrosselt als CRC-geschuetzter Blob ins NVS geschrieben und beim Boot vor buildUI
+// zurueckgeladen. Die Kacheln zeigen damit schon im ersten Frame Werte, abgedimmt
+// (stale) bis MQTT den Zustand bestaetigt.
+
+// Mindestabstand zwischen zwei Flash-Schreibvorgaengen (0 = nie automatisch schreiben)
+#ifndef ENTITY_SNAPSHOT_INTERVAL_MS
+#define ENTITY_SNAPSHOT_INTERVAL_MS (10UL * 60UL * 1000UL)
+#endif
+// Erster Snapshot nach dem Boot, sobald Werte da sind
+#ifndef ENTITY_SNAPSHOT_FIRST_MS
+#define ENTITY_SNAPSHOT_FIRST_MS (60UL * 1000UL)
+#endif
+// Obergrenze fuer den Blob; laengere Rohwerte (JSON) werden nicht gespeichert,
+// Schalter behalten ihren geparsten Zustand
+#ifndef ENTITY_SNAPSHOT_MAX_BYTES
+#define ENTITY_SNAPSHOT_MAX_BYTES 6144
+#endif
+#ifndef ENTITY_SNAPSHOT_MAX_VALUE
+#define ENTITY_SNAPSHOT_MAX_VALUE 64
+#endif
+
+// Boot: Snapshot in die Entity-Tabelle laden (nach configStore.load, vor buildUI)
+bool entity_snapshot_restore();
+// Loop: schreibt, wenn sich Werte geaendert haben und das Intervall abgelaufen ist
+void entity_snapshot_service();
+// Sofort schreiben (z.B. vor Neustart)
+bool entity_snapshot_flush();
+
+// Boot-Messung: Kachel hat einen Wert angezeigt / Frame wurde gerendert
+void entity_snapshot_note_value(bool stale);
+void entity_snapshot_note_frame();
+
+String entity_snapshot_stats_json();
+
+#endif // ENTITY_SNAPSHOT_H
@@ -0,0 +1,503 @@
+#include "src/network/entity_state.h"
+#include "src/network/entity_table.h"
+#include <math.h>
+#include <stdlib.h>
+
+static EntityStateStats g_stats = {};
+
+static uint32_t clamp_rgb(int r, int g, int b) {
+  auto clamp = [](int v) { return v < 0 ? 0 : (v > 255 ? 255 : v); };
+  return (static_cast<uint32_t>(clamp(r)) << 16) |
+         (static_cast<uint32_t>(clamp(g)) << 8) |
+         static_cast<uint32_t>(clamp(b));
+}
+
+static bool parse_on_off(const String& text, bool& is_on) {
+  String lower = text;
+  lower.trim();
+  lower.toLowerCase();
+  if (lower == "on" || lower == "true" || lower == "1" || lower == "yes") {
+    is_on = true;
+    return true;
+  }
+  if (lower == "off" || lower == "false" || lower == "0" || lower == "no") {
+    is_on = false;
+    return true;
+  }
+  return false;
+}
+
+static bool parse_hex_color(const String& text, uint32_t& color) {
+  String t = text;
+  t.trim();
+  if (t.startsWith("#")) t.remove(0, 1);
+  if (t.startsWith("0x") || t.startsWith("0X")) t.remove(0, 2);
+  if (t.length() != 6) return false;
+  char* end = nullptr;
+  long val = strtol(t.c_str(), &end, 16);
+  if (!end || end == t.c_str() || *end != '\0') return false;
+  color = static_cast<uint32_t>(val) & 0xFFFFFF;
+  return true;
+}
+
+static bool parse_rgb_list(const String& list, int& r, int& g, int& b) {
+  const char* ptr = list.c_str();
+  char* end = nullptr;
+  long vals[3];
+  for (int i = 0; i < 3; ++i) {
+    while (*ptr && (*ptr == ' ' || *ptr == ',')) ++ptr;
+    if (!*ptr) return false;
+    vals[i] = strtol(ptr, &end, 10);
+    if (!end || end == ptr) return false;
+    ptr = end;
+  }
+  r = static_cast<int>(vals[0]);
+  g = static_cast<int>(vals[1]);
+  b = static_cast<int>(vals[2]);
+  return true;
+}
+
+static bool parse_hs_list(const String& list, float& h, float& s) {
+  const char* ptr = list.c_str();
+  char* end = nullptr;
+  float vals[2];
+  for (int i = 0; i < 2; ++i) {
+    while (*ptr && (*ptr == ' ' || *ptr == ',')) ++ptr;
+    if (!*ptr) return false;
+    vals[i] = strtof(ptr, &end);
+    if (!end || end == ptr) return false;
+    ptr = end;
+  }
+  h = vals[0];
+  s = vals[1];
+  return true;
+}
+
+static uint32_t hs_to_rgb(float h, float s) {
+  float hh = fmodf(h, 360.0f);
+  if (hh < 0) hh += 360.0f;
+  float sat = s / 100.0f;
+  float c = sat;
+  float x = c * (1.0f - fabsf(fmodf(hh / 60.0f, 2.0f) - 1.0f));
+  float m = 1.0f - c;
+  float r1 = 0, g1 = 0, b1 = 0;
+  if (hh < 60.0f) { r1 = c; g1 = x; b1 = 0; }
+  else if (hh < 120.0f) { r1 = x; g1 = c; b1 = 0; }
+  else if (hh < 180.0f) { r1 = 0; g1 = c; b1 = x; }
+  else if (hh < 240.0f) { r1 = 0; g1 = x; b1 = c; }
+  else if (hh < 300.0f) { r1 = x; g1 = 0; b1 = c; }
+  else { r1 = c; g1 = 0; b1 = x; }
+  int r = static_cast<int>((r1 + m) * 255.0f);
+  int g = static_cast<int>((g1 + m) * 255.0f);
+  int b = static_cast<int>((b1 + m) * 255.0f);
+  return clamp_rgb(r, g, b);
+}
+
+static bool extract_json_string_field(const String& src, const char* key, String& out) {
+  if (!key || !*key) return false;
+  String pattern = String("\"") + key + "\"";
+  int idx = src.indexOf(pattern);
+  if (idx < 0) return false;
+  int colon = src.indexOf(':', idx);
+  if (colon < 0) return false;
+  int q1 = src.indexOf('"', colon);
+  if (q1 < 0) return false;
+  int q2 = src.indexOf('"', q1 + 1);
+  if (q2 < 0) return false;
+  out = src.substring(q1 + 1, q2);
+  out.trim();
+  return out.length() > 0;
+}
+
+static bool extract_json_array_field(const String& src, const char* key, String& out) {
+  if (!key || !*key) return false;
+  String pattern = String("\"") + key + "\"";
+  int idx = src.indexOf(pattern);
+  if (idx < 0) return false;
+  int start = src.indexOf('[', idx);
+  int end = src.indexOf(']', start);
+  if (start < 0 || end < start) return false;
+  out = src.substring(start + 1, end);
+  out.trim();
+  return out.length() > 0;
+}
+
+static bool extract_json_number_field(const String& src, const char* key, float& out) {
+  if (!key || !*key) return false;
+  String pattern = String("\"") + key + "\"";
+  int idx = src.indexOf(pattern);
+  if (idx < 0) return false;
+  int colon = src.indexOf(':', idx);
+  if (colon < 0) return false;
+  int pos = colon + 1;
+  while (pos < src.length() && (src.charAt(pos) == ' ' || src.charAt(pos) == '\t')) {
+    ++pos;
+  }
+  if (pos >= src.length()) return false;
+  const char* start = src.c_str() + pos;
+  char* end = nullptr;
+  float val = strtof(start, &end);
+  if (!end || end == start) return false;
+  out = val;
+  return true;
+}
+
+static bool extract_json_object_field(const String& src, const char* key, String& out) {
+  if (!key || !*key) return false;
+  String pattern = "\"";
+  pattern += key;
+  pattern += "\"";
+  int idx = src.indexOf(pattern);
+  if (idx < 0) return false;
+  int colon = src.indexOf(':', idx);
+  if (colon < 0) return false;
+  int pos = colon + 1;
+  while (pos < src.length() && (src.charAt(pos) == ' ' || src.charAt(pos) == '\t')) {
+    ++pos;
+  }
+  if (pos >= src.length() || src.charAt(pos) != '{') return false;
+  int depth = 0;
+  bool in_string = false;
+  for (int i = pos; i < src.length(); ++i) {
+    char c = src.charAt(i);
+    if (c == '"' && (i == 0 || src.charAt(i - 1) != '\\')) {
+      in_string = !in_string;
+    }
+    if (in_string) continue;
+    if (c == '{') {
+      ++depth;
+    } else if (c == '}') {
+      --depth;
+      if (depth == 0) {
+        out = src.substring(pos, i + 1);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+static bool list_contains_mode(String list, const char* mode) {
+  if (!mode || !*mode) return false;
+  list.toLowerCase();
+  list.replace("\"", "");
+  int start = 0;
+  while (start < list.length()) {
+    int comma = list.indexOf(',', start);
+    if (comma < 0) comma = list.length();
+    String token = list.substring(start, comma);
+    token.trim();
+    if (token == mode) return true;
+    start = comma + 1;
+  }
+  return false;
+}
+
+static bool is_color_mode(const String& mode) {
+  return mode == "hs" ||
+         mode == "rgb" ||
+         mode == "xy" ||
+         mode == "rgbw" ||
+         mode == "rgbww" ||
+         mode == "color_temp";
+}
+
+SwitchState parse_switch_payload(const char* payload) {
+  SwitchState out;
+  if (!payload) return out;
+  String text = payload;
+  text.trim();
+  if (!text.length()) return out;
+
+  if (text.startsWith("{")) {
+    String state;
+    if (extract_json_string_field(text, "state", state)) {
+      out.has_state = parse_on_off(state, out.is_on);
+    }
+
+    String supported_modes;
+    if (extract_json_array_field(text, "supported_color_modes", supported_modes)) {
+      out.supported_modes_known = true;
+      bool has_brightness = list_contains_mode(supported_modes, "brightness");
+      bool has_color = list_contains_mode(supported_modes, "hs") ||
+                       list_contains_mode(supported_modes, "rgb") ||
+                       list_contains_mode(supported_modes, "xy") ||
+                       list_contains_mode(supported_modes, "rgbw") ||
+                       list_contains_mode(supported_modes, "rgbww") ||
+                       list_contains_mode(supported_modes, "color_temp");
+      bool has_onoff = list_contains_mode(supported_modes, "onoff");
+      out.supports_brightness = has_brightness;
+      out.supports_color = has_color;
+      out.supported_onoff_only = has_onoff && !has_brightness && !has_color;
+    }
+
+    String color_mode;
+    if (extract_json_string_field(text, "color_mode", color_mode)) {
+      String mode = color_mode;
+      mode.toLowerCase();
+      if (mode == "brightness") {
+        out.supports_brightness = true;
+        out.supported_onoff_only = false;
+      }
+      if (is_color_mode(mode)) {
+        out.supports_color = true;
+        out.supported_onoff_only = false;
+      }
+      if (mode == "onoff" && !out.supported_modes_known) {
+        out.supported_modes_known = true;
+        out.supported_onoff_only = true;
+      }
+    }
+
+    float bright_pct = -1.0f;
+    float bright_raw = -1.0f;
+    if (extract_json_number_field(text, "brightness_pct", bright_pct)) {
+      int pct = static_cast<int>(roundf(bright_pct));
+      if (pct < 0) pct = 0;
+      if (pct > 100) pct = 100;
+      out.has_brightness = true;
+      out.brightness_pct = static_cast<uint8_t>(pct);
+    } else if (extract_json_number_field(text, "brightness", bright_raw)) {
+      int pct = static_cast<int>(roundf((bright_raw / 255.0f) * 100.0f));
+      if (pct < 0) pct = 0;
+      if (pct > 100) pct = 100;
+      out.has_brightness = true;
+      out.brightness_pct = static_cast<uint8_t>(pct);
+    }
+
+    String color_text;
+    if (extract_json_string_field(text, "color", color_text)) {
+      uint32_t color = 0;
+      if (parse_hex_color(color_text, color)) {
+        out.has_color = true;
+        out.color = color;
+      }
+    }
+
+    if (!out.has_color) {
+      String rgb_list;
+      if (extract_json_array_field(text, "rgb_color", rgb_list)) {
+        int r = 0, g = 0, b = 0;
+        if (parse_rgb_list(rgb_list, r, g, b)) {
+          out.has_color = true;
+          out.color = clamp_rgb(r, g, b);
+        }
+      }
+    }
+
+    {
+      String hs_list;
+      if (extract_json_array_field(text, "hs_color", hs_list)) {
+        float h = 0.0f, s = 0.0f;
+        if (parse_hs_list(hs_list, h, s)) {
+          out.has_hs = true;
+          out.hs_h = h;
+          out.hs_s = s;
+          out.has_color = true;
+          out.color = hs_to_rgb(h, s);
+        }
+      }
+    }
+
+    String attributes;
+    if (extract_json_object_field(text, "attributes", attributes)) {
+      if (extract_json_array_field(attributes, "supported_color_modes", supported_modes)) {
+        out.supported_modes_known = true;
+        bool has_brightness = list_contains_mode(supported_modes, "brightness");
+        bool has_color = list_contains_mode(supported_modes, "hs") ||
+                         list_contains_mode(supported_modes, "rgb") ||
+                         list_contains_mode(supported_modes, "xy") ||
+                         list_contains_mode(supported_modes, "rgbw") ||
+                         list_contains_mode(supported_modes, "rgbww") ||
+                         list_contains_mode(supported_modes, "color_temp");
+        bool has_onoff = list_contains_mode(supported_modes, "onoff");
+        out.supports_brightness = has_brightness;
+        out.supports_color = has_color;
+        out.supported_onoff_only = has_onoff && !has_brightness && !has_color;
+      }
+
+      if (extract_json_string_field(attributes, "color_mode", color_mode)) {
+        String mode = color_mode;
+        mode.toLowerCase();
+        if (mode == "brightness") {
+          out.supports_brightness = true;
+          out.supported_onoff_only = false;
+        }
+        if (is_color_mode(mode)) {
+          out.supports_color = true;
+          out.supported_onoff_only = false;
+        }
+        if (mode == "onoff" && !out.supported_modes_known) {
+          out.supported_modes_known = true;
+          out.supported_onoff_only = true;
+        }
+      }
+
+      if (!out.has_brightness && extract_json_number_field(attributes, "brightness_pct", bright_pct)) {
+        int pct = static_cast<int>(roundf(bright_pct));
+        if (pct < 0) pct = 0;
+        if (pct > 100) pct = 100;
+        out.has_brightness = true;
+        out.brightness_pct = static_cast<uint8_t>(pct);
+      } else if (!out.has_brightness && extract_json_number_field(attributes, "brightness", bright_raw)) {
+        int pct = static_cast<int>(roundf((bright_raw / 255.0f) * 100.0f));
+        if (pct < 0) pct = 0;
+        if (pct > 100) pct = 100;
+        out.has_brightness = true;
+        out.brightness_pct = static_cast<uint8_t>(pct);
+      }
+
+      if (!out.has_color) {
+        if (extract_json_string_field(attributes, "color", color_text)) {
+          uint32_t color = 0;
+          if (parse_hex_color(color_text, color)) {
+            out.has_color = true;
+            out.color = color;
+          }
+        }
+      }
+
+      if (!out.has_color) {
+        String rgb_list;
+        if (extract_json_array_field(attributes, "rgb_color", rgb_list)) {
+          int r = 0, g = 0, b = 0;
+          if (parse_rgb_list(rgb_list, r, g, b)) {
+            out.has_color = true;
+            out.color = clamp_rgb(r, g, b);
+          }
+        }
+      }
+
+      {
+        String hs_list;
+        if (extract_json_array_field(attributes, "hs_color", hs_list)) {
+          float h = 0.0f, s = 0.0f;
+          if (parse_hs_list(hs_list, h, s)) {
+            out.has_hs = true;
+            out.hs_h = h;
+            out.hs_s = s;
+            out.has_color = true;
+            out.color = hs_to_rgb(h, s);
+          }
+        }
+      }
+    }
+  }
+
+  if (!out.has_state) {
+    out.has_state = parse_on_off(text, out.is_on);
+  }
+
+  if (!out.has_color) {
+    uint32_t color = 0;
+    if (parse_hex_color(text, color)) {
+      out.has_color = true;
+      out.color = color;
+    } else if (text.startsWith("rgb(") && text.endsWith(")")) {
+      String list = text.substring(4, text.length() - 1);
+      int r = 0, g = 0, b = 0;
+      if (parse_rgb_list(list, r, g, b)) {
+        out.has_color = true;
+        out.color = clamp_rgb(r, g, b);
+      }
+    }
+  }
+
+  if (!out.has_state && out.has_color) {
+    out.has_state = true;
+    out.is_on = true;
+  }
+  if (!out.has_state && out.has_brightness) {
+    out.has_state = true;
+    out.is_on = out.brightness_pct > 0;
+  }
+
+  if (out.has_color) {
+    out.supports_color = true;
+  }
+  if (out.has_hs) {
+    out.supports_color = true;
+  }
+  if (out.has_brightness) {
+    out.supports_brightness = true;
+    out.supported_onoff_only = false;
+  }
+  if (out.supports_color) {
+    out.supports_brightness = true;
+    out.supported_onoff_only = false;
+  }
+
+  return out;
+}
+
+static bool parse_number(const char* payload, float& out) {
+  // Wie apply_decimals: Komma als Dezimaltrenner zulassen
+  char buf[32];
+  size_t n = 0;
+  while (*payload == ' ') ++payload;
+  for (; payload[n] && n < sizeof(buf) - 1; ++n) {
+    buf[n] = payload[n] == ',' ? '.' : payload[n];
+  }
+  buf[n] = '\0';
+  char* end = nullptr;
+  float f = strtof(buf, &end);
+  if (!end || end == buf) return false;
+  if (isnan(f) || isinf(f)) return false;
+  out = f;
+  return true;
+}
+
+const EntityEntry* entity_state_update(const char* entity_id, const char* payload) {
+  if (!entity_id || !*entity_id || !payload) return nullptr;
+  const uint32_t start_us = micros();
+  EntityEntry& e = entityTable.setValue(entity_id, String(payload));
+  if (!e.id) return nullptr;
+
+  e.has_number = parse_number(payload, e.number);
+  SwitchState sw = parse_switch_payload(payload);
+  e.has_switch = sw.has_state || sw.has_color || sw.has_brightness ||
+                 sw.supports_color || sw.supports_brightness;
+  e.sw = e.has_switch ? sw : SwitchState{};
+  e.stale = false;
+
+  g_stats.parses++;
+  g_stats.parse_us_total += micros() - start_us;
+  return &e;
+}
+
+const EntityEntry* entity_state_lookup(const char* entity_id) {
+  const EntityEntry* e = entityTable.find(entity_id);
+  if (!e || (e->value.length() == 0 && !e->has_switch)) {
+    g_stats.misses++;
+    return nullptr;
+  }
+  g_stats.hits++;
+  return e;
+}
+
+void entity_state_restore(const char* entity_id, const char* value, const SwitchState* sw) {
+  if (!entity_id || !*entity_id) return;
+  EntityEntry& e = entityTable.upsert(entity_id);
+  if (!e.id) return;
+  const char* text = value ? value : "";
+  e.value = text;
+  e.has_number = parse_number(text, e.number);
+  if (sw) {
+    e.sw = *sw;
+    e.has_switch = true;
+  } else {
+    SwitchState parsed = parse_switch_payload(text);
+    e.has_switch = parsed.has_state || parsed.has_color || parsed.has_brightness ||
+                   parsed.supports_color || parsed.supports_brightness;
+    e.sw = e.has_switch ? parsed : SwitchState{};
+  }
+  e.stale = true;
+}
+
+void entity_state_reserve(size_t entities) {
+  entityTable.reserve(entities);
+}
+
+EntityStateStats entity_state_get_stats() {
+  return g_stats;
+}
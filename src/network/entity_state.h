@@ -0,0 +1,53 @@
+#ifndef ENTITY_STATE_H
+#define ENTITY_STATE_H
+
+#include <Arduino.h>
+
+struct EntityEntry;
+
+// Zustands-Cache fuer Home-Assistant-Entities: jede MQTT-Nachricht wird einmal
+// geparst (Zahl, an/aus, Farbe, Helligkeit) und in der Entity-Tabelle abgelegt.
+// Tiles, Popups und Lazy-Tabs uebernehmen den fertigen Zustand ohne erneutes Parsen.
+
+// Schalt-/Licht-Zustand ("on"/"off" oder JSON mit Attributen)
+struct SwitchState {
+  bool has_state = false;
+  bool is_on = false;
+  bool has_color = false;
+  uint32_t color = 0;
+  bool has_hs = false;
+  float hs_h = 0.0f;
+  float hs_s = 0.0f;
+  bool has_brightness = false;
+  uint8_t brightness_pct = 100;
+  bool supports_color = false;
+  bool supports_brightness = false;
+  bool supported_modes_known = false;
+  bool supported_onoff_only = false;
+};
+
+SwitchState parse_switch_payload(const char* payload);
+
+// MQTT: Rohwert speichern und parsen; nullptr bei leerer ID oder ohne Speicher
+const EntityEntry* entity_state_update(const char* entity_id, const char* payload);
+
+// Letzter Zustand (zaehlt Treffer/Fehlversuche); nullptr = noch kein Wert
+const EntityEntry* entity_state_lookup(const char* entity_id);
+
+// Boot: Zustand aus dem Snapshot uebernehmen, als veraltet markiert bis MQTT liefert.
+// sw == nullptr: nur Rohwert (wird wie eine MQTT-Payload geparst)
+void entity_state_restore(const char* entity_id, const char* value, const SwitchState* sw);
+
+// Tabelle fuer die konfigurierten Entities vorbelegen (kein Rehash im Betrieb)
+void entity_state_reserve(size_t entities);
+
+struct EntityStateStats {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t parses;
+  uint32_t parse_us_total;
+};
+
+EntityStateStats entity_state_get_stats();
+
+#endif // ENTITY_STATE_H
@@ -0,0 +1,318 @@
+#include "src/network/entity_table.h"
+#include <ctype.h>
+#include <esp_heap_caps.h>
+
+// Globale Instanz
+EntityTable entityTable;
+
+static constexpr size_t kMinCapacity = 64;       // Zweierpotenz
+static constexpr size_t kPoolBlockSize = 2048;
+
+static uint32_t hash_id(const char* s) {
+  uint32_t h = 2166136261u;  // FNV-1a
+  for (; *s; ++s) {
+    h ^= static_cast<uint8_t>(tolower(static_cast<unsigned char>(*s)));
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// stored ist bereits lowercase, key beliebig
+static bool id_equals(const char* stored, const char* key) {
+  for (; *stored && *key; ++stored, ++key) {
+    if (*stored != static_cast<char>(tolower(static_cast<unsigned char>(*key)))) return false;
+  }
+  return *stored == *key;
+}
+
+static char* pool_alloc(size_t bytes) {
+  char* p = static_cast<char*>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  if (!p) p = static_cast<char*>(malloc(bytes));
+  return p;
+}
+
+EntityTable::~EntityTable() {
+  for (char* block : pool_blocks) {
+    free(block);
+  }
+}
+
+const char* EntityTable::poolCopy(const char* entity_id) {
+  const size_t len = strlen(entity_id) + 1;
+  char* dst = nullptr;
+  if (len > kPoolBlockSize / 4) {
+    // Ausreisser bekommen einen eigenen Block, der laufende Block bleibt aktiv
+    dst = pool_alloc(len);
+    if (!dst) return nullptr;
+    pool_blocks.push_back(dst);
+    pool_bytes += len;
+  } else {
+    if (!pool_cur || pool_used + len > kPoolBlockSize) {
+      char* block = pool_alloc(kPoolBlockSize);
+      if (!block) return nullptr;
+      pool_blocks.push_back(block);
+      pool_bytes += kPoolBlockSize;
+      pool_cur = block;
+      pool_used = 0;
+    }
+    dst = pool_cur + pool_used;
+    pool_used += len;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    dst[i] = static_cast<char>(tolower(static_cast<unsigned char>(entity_id[i])));
+  }
+  return dst;
+}
+
+size_t EntityTable::probe(const char* entity_id, uint32_t hash) const {
+  const size_t mask = slots.size() - 1;
+  size_t idx = hash & mask;
+  lookups++;
+  while (slots[idx].id) {
+    if (slots[idx].hash == hash && id_equals(slots[idx].id, entity_id)) break;
+    idx = (idx + 1) & mask;
+    probes++;
+  }
+  return idx;
+}
+
+void EntityTable::grow() {
+  const size_t new_cap = slots.empty() ? kMinCapacity : slots.size() * 2;
+  rehash(new_cap);
+}
+
+void EntityTable::rehash(size_t new_cap) {
+  std::vector<EntityEntry> old;
+  old.swap(slots);
+  slots.resize(new_cap);
+  const size_t mask = new_cap - 1;
+  for (EntityEntry& e : old) {
+    if (!e.id) continue;
+    size_t idx = e.hash & mask;
+    while (slots[idx].id) idx = (idx + 1) & mask;
+    slots[idx] = std::move(e);
+  }
+}
+
+EntityEntry& EntityTable::upsert(const char* entity_id) {
+  // Ladefaktor <= 0.7 haelt die Sondierketten kurz
+  if (slots.empty() || (count + 1) * 10 > slots.size() * 7) grow();
+  const uint32_t hash = hash_id(entity_id);
+  const size_t idx = probe(entity_id, hash);
+  EntityEntry& e = slots[idx];
+  if (!e.id) {
+    const char* id = poolCopy(entity_id);
+    if (!id) {
+      // Kein Speicher: Schreibzugriffe landen in einem Wegwerf-Eintrag
+      static EntityEntry overflow{};
+      Serial.printf("[EntityTable] Kein Speicher fuer '%s'\n", entity_id);
+      overflow = EntityEntry{};
+      return overflow;
+    }
+    e.id = id;
+    e.hash = hash;
+    count++;
+  }
+  return e;
+}
+
+EntityEntry* EntityTable::find(const char* entity_id) {
+  if (slots.empty() || !entity_id || !*entity_id) return nullptr;
+  const size_t idx = probe(entity_id, hash_id(entity_id));
+  return slots[idx].id ? &slots[idx] : nullptr;
+}
+
+const EntityEntry* EntityTable::find(const char* entity_id) const {
+  if (slots.empty() || !entity_id || !*entity_id) return nullptr;
+  const size_t idx = probe(entity_id, hash_id(entity_id));
+  return slots[idx].id ? &slots[idx] : nullptr;
+}
+
+const char* EntityTable::intern(const char* entity_id) {
+  if (!entity_id || !*entity_id) return nullptr;
+  return upsert(entity_id).id;
+}
+
+EntityEntry& EntityTable::setValue(const char* entity_id, const String& value) {
+  EntityEntry& e = upsert(entity_id);
+  e.value = value;
+  e.updated_ms = millis();
+  e.seq = ++change_seq;
+  updates++;
+  return e;
+}
+
+void EntityTable::reserve(size_t n) {
+  size_t cap = slots.empty() ? kMinCapacity : slots.size();
+  while (n * 10 > cap * 7) cap *= 2;
+  if (cap > slots.size()) rehash(cap);
+}
+
+void EntityTable::reset() {
+  for (EntityEntry& e : slots) {
+    if (!e.id) continue;
+    if (e.value.length()) e.seq = ++change_seq;  // Web-Clients: Wert geloescht
+    e.unit = String();
+    e.name = String();
+    e.value = String();
+    e.updated_ms = 0;
+    e.number = 0.0f;
+    e.has_number = false;
+    e.has_switch = false;
+    e.sw = SwitchState{};
+    e.stale = false;
+  }
+}
+
+EntityTableStats EntityTable::stats() const {
+  EntityTableStats st{};
+  st.entries = count;
+  st.capacity = slots.size();
+  st.pool_bytes = pool_bytes;
+  st.lookups = lookups;
+  st.probes = probes;
+  st.updates = updates;
+  return st;
+}
+
+/* === Benchmark: alte Key=Value-Strings vs. Tabelle === */
+
+// Alte Implementierung (HaBridgeConfig vor der Tabelle), nur fuer den Vergleich
+static String legacy_lookup(const String& text, const String& key) {
+  int start = 0;
+  while (start < text.length()) {
+    int end = text.indexOf('\n', start);
+    if (end < 0) end = text.length();
+    String line = text.substring(start, end);
+    int eq = line.indexOf('=');
+    if (eq > 0) {
+      String lhs = line.substring(0, eq);
+      lhs.trim();
+      if (lhs.equalsIgnoreCase(key)) {
+        String rhs = line.substring(eq + 1);
+        rhs.trim();
+        return rhs;
+      }
+    }
+    start = end + 1;
+  }
+  return "";
+}
+
+static void legacy_update(String& map, const String& entity_id, const String& value) {
+  String next;
+  bool found = false;
+  int start = 0;
+  while (start < map.length()) {
+    int end = map.indexOf('\n', start);
+    if (end < 0) end = map.length();
+    String line = map.substring(start, end);
+    int eq = line.indexOf('=');
+    if (eq > 0) {
+      String entity = line.substring(0, eq);
+      entity.trim();
+      if (next.length()) next += '\n';
+      if (entity.equalsIgnoreCase(entity_id)) {
+        next += entity_id + "=" + value;
+        found = true;
+      } else {
+        next += line;
+      }
+    }
+    start = end + 1;
+  }
+  if (!found) {
+    if (next.length()) next += '\n';
+    next += entity_id + "=" + value;
+  }
+  map = next;
+}
+
+static String bench_id(uint16_t i) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "sensor.bench_%03u", static_cast<unsigned>(i));
+  return String(buf);
+}
+
+String entity_table_benchmark(uint16_t entities, uint16_t updates_per_sec, uint16_t seconds) {
+  if (entities == 0) entities = 1;
+  const uint32_t total_updates = static_cast<uint32_t>(updates_per_sec) * seconds;
+  // Der alte Pfad ist O(n) pro Update: Stichprobe begrenzen und hochrechnen
+  const uint32_t legacy_updates = total_updates < 200 ? total_updates : 200;
+  const uint32_t lookups = entities;
+
+  std::vector<String> ids;
+  ids.reserve(entities);
+  String values_map;
+  String units_map;
+  for (uint16_t i = 0; i < entities; ++i) {
+    ids.push_back(bench_id(i));
+    if (values_map.length()) values_map += '\n';
+    values_map += ids[i] + "=0";
+    if (units_map.length()) units_map += '\n';
+    units_map += ids[i] + "=W";
+  }
+
+  uint32_t start = micros();
+  for (uint32_t u = 0; u < legacy_updates; ++u) {
+    legacy_update(values_map, ids[(u * 7) % entities], String(u));
+    if ((u & 15) == 0) yield();
+  }
+  const uint32_t legacy_update_us = micros() - start;
+
+  start = micros();
+  size_t hits = 0;
+  for (uint32_t l = 0; l < lookups; ++l) {
+    hits += legacy_lookup(units_map, ids[(l * 13) % entities]).length() ? 1 : 0;
+    if ((l & 31) == 0) yield();
+  }
+  const uint32_t legacy_lookup_us = micros() - start;
+
+  EntityTable table;
+  start = micros();
+  for (uint16_t i = 0; i < entities; ++i) {
+    EntityEntry& e = table.upsert(ids[i].c_str());
+    e.unit = "W";
+    e.value = "0";
+  }
+  const uint32_t table_build_us = micros() - start;
+
+  start = micros();
+  for (uint32_t u = 0; u < total_updates; ++u) {
+    table.setValue(ids[(u * 7) % entities].c_str(), String(u));
+  }
+  const uint32_t table_update_us = micros() - start;
+
+  start = micros();
+  for (uint32_t l = 0; l < lookups; ++l) {
+    const EntityEntry* e = table.find(ids[(l * 13) % entities].c_str());
+    hits += (e && e->unit.length()) ? 1 : 0;
+  }
+  const uint32_t table_lookup_us = micros() - start;
+
+  const float legacy_per_update = legacy_updates ? static_cast<float>(legacy_update_us) / legacy_updates : 0.0f;
+  const float table_per_update = total_updates ? static_cast<float>(table_update_us) / total_updates : 0.0f;
+  const float legacy_per_lookup = static_cast<float>(legacy_lookup_us) / lookups;
+  const float table_per_lookup = static_cast<float>(table_lookup_us) / lookups;
+  const EntityTableStats st = table.stats();
+
+  String json = "{\"entities\":" + String(entities);
+  json += ",\"updates_per_sec\":" + String(updates_per_sec);
+  json += ",\"seconds\":" + String(seconds);
+  json += ",\"legacy\":{\"update_us\":" + String(legacy_per_update, 1);
+  json += ",\"lookup_us\":" + String(legacy_per_lookup, 1);
+  json += ",\"cpu_pct\":" + String(legacy_per_update * updates_per_sec / 10000.0f, 2);
+  json += ",\"sampled_updates\":" + String(legacy_updates) + "}";
+  json += ",\"table\":{\"update_us\":" + String(table_per_update, 2);
+  json += ",\"lookup_us\":" + String(table_per_lookup, 2);
+  json += ",\"cpu_pct\":" + String(table_per_update * updates_per_sec / 10000.0f, 4);
+  json += ",\"build_us\":" + String(table_build_us);
+  json += ",\"capacity\":" + String(st.capacity);
+  json += ",\"avg_probe\":" + String(st.lookups ? 1.0f + static_cast<float>(st.probes) / st.lookups : 0.0f, 2);
+  json += ",\"pool_bytes\":" + String(st.pool_bytes) + "}";
+  json += ",\"hits\":" + String(static_cast<unsigned>(hits));
+  json += "}";
+  Serial.printf("[EntityTable] Bench %u Entities: Update alt %.1f us / neu %.2f us, Lookup alt %.1f us / neu %.2f us\n",
+                entities, legacy_per_update, table_per_update, legacy_per_lookup, table_per_lookup);
+  return json;
+}
@@ -0,0 +1,97 @@
+#ifndef ENTITY_TABLE_H
+#define ENTITY_TABLE_H
+
+#include <Arduino.h>
+#include <vector>
+#include "src/network/entity_state.h"
+
+// Entity-Metadaten und letzte Werte aus Home Assistant (Einheit, Name, Wert, Zeitstempel).
+// Ersetzt die "entity=wert\n"-Strings der Bridge-Konfiguration: offene Adressierung
+// (lineares Sondieren, FNV-1a), Schluessel ist die internierte Entity-ID in
+// Kleinbuchstaben. Eintraege werden nie entfernt, reset() leert nur die Felder -
+// interne ID-Zeiger bleiben dadurch dauerhaft gueltig.
+
+struct EntityEntry {
+  const char* id = nullptr;  // interniert, lowercase; nullptr = freier Slot
+  uint32_t hash = 0;
+  String unit;
+  String name;
+  String value;              // Rohwert (letzte MQTT-Payload)
+  uint32_t updated_ms = 0;   // millis() der letzten Wertaenderung, 0 = kein Wert
+  // Geparster Zustand (entity_state_update)
+  float number = 0.0f;
+  bool has_number = false;
+  bool has_switch = false;
+  SwitchState sw;
+  bool stale = false;        // aus dem Boot-Snapshot, noch nicht per MQTT bestaetigt
+  uint32_t seq = 0;          // Aenderungszaehler (changeSeq) der letzten Wertaenderung
+};
+
+struct EntityTableStats {
+  uint32_t entries;
+  uint32_t capacity;
+  uint32_t pool_bytes;  // internierte IDs
+  uint32_t lookups;
+  uint32_t probes;      // Summe Sondierschritte (lookups + probes/lookups = Schnitt)
+  uint32_t updates;
+};
+
+class EntityTable {
+public:
+  EntityTable() = default;
+  ~EntityTable();
+  EntityTable(const EntityTable&) = delete;
+  EntityTable& operator=(const EntityTable&) = delete;
+
+  // Liefert den Eintrag (legt ihn bei Bedarf an)
+  EntityEntry& upsert(const char* entity_id);
+  EntityEntry* find(const char* entity_id);
+  const EntityEntry* find(const char* entity_id) const;
+
+  // Stabiler Zeiger auf die internierte ID (lowercase), nullptr bei leerer ID
+  const char* intern(const char* entity_id);
+
+  EntityEntry& setValue(const char* entity_id, const String& value);
+  // Kapazitaet fuer mindestens n Eintraege bei Ladefaktor 0.7
+  void reserve(size_t n);
+  // Einheit/Name/Wert aller Eintraege leeren (neue Discovery)
+  void reset();
+
+  size_t size() const { return count; }
+  // Steigt mit jeder Wertaenderung; Eintraege mit seq > x haben sich seit x geaendert
+  uint32_t changeSeq() const { return change_seq; }
+  EntityTableStats stats() const;
+
+  template <typename Fn>
+  void forEach(Fn fn) const {
+    for (const EntityEntry& e : slots) {
+      if (e.id) fn(e);
+    }
+  }
+
+private:
+  size_t probe(const char* entity_id, uint32_t hash) const;
+  void grow();
+  void rehash(size_t new_cap);
+  const char* poolCopy(const char* entity_id);
+
+  std::vector<EntityEntry> slots;
+  size_t count = 0;
+  std::vector<char*> pool_blocks;
+  char* pool_cur = nullptr;  // laufender Block fuer kurze IDs
+  size_t pool_used = 0;
+  size_t pool_bytes = 0;
+  mutable uint32_t lookups = 0;
+  mutable uint32_t probes = 0;
+  uint32_t updates = 0;
+  uint32_t change_seq = 0;
+};
+
+extern EntityTable entityTable;
+
+// Vergleich alt (Key=Value-String) vs. Tabelle auf einer Scratch-Instanz;
+// Ergebnis als JSON (GET /api/perf/entity_bench, Web-Task; tests/host/test_entity_table).
+// Dauert je nach Groesse einige 100 ms, fasst entityTable nicht an.
+String entity_table_benchmark(uint16_t entities, uint16_t updates_per_sec, uint16_t seconds);
+
+#endif // ENTITY_TABLE_H
@@ -1,21 +1,24 @@
 #include "src/network/ha_bridge_config.h"
+#include "src/core/config_store.h"
+#include "src/network/entity_table.h"
 
 #include <Preferences.h>
 #include <stdio.h>
 
-static const char* PREF_NAMESPACE = "tab5_config";
+static const char* PREF_NAMESPACE = "tab5_config";  // Altbestand vor dem Config-Image
+static constexpr uint8_t kImageSectionVersion = 1;
 static void logList(const char* label, const String& text);
 static bool sensorExistsInList(const String& list, const String& candidate);
 static bool aliasExistsInList(const String& list, const String& alias);
-static void parseSensorMetaSection(const String& body, String& units, String& names, String& values);
+static void parseSensorMetaSection(const String& body);
 static bool extractStringField(const String& object, const char* key, String& out);
-static String lookupKeyValue(const String& text, const String& key);
+static void importKeyValueText(const String& text, String EntityEntry::*field);
 
 HaBridgeConfig haBridgeConfig;
 
 HaBridgeConfig::HaBridgeConfig() = default;
 
-bool HaBridgeConfig::load() {
+bool HaBridgeConfig::loadLegacy() {
   Preferences prefs;
   if (!prefs.begin(PREF_NAMESPACE, true)) {
     return false;
@@ -25,9 +28,9 @@ bool HaBridgeConfig::load() {
   data.lights_text = "";
   data.switches_text = "";
   data.scene_alias_text = prefs.getString("ha_scene_alias", "");
-  data.sensor_units_map = prefs.getString("ha_sens_units", "");
-  data.sensor_names_map = prefs.getString("ha_sens_names", "");
-  data.sensor_values_map = prefs.getString("ha_sens_vals", "");
+  importKeyValueText(prefs.getString("ha_sens_units", ""), &EntityEntry::unit);
+  importKeyValueText(prefs.getString("ha_sens_names", ""), &EntityEntry::name);
+  importKeyValueText(prefs.getString("ha_sens_vals", ""), &EntityEntry::value);
   for (size_t i = 0; i < HA_SENSOR_SLOT_COUNT; ++i) {
     char key[12];
     snprintf(key, sizeof(key), "slot_s%u", static_cast<unsigned>(i));
@@ -53,42 +56,58 @@ bool HaBridgeConfig::load() {
   return true;
 }
 
-bool HaBridgeConfig::save(const HaBridgeConfigData& incoming) {
-  Preferences prefs;
-  if (!prefs.begin(PREF_NAMESPACE, false)) {
-    return false;
-  }
-
-  // WICHTIG: Listen NICHT in NVS speichern - die kommen per MQTT-Discovery!
-  // Nur die Zuordnungen (Slots) speichern, sonst wird NVS bei vielen Sensoren zu groß!
-  // prefs.putString("ha_sensors", incoming.sensors_text);
-  // prefs.putString("ha_scene_alias", incoming.scene_alias_text);
-  // prefs.putString("ha_sens_units", incoming.sensor_units_map);
-  // prefs.putString("ha_sens_names", incoming.sensor_names_map);
-  // prefs.putString("ha_sens_vals", incoming.sensor_values_map);
+void HaBridgeConfig::writeImage(ConfigImageWriter& out) const {
+  out.beginSection(CFG_SECTION_BRIDGE, kImageSectionVersion);
+  out.u8(HA_SENSOR_SLOT_COUNT);
   for (size_t i = 0; i < HA_SENSOR_SLOT_COUNT; ++i) {
-    char key[12];
-    snprintf(key, sizeof(key), "slot_s%u", static_cast<unsigned>(i));
-    prefs.putString(key, incoming.sensor_slots[i]);
-    snprintf(key, sizeof(key), "title_s%u", static_cast<unsigned>(i));
-    prefs.putString(key, incoming.sensor_titles[i]);
-    snprintf(key, sizeof(key), "unit_s%u", static_cast<unsigned>(i));
-    prefs.putString(key, incoming.sensor_custom_units[i]);
-    snprintf(key, sizeof(key), "color_s%u", static_cast<unsigned>(i));
-    prefs.putUInt(key, incoming.sensor_colors[i]);
+    out.str(data.sensor_slots[i]);
+    out.str(data.sensor_titles[i]);
+    out.str(data.sensor_custom_units[i]);
+    out.u32(data.sensor_colors[i]);
   }
+  out.u8(HA_SCENE_SLOT_COUNT);
   for (size_t i = 0; i < HA_SCENE_SLOT_COUNT; ++i) {
-    char key[12];
-    snprintf(key, sizeof(key), "slot_c%u", static_cast<unsigned>(i));
-    prefs.putString(key, incoming.scene_slots[i]);
-    snprintf(key, sizeof(key), "title_c%u", static_cast<unsigned>(i));
-    prefs.putString(key, incoming.scene_titles[i]);
-    snprintf(key, sizeof(key), "color_c%u", static_cast<unsigned>(i));
-    prefs.putUInt(key, incoming.scene_colors[i]);
+    out.str(data.scene_slots[i]);
+    out.str(data.scene_titles[i]);
+    out.u32(data.scene_colors[i]);
   }
-  prefs.end();
+  out.endSection();
+}
 
+void HaBridgeConfig::readImage(ConfigImageReader& in) {
+  const uint8_t sensor_count = in.u8();
+  for (size_t i = 0; i < sensor_count && in.ok(); ++i) {
+    String slot = in.str();
+    String title = in.str();
+    String unit = in.str();
+    uint32_t color = in.u32();
+    if (i >= HA_SENSOR_SLOT_COUNT) continue;
+    data.sensor_slots[i] = slot;
+    data.sensor_titles[i] = title;
+    data.sensor_custom_units[i] = unit;
+    data.sensor_colors[i] = color;
+  }
+  const uint8_t scene_count = in.u8();
+  for (size_t i = 0; i < scene_count && in.ok(); ++i) {
+    String slot = in.str();
+    String title = in.str();
+    uint32_t color = in.u32();
+    if (i >= HA_SCENE_SLOT_COUNT) continue;
+    data.scene_slots[i] = slot;
+    data.scene_titles[i] = title;
+    data.scene_colors[i] = color;
+  }
+}
+
+bool HaBridgeConfig::save(const HaBridgeConfigData& incoming) {
+  // WICHTIG: Listen landen NICHT im Flash - die kommen per MQTT-Discovery!
+  // Ins Config-Image gehen nur die Zuordnungen (Slots), siehe writeImage.
+  HaBridgeConfigData prev = data;
   data = incoming;
+  if (!configStore.commit()) {
+    data = prev;
+    return false;
+  }
   return true;
 }
 
@@ -100,15 +119,18 @@ bool HaBridgeConfig::hasData() const {
 }
 
 String HaBridgeConfig::findSensorUnit(const String& entity_id) const {
-  return lookupKeyValue(data.sensor_units_map, entity_id);
+  const EntityEntry* e = entityTable.find(entity_id.c_str());
+  return e ? e->unit : String();
 }
 
 String HaBridgeConfig::findSensorName(const String& entity_id) const {
-  return lookupKeyValue(data.sensor_names_map, entity_id);
+  const EntityEntry* e = entityTable.find(entity_id.c_str());
+  return e ? e->name : String();
 }
 
 String HaBridgeConfig::findSensorInitialValue(const String& entity_id) const {
-  return lookupKeyValue(data.sensor_values_map, entity_id);
+  const EntityEntry* e = entityTable.find(entity_id.c_str());
+  return e ? e->value : String();
 }
 
 String HaBridgeConfig::buildJsonPayload(const char* device_id,
@@ -295,8 +317,6 @@ bool HaBridgeConfig::applyJson(const char* json_payload) {
     parseObjectSection(json.substring(scene_idx), merged.scene_alias_text);
   }
 
-  parseSensorMetaSection(json, merged.sensor_units_map, merged.sensor_names_map, merged.sensor_values_map);
-
   for (size_t i = 0; i < HA_SENSOR_SLOT_COUNT; ++i) {
     if (merged.sensor_slots[i].length() &&
         !sensorExistsInList(merged.sensors_text, merged.sensor_slots[i])) {
@@ -315,6 +335,7 @@ bool HaBridgeConfig::applyJson(const char* json_payload) {
 
   bool ok = save(merged);
   if (ok) {
+    parseSensorMetaSection(json);
     Serial.println("[Bridge] Konfiguration aus Home Assistant uebernommen");
     logList("Sensoren", data.sensors_text);
     logList("Lichter", data.lights_text);
@@ -398,10 +419,8 @@ static bool extractStringField(const String& object, const char* key, String& ou
   return out.length() > 0;
 }
 
-static void parseSensorMetaSection(const String& body, String& units, String& names, String& values) {
-  units = "";
-  names = "";
-  values = "";
+static void parseSensorMetaSection(const String& body) {
+  entityTable.reset();
   int meta_idx = body.indexOf("\"sensor_meta\"");
   if (meta_idx < 0) {
     return;
@@ -422,27 +441,26 @@ static void parseSensorMetaSection(const String& body, String& units, String& na
       obj_start = segment.indexOf('{', obj_end + 1);
       continue;
     }
+    EntityEntry& e = entityTable.upsert(entity.c_str());
     String unit;
     if (extractStringField(object, "unit", unit)) {
-      if (units.length()) units += '\n';
-      units += entity + "=" + unit;
+      e.unit = unit;
     }
     String name;
     if (extractStringField(object, "name", name)) {
-      if (names.length()) names += '\n';
-      names += entity + "=" + name;
+      e.name = name;
     }
     String value;
     if (extractStringField(object, "value", value)) {
-      if (values.length()) values += '\n';
-      values += entity + "=" + value;
+      // Ueber setValue, damit seq/changeSeq steigen (Live-Deltas); e danach nicht mehr benutzen
+      entityTable.setValue(entity.c_str(), value);
     }
     obj_start = segment.indexOf('{', obj_end + 1);
   }
 }
 
-static String lookupKeyValue(const String& text, const String& key) {
-  if (!key.length()) return "";
+// Altbestand "entity=wert\n" (NVS) in die Tabelle uebernehmen
+static void importKeyValueText(const String& text, String EntityEntry::*field) {
   int start = 0;
   while (start < text.length()) {
     int end = text.indexOf('\n', start);
@@ -450,63 +468,14 @@ static String lookupKeyValue(const String& text, const String& key) {
     String line = text.substring(start, end);
     int eq = line.indexOf('=');
     if (eq > 0) {
-      String lhs = line.substring(0, eq);
-      lhs.trim();
-      if (lhs.equalsIgnoreCase(key)) {
-        String rhs = line.substring(eq + 1);
-        rhs.trim();
-        return rhs;
-      }
-    }
-    start = end + 1;
-  }
-  return "";
-}
-
-void HaBridgeConfig::updateSensorValue(const String& entity_id, const String& value) {
-  if (entity_id.length() == 0) return;
-
-  // Parse sensor_values_map and update/add the value
-  String& valuesMap = data.sensor_values_map;
-  String newMap = "";
-  bool found = false;
-
-  int start = 0;
-  while (start < valuesMap.length()) {
-    int end = valuesMap.indexOf('\n', start);
-    if (end < 0) end = valuesMap.length();
-
-    String line = valuesMap.substring(start, end);
-    int eq = line.indexOf('=');
-
-    if (eq > 0) {
-      String entity = line.substring(0, eq);
-      entity.trim();
-
-      if (entity.equalsIgnoreCase(entity_id)) {
-        // Update existing entry
-        if (newMap.length()) newMap += '\n';
-        newMap += entity_id + "=" + value;
-        found = true;
-      } else {
-        // Keep existing entry
-        if (newMap.length()) newMap += '\n';
-        newMap += line;
+      String key = line.substring(0, eq);
+      String value = line.substring(eq + 1);
+      key.trim();
+      value.trim();
+      if (key.length()) {
+        entityTable.upsert(key.c_str()).*field = value;
       }
-    } else if (line.length() > 0) {
-      // Keep non-empty lines without '='
-      if (newMap.length()) newMap += '\n';
-      newMap += line;
     }
-
     start = end + 1;
   }
-
-  // Add new entry if not found
-  if (!found) {
-    if (newMap.length()) newMap += '\n';
-    newMap += entity_id + "=" + value;
-  }
-
-  valuesMap = newMap;
 }
@@ -3,6 +3,9 @@
 
 #include <Arduino.h>
 
+class ConfigImageWriter;
+class ConfigImageReader;
+
 static constexpr size_t HA_SENSOR_SLOT_COUNT = 6;
 static constexpr size_t HA_SCENE_SLOT_COUNT = 6;
 
@@ -13,9 +16,6 @@ struct HaBridgeConfigData {
   String scene_alias_text;
   String sensor_slots[HA_SENSOR_SLOT_COUNT];
   String scene_slots[HA_SCENE_SLOT_COUNT];
-  String sensor_units_map;
-  String sensor_names_map;
-  String sensor_values_map;
   String sensor_titles[HA_SENSOR_SLOT_COUNT];
   String sensor_custom_units[HA_SENSOR_SLOT_COUNT];
   String scene_titles[HA_SCENE_SLOT_COUNT];
@@ -27,19 +27,23 @@ class HaBridgeConfig {
 public:
   HaBridgeConfig();
 
-  bool load();
+  // Alte Einzel-Keys (Preferences) - nur noch fuer die Migration ins Config-Image
+  bool loadLegacy();
+  // Config-Image (Sektion CFG_SECTION_BRIDGE): nur die Slot-Zuordnungen,
+  // die Listen kommen per MQTT-Discovery
+  void writeImage(ConfigImageWriter& out) const;
+  void readImage(ConfigImageReader& in);
+
   bool save(const HaBridgeConfigData& data);
   bool applyJson(const char* json_payload);
 
   const HaBridgeConfigData& get() const { return data; }
   bool hasData() const;
+  // Einheit/Name/letzter Wert kommen aus der Entity-Tabelle (entity_table.h)
   String findSensorUnit(const String& entity_id) const;
   String findSensorName(const String& entity_id) const;
   String findSensorInitialValue(const String& entity_id) const;
 
-  // Update live sensor value (for web interface)
-  void updateSensorValue(const String& entity_id, const String& value);
-
   String buildJsonPayload(const char* device_id,
                           const char* base_topic,
                           const char* ha_prefix) const;
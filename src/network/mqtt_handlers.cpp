@@ -2,6 +2,9 @@
 #include "src/network/mqtt_topics.h"
 #include "src/network/network_manager.h"
 #include "src/network/ha_bridge_config.h"
+#include "src/network/entity_table.h"
+#include "src/core/display_manager.h"
+#include "src/core/metrics.h"
 #include "src/ui/tab_tiles_unified.h"
 #include "src/ui/sensor_popup.h"
 #include "src/tiles/tile_config.h"
@@ -128,12 +131,12 @@ static void rebuildDynamicRoutes(std::vector<DynamicSensorRoute>& routes) {
 static bool tryHandleDynamicSensor(const char* topic, const char* payload) {
   for (const auto& route : g_dynamic_routes) {
     if (route.topic == topic) {
+      // Einmal parsen und in der Entity-Tabelle ablegen (Display, Lazy-Tabs, Web-Interface)
+      entity_state_update(route.entity_id.c_str(), payload);
       // Update tile-based system (display) - all grids
       tiles_update_sensor_by_entity(GridType::TAB0, route.entity_id.c_str(), payload);
       tiles_update_sensor_by_entity(GridType::TAB1, route.entity_id.c_str(), payload);
       tiles_update_sensor_by_entity(GridType::TAB2, route.entity_id.c_str(), payload);
-      // Update sensor values map (for web interface)
-      haBridgeConfig.updateSensorValue(route.entity_id, payload);
       return true;
     }
   }
@@ -146,8 +149,17 @@ static char small_buf[SMALL_BUF];
 static char large_buf[LARGE_BUF];
 
 // ========== MQTT Callback (Topic-Routing) ==========
+static MetricCounter g_msgs_bridge("tab5_mqtt_messages_total", "Empfangene MQTT-Nachrichten je Route", "route=\"bridge_apply\"");
+static MetricCounter g_msgs_static("tab5_mqtt_messages_total", "Empfangene MQTT-Nachrichten je Route", "route=\"static\"");
+static MetricCounter g_msgs_sensor("tab5_mqtt_messages_total", "Empfangene MQTT-Nachrichten je Route", "route=\"sensor\"");
+static MetricCounter g_msgs_history("tab5_mqtt_messages_total", "Empfangene MQTT-Nachrichten je Route", "route=\"history\"");
+static MetricCounter g_msgs_unhandled("tab5_mqtt_messages_total", "Empfangene MQTT-Nachrichten je Route", "route=\"unhandled\"");
+static MetricCounter g_msgs_bytes("tab5_mqtt_payload_bytes_total", "Empfangene MQTT-Payload-Bytes");
+
 void mqttCallback(char* topic, uint8_t* payload, unsigned int length) {
   yield();  // Webserver atmen lassen!
+  LvglLock lock;  // Handler greifen auf Tiles/Popups zu
+  g_msgs_bytes.inc(length);
 
   const char* apply_topic = networkManager.getBridgeApplyTopic();
   if (apply_topic && strcmp(topic, apply_topic) == 0) {
@@ -160,6 +172,7 @@ void mqttCallback(char* topic, uint8_t* payload, unsigned int length) {
     cfg_buf[copy_len] = '\0';
     yield();  // Nach großem Copy
     Serial.printf("[Bridge] apply-topic hit (%u bytes)\n", (unsigned)copy_len);
+    g_msgs_bridge.inc();
     if (haBridgeConfig.applyJson(cfg_buf)) {
       Serial.println("[Bridge] Konfiguration von HA empfangen");
       yield();  // Nach JSON Parse
@@ -200,6 +213,7 @@ void mqttCallback(char* topic, uint8_t* payload, unsigned int length) {
   memcpy(dyn_buf, payload, copy_len);
   dyn_buf[copy_len] = '\0';
   if (tryHandleDynamicSensor(topic, dyn_buf)) {
+    g_msgs_sensor.inc();
     yield();  // Nach Sensor-Update
     return;
   }
@@ -210,13 +224,16 @@ void mqttCallback(char* topic, uint8_t* payload, unsigned int length) {
     memcpy(large_buf, payload, copy_len);
     large_buf[copy_len] = '\0';
     queue_sensor_popup_history(nullptr, large_buf, copy_len);
+    g_msgs_history.inc();
     return;
   }
 
   if (processed_static) {
+    g_msgs_static.inc();
     return;
   }
 
+  g_msgs_unhandled.inc();
   Serial.printf("MQTT: Unhandled topic %s\n", topic);
 }
 
@@ -434,6 +451,8 @@ void mqttReloadDynamicSlots() {
     }
   }
   rebuildDynamicRoutes(g_dynamic_routes);
+  // Tabelle vorab dimensionieren, damit MQTT-Updates nie ein Rehash ausloesen
+  entity_state_reserve(entityTable.size() + g_dynamic_routes.size());
   if (mqtt.connected()) {
     for (const auto& route : g_dynamic_routes) {
       mqtt.subscribe(route.topic.c_str());
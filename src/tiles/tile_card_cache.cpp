@@ -0,0 +1,251 @@
+#include "src/tiles/tile_card_cache.h"
+#include "src/core/display_manager.h"
+#include <Arduino.h>
+#include <math.h>
+#include <vector>
+#include <misc/cache/instance/lv_image_cache.h>
+#include "esp_heap_caps.h"
+
+/* === Cache-Eintraege === */
+struct CardBgEntry {
+  uint16_t w = 0;
+  uint16_t h = 0;
+  uint8_t radius = 0;
+  uint32_t color = 0;
+  uint32_t backdrop = 0;
+  uint16_t refs = 0;
+  uint32_t last_use = 0;
+  uint8_t* buf = nullptr;
+  size_t bytes = 0;
+  lv_image_dsc_t dsc{};
+};
+
+// Pro Card: gewuenschte Farben + aktuell gebundene Eintraege
+struct CardBgBinding {
+  uint8_t radius;
+  uint32_t color;
+  uint32_t pressed_color;
+  bool has_pressed;
+  CardBgEntry* normal;
+  CardBgEntry* pressed;
+};
+
+static constexpr size_t kCardCacheBudgetBytes = 4 * 1024 * 1024;  // PSRAM
+static std::vector<CardBgEntry*> g_card_entries;
+static size_t g_card_cache_bytes = 0;
+static uint32_t g_card_cache_hits = 0;
+static uint32_t g_card_cache_misses = 0;
+static uint32_t g_card_cache_evictions = 0;
+static uint32_t g_card_cache_fallbacks = 0;
+static uint32_t g_card_cache_use_seq = 0;
+
+static inline uint16_t rgb565_swapped(uint32_t c) {
+  uint16_t v = static_cast<uint16_t>(((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F));
+  return static_cast<uint16_t>((v >> 8) | (v << 8));
+}
+
+// Ecken ohne Anti-Aliasing (wie das Display) auf bg setzen
+static void mask_corners(uint16_t* dst, uint16_t w, uint16_t h, uint8_t radius, uint16_t bg) {
+  int r = radius;
+  if (r * 2 > w) r = w / 2;
+  if (r * 2 > h) r = h / 2;
+
+  for (int y = 0; y < r; ++y) {
+    const float cy = static_cast<float>(r) - static_cast<float>(y) - 0.5f;
+    int inset = static_cast<int>(r - sqrtf(static_cast<float>(r * r) - cy * cy) + 0.5f);
+    if (inset < 0) inset = 0;
+    if (inset > w / 2) inset = w / 2;
+    uint16_t* top = dst + static_cast<size_t>(y) * w;
+    uint16_t* bottom = dst + static_cast<size_t>(h - 1 - y) * w;
+    for (int x = 0; x < inset; ++x) {
+      top[x] = bg;
+      top[w - 1 - x] = bg;
+      bottom[x] = bg;
+      bottom[w - 1 - x] = bg;
+    }
+  }
+}
+
+// Rastert ein abgerundetes Rechteck
+static void rasterize_card(uint16_t* dst, uint16_t w, uint16_t h, uint8_t radius,
+                           uint16_t fg, uint16_t bg) {
+  // Erste Zeile einmal fuellen, danach per memcpy kopieren
+  for (uint16_t x = 0; x < w; ++x) dst[x] = fg;
+  for (uint16_t y = 1; y < h; ++y) {
+    memcpy(dst + static_cast<size_t>(y) * w, dst, w * sizeof(uint16_t));
+  }
+  mask_corners(dst, w, h, radius, bg);
+}
+
+static void free_entry(CardBgEntry* entry) {
+  if (!entry) return;
+  lv_image_cache_drop(&entry->dsc);
+  if (entry->buf) heap_caps_free(entry->buf);
+  g_card_cache_bytes -= entry->bytes;
+  delete entry;
+}
+
+// Unbenutzte Eintraege (refs == 0) nach LRU freigeben, bis `needed` ins Budget passt
+static bool make_room(size_t needed) {
+  while (g_card_cache_bytes + needed > kCardCacheBudgetBytes) {
+    size_t victim = g_card_entries.size();
+    for (size_t i = 0; i < g_card_entries.size(); ++i) {
+      CardBgEntry* e = g_card_entries[i];
+      if (e->refs != 0) continue;
+      if (victim == g_card_entries.size() || e->last_use < g_card_entries[victim]->last_use) {
+        victim = i;
+      }
+    }
+    if (victim == g_card_entries.size()) return false;
+    free_entry(g_card_entries[victim]);
+    g_card_entries.erase(g_card_entries.begin() + victim);
+    g_card_cache_evictions++;
+  }
+  return true;
+}
+
+static CardBgEntry* acquire_entry(uint16_t w, uint16_t h, uint8_t radius, uint32_t color, uint32_t backdrop) {
+  for (CardBgEntry* e : g_card_entries) {
+    if (e->w == w && e->h == h && e->radius == radius && e->color == color && e->backdrop == backdrop) {
+      e->refs++;
+      e->last_use = ++g_card_cache_use_seq;
+      g_card_cache_hits++;
+      return e;
+    }
+  }
+
+  g_card_cache_misses++;
+  const size_t bytes = static_cast<size_t>(w) * h * sizeof(uint16_t);
+  if (!make_room(bytes)) return nullptr;
+  uint8_t* buf = static_cast<uint8_t*>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  if (!buf) return nullptr;
+
+  rasterize_card(reinterpret_cast<uint16_t*>(buf), w, h, radius, rgb565_swapped(color), rgb565_swapped(backdrop));
+
+  CardBgEntry* e = new CardBgEntry();
+  e->w = w;
+  e->h = h;
+  e->radius = radius;
+  e->color = color;
+  e->backdrop = backdrop;
+  e->refs = 1;
+  e->last_use = ++g_card_cache_use_seq;
+  e->buf = buf;
+  e->bytes = bytes;
+  e->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+  e->dsc.header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED;
+  e->dsc.header.w = w;
+  e->dsc.header.h = h;
+  e->dsc.header.stride = static_cast<uint32_t>(w) * sizeof(uint16_t);
+  e->dsc.data = buf;
+  e->dsc.data_size = bytes;
+  g_card_entries.push_back(e);
+  g_card_cache_bytes += bytes;
+  return e;
+}
+
+static void release_entry(CardBgEntry*& entry) {
+  if (!entry) return;
+  if (entry->refs > 0) entry->refs--;
+  entry = nullptr;
+}
+
+// Erster deckender Vorfahre bestimmt die Eckfarbe
+uint32_t tile_card_cache_backdrop(lv_obj_t* obj) {
+  lv_obj_t* p = obj ? lv_obj_get_parent(obj) : nullptr;
+  while (p) {
+    if (lv_obj_get_style_bg_opa(p, LV_PART_MAIN) >= LV_OPA_COVER) {
+      return lv_color_to_u32(lv_obj_get_style_bg_color(p, LV_PART_MAIN)) & 0xFFFFFF;
+    }
+    p = lv_obj_get_parent(p);
+  }
+  return 0x000000;
+}
+
+static void apply_native_style(lv_obj_t* card, const CardBgBinding* b) {
+  lv_obj_set_style_bg_image_src(card, nullptr, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_bg_image_src(card, nullptr, LV_PART_MAIN | LV_STATE_PRESSED);
+  lv_obj_set_style_bg_opa(card, LV_OPA_COVER, 0);
+  lv_obj_set_style_radius(card, b->radius, 0);
+}
+
+static void bind_card(lv_obj_t* card, CardBgBinding* b) {
+  const int32_t w = lv_obj_get_width(card);
+  const int32_t h = lv_obj_get_height(card);
+  if (w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF) return;
+  if (b->normal && b->normal->w == w && b->normal->h == h) return;
+
+  release_entry(b->normal);
+  release_entry(b->pressed);
+
+  const uint32_t backdrop = tile_card_cache_backdrop(card);
+  b->normal = acquire_entry(static_cast<uint16_t>(w), static_cast<uint16_t>(h), b->radius, b->color, backdrop);
+  if (b->normal && b->has_pressed) {
+    b->pressed = acquire_entry(static_cast<uint16_t>(w), static_cast<uint16_t>(h), b->radius, b->pressed_color, backdrop);
+  }
+  if (!b->normal || (b->has_pressed && !b->pressed)) {
+    release_entry(b->normal);
+    release_entry(b->pressed);
+    g_card_cache_fallbacks++;
+    apply_native_style(card, b);
+    return;
+  }
+
+  // Bild deckt die ganze Card ab -> kein Radius/Bg mehr rechnen
+  lv_obj_set_style_bg_opa(card, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_radius(card, 0, 0);
+  lv_obj_set_style_bg_image_src(card, &b->normal->dsc, LV_PART_MAIN | LV_STATE_DEFAULT);
+  if (b->pressed) {
+    lv_obj_set_style_bg_image_src(card, &b->pressed->dsc, LV_PART_MAIN | LV_STATE_PRESSED);
+  }
+}
+
+static void card_cache_event_cb(lv_event_t* e) {
+  lv_event_code_t code = lv_event_get_code(e);
+  CardBgBinding* b = static_cast<CardBgBinding*>(lv_event_get_user_data(e));
+  if (!b) return;
+  lv_obj_t* card = static_cast<lv_obj_t*>(lv_event_get_target(e));
+
+  if (code == LV_EVENT_SIZE_CHANGED) {
+    bind_card(card, b);
+  } else if (code == LV_EVENT_PRESSED || code == LV_EVENT_RELEASED) {
+    displayManager.markNextRender(code == LV_EVENT_PRESSED ? "Card pressed" : "Card released");
+  } else if (code == LV_EVENT_DELETE) {
+    release_entry(b->normal);
+    release_entry(b->pressed);
+    delete b;
+  }
+}
+
+void tile_card_cache_attach(lv_obj_t* card, uint8_t radius, uint32_t color,
+                            uint32_t pressed_color, bool has_pressed) {
+#if TILE_CARD_CACHE_ENABLED
+  if (!card) return;
+  CardBgBinding* b = new CardBgBinding{radius, color, pressed_color, has_pressed, nullptr, nullptr};
+  lv_obj_add_event_cb(card, card_cache_event_cb, LV_EVENT_SIZE_CHANGED, b);
+  lv_obj_add_event_cb(card, card_cache_event_cb, LV_EVENT_PRESSED, b);
+  lv_obj_add_event_cb(card, card_cache_event_cb, LV_EVENT_RELEASED, b);
+  lv_obj_add_event_cb(card, card_cache_event_cb, LV_EVENT_DELETE, b);
+#else
+  (void)card;
+  (void)radius;
+  (void)color;
+  (void)pressed_color;
+  (void)has_pressed;
+#endif
+}
+
+void tile_card_cache_mask_corners(uint16_t* px, uint16_t w, uint16_t h, uint8_t radius, uint32_t backdrop) {
+  if (!px || w == 0 || h == 0) return;
+  mask_corners(px, w, h, radius, rgb565_swapped(backdrop));
+}
+
+void tile_card_cache_log_stats() {
+  Serial.printf("[CardCache] %u Eintraege, %u KB | Hits: %lu, Misses: %lu, Evictions: %lu, Fallbacks: %lu\n",
+                static_cast<unsigned>(g_card_entries.size()),
+                static_cast<unsigned>(g_card_cache_bytes / 1024),
+                static_cast<unsigned long>(g_card_cache_hits),
+                static_cast<unsigned long>(g_card_cache_misses),
+                static_cast<unsigned long>(g_card_cache_evictions),
+                static_cast<unsigned long>(g_card_cache_fallbacks));
+}
@@ -0,0 +1,30 @@
+#ifndef TILE_CARD_CACHE_H
+#define TILE_CARD_CACHE_H
+
+#include <lvgl.h>
+
+// Vorgerenderte Card-Hintergruende (abgerundetes Rechteck, RGB565 in PSRAM).
+// Statt die Eckmasken bei jedem Redraw neu zu berechnen, wird pro
+// (Groesse, Radius, Farbe, Hintergrund) einmal gerastert und danach nur geblittet.
+// 0 = klassisches LVGL-Rounded-Rect (Vergleichsmessung vorher/nachher).
+#ifndef TILE_CARD_CACHE_ENABLED
+#define TILE_CARD_CACHE_ENABLED 1
+#endif
+
+// Haengt den Cache an eine Card. Die Groesse wird erst nach dem Grid-Layout
+// bekannt (LV_EVENT_SIZE_CHANGED); bis dahin bleibt der normale Style aktiv.
+// pressed_color wird nur genutzt, wenn has_pressed gesetzt ist.
+void tile_card_cache_attach(lv_obj_t* card, uint8_t radius, uint32_t color,
+                            uint32_t pressed_color, bool has_pressed);
+
+// Farbe hinter den Card-Ecken (erster deckender Vorfahre)
+uint32_t tile_card_cache_backdrop(lv_obj_t* card);
+
+// Ecken eines Bildes (RGB565 Byte-getauscht) wie bei den Card-Hintergruenden
+// mit der Hintergrundfarbe fuellen, z.B. fuer Thumbnails als Card-Bild
+void tile_card_cache_mask_corners(uint16_t* px, uint16_t w, uint16_t h, uint8_t radius, uint32_t backdrop);
+
+// Statistik (Hits/Misses/Bytes) ins Serial-Log
+void tile_card_cache_log_stats();
+
+#endif // TILE_CARD_CACHE_H
@@ -1,9 +1,13 @@
 #include "src/tiles/tile_config.h"
+#include "src/core/config_store.h"
 #include <Preferences.h>
 #include <string.h>
+#include <vector>
 #include <SD.h>
 
+// Altbestand vor dem Config-Image (nur noch gelesen)
 static const char* PREF_NAMESPACE = "tab5_tiles";
+static constexpr uint8_t kImageSectionVersion = 1;
 static constexpr uint8_t PACKED_GRID_VERSION = 3;
 static constexpr uint16_t IMAGE_SLIDESHOW_DEFAULT_SEC = 10;
 static constexpr uint16_t IMAGE_SLIDESHOW_MAX_SEC = 3600;
@@ -109,15 +113,6 @@ TileConfig tileConfig;
 
 TileConfig::TileConfig() = default;
 
-static void copyString(const String& src, char* dst, size_t max_len) {
-  if (!dst || max_len == 0) return;
-  memset(dst, 0, max_len);
-  if (src.length() == 0) return;
-  size_t n = src.length();
-  if (n >= max_len) n = max_len - 1;
-  memcpy(dst, src.c_str(), n);
-}
-
 static uint8_t clampDecimals(uint8_t val) {
   if (val == 0xFF) return 0xFF;
   if (val > 6) return 6;
@@ -142,33 +137,12 @@ static bool sdReady() {
   return SD.cardType() != CARD_NONE;
 }
 
-static bool ensureImagePathDir() {
-  if (!sdReady()) return false;
-  if (SD.exists(kImagePathDir)) return true;
-  return SD.mkdir(kImagePathDir);
-}
-
 static String imagePathFile(const char* prefix, size_t index) {
   char buf[64];
   snprintf(buf, sizeof(buf), "%s/%s_%02u.url", kImagePathDir, prefix, static_cast<unsigned>(index));
   return String(buf);
 }
 
-static bool writeImagePathSd(const char* prefix, size_t index, const String& path) {
-  if (!ensureImagePathDir()) return false;
-  String filePath = imagePathFile(prefix, index);
-  if (path.length() == 0) {
-    if (SD.exists(filePath)) SD.remove(filePath);
-    return true;
-  }
-  if (SD.exists(filePath)) SD.remove(filePath);
-  File f = SD.open(filePath, FILE_WRITE);
-  if (!f) return false;
-  f.print(path);
-  f.close();
-  return true;
-}
-
 static bool readImagePathSd(const char* prefix, size_t index, String& out) {
   out = "";
   if (!sdReady()) return false;
@@ -182,31 +156,6 @@ static bool readImagePathSd(const char* prefix, size_t index, String& out) {
   return out.length() > 0;
 }
 
-static void packTile(const Tile& in, PackedTile& out) {
-  memset(&out, 0, sizeof(out));
-  out.type = static_cast<uint8_t>(in.type);
-  out.sensor_decimals = clampDecimals(in.sensor_decimals);
-  out.key_code = in.key_code;
-  out.key_modifier = in.key_modifier;
-  out.bg_color = in.bg_color;
-  out.sensor_value_font = clampSensorValueFont(in.sensor_value_font);
-  out.image_slideshow_sec = clampImageSlideshowSeconds(in.image_slideshow_sec);
-  copyString(in.title, out.title, sizeof(out.title));
-  copyString(in.icon_name, out.icon_name, sizeof(out.icon_name));
-  copyString(in.sensor_unit, out.sensor_unit, sizeof(out.sensor_unit));
-  copyString(in.scene_alias, out.scene_alias, sizeof(out.scene_alias));
-  if (in.type == TILE_IMAGE) {
-    // TILE_IMAGE speichert image_path nicht im NVS (liegt auf SD).
-    out.sensor_entity[0] = '\0';
-    out.key_macro[0] = '\0';
-    Serial.printf("[TileConfig] packTile - TILE_IMAGE: image_path='%s' (SD)\n",
-                  in.image_path.c_str());
-  } else {
-    copyString(in.sensor_entity, out.sensor_entity, sizeof(out.sensor_entity));
-    copyString(in.key_macro, out.key_macro, sizeof(out.key_macro));
-  }
-}
-
 static bool looksLikeImagePath(const String& value) {
   if (value.length() == 0) return false;
   if (value.startsWith("/") || value.startsWith("__")) return true;
@@ -224,9 +173,6 @@ static void applyImagePathsFromSd(const char* prefix, TileGridConfig& grid) {
       tile.image_path = sd_path;
       continue;
     }
-    if (have_sd && tile.image_path.length() > 0) {
-      writeImagePathSd(prefix, i, tile.image_path);
-    }
     if (!have_sd) {
       tile.image_path = "";
     }
@@ -469,7 +415,7 @@ static bool migrateOldBlobs() {
   return had_old_blobs;
 }
 
-bool TileConfig::load() {
+bool TileConfig::loadLegacy() {
   migrateOldBlobs();  // Migrate old home/game/weather to tab0/tab1/tab2
   clearAllLegacyKeys();  // Aufräumen von Altlasten (vorherige Key/Value-Layouts)
   bool tab0_ok = loadGrid("tab0", tab0_grid);
@@ -479,45 +425,148 @@ bool TileConfig::load() {
   return tab0_ok && tab1_ok && tab2_ok;
 }
 
-bool TileConfig::save(const TileGridConfig& tab0, const TileGridConfig& tab1, const TileGridConfig& tab2) {
-  bool tab0_ok = saveGrid("tab0", tab0);
-  bool tab1_ok = saveGrid("tab1", tab1);
-  bool tab2_ok = saveGrid("tab2", tab2);
-
-  if (tab0_ok && tab1_ok && tab2_ok) {
-    tab0_grid = tab0;
-    tab1_grid = tab1;
-    tab2_grid = tab2;
-    Serial.println("[TileConfig] Konfiguration gespeichert");
-    return true;
+void TileConfig::clearLegacy() {
+  Preferences prefs;
+  if (!prefs.begin(PREF_NAMESPACE, false)) return;
+  prefs.clear();
+  prefs.end();
+  Serial.println("[TileConfig] Alte Grid-Blobs entfernt (liegen im Config-Image)");
+}
+
+static void writeTile(ConfigImageWriter& out, const Tile& tile) {
+  out.u8(static_cast<uint8_t>(tile.type));
+  out.u32(tile.bg_color);
+  out.u8(clampDecimals(tile.sensor_decimals));
+  out.u8(clampSensorValueFont(tile.sensor_value_font));
+  out.u8(tile.key_code);
+  out.u8(tile.key_modifier);
+  out.u16(clampImageSlideshowSeconds(tile.image_slideshow_sec));
+  out.str(tile.title);
+  out.str(tile.icon_name);
+  out.str(tile.sensor_entity);
+  out.str(tile.sensor_unit);
+  out.str(tile.scene_alias);
+  out.str(tile.key_macro);
+  out.str(tile.type == TILE_IMAGE ? tile.image_path : String());
+}
+
+static void readTile(ConfigImageReader& in, Tile& tile) {
+  tile.type = static_cast<TileType>(in.u8());
+  tile.bg_color = in.u32();
+  tile.sensor_decimals = clampDecimals(in.u8());
+  tile.sensor_value_font = clampSensorValueFont(in.u8());
+  tile.key_code = in.u8();
+  tile.key_modifier = in.u8();
+  tile.image_slideshow_sec = clampImageSlideshowSeconds(in.u16());
+  tile.title = in.str();
+  tile.icon_name = in.str();
+  tile.sensor_entity = in.str();
+  tile.sensor_unit = in.str();
+  tile.scene_alias = in.str();
+  tile.key_macro = in.str();
+  tile.image_path = in.str();
+}
+
+void TileConfig::writeImage(ConfigImageWriter& out) const {
+  const TileGridConfig* grids[] = {&tab0_grid, &tab1_grid, &tab2_grid};
+  out.beginSection(CFG_SECTION_TILES, kImageSectionVersion);
+  out.u8(3);
+  for (const TileGridConfig* grid : grids) {
+    out.u8(TILES_PER_GRID);
+    for (size_t i = 0; i < TILES_PER_GRID; ++i) {
+      writeTile(out, grid->tiles[i]);
+    }
+  }
+  out.u8(4);
+  for (uint8_t i = 0; i < 4; ++i) {
+    out.str(tab_configs[i].name);
+    out.str(tab_configs[i].icon_name);
   }
+  out.endSection();
+}
 
-  return false;
+void TileConfig::readImage(ConfigImageReader& in) {
+  TileGridConfig* grids[] = {&tab0_grid, &tab1_grid, &tab2_grid};
+  const uint8_t grid_count = in.u8();
+  for (uint8_t g = 0; g < grid_count && in.ok(); ++g) {
+    const uint8_t tile_count = in.u8();
+    for (uint8_t i = 0; i < tile_count && in.ok(); ++i) {
+      Tile tile;
+      readTile(in, tile);
+      if (g < 3 && i < TILES_PER_GRID) grids[g]->tiles[i] = tile;
+    }
+  }
+  const uint8_t tab_count = in.u8();
+  for (uint8_t i = 0; i < tab_count && in.ok(); ++i) {
+    char name[sizeof(tab_configs[0].name)];
+    char icon[sizeof(tab_configs[0].icon_name)];
+    in.str(name, sizeof(name));
+    in.str(icon, sizeof(icon));
+    if (i >= 4) continue;
+    setTabName(i, name);
+    setTabIcon(i, icon);
+  }
 }
 
-bool TileConfig::saveSingleGrid(const char* grid_name, const TileGridConfig& grid) {
-  if (!grid_name || !*grid_name) {
+bool TileConfig::save(const TileGridConfig& tab0, const TileGridConfig& tab1, const TileGridConfig& tab2) {
+  TileGridConfig prev0 = tab0_grid;
+  TileGridConfig prev1 = tab1_grid;
+  TileGridConfig prev2 = tab2_grid;
+  tab0_grid = tab0;
+  tab1_grid = tab1;
+  tab2_grid = tab2;
+
+  if (!configStore.commit()) {
+    tab0_grid = prev0;
+    tab1_grid = prev1;
+    tab2_grid = prev2;
     return false;
   }
+  Serial.println("[TileConfig] Konfiguration gespeichert");
+  return true;
+}
 
-  bool ok = false;
-  if (strcmp(grid_name, "tab0") == 0) {
-    ok = saveGrid("tab0", grid);
-    if (ok) tab0_grid = grid;
-  } else if (strcmp(grid_name, "tab1") == 0) {
-    ok = saveGrid("tab1", grid);
-    if (ok) tab1_grid = grid;
-  } else if (strcmp(grid_name, "tab2") == 0) {
-    ok = saveGrid("tab2", grid);
-    if (ok) tab2_grid = grid;
-  } else {
+bool TileConfig::saveLayout(const TileGridConfig grids[3], const TabConfig tabs[4]) {
+  // Vorigen Stand auf dem Heap sichern (3 Grids sind fuer den Loop-Stack zu gross)
+  std::vector<TileGridConfig> prev = {tab0_grid, tab1_grid, tab2_grid};
+  TabConfig prev_tabs[4];
+  memcpy(prev_tabs, tab_configs, sizeof(tab_configs));
+
+  tab0_grid = grids[0];
+  tab1_grid = grids[1];
+  tab2_grid = grids[2];
+  memcpy(tab_configs, tabs, sizeof(tab_configs));
+
+  if (!configStore.commit()) {
+    tab0_grid = prev[0];
+    tab1_grid = prev[1];
+    tab2_grid = prev[2];
+    memcpy(tab_configs, prev_tabs, sizeof(tab_configs));
+    Serial.println("[TileConfig] Layout nicht gespeichert");
     return false;
   }
+  Serial.println("[TileConfig] Layout gespeichert (3 Grids + Tabs)");
+  return true;
+}
 
-  if (ok) {
-    Serial.printf("[TileConfig] Grid '%s' gespeichert (single)\n", grid_name);
+TileGridConfig* TileConfig::gridByName(const char* grid_name) {
+  if (!grid_name) return nullptr;
+  if (strcmp(grid_name, "tab0") == 0) return &tab0_grid;
+  if (strcmp(grid_name, "tab1") == 0) return &tab1_grid;
+  if (strcmp(grid_name, "tab2") == 0) return &tab2_grid;
+  return nullptr;
+}
+
+bool TileConfig::saveSingleGrid(const char* grid_name, const TileGridConfig& grid) {
+  TileGridConfig* target = gridByName(grid_name);
+  if (!target) {
+    return false;
   }
-  return ok;
+
+  // Web-Admin speichert bei jedem Tastendruck: nur RAM, Flash per Write-Behind
+  if (target != &grid) *target = grid;
+  configStore.markDirty();
+  return true;
 }
 
 bool TileConfig::loadGrid(const char* prefix, TileGridConfig& grid) {
@@ -557,7 +606,6 @@ bool TileConfig::loadGrid(const char* prefix, TileGridConfig& grid) {
           prefs.end();
           Serial.printf("[TileConfig] Grid '%s' geladen (blob v4)\n", prefix);
           applyImagePathsFromSd(prefix, grid);
-          saveGrid(prefix, grid);  // Migration auf neues Format
           return true;
         }
       }
@@ -572,7 +620,6 @@ bool TileConfig::loadGrid(const char* prefix, TileGridConfig& grid) {
           prefs.end();
           Serial.printf("[TileConfig] Grid '%s' geladen (blob v2)\n", prefix);
           applyImagePathsFromSd(prefix, grid);
-          saveGrid(prefix, grid);  // Migration auf neues Format
           return true;
         }
       }
@@ -587,7 +634,6 @@ bool TileConfig::loadGrid(const char* prefix, TileGridConfig& grid) {
           prefs.end();
           Serial.printf("[TileConfig] Grid '%s' geladen (blob v1)\n", prefix);
           applyImagePathsFromSd(prefix, grid);
-          saveGrid(prefix, grid);  // Migration auf neues Format
           return true;
         }
       }
@@ -600,55 +646,10 @@ bool TileConfig::loadGrid(const char* prefix, TileGridConfig& grid) {
   bool legacy_ok = loadGridLegacy(prefix, grid);
   if (legacy_ok) {
     applyImagePathsFromSd(prefix, grid);
-    saveGrid(prefix, grid);  // Migration: schreibt Blob
   }
   return legacy_ok;
 }
 
-bool TileConfig::saveGrid(const char* prefix, const TileGridConfig& grid) {
-  char blob_key[16];
-  if (!buildBlobKey(prefix, blob_key, sizeof(blob_key))) {
-    return false;
-  }
-
-  Preferences prefs;
-  if (!prefs.begin(PREF_NAMESPACE, false)) {
-    Serial.printf("[TileConfig] Fehler beim Öffnen von NVS namespace '%s'\n", PREF_NAMESPACE);
-    return false;
-  }
-
-  Serial.printf("[TileConfig] Versuche zu speichern: '%s' (key='%s', size=%u bytes)\n",
-                prefix, blob_key, static_cast<unsigned>(sizeof(PackedGrid)));
-
-  clearLegacyKeys(prefs, prefix);  // Alte Key/Value-EintrÃ¤ge freirÃ¤umen
-
-  PackedGrid packed{};
-  packed.version = PACKED_GRID_VERSION;
-  for (size_t i = 0; i < TILES_PER_GRID; ++i) {
-    if (grid.tiles[i].type == TILE_IMAGE) {
-      if (!sdReady()) {
-        Serial.println("[TileConfig] WARN: SD fehlt, image_path wird nicht gespeichert");
-      } else if (!writeImagePathSd(prefix, i, grid.tiles[i].image_path)) {
-        Serial.println("[TileConfig] WARN: image_path konnte nicht auf SD gespeichert werden");
-      }
-    }
-    packTile(grid.tiles[i], packed.tiles[i]);
-  }
-
-  size_t written = prefs.putBytes(blob_key, &packed, sizeof(packed));
-  prefs.end();
-
-  if (written != sizeof(packed)) {
-    Serial.printf("[TileConfig] Fehler beim Speichern von Grid '%s' (geschrieben: %u, erwartet: %u)\n",
-                  prefix, static_cast<unsigned>(written), static_cast<unsigned>(sizeof(packed)));
-    return false;
-  }
-
-  Serial.printf("[TileConfig] Grid '%s' gespeichert (blob, %u bytes)\n",
-                prefix, static_cast<unsigned>(written));
-  return true;
-}
-
 // ========== Tab Names (configurable via web interface) ==========
 
 const char* TileConfig::getTabName(uint8_t tab_index) const {
@@ -717,32 +718,6 @@ bool TileConfig::loadTabNames() {
 }
 
 bool TileConfig::saveTabNames() {
-  Preferences prefs;
-  if (!prefs.begin("tab5_config", false)) {  // Read-write
-    return false;
-  }
-
-  for (uint8_t i = 0; i < 4; i++) {
-    char key[16];
-
-    // Save tab name
-    snprintf(key, sizeof(key), "tab_name_%u", i);
-    if (tab_configs[i].name[0] != '\0') {
-      prefs.putString(key, tab_configs[i].name);
-    } else {
-      prefs.remove(key);  // Remove if empty (use default)
-    }
-
-    // Save tab icon
-    snprintf(key, sizeof(key), "tab_icon_%u", i);
-    if (tab_configs[i].icon_name[0] != '\0') {
-      prefs.putString(key, tab_configs[i].icon_name);
-    } else {
-      prefs.remove(key);  // Remove if empty (no icon)
-    }
-  }
-
-  prefs.end();
-  Serial.println("[TileConfig] Tab-Namen und Icons gespeichert");
+  configStore.markDirty();
   return true;
 }
@@ -3,6 +3,9 @@
 
 #include <Arduino.h>
 
+class ConfigImageWriter;
+class ConfigImageReader;
+
 static constexpr size_t TILES_PER_GRID = 12;
 
 enum TileType : uint8_t {
@@ -67,8 +70,21 @@ class TileConfig {
 public:
   TileConfig();
 
-  bool load();
+  // Altbestand (PackedGrid V1-V4 im NVS, Bildpfade unter /_tile_links auf SD)
+  // - nur noch fuer die Migration ins Config-Image
+  bool loadLegacy();
+  void clearLegacy();  // alte Grid-Blobs nach erfolgreicher Migration entfernen
+
+  // Config-Image (Sektion CFG_SECTION_TILES): Grids inkl. Bildpfad + Tab-Namen/Icons
+  void writeImage(ConfigImageWriter& out) const;
+  void readImage(ConfigImageReader& in);
+
   bool save(const TileGridConfig& tab0, const TileGridConfig& tab1, const TileGridConfig& tab2);
+  // Komplettes Layout (3 Grids + 4 Tab-Namen/Icons) in einem Schritt uebernehmen und
+  // sofort als ein Image speichern; bei Fehler bleibt der vorige Stand im RAM.
+  bool saveLayout(const TileGridConfig grids[3], const TabConfig tabs[4]);
+
+  // Einzelnes Grid (Web-Admin): RAM sofort, Flash verzoegert (ConfigStore::markDirty)
   bool saveSingleGrid(const char* grid_name, const TileGridConfig& grid);
 
   const TileGridConfig& getTab0Grid() const { return tab0_grid; }
@@ -87,8 +103,7 @@ public:
   const char* getTabIcon(uint8_t tab_index) const;
   void setTabIcon(uint8_t tab_index, const char* icon_name);
 
-  bool loadTabNames();
-  bool saveTabNames();
+  bool saveTabNames();  // Write-Behind wie saveSingleGrid
 
 private:
   TileGridConfig tab0_grid;
@@ -98,7 +113,8 @@ private:
   TabConfig tab_configs[4];  // [0]=Tab0, [1]=Tab1, [2]=Tab2, [3]=Tab3(Settings)
 
   bool loadGrid(const char* prefix, TileGridConfig& grid);
-  bool saveGrid(const char* prefix, const TileGridConfig& grid);
+  bool loadTabNames();
+  TileGridConfig* gridByName(const char* grid_name);
 };
 
 extern TileConfig tileConfig;
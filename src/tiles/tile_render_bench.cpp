@@ -0,0 +1,398 @@
+#include "src/tiles/tile_render_bench.h"
+#include "src/tiles/tile_renderer.h"
+#include "src/tiles/tile_card_cache.h"
+#include "src/core/display_manager.h"
+#include "src/ui/sensor_popup.h"
+#include "src/ui/light_popup.h"
+#include "src/ui/image_popup.h"
+#include <lvgl.h>
+#include <SD.h>
+#include "esp_heap_caps.h"
+
+/* === Layout wie tab_tiles_unified (Grid 3x4) === */
+static const int BENCH_GAP = 24;
+static const int BENCH_PAD = 24;
+static const char* kBenchDir = "/_bench";
+static const uint32_t kGoldenMagic = 0x35363547;  // "G565"
+
+static bool g_bench_pending = false;
+static bool g_bench_record = false;
+static String g_bench_image_path;
+static String g_bench_json = "{}";
+static lv_obj_t* g_bench_screen = nullptr;  // nie geladen: rendert nur per Snapshot
+
+struct BenchResult {
+  uint32_t build_us = 0;
+  uint32_t render_us = 0;
+  uint32_t render_warm_us = 0;
+  uint32_t objects = 0;
+  int32_t lv_mem_delta = 0;
+  int32_t heap_delta = 0;
+  int32_t psram_delta = 0;
+  int32_t diff_pixels = -1;
+  const char* golden = "none";
+};
+
+static uint32_t count_objects(lv_obj_t* obj) {
+  if (!obj) return 0;
+  uint32_t n = 1;
+  uint32_t cnt = lv_obj_get_child_count(obj);
+  for (uint32_t i = 0; i < cnt; ++i) {
+    n += count_objects(lv_obj_get_child(obj, i));
+  }
+  return n;
+}
+
+static size_t lv_mem_used() {
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  return mon.total_size - mon.free_size;
+}
+
+static lv_obj_t* create_bench_grid() {
+  lv_obj_t* grid = lv_obj_create(g_bench_screen);
+  lv_obj_set_size(grid, SCREEN_WIDTH, SCREEN_HEIGHT);
+  lv_obj_set_style_bg_color(grid, lv_color_hex(0x000000), 0);
+  lv_obj_set_style_bg_opa(grid, LV_OPA_COVER, 0);
+  lv_obj_set_style_border_width(grid, 0, 0);
+  lv_obj_set_style_radius(grid, 0, 0);
+  lv_obj_set_style_pad_all(grid, BENCH_PAD, 0);
+  lv_obj_set_style_pad_column(grid, BENCH_GAP, 0);
+  lv_obj_set_style_pad_row(grid, BENCH_GAP, 0);
+  lv_obj_remove_flag(grid, LV_OBJ_FLAG_SCROLLABLE);
+
+  static lv_coord_t col_dsc[] = {
+    LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST
+  };
+  static lv_coord_t row_dsc[] = {
+    LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST
+  };
+  lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
+  return grid;
+}
+
+/* === Repraesentative Tiles === */
+static Tile bench_tile(TileType type, uint8_t variant) {
+  Tile t;
+  t.type = type;
+  switch (type) {
+    case TILE_SENSOR:
+      t.title = variant ? "Luftfeuchte" : "Temperatur";
+      t.icon_name = variant ? "water-percent" : "thermometer";
+      t.sensor_entity = variant ? "sensor.bench_humidity" : "sensor.bench_temp";
+      t.sensor_unit = variant ? "%" : "\xC2\xB0" "C";
+      t.sensor_decimals = 1;
+      break;
+    case TILE_SCENE:
+      t.title = "Abend";
+      t.icon_name = "weather-night";
+      t.scene_alias = "bench_evening";
+      break;
+    case TILE_KEY:
+      t.title = "Mute";
+      t.icon_name = "volume-off";
+      t.key_code = 0x7F;
+      break;
+    case TILE_NAVIGATE:
+      t.title = "Tab 2";
+      t.icon_name = "arrow-right";
+      t.key_code = 1;
+      break;
+    case TILE_SWITCH:
+      t.title = variant ? "Steckdose" : "Licht";
+      t.icon_name = variant ? "power-socket-eu" : "lightbulb";
+      t.sensor_entity = variant ? "switch.bench" : "light.bench";
+      t.sensor_decimals = variant ? 1 : 0;  // 1 = Switch-Widget
+      break;
+    case TILE_IMAGE:
+      t.title = "Bilder";
+      t.icon_name = "image";
+      t.image_path = "/bench";
+      break;
+    default:
+      break;
+  }
+  return t;
+}
+
+/* === Golden-Images auf SD === */
+static String golden_path(const char* name) {
+  return String(kBenchDir) + "/" + name + ".g565";
+}
+
+static bool write_golden(const char* name, const lv_draw_buf_t* buf) {
+  if (!SD.exists(kBenchDir) && !SD.mkdir(kBenchDir)) return false;
+  String path = golden_path(name);
+  if (SD.exists(path)) SD.remove(path);
+  File f = SD.open(path, FILE_WRITE);
+  if (!f) return false;
+  const uint16_t w = buf->header.w;
+  const uint16_t h = buf->header.h;
+  f.write(reinterpret_cast<const uint8_t*>(&kGoldenMagic), sizeof(kGoldenMagic));
+  f.write(reinterpret_cast<const uint8_t*>(&w), sizeof(w));
+  f.write(reinterpret_cast<const uint8_t*>(&h), sizeof(h));
+  const size_t row_bytes = static_cast<size_t>(w) * 2;
+  bool ok = true;
+  for (uint16_t y = 0; y < h && ok; ++y) {
+    ok = f.write(buf->data + static_cast<size_t>(y) * buf->header.stride, row_bytes) == row_bytes;
+  }
+  f.close();
+  return ok;
+}
+
+// Anzahl abweichender Pixel; -1 wenn kein vergleichbares Golden-Image existiert
+static int32_t diff_golden(const char* name, const lv_draw_buf_t* buf) {
+  String path = golden_path(name);
+  if (!SD.exists(path)) return -1;
+  File f = SD.open(path, FILE_READ);
+  if (!f) return -1;
+  uint32_t magic = 0;
+  uint16_t w = 0;
+  uint16_t h = 0;
+  f.read(reinterpret_cast<uint8_t*>(&magic), sizeof(magic));
+  f.read(reinterpret_cast<uint8_t*>(&w), sizeof(w));
+  f.read(reinterpret_cast<uint8_t*>(&h), sizeof(h));
+  if (magic != kGoldenMagic || w != buf->header.w || h != buf->header.h) {
+    f.close();
+    return -1;
+  }
+  const size_t row_bytes = static_cast<size_t>(w) * 2;
+  uint16_t* row = static_cast<uint16_t*>(heap_caps_malloc(row_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  if (!row) {
+    f.close();
+    return -1;
+  }
+  int32_t diff = 0;
+  for (uint16_t y = 0; y < h; ++y) {
+    if (f.read(reinterpret_cast<uint8_t*>(row), row_bytes) != static_cast<int>(row_bytes)) {
+      diff = -1;
+      break;
+    }
+    const uint16_t* cur = reinterpret_cast<const uint16_t*>(buf->data + static_cast<size_t>(y) * buf->header.stride);
+    for (uint16_t x = 0; x < w; ++x) {
+      if (cur[x] != row[x]) diff++;
+    }
+  }
+  heap_caps_free(row);
+  f.close();
+  return diff;
+}
+
+static void compare_golden(const char* name, const lv_draw_buf_t* snap, BenchResult& r) {
+  if (SD.cardType() == CARD_NONE) return;
+  if (!g_bench_record) {
+    r.diff_pixels = diff_golden(name, snap);
+  }
+  if (r.diff_pixels < 0) {
+    r.golden = write_golden(name, snap) ? "recorded" : "write_failed";
+  } else {
+    r.golden = (r.diff_pixels == 0) ? "match" : "diff";
+  }
+}
+
+/* === Messung === */
+typedef lv_obj_t* (*bench_build_fn)(const void* arg);
+typedef void (*bench_cleanup_fn)(lv_obj_t* obj);
+
+static void run_scenario(const char* name, bench_build_fn build, bench_cleanup_fn cleanup,
+                         const void* arg, String& json, bool& first) {
+  BenchResult r;
+
+  const size_t mem_before = lv_mem_used();
+  const uint32_t heap_before = ESP.getFreeHeap();
+  const uint32_t psram_before = ESP.getFreePsram();
+
+  uint32_t t0 = micros();
+  lv_obj_t* obj = build(arg);
+  r.build_us = micros() - t0;
+  if (!obj) {
+    Serial.printf("[RenderBench] %s: Aufbau fehlgeschlagen\n", name);
+    return;
+  }
+
+  // Off-Screen rendern: Snapshot in eigenen Puffer, das Display bleibt unberuehrt
+  lv_obj_update_layout(obj);
+  lv_draw_buf_t* snap = lv_snapshot_create_draw_buf(obj, LV_COLOR_FORMAT_RGB565);
+  if (!snap) {
+    Serial.printf("[RenderBench] %s: kein Snapshot-Puffer\n", name);
+    cleanup(obj);
+    return;
+  }
+  t0 = micros();
+  lv_result_t res = lv_snapshot_take_to_draw_buf(obj, LV_COLOR_FORMAT_RGB565, snap);
+  r.render_us = micros() - t0;
+
+  t0 = micros();
+  if (res == LV_RESULT_OK) res = lv_snapshot_take_to_draw_buf(obj, LV_COLOR_FORMAT_RGB565, snap);
+  r.render_warm_us = micros() - t0;
+
+  r.objects = count_objects(obj);
+  r.lv_mem_delta = static_cast<int32_t>(lv_mem_used()) - static_cast<int32_t>(mem_before);
+  r.heap_delta = static_cast<int32_t>(heap_before) - static_cast<int32_t>(ESP.getFreeHeap());
+  r.psram_delta = static_cast<int32_t>(psram_before) - static_cast<int32_t>(ESP.getFreePsram());
+
+  if (res == LV_RESULT_OK) compare_golden(name, snap, r);
+  else r.golden = "snapshot_failed";
+  lv_draw_buf_destroy(snap);
+  cleanup(obj);
+
+  Serial.printf("[RenderBench] %-14s build %6lu us | render %6lu us (warm %6lu us) | %3lu obj | lv_mem %+ld B | golden %s (%ld)\n",
+                name, (unsigned long)r.build_us, (unsigned long)r.render_us,
+                (unsigned long)r.render_warm_us, (unsigned long)r.objects,
+                (long)r.lv_mem_delta, r.golden, (long)r.diff_pixels);
+
+  if (!first) json += ",";
+  first = false;
+  json += "{\"name\":\"";
+  json += name;
+  json += "\",\"build_us\":" + String(r.build_us);
+  json += ",\"render_us\":" + String(r.render_us);
+  json += ",\"render_warm_us\":" + String(r.render_warm_us);
+  json += ",\"objects\":" + String(r.objects);
+  json += ",\"lv_mem_delta\":" + String(r.lv_mem_delta);
+  json += ",\"heap_delta\":" + String(r.heap_delta);
+  json += ",\"psram_delta\":" + String(r.psram_delta);
+  json += ",\"golden\":\"";
+  json += r.golden;
+  json += "\",\"diff_pixels\":" + String(r.diff_pixels);
+  json += "}";
+}
+
+static lv_obj_t* build_single_tile(const void* arg) {
+  const Tile* tile = static_cast<const Tile*>(arg);
+  lv_obj_t* grid = create_bench_grid();
+  render_tile(grid, 0, 0, *tile, 0, GridType::BENCH, nullptr);
+  return grid;
+}
+
+static lv_obj_t* build_full_grid(const void*) {
+  static const TileType kMix[TILES_PER_GRID] = {
+    TILE_SENSOR, TILE_SENSOR, TILE_SWITCH,
+    TILE_SWITCH, TILE_SCENE, TILE_KEY,
+    TILE_NAVIGATE, TILE_IMAGE, TILE_SENSOR,
+    TILE_SCENE, TILE_SWITCH, TILE_EMPTY
+  };
+  lv_obj_t* grid = create_bench_grid();
+  for (uint8_t i = 0; i < TILES_PER_GRID; ++i) {
+    Tile tile = bench_tile(kMix[i], i & 1);
+    render_tile(grid, i % 3, i / 3, tile, i, GridType::BENCH, nullptr);
+  }
+  return grid;
+}
+
+static void cleanup_grid(lv_obj_t* grid) {
+  reset_sensor_widgets(GridType::BENCH);
+  reset_switch_widgets(GridType::BENCH);
+  lv_obj_delete(grid);
+}
+
+static lv_obj_t* build_sensor_popup(const void*) {
+  SensorPopupInit init;
+  init.entity_id = "sensor.bench_temp";
+  init.title = "Temperatur";
+  init.icon_name = "thermometer";
+  init.value = "21.5";
+  init.unit = "\xC2\xB0" "C";
+  show_sensor_popup(init);
+  return lv_layer_top();
+}
+
+static void cleanup_sensor_popup(lv_obj_t*) {
+  hide_sensor_popup();
+}
+
+static lv_obj_t* build_light_popup(const void*) {
+  LightPopupInit init;
+  init.entity_id = "light.bench";
+  init.title = "Licht";
+  init.icon_name = "lightbulb";
+  init.color = 0xFFB347;
+  init.brightness_pct = 60;
+  init.has_color = true;
+  init.has_brightness = true;
+  init.has_state = true;
+  init.supports_color = true;
+  init.supports_brightness = true;
+  show_light_popup(init);
+  return lv_layer_top();
+}
+
+static void cleanup_light_popup(lv_obj_t*) {
+  hide_light_popup();
+}
+
+static lv_obj_t* build_image_popup(const void* arg) {
+  const String* path = static_cast<const String*>(arg);
+  show_image_popup(path->c_str(), 0);
+  return lv_layer_top();
+}
+
+static void cleanup_image_popup(lv_obj_t*) {
+  hide_image_popup();
+}
+
+void tile_render_bench_request(bool record_golden, const String& image_path) {
+  g_bench_record = record_golden;
+  g_bench_image_path = image_path;
+  g_bench_pending = true;
+}
+
+bool tile_render_bench_is_pending() {
+  return g_bench_pending;
+}
+
+const String& tile_render_bench_last_json() {
+  return g_bench_json;
+}
+
+void tile_render_bench_process() {
+  if (!g_bench_pending) return;
+  g_bench_pending = false;
+  if (!displayManager.getDisplay()) return;
+
+  Serial.println("[RenderBench] Start");
+  const uint32_t start_ms = millis();
+  g_bench_screen = lv_obj_create(nullptr);
+  String json;
+  json.reserve(2048);
+  json = "{\"draw_units\":" + String(LV_DRAW_SW_DRAW_UNIT_CNT);
+  json += ",\"card_cache\":" + String(TILE_CARD_CACHE_ENABLED);
+  json += ",\"scenarios\":[";
+  bool first = true;
+
+  static const struct {
+    const char* name;
+    TileType type;
+    uint8_t variant;
+  } kTileScenarios[] = {
+    {"tile_sensor", TILE_SENSOR, 0},
+    {"tile_scene", TILE_SCENE, 0},
+    {"tile_key", TILE_KEY, 0},
+    {"tile_navigate", TILE_NAVIGATE, 0},
+    {"tile_light", TILE_SWITCH, 0},
+    {"tile_switch", TILE_SWITCH, 1},
+    {"tile_image", TILE_IMAGE, 0},
+    {"tile_empty", TILE_EMPTY, 0},
+  };
+  for (const auto& sc : kTileScenarios) {
+    Tile tile = bench_tile(sc.type, sc.variant);
+    run_scenario(sc.name, build_single_tile, cleanup_grid, &tile, json, first);
+  }
+  run_scenario("grid_full", build_full_grid, cleanup_grid, nullptr, json, first);
+  run_scenario("popup_sensor", build_sensor_popup, cleanup_sensor_popup, nullptr, json, first);
+  run_scenario("popup_light", build_light_popup, cleanup_light_popup, nullptr, json, first);
+  if (g_bench_image_path.length() > 0) {
+    run_scenario("popup_image", build_image_popup, cleanup_image_popup, &g_bench_image_path, json, first);
+  }
+
+  lv_obj_delete(g_bench_screen);
+  g_bench_screen = nullptr;
+
+  json += "],\"total_ms\":" + String(millis() - start_ms) + "}";
+  g_bench_json = json;
+
+  // Popups liefen auf lv_layer_top -> sichtbaren Screen einmal neu zeichnen
+  lv_obj_invalidate(lv_screen_active());
+  tile_card_cache_log_stats();
+  Serial.printf("[RenderBench] Fertig in %lu ms\n", (unsigned long)(millis() - start_ms));
+}
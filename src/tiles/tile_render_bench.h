@@ -0,0 +1,25 @@
+#ifndef TILE_RENDER_BENCH_H
+#define TILE_RENDER_BENCH_H
+
+#include <Arduino.h>
+
+// On-Device Render-Benchmark fuer alle Tile-Typen, volle Grids und Popups.
+// Misst pro Szenario Aufbau-/Renderzeit, Objektanzahl und Speicherverbrauch
+// und vergleicht einen Snapshot pixelweise mit einem Golden-Image auf SD
+// (/_bench/<szenario>.g565, wird beim ersten Lauf bzw. mit record=1 geschrieben).
+// Kacheln und Grids entstehen auf einem eigenen, nie geladenen Screen mit eigenen
+// Widget-Slots (GridType::BENCH) und werden per Snapshot gerendert; die Tabs
+// bleiben unberuehrt. Popups laufen ueber ihre normalen Instanzen auf lv_layer_top.
+
+// Lauf anfordern (Web-Handler); ausgefuehrt wird im Main Loop
+void tile_render_bench_request(bool record_golden, const String& image_path);
+
+// Im Main Loop unter LvglLock aufrufen
+void tile_render_bench_process();
+
+bool tile_render_bench_is_pending();
+
+// Ergebnis des letzten Laufs als JSON ("{}" wenn noch keiner gelaufen ist)
+const String& tile_render_bench_last_json();
+
+#endif // TILE_RENDER_BENCH_H
@@ -1,20 +1,26 @@
 #include "src/tiles/tile_renderer.h"
 #include "src/network/ha_bridge_config.h"
+#include "src/network/entity_table.h"
+#include "src/network/entity_snapshot.h"
 #include "src/network/mqtt_handlers.h"
 #include "src/game/game_ws_server.h"
 #include "src/tiles/tile_config.h"
 #include "src/tiles/mdi_icons.h"
+#include "src/tiles/tile_card_cache.h"
+#include "src/tiles/tile_thumb.h"
 #include "src/ui/ui_manager.h"
 #include "src/ui/light_popup.h"
 #include "src/ui/sensor_popup.h"
 #include "src/ui/image_popup.h"
 #include "src/fonts/ui_fonts.h"
+#include "src/core/metrics.h"
 #include <Arduino.h>
 #include <math.h>
 #include <stdlib.h>
 
 /* === Layout-Konstanten === */
 static const int CARD_H = 150;
+static const int CARD_RADIUS = 22;
 
 /* === Fonts === */
 #define FONT_TITLE (&ui_font_24)
@@ -29,6 +35,9 @@ static const int CARD_H = 150;
 
 #define FONT_UNIT (&ui_font_24)
 
+// Werte aus dem Boot-Snapshot (noch nicht per MQTT bestaetigt)
+#define STALE_OPA LV_OPA_50
+
 /* === Globale State für Updates === */
 struct SensorTileWidgets {
   lv_obj_t* value_label = nullptr;
@@ -49,33 +58,58 @@ static SwitchTileWidgets g_tab0_switches[TILES_PER_GRID];
 static SwitchTileWidgets g_tab1_switches[TILES_PER_GRID];
 static SwitchTileWidgets g_tab2_switches[TILES_PER_GRID];
 
-struct SwitchState {
-  bool has_state = false;
-  bool is_on = false;
-  bool has_color = false;
-  uint32_t color = 0;
-  bool has_hs = false;
-  float hs_h = 0.0f;
-  float hs_s = 0.0f;
-  bool has_brightness = false;
-  uint8_t brightness_pct = 100;
-  bool supports_color = false;
-  bool supports_brightness = false;
-  bool supported_modes_known = false;
-  bool supported_onoff_only = false;
-};
-
 static SwitchState g_tab0_switch_states[TILES_PER_GRID];
 static SwitchState g_tab1_switch_states[TILES_PER_GRID];
 static SwitchState g_tab2_switch_states[TILES_PER_GRID];
 
+// Render-Benchmark: eigene Slots, damit die echten Tabs unberuehrt bleiben
+static SensorTileWidgets g_bench_sensors[TILES_PER_GRID];
+static SwitchTileWidgets g_bench_switches[TILES_PER_GRID];
+static SwitchState g_bench_switch_states[TILES_PER_GRID];
+
+static SensorTileWidgets* get_sensor_widget_array(GridType grid_type) {
+  switch (grid_type) {
+    case GridType::TAB1: return g_tab1_sensors;
+    case GridType::TAB2: return g_tab2_sensors;
+    case GridType::BENCH: return g_bench_sensors;
+    default: return g_tab0_sensors;
+  }
+}
+
+static SwitchTileWidgets* get_switch_widget_array(GridType grid_type) {
+  switch (grid_type) {
+    case GridType::TAB1: return g_tab1_switches;
+    case GridType::TAB2: return g_tab2_switches;
+    case GridType::BENCH: return g_bench_switches;
+    default: return g_tab0_switches;
+  }
+}
+
+static SwitchState* get_switch_state_array(GridType grid_type) {
+  switch (grid_type) {
+    case GridType::TAB1: return g_tab1_switch_states;
+    case GridType::TAB2: return g_tab2_switch_states;
+    case GridType::BENCH: return g_bench_switch_states;
+    default: return g_tab0_switch_states;
+  }
+}
+
+// Bench-Kacheln haben keine gespeicherte Konfiguration -> leeres Grid
+static const TileGridConfig& get_grid_config(GridType grid_type) {
+  static const TileGridConfig kNoConfig;
+  switch (grid_type) {
+    case GridType::TAB1: return tileConfig.getTab1Grid();
+    case GridType::TAB2: return tileConfig.getTab2Grid();
+    case GridType::BENCH: return kNoConfig;
+    default: return tileConfig.getTab0Grid();
+  }
+}
+
 static void set_label_style(lv_obj_t* lbl, lv_color_t c, const lv_font_t* f);
 static bool is_light_entity_id(const String& entity_id);
 
 static void clear_sensor_widgets(GridType grid_type) {
-  SensorTileWidgets* target = g_tab0_sensors;
-  if (grid_type == GridType::TAB1) target = g_tab1_sensors;
-  else if (grid_type == GridType::TAB2) target = g_tab2_sensors;
+  SensorTileWidgets* target = get_sensor_widget_array(grid_type);
   for (size_t i = 0; i < TILES_PER_GRID; ++i) {
     target[i].value_label = nullptr;
     target[i].unit_label = nullptr;
@@ -84,10 +118,7 @@ static void clear_sensor_widgets(GridType grid_type) {
 
 void reset_sensor_widget(GridType grid_type, uint8_t grid_index) {
   if (grid_index >= TILES_PER_GRID) return;
-  SensorTileWidgets* target = g_tab0_sensors;
-  if (grid_type == GridType::TAB1) target = g_tab1_sensors;
-  else if (grid_type == GridType::TAB2) target = g_tab2_sensors;
-  target[grid_index] = {};
+  get_sensor_widget_array(grid_type)[grid_index] = {};
 }
 
 void reset_sensor_widgets(GridType grid_type) {
@@ -95,15 +126,8 @@ void reset_sensor_widgets(GridType grid_type) {
 }
 
 static void clear_switch_widgets(GridType grid_type) {
-  SwitchTileWidgets* target = g_tab0_switches;
-  SwitchState* state_target = g_tab0_switch_states;
-  if (grid_type == GridType::TAB1) {
-    target = g_tab1_switches;
-    state_target = g_tab1_switch_states;
-  } else if (grid_type == GridType::TAB2) {
-    target = g_tab2_switches;
-    state_target = g_tab2_switch_states;
-  }
+  SwitchTileWidgets* target = get_switch_widget_array(grid_type);
+  SwitchState* state_target = get_switch_state_array(grid_type);
   for (size_t i = 0; i < TILES_PER_GRID; ++i) {
     target[i].icon_label = nullptr;
     target[i].title_label = nullptr;
@@ -114,15 +138,8 @@ static void clear_switch_widgets(GridType grid_type) {
 
 void reset_switch_widget(GridType grid_type, uint8_t grid_index) {
   if (grid_index >= TILES_PER_GRID) return;
-  SwitchTileWidgets* target = g_tab0_switches;
-  SwitchState* state_target = g_tab0_switch_states;
-  if (grid_type == GridType::TAB1) {
-    target = g_tab1_switches;
-    state_target = g_tab1_switch_states;
-  } else if (grid_type == GridType::TAB2) {
-    target = g_tab2_switches;
-    state_target = g_tab2_switch_states;
-  }
+  SwitchTileWidgets* target = get_switch_widget_array(grid_type);
+  SwitchState* state_target = get_switch_state_array(grid_type);
   target[grid_index] = {};
   state_target[grid_index] = {};
 }
@@ -137,6 +154,7 @@ struct SensorUpdate {
   uint8_t grid_index;
   String value;
   String unit;
+  bool stale;
   bool valid;
 };
 
@@ -145,12 +163,16 @@ static SensorUpdate g_update_queue[QUEUE_SIZE];
 static volatile uint8_t g_queue_head = 0;
 static volatile uint8_t g_queue_tail = 0;
 static uint32_t g_queue_overflow_count = 0;
+static MetricCallback g_queue_overflow_metric("tab5_tile_queue_overflows_total", "Verworfene Kachel-Updates (Queue voll)",
+                                              MetricType::Counter, []() -> double { return g_queue_overflow_count; },
+                                              "queue=\"sensor\"");
+static MetricCallback g_queue_depth_metric("tab5_tile_queue_depth", "Wartende Kachel-Updates", MetricType::Gauge,
+                                           []() -> double { return (uint8_t)(g_queue_head - g_queue_tail + QUEUE_SIZE) % QUEUE_SIZE; },
+                                           "queue=\"sensor\"");
 
 static uint8_t get_sensor_decimals(GridType grid_type, uint8_t grid_index) {
   if (grid_index >= TILES_PER_GRID) return 0xFF;
-  const TileGridConfig& grid = (grid_type == GridType::TAB1)
-                                 ? tileConfig.getTab1Grid()
-                                 : (grid_type == GridType::TAB2 ? tileConfig.getTab2Grid() : tileConfig.getTab0Grid());
+  const TileGridConfig& grid = get_grid_config(grid_type);
   return grid.tiles[grid_index].sensor_decimals;
 }
 
@@ -179,7 +201,8 @@ static bool apply_decimals(String& value, uint8_t decimals) {
 }
 
 // MQTT Callback ruft das auf (thread-safe!)
-void queue_sensor_tile_update(GridType grid_type, uint8_t grid_index, const char* value, const char* unit) {
+void queue_sensor_tile_update(GridType grid_type, uint8_t grid_index, const char* value, const char* unit,
+                              bool stale) {
   if (grid_index >= TILES_PER_GRID || !value) {
     return;
   }
@@ -193,6 +216,7 @@ void queue_sensor_tile_update(GridType grid_type, uint8_t grid_index, const char
         pending.grid_index == grid_index) {
       pending.value = String(value);
       pending.unit = unit ? String(unit) : "";
+      pending.stale = stale;
       return;
     }
     idx = (idx + 1) % QUEUE_SIZE;
@@ -212,6 +236,7 @@ void queue_sensor_tile_update(GridType grid_type, uint8_t grid_index, const char
   g_update_queue[g_queue_head].grid_index = grid_index;
   g_update_queue[g_queue_head].value = String(value);
   g_update_queue[g_queue_head].unit = unit ? String(unit) : "";
+  g_update_queue[g_queue_head].stale = stale;
   g_update_queue[g_queue_head].valid = true;
 
   g_queue_head = next_head;
@@ -224,7 +249,7 @@ void process_sensor_update_queue() {
 
     if (upd.valid) {
       update_sensor_tile_value(upd.grid_type, upd.grid_index, upd.value.c_str(),
-                              upd.unit.length() > 0 ? upd.unit.c_str() : nullptr);
+                              upd.unit.length() > 0 ? upd.unit.c_str() : nullptr, upd.stale);
       upd.valid = false;
     }
 
@@ -236,7 +261,8 @@ void process_sensor_update_queue() {
 struct SwitchUpdate {
   GridType grid_type;
   uint8_t grid_index;
-  String payload;
+  SwitchState state;  // bereits geparst (entity_state_update)
+  bool stale;
   bool valid;
 };
 
@@ -245,203 +271,12 @@ static SwitchUpdate g_switch_queue[SWITCH_QUEUE_SIZE];
 static volatile uint8_t g_switch_head = 0;
 static volatile uint8_t g_switch_tail = 0;
 static uint32_t g_switch_overflow_count = 0;
-
-static uint32_t clamp_rgb(int r, int g, int b) {
-  auto clamp = [](int v) { return v < 0 ? 0 : (v > 255 ? 255 : v); };
-  return (static_cast<uint32_t>(clamp(r)) << 16) |
-         (static_cast<uint32_t>(clamp(g)) << 8) |
-         static_cast<uint32_t>(clamp(b));
-}
-
-static bool parse_on_off(const String& text, bool& is_on) {
-  String lower = text;
-  lower.trim();
-  lower.toLowerCase();
-  if (lower == "on" || lower == "true" || lower == "1" || lower == "yes") {
-    is_on = true;
-    return true;
-  }
-  if (lower == "off" || lower == "false" || lower == "0" || lower == "no") {
-    is_on = false;
-    return true;
-  }
-  return false;
-}
-
-static bool parse_hex_color(const String& text, uint32_t& color) {
-  String t = text;
-  t.trim();
-  if (t.startsWith("#")) t.remove(0, 1);
-  if (t.startsWith("0x") || t.startsWith("0X")) t.remove(0, 2);
-  if (t.length() != 6) return false;
-  char* end = nullptr;
-  long val = strtol(t.c_str(), &end, 16);
-  if (!end || end == t.c_str() || *end != '\0') return false;
-  color = static_cast<uint32_t>(val) & 0xFFFFFF;
-  return true;
-}
-
-static bool parse_rgb_list(const String& list, int& r, int& g, int& b) {
-  const char* ptr = list.c_str();
-  char* end = nullptr;
-  long vals[3];
-  for (int i = 0; i < 3; ++i) {
-    while (*ptr && (*ptr == ' ' || *ptr == ',')) ++ptr;
-    if (!*ptr) return false;
-    vals[i] = strtol(ptr, &end, 10);
-    if (!end || end == ptr) return false;
-    ptr = end;
-  }
-  r = static_cast<int>(vals[0]);
-  g = static_cast<int>(vals[1]);
-  b = static_cast<int>(vals[2]);
-  return true;
-}
-
-static bool parse_hs_list(const String& list, float& h, float& s) {
-  const char* ptr = list.c_str();
-  char* end = nullptr;
-  float vals[2];
-  for (int i = 0; i < 2; ++i) {
-    while (*ptr && (*ptr == ' ' || *ptr == ',')) ++ptr;
-    if (!*ptr) return false;
-    vals[i] = strtof(ptr, &end);
-    if (!end || end == ptr) return false;
-    ptr = end;
-  }
-  h = vals[0];
-  s = vals[1];
-  return true;
-}
-
-static uint32_t hs_to_rgb(float h, float s) {
-  float hh = fmodf(h, 360.0f);
-  if (hh < 0) hh += 360.0f;
-  float sat = s / 100.0f;
-  float c = sat;
-  float x = c * (1.0f - fabsf(fmodf(hh / 60.0f, 2.0f) - 1.0f));
-  float m = 1.0f - c;
-  float r1 = 0, g1 = 0, b1 = 0;
-  if (hh < 60.0f) { r1 = c; g1 = x; b1 = 0; }
-  else if (hh < 120.0f) { r1 = x; g1 = c; b1 = 0; }
-  else if (hh < 180.0f) { r1 = 0; g1 = c; b1 = x; }
-  else if (hh < 240.0f) { r1 = 0; g1 = x; b1 = c; }
-  else if (hh < 300.0f) { r1 = x; g1 = 0; b1 = c; }
-  else { r1 = c; g1 = 0; b1 = x; }
-  int r = static_cast<int>((r1 + m) * 255.0f);
-  int g = static_cast<int>((g1 + m) * 255.0f);
-  int b = static_cast<int>((b1 + m) * 255.0f);
-  return clamp_rgb(r, g, b);
-}
-
-static bool extract_json_string_field(const String& src, const char* key, String& out) {
-  if (!key || !*key) return false;
-  String pattern = String("\"") + key + "\"";
-  int idx = src.indexOf(pattern);
-  if (idx < 0) return false;
-  int colon = src.indexOf(':', idx);
-  if (colon < 0) return false;
-  int q1 = src.indexOf('"', colon);
-  if (q1 < 0) return false;
-  int q2 = src.indexOf('"', q1 + 1);
-  if (q2 < 0) return false;
-  out = src.substring(q1 + 1, q2);
-  out.trim();
-  return out.length() > 0;
-}
-
-static bool extract_json_array_field(const String& src, const char* key, String& out) {
-  if (!key || !*key) return false;
-  String pattern = String("\"") + key + "\"";
-  int idx = src.indexOf(pattern);
-  if (idx < 0) return false;
-  int start = src.indexOf('[', idx);
-  int end = src.indexOf(']', start);
-  if (start < 0 || end < start) return false;
-  out = src.substring(start + 1, end);
-  out.trim();
-  return out.length() > 0;
-}
-
-static bool extract_json_number_field(const String& src, const char* key, float& out) {
-  if (!key || !*key) return false;
-  String pattern = String("\"") + key + "\"";
-  int idx = src.indexOf(pattern);
-  if (idx < 0) return false;
-  int colon = src.indexOf(':', idx);
-  if (colon < 0) return false;
-  int pos = colon + 1;
-  while (pos < src.length() && (src.charAt(pos) == ' ' || src.charAt(pos) == '\t')) {
-    ++pos;
-  }
-  if (pos >= src.length()) return false;
-  const char* start = src.c_str() + pos;
-  char* end = nullptr;
-  float val = strtof(start, &end);
-  if (!end || end == start) return false;
-  out = val;
-  return true;
-}
-
-static bool extract_json_object_field(const String& src, const char* key, String& out) {
-  if (!key || !*key) return false;
-  String pattern = "\"";
-  pattern += key;
-  pattern += "\"";
-  int idx = src.indexOf(pattern);
-  if (idx < 0) return false;
-  int colon = src.indexOf(':', idx);
-  if (colon < 0) return false;
-  int pos = colon + 1;
-  while (pos < src.length() && (src.charAt(pos) == ' ' || src.charAt(pos) == '\t')) {
-    ++pos;
-  }
-  if (pos >= src.length() || src.charAt(pos) != '{') return false;
-  int depth = 0;
-  bool in_string = false;
-  for (int i = pos; i < src.length(); ++i) {
-    char c = src.charAt(i);
-    if (c == '"' && (i == 0 || src.charAt(i - 1) != '\\')) {
-      in_string = !in_string;
-    }
-    if (in_string) continue;
-    if (c == '{') {
-      ++depth;
-    } else if (c == '}') {
-      --depth;
-      if (depth == 0) {
-        out = src.substring(pos, i + 1);
-        return true;
-      }
-    }
-  }
-  return false;
-}
-
-static bool list_contains_mode(String list, const char* mode) {
-  if (!mode || !*mode) return false;
-  list.toLowerCase();
-  list.replace("\"", "");
-  int start = 0;
-  while (start < list.length()) {
-    int comma = list.indexOf(',', start);
-    if (comma < 0) comma = list.length();
-    String token = list.substring(start, comma);
-    token.trim();
-    if (token == mode) return true;
-    start = comma + 1;
-  }
-  return false;
-}
-
-static bool is_color_mode(const String& mode) {
-  return mode == "hs" ||
-         mode == "rgb" ||
-         mode == "xy" ||
-         mode == "rgbw" ||
-         mode == "rgbww" ||
-         mode == "color_temp";
-}
+static MetricCallback g_switch_overflow_metric("tab5_tile_queue_overflows_total", "Verworfene Kachel-Updates (Queue voll)",
+                                               MetricType::Counter, []() -> double { return g_switch_overflow_count; },
+                                               "queue=\"switch\"");
+static MetricCallback g_switch_depth_metric("tab5_tile_queue_depth", "Wartende Kachel-Updates", MetricType::Gauge,
+                                            []() -> double { return (uint8_t)(g_switch_head - g_switch_tail + SWITCH_QUEUE_SIZE) % SWITCH_QUEUE_SIZE; },
+                                            "queue=\"switch\"");
 
 static LightPopupInit build_popup_init_from_state(const Tile& tile, const SwitchState& state) {
   LightPopupInit init;
@@ -486,247 +321,13 @@ static LightPopupInit build_popup_init_from_state(const Tile& tile, const Switch
   return init;
 }
 
-static SwitchState parse_switch_payload(const char* payload) {
-  SwitchState out;
-  if (!payload) return out;
-  String text = payload;
-  text.trim();
-  if (!text.length()) return out;
-
-  if (text.startsWith("{")) {
-    String state;
-    if (extract_json_string_field(text, "state", state)) {
-      out.has_state = parse_on_off(state, out.is_on);
-    }
-
-    String supported_modes;
-    if (extract_json_array_field(text, "supported_color_modes", supported_modes)) {
-      out.supported_modes_known = true;
-      bool has_brightness = list_contains_mode(supported_modes, "brightness");
-      bool has_color = list_contains_mode(supported_modes, "hs") ||
-                       list_contains_mode(supported_modes, "rgb") ||
-                       list_contains_mode(supported_modes, "xy") ||
-                       list_contains_mode(supported_modes, "rgbw") ||
-                       list_contains_mode(supported_modes, "rgbww") ||
-                       list_contains_mode(supported_modes, "color_temp");
-      bool has_onoff = list_contains_mode(supported_modes, "onoff");
-      out.supports_brightness = has_brightness;
-      out.supports_color = has_color;
-      out.supported_onoff_only = has_onoff && !has_brightness && !has_color;
-    }
-
-    String color_mode;
-    if (extract_json_string_field(text, "color_mode", color_mode)) {
-      String mode = color_mode;
-      mode.toLowerCase();
-      if (mode == "brightness") {
-        out.supports_brightness = true;
-        out.supported_onoff_only = false;
-      }
-      if (is_color_mode(mode)) {
-        out.supports_color = true;
-        out.supported_onoff_only = false;
-      }
-      if (mode == "onoff" && !out.supported_modes_known) {
-        out.supported_modes_known = true;
-        out.supported_onoff_only = true;
-      }
-    }
-
-    float bright_pct = -1.0f;
-    float bright_raw = -1.0f;
-    if (extract_json_number_field(text, "brightness_pct", bright_pct)) {
-      int pct = static_cast<int>(roundf(bright_pct));
-      if (pct < 0) pct = 0;
-      if (pct > 100) pct = 100;
-      out.has_brightness = true;
-      out.brightness_pct = static_cast<uint8_t>(pct);
-    } else if (extract_json_number_field(text, "brightness", bright_raw)) {
-      int pct = static_cast<int>(roundf((bright_raw / 255.0f) * 100.0f));
-      if (pct < 0) pct = 0;
-      if (pct > 100) pct = 100;
-      out.has_brightness = true;
-      out.brightness_pct = static_cast<uint8_t>(pct);
-    }
-
-    String color_text;
-    if (extract_json_string_field(text, "color", color_text)) {
-      uint32_t color = 0;
-      if (parse_hex_color(color_text, color)) {
-        out.has_color = true;
-        out.color = color;
-      }
-    }
-
-    if (!out.has_color) {
-      String rgb_list;
-      if (extract_json_array_field(text, "rgb_color", rgb_list)) {
-        int r = 0, g = 0, b = 0;
-        if (parse_rgb_list(rgb_list, r, g, b)) {
-          out.has_color = true;
-          out.color = clamp_rgb(r, g, b);
-        }
-      }
-    }
-
-    {
-      String hs_list;
-      if (extract_json_array_field(text, "hs_color", hs_list)) {
-        float h = 0.0f, s = 0.0f;
-        if (parse_hs_list(hs_list, h, s)) {
-          out.has_hs = true;
-          out.hs_h = h;
-          out.hs_s = s;
-          out.has_color = true;
-          out.color = hs_to_rgb(h, s);
-        }
-      }
-    }
-
-    String attributes;
-    if (extract_json_object_field(text, "attributes", attributes)) {
-      if (extract_json_array_field(attributes, "supported_color_modes", supported_modes)) {
-        out.supported_modes_known = true;
-        bool has_brightness = list_contains_mode(supported_modes, "brightness");
-        bool has_color = list_contains_mode(supported_modes, "hs") ||
-                         list_contains_mode(supported_modes, "rgb") ||
-                         list_contains_mode(supported_modes, "xy") ||
-                         list_contains_mode(supported_modes, "rgbw") ||
-                         list_contains_mode(supported_modes, "rgbww") ||
-                         list_contains_mode(supported_modes, "color_temp");
-        bool has_onoff = list_contains_mode(supported_modes, "onoff");
-        out.supports_brightness = has_brightness;
-        out.supports_color = has_color;
-        out.supported_onoff_only = has_onoff && !has_brightness && !has_color;
-      }
-
-      if (extract_json_string_field(attributes, "color_mode", color_mode)) {
-        String mode = color_mode;
-        mode.toLowerCase();
-        if (mode == "brightness") {
-          out.supports_brightness = true;
-          out.supported_onoff_only = false;
-        }
-        if (is_color_mode(mode)) {
-          out.supports_color = true;
-          out.supported_onoff_only = false;
-        }
-        if (mode == "onoff" && !out.supported_modes_known) {
-          out.supported_modes_known = true;
-          out.supported_onoff_only = true;
-        }
-      }
-
-      if (!out.has_brightness && extract_json_number_field(attributes, "brightness_pct", bright_pct)) {
-        int pct = static_cast<int>(roundf(bright_pct));
-        if (pct < 0) pct = 0;
-        if (pct > 100) pct = 100;
-        out.has_brightness = true;
-        out.brightness_pct = static_cast<uint8_t>(pct);
-      } else if (!out.has_brightness && extract_json_number_field(attributes, "brightness", bright_raw)) {
-        int pct = static_cast<int>(roundf((bright_raw / 255.0f) * 100.0f));
-        if (pct < 0) pct = 0;
-        if (pct > 100) pct = 100;
-        out.has_brightness = true;
-        out.brightness_pct = static_cast<uint8_t>(pct);
-      }
-
-      if (!out.has_color) {
-        if (extract_json_string_field(attributes, "color", color_text)) {
-          uint32_t color = 0;
-          if (parse_hex_color(color_text, color)) {
-            out.has_color = true;
-            out.color = color;
-          }
-        }
-      }
-
-      if (!out.has_color) {
-        String rgb_list;
-        if (extract_json_array_field(attributes, "rgb_color", rgb_list)) {
-          int r = 0, g = 0, b = 0;
-          if (parse_rgb_list(rgb_list, r, g, b)) {
-            out.has_color = true;
-            out.color = clamp_rgb(r, g, b);
-          }
-        }
-      }
-
-      {
-        String hs_list;
-        if (extract_json_array_field(attributes, "hs_color", hs_list)) {
-          float h = 0.0f, s = 0.0f;
-          if (parse_hs_list(hs_list, h, s)) {
-            out.has_hs = true;
-            out.hs_h = h;
-            out.hs_s = s;
-            out.has_color = true;
-            out.color = hs_to_rgb(h, s);
-          }
-        }
-      }
-    }
-  }
-
-  if (!out.has_state) {
-    out.has_state = parse_on_off(text, out.is_on);
-  }
-
-  if (!out.has_color) {
-    uint32_t color = 0;
-    if (parse_hex_color(text, color)) {
-      out.has_color = true;
-      out.color = color;
-    } else if (text.startsWith("rgb(") && text.endsWith(")")) {
-      String list = text.substring(4, text.length() - 1);
-      int r = 0, g = 0, b = 0;
-      if (parse_rgb_list(list, r, g, b)) {
-        out.has_color = true;
-        out.color = clamp_rgb(r, g, b);
-      }
-    }
-  }
-
-  if (!out.has_state && out.has_color) {
-    out.has_state = true;
-    out.is_on = true;
-  }
-  if (!out.has_state && out.has_brightness) {
-    out.has_state = true;
-    out.is_on = out.brightness_pct > 0;
-  }
-
-  if (out.has_color) {
-    out.supports_color = true;
-  }
-  if (out.has_hs) {
-    out.supports_color = true;
-  }
-  if (out.has_brightness) {
-    out.supports_brightness = true;
-    out.supported_onoff_only = false;
-  }
-  if (out.supports_color) {
-    out.supports_brightness = true;
-    out.supported_onoff_only = false;
-  }
-
-  return out;
-}
-
-static void update_switch_tile_state(GridType grid_type, uint8_t grid_index, const char* payload) {
-  if (grid_index >= TILES_PER_GRID || !payload) return;
-  SwitchTileWidgets* target = g_tab0_switches;
-  SwitchState* state_target = g_tab0_switch_states;
-  if (grid_type == GridType::TAB1) {
-    target = g_tab1_switches;
-    state_target = g_tab1_switch_states;
-  } else if (grid_type == GridType::TAB2) {
-    target = g_tab2_switches;
-    state_target = g_tab2_switch_states;
-  }
+static void update_switch_tile_state(GridType grid_type, uint8_t grid_index, const SwitchState& parsed,
+                                     bool stale) {
+  if (grid_index >= TILES_PER_GRID) return;
+  SwitchTileWidgets* target = get_switch_widget_array(grid_type);
+  SwitchState* state_target = get_switch_state_array(grid_type);
 
-  SwitchState state = parse_switch_payload(payload);
+  SwitchState state = parsed;
   if (!state.has_state &&
       !state.has_color &&
       !state.has_brightness &&
@@ -759,9 +360,7 @@ static void update_switch_tile_state(GridType grid_type, uint8_t grid_index, con
     state.color = prev.color;
   }
 
-  const TileGridConfig& grid = (grid_type == GridType::TAB1)
-                                 ? tileConfig.getTab1Grid()
-                                 : (grid_type == GridType::TAB2 ? tileConfig.getTab2Grid() : tileConfig.getTab0Grid());
+  const TileGridConfig& grid = get_grid_config(grid_type);
   const Tile& tile = grid.tiles[grid_index];
   const String& entity_id = tile.sensor_entity;
   const bool is_light_entity = is_light_entity_id(entity_id);
@@ -791,10 +390,13 @@ static void update_switch_tile_state(GridType grid_type, uint8_t grid_index, con
   }
 
   lv_color_t lv_color = lv_color_hex(icon_color);
+  const lv_opa_t opa = stale ? STALE_OPA : LV_OPA_COVER;
   if (widgets.icon_label) {
     lv_obj_set_style_text_color(widgets.icon_label, lv_color, 0);
+    lv_obj_set_style_opa(widgets.icon_label, opa, 0);
   } else if (widgets.title_label) {
     lv_obj_set_style_text_color(widgets.title_label, lv_color, 0);
+    lv_obj_set_style_opa(widgets.title_label, opa, 0);
   }
 
   if (widgets.switch_obj) {
@@ -805,11 +407,13 @@ static void update_switch_tile_state(GridType grid_type, uint8_t grid_index, con
     }
     lv_obj_set_style_bg_color(widgets.switch_obj, lv_color_hex(kIconOff), LV_PART_INDICATOR | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(widgets.switch_obj, lv_color_hex(icon_color), LV_PART_INDICATOR | LV_STATE_CHECKED);
+    lv_obj_set_style_opa(widgets.switch_obj, opa, 0);
   }
+  entity_snapshot_note_value(stale);
 }
 
-void queue_switch_tile_update(GridType grid_type, uint8_t grid_index, const char* payload) {
-  if (grid_index >= TILES_PER_GRID || !payload) {
+void queue_switch_tile_state(GridType grid_type, uint8_t grid_index, const SwitchState& state, bool stale) {
+  if (grid_index >= TILES_PER_GRID) {
     return;
   }
 
@@ -819,7 +423,8 @@ void queue_switch_tile_update(GridType grid_type, uint8_t grid_index, const char
     if (pending.valid &&
         pending.grid_type == grid_type &&
         pending.grid_index == grid_index) {
-      pending.payload = String(payload);
+      pending.state = state;
+      pending.stale = stale;
       return;
     }
     idx = (idx + 1) % SWITCH_QUEUE_SIZE;
@@ -835,7 +440,8 @@ void queue_switch_tile_update(GridType grid_type, uint8_t grid_index, const char
 
   g_switch_queue[g_switch_head].grid_type = grid_type;
   g_switch_queue[g_switch_head].grid_index = grid_index;
-  g_switch_queue[g_switch_head].payload = String(payload);
+  g_switch_queue[g_switch_head].state = state;
+  g_switch_queue[g_switch_head].stale = stale;
   g_switch_queue[g_switch_head].valid = true;
   g_switch_head = next_head;
 }
@@ -844,7 +450,7 @@ void process_switch_update_queue() {
   while (g_switch_tail != g_switch_head) {
     SwitchUpdate& upd = g_switch_queue[g_switch_tail];
     if (upd.valid) {
-      update_switch_tile_state(upd.grid_type, upd.grid_index, upd.payload.c_str());
+      update_switch_tile_state(upd.grid_type, upd.grid_index, upd.state, upd.stale);
       upd.valid = false;
     }
     g_switch_tail = (g_switch_tail + 1) % SWITCH_QUEUE_SIZE;
@@ -881,12 +487,7 @@ void render_tile_grid(lv_obj_t* parent, const TileGridConfig& config, GridType g
     Serial.printf("[TileRenderer] Erstelle Tile %d/%d...\n", i + 1, TILES_PER_GRID);
 
     render_tile(parent, col, row, config.tiles[i], i, grid_type, scene_cb);
-
-    // PROGRESSIVES RENDERING: Pause zwischen Tiles (verhindert Crash)
-    yield();                    // Watchdog füttern
-    delay(10);                 // 10ms Pause für System Processing (120ms total)
-    yield();                   // Nochmal Watchdog
-    // KEIN lv_timer_handler() hier! Sonst werden unfertige Tiles gezeichnet!
+    // Zeitgesteuerter Aufbau ueber mehrere Frames: siehe tab_tiles_unified (Builder)
 
     Serial.printf("[TileRenderer] ✓ Tile %d/%d fertig\n", i + 1, TILES_PER_GRID);
   }
@@ -901,6 +502,8 @@ void render_tile_grid(lv_obj_t* parent, const TileGridConfig& config, GridType g
                 heap_after / 1024, heap_used / 1024,
                 psram_after / 1024, psram_used / 1024);
   Serial.printf("[TileRenderer] Min Free Heap seit Boot: %u KB\n", ESP.getMinFreeHeap() / 1024);
+  tile_card_cache_log_stats();
+  tile_thumb_log_stats();
 }
 
 lv_obj_t* render_tile(lv_obj_t* parent, int col, int row, const Tile& tile, uint8_t index, GridType grid_type, scene_publish_cb_t scene_cb) {
@@ -951,9 +554,10 @@ lv_obj_t* render_sensor_tile(lv_obj_t* parent, int col, int row, const Tile& til
   // Pressed-State: 10% heller
   uint32_t pressed_color = card_color + 0x101010;
   lv_obj_set_style_bg_color(card, lv_color_hex(pressed_color), LV_PART_MAIN | LV_STATE_PRESSED);
+  tile_card_cache_attach(card, CARD_RADIUS, card_color, pressed_color, true);
 
   lv_obj_set_style_bg_opa(card, LV_OPA_COVER, 0);
-  lv_obj_set_style_radius(card, 22, 0);
+  lv_obj_set_style_radius(card, CARD_RADIUS, 0);
   lv_obj_set_style_border_width(card, 0, 0);
   lv_obj_set_style_shadow_width(card, 0, 0);
   lv_obj_set_style_pad_hor(card, 20, 0);
@@ -999,8 +603,7 @@ lv_obj_t* render_sensor_tile(lv_obj_t* parent, int col, int row, const Tile& til
   lv_obj_align(v, LV_ALIGN_CENTER, 0, 28);  // Nach unten verschoben (war 18)
 
   // Speichern für spätere Updates
-  SensorTileWidgets* target = (grid_type == GridType::TAB0) ? g_tab0_sensors : g_tab1_sensors;
-  if (grid_type == GridType::TAB2) target = g_tab2_sensors;
+  SensorTileWidgets* target = get_sensor_widget_array(grid_type);
   target[index].value_label = v;
   target[index].unit_label = nullptr;
 
@@ -1060,7 +663,7 @@ struct SceneEventData {
 
 lv_obj_t* render_scene_tile(lv_obj_t* parent, int col, int row, const Tile& tile, uint8_t index, scene_publish_cb_t scene_cb) {
   lv_obj_t* btn = lv_button_create(parent);
-  lv_obj_set_style_radius(btn, 22, 0);
+  lv_obj_set_style_radius(btn, CARD_RADIUS, 0);
   lv_obj_set_style_border_width(btn, 0, 0);
 
   // Farbe verwenden (Standard: 0x353535 wenn color = 0)
@@ -1071,6 +674,7 @@ lv_obj_t* render_scene_tile(lv_obj_t* parent, int col, int row, const Tile& tile
   uint32_t pressed_color = btn_color + 0x101010;
   lv_obj_set_style_bg_color(btn, lv_color_hex(pressed_color), LV_PART_MAIN | LV_STATE_PRESSED);
   lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+  tile_card_cache_attach(btn, CARD_RADIUS, btn_color, pressed_color, true);
   lv_obj_set_style_shadow_width(btn, 0, 0);
   lv_obj_set_height(btn, CARD_H);
   lv_obj_remove_flag(btn, LV_OBJ_FLAG_SCROLLABLE);
@@ -1158,7 +762,7 @@ struct KeyEventData {
 
 lv_obj_t* render_key_tile(lv_obj_t* parent, int col, int row, const Tile& tile, uint8_t index, GridType grid_type) {
   lv_obj_t* btn = lv_button_create(parent);
-  lv_obj_set_style_radius(btn, 22, 0);
+  lv_obj_set_style_radius(btn, CARD_RADIUS, 0);
   lv_obj_set_style_border_width(btn, 0, 0);
 
   // Farbe verwenden (Standard: 0x353535 wenn color = 0)
@@ -1169,6 +773,7 @@ lv_obj_t* render_key_tile(lv_obj_t* parent, int col, int row, const Tile& tile,
   uint32_t pressed_color = btn_color + 0x101010;
   lv_obj_set_style_bg_color(btn, lv_color_hex(pressed_color), LV_PART_MAIN | LV_STATE_PRESSED);
   lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+  tile_card_cache_attach(btn, CARD_RADIUS, btn_color, pressed_color, true);
   lv_obj_set_style_shadow_width(btn, 0, 0);
   lv_obj_set_height(btn, CARD_H);
   lv_obj_remove_flag(btn, LV_OBJ_FLAG_SCROLLABLE);
@@ -1267,7 +872,7 @@ struct NavigateEventData {
 
 lv_obj_t* render_navigate_tile(lv_obj_t* parent, int col, int row, const Tile& tile, uint8_t index) {
   lv_obj_t* btn = lv_button_create(parent);
-  lv_obj_set_style_radius(btn, 22, 0);
+  lv_obj_set_style_radius(btn, CARD_RADIUS, 0);
   lv_obj_set_style_border_width(btn, 0, 0);
 
   // Farbe verwenden (Standard: 0x353535 wenn color = 0)
@@ -1278,6 +883,7 @@ lv_obj_t* render_navigate_tile(lv_obj_t* parent, int col, int row, const Tile& t
   uint32_t pressed_color = btn_color + 0x101010;
   lv_obj_set_style_bg_color(btn, lv_color_hex(pressed_color), LV_PART_MAIN | LV_STATE_PRESSED);
   lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+  tile_card_cache_attach(btn, CARD_RADIUS, btn_color, pressed_color, true);
   lv_obj_set_style_shadow_width(btn, 0, 0);
   lv_obj_set_height(btn, CARD_H);
   lv_obj_remove_flag(btn, LV_OBJ_FLAG_SCROLLABLE);
@@ -1379,12 +985,6 @@ struct SwitchWidgetEventData {
   String entity_id;
 };
 
-static SwitchState* get_switch_state_array(GridType grid_type) {
-  if (grid_type == GridType::TAB1) return g_tab1_switch_states;
-  if (grid_type == GridType::TAB2) return g_tab2_switch_states;
-  return g_tab0_switch_states;
-}
-
 static SwitchState get_switch_state(GridType grid_type, uint8_t index) {
   if (index >= TILES_PER_GRID) return {};
   return get_switch_state_array(grid_type)[index];
@@ -1402,9 +1002,7 @@ static LightPopupInit build_light_popup_init(const SwitchEventData* data) {
   init.is_light = is_light_entity_id(data->entity_id);
 
   // Get icon from tile config
-  const TileGridConfig& grid = (data->grid_type == GridType::TAB1)
-                                 ? tileConfig.getTab1Grid()
-                                 : (data->grid_type == GridType::TAB2 ? tileConfig.getTab2Grid() : tileConfig.getTab0Grid());
+  const TileGridConfig& grid = get_grid_config(data->grid_type);
   if (data->index < TILES_PER_GRID) {
     init.icon_name = grid.tiles[data->index].icon_name;
   }
@@ -1451,18 +1049,20 @@ static bool is_switch_widget_tile(const Tile& tile) {
 lv_obj_t* render_switch_tile(lv_obj_t* parent, int col, int row, const Tile& tile, uint8_t index, GridType grid_type) {
   const bool use_switch_widget = is_switch_widget_tile(tile);
   lv_obj_t* container = use_switch_widget ? lv_obj_create(parent) : lv_button_create(parent);
-  lv_obj_set_style_radius(container, 22, 0);
+  lv_obj_set_style_radius(container, CARD_RADIUS, 0);
   lv_obj_set_style_border_width(container, 0, 0);
 
   // Farbe verwenden (Standard: 0x353535 wenn color = 0)
   uint32_t tile_color = (tile.bg_color != 0) ? tile.bg_color : 0x353535;
   lv_obj_set_style_bg_color(container, lv_color_hex(tile_color), LV_PART_MAIN | LV_STATE_DEFAULT);
 
+  uint32_t pressed_color = tile_color;
   if (!use_switch_widget) {
     // Pressed-State: 10% heller
-    uint32_t pressed_color = tile_color + 0x101010;
+    pressed_color = tile_color + 0x101010;
     lv_obj_set_style_bg_color(container, lv_color_hex(pressed_color), LV_PART_MAIN | LV_STATE_PRESSED);
   }
+  tile_card_cache_attach(container, CARD_RADIUS, tile_color, pressed_color, !use_switch_widget);
 
   lv_obj_set_style_bg_opa(container, LV_OPA_COVER, 0);
   lv_obj_set_style_shadow_width(container, 0, 0);
@@ -1561,9 +1161,7 @@ lv_obj_t* render_switch_tile(lv_obj_t* parent, int col, int row, const Tile& til
     }
   }
 
-  SwitchTileWidgets* target = g_tab0_switches;
-  if (grid_type == GridType::TAB1) target = g_tab1_switches;
-  else if (grid_type == GridType::TAB2) target = g_tab2_switches;
+  SwitchTileWidgets* target = get_switch_widget_array(grid_type);
   if (index < TILES_PER_GRID) {
     target[index].icon_label = icon_lbl;
     target[index].title_label = title_lbl;
@@ -1571,9 +1169,9 @@ lv_obj_t* render_switch_tile(lv_obj_t* parent, int col, int row, const Tile& til
   }
 
   if (tile.sensor_entity.length()) {
-    String initial = haBridgeConfig.findSensorInitialValue(tile.sensor_entity);
-    if (initial.length()) {
-      update_switch_tile_state(grid_type, index, initial.c_str());
+    const EntityEntry* entry = entity_state_lookup(tile.sensor_entity.c_str());
+    if (entry && entry->has_switch) {
+      update_switch_tile_state(grid_type, index, entry->sw, entry->stale);
     }
   }
 
@@ -1640,7 +1238,7 @@ lv_obj_t* render_image_tile(lv_obj_t* parent, int col, int row, const Tile& tile
   Serial.printf("[TileRenderer] render_image_tile: title='%s', image_path='%s'\n", tile.title.c_str(), tile.image_path.c_str());
 
   lv_obj_t* btn = lv_button_create(parent);
-  lv_obj_set_style_radius(btn, 22, 0);
+  lv_obj_set_style_radius(btn, CARD_RADIUS, 0);
   lv_obj_set_style_border_width(btn, 0, 0);
 
   // Farbe verwenden (Standard: 0x353535 wenn color = 0)
@@ -1651,6 +1249,7 @@ lv_obj_t* render_image_tile(lv_obj_t* parent, int col, int row, const Tile& tile
   uint32_t pressed_color = btn_color + 0x101010;
   lv_obj_set_style_bg_color(btn, lv_color_hex(pressed_color), LV_PART_MAIN | LV_STATE_PRESSED);
   lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+  tile_card_cache_attach(btn, CARD_RADIUS, btn_color, pressed_color, true);
   lv_obj_set_style_shadow_width(btn, 0, 0);
   lv_obj_set_height(btn, CARD_H);
   lv_obj_remove_flag(btn, LV_OBJ_FLAG_SCROLLABLE);
@@ -1682,8 +1281,10 @@ lv_obj_t* render_image_tile(lv_obj_t* parent, int col, int row, const Tile& tile
   }
 
   // Title Label
+  lv_obj_t* title_lbl = nullptr;
   if (has_title) {
     lv_obj_t* l = lv_label_create(btn);
+    title_lbl = l;
     if (l) {
       set_label_style(l, lv_color_white(), FONT_TITLE);
       lv_label_set_text(l, tile.title.c_str());
@@ -1700,6 +1301,9 @@ lv_obj_t* render_image_tile(lv_obj_t* parent, int col, int row, const Tile& tile
   if (tile.image_path.length() > 0) {
     Serial.printf("[TileRenderer] Registriere Click-Event für image_path='%s'\n", tile.image_path.c_str());
 
+    // Vorschaubild als Card-Hintergrund, sobald im Hintergrund erzeugt/geladen
+    tile_thumb_attach(btn, tile.image_path, CARD_RADIUS, icon_lbl, title_lbl);
+
     // Allocate permanent storage for event data
     ImageEventData* event_data = new ImageEventData{tile.image_path, tile.image_slideshow_sec};
 
@@ -1735,6 +1339,22 @@ lv_obj_t* render_image_tile(lv_obj_t* parent, int col, int row, const Tile& tile
   return btn;
 }
 
+lv_obj_t* render_placeholder_tile(lv_obj_t* parent, int col, int row) {
+  lv_obj_t* placeholder = lv_obj_create(parent);
+  lv_obj_set_style_bg_color(placeholder, lv_color_hex(0x1A1A1A), 0);
+  lv_obj_set_style_bg_opa(placeholder, LV_OPA_COVER, 0);
+  lv_obj_set_style_radius(placeholder, CARD_RADIUS, 0);
+  lv_obj_set_style_border_width(placeholder, 0, 0);
+  lv_obj_set_style_shadow_width(placeholder, 0, 0);
+  lv_obj_remove_flag(placeholder, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_remove_flag(placeholder, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_height(placeholder, CARD_H);
+  lv_obj_set_grid_cell(placeholder,
+      LV_GRID_ALIGN_STRETCH, col, 1,
+      LV_GRID_ALIGN_STRETCH, row, 1);
+  return placeholder;
+}
+
 lv_obj_t* render_empty_tile(lv_obj_t* parent, int col, int row) {
   lv_obj_t* placeholder = lv_obj_create(parent);
   lv_obj_set_style_bg_opa(placeholder, LV_OPA_TRANSP, 0);
@@ -1746,13 +1366,13 @@ lv_obj_t* render_empty_tile(lv_obj_t* parent, int col, int row) {
   return placeholder;
 }
 
-void update_sensor_tile_value(GridType grid_type, uint8_t grid_index, const char* value, const char* unit) {
+void update_sensor_tile_value(GridType grid_type, uint8_t grid_index, const char* value, const char* unit,
+                              bool stale) {
   if (grid_index >= TILES_PER_GRID) {
     return;
   }
 
-  SensorTileWidgets* target = (grid_type == GridType::TAB1) ? g_tab1_sensors : g_tab0_sensors;
-  if (grid_type == GridType::TAB2) target = g_tab2_sensors;
+  SensorTileWidgets* target = get_sensor_widget_array(grid_type);
   lv_obj_t* value_label = target[grid_index].value_label;
   if (!value_label) {
     return;
@@ -1787,4 +1407,6 @@ void update_sensor_tile_value(GridType grid_type, uint8_t grid_index, const char
     combined += unit;
   }
   lv_label_set_text(value_label, combined.c_str());
+  lv_obj_set_style_text_opa(value_label, stale ? STALE_OPA : LV_OPA_COVER, 0);
+  if (displayValue != "--") entity_snapshot_note_value(stale);
 }
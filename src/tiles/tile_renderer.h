@@ -3,6 +3,7 @@
 
 #include <lvgl.h>
 #include "src/tiles/tile_config.h"
+#include "src/network/entity_state.h"
 
 // Forward declarations
 typedef void (*scene_publish_cb_t)(const char* scene_alias);
@@ -10,7 +11,8 @@ typedef void (*scene_publish_cb_t)(const char* scene_alias);
 enum class GridType : uint8_t {
   TAB0 = 0,
   TAB1 = 1,
-  TAB2 = 2
+  TAB2 = 2,
+  BENCH = 3  // Render-Benchmark: eigene Widget-Slots, gehoert zu keinem Tab
 };
 
 // Rendert ein komplettes Tile-Grid (12 Kacheln, 3×4)
@@ -28,21 +30,27 @@ lv_obj_t* render_switch_tile(lv_obj_t* parent, int col, int row, const Tile& til
 lv_obj_t* render_image_tile(lv_obj_t* parent, int col, int row, const Tile& tile, uint8_t index);
 lv_obj_t* render_empty_tile(lv_obj_t* parent, int col, int row);
 
+// Platzhalter-Card (leichtgewichtig), bis der Builder das echte Tile erzeugt
+lv_obj_t* render_placeholder_tile(lv_obj_t* parent, int col, int row);
+
 // Update-Funktionen (für Sensoren)
-void update_sensor_tile_value(GridType grid_type, uint8_t grid_index, const char* value, const char* unit = nullptr);
+// stale = Wert aus dem Boot-Snapshot, wird abgedimmt bis MQTT ihn bestaetigt
+void update_sensor_tile_value(GridType grid_type, uint8_t grid_index, const char* value, const char* unit = nullptr,
+                              bool stale = false);
 void reset_sensor_widget(GridType grid_type, uint8_t grid_index);
 void reset_sensor_widgets(GridType grid_type);
 
 // THREAD-SAFE: Queue für Sensor-Updates (MQTT Callback → Main Loop)
-void queue_sensor_tile_update(GridType grid_type, uint8_t grid_index, const char* value, const char* unit = nullptr);
+void queue_sensor_tile_update(GridType grid_type, uint8_t grid_index, const char* value, const char* unit = nullptr,
+                              bool stale = false);
 void process_sensor_update_queue();  // Im Main Loop VOR lv_timer_handler() aufrufen!
 
 // Update-Funktionen (fuer Switches)
 void reset_switch_widget(GridType grid_type, uint8_t grid_index);
 void reset_switch_widgets(GridType grid_type);
 
-// THREAD-SAFE: Queue fuer Switch-Updates (MQTT Callback -> Main Loop)
-void queue_switch_tile_update(GridType grid_type, uint8_t grid_index, const char* payload);
+// THREAD-SAFE: Queue fuer Switch-Updates (MQTT Callback -> Main Loop), Zustand bereits geparst
+void queue_switch_tile_state(GridType grid_type, uint8_t grid_index, const SwitchState& state, bool stale = false);
 void process_switch_update_queue();  // Im Main Loop VOR lv_timer_handler() aufrufen!
 
 #endif // TILE_RENDERER_H
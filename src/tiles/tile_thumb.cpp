@@ -0,0 +1,577 @@
+#include "src/tiles/tile_thumb.h"
+#include "src/tiles/tile_card_cache.h"
+#include "src/core/display_manager.h"
+#include "src/core/sd_io.h"
+#include "src/ui/image_cache.h"
+#include "src/ui/image_popup.h"
+#include <SD.h>
+#include <vector>
+#include "esp_heap_caps.h"
+#include "esp_rom_crc.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+
+/* === Datei-Format === */
+// LVGL-.bin (RGB565_SWAPPED, ohne Ecken) + Fusszeile mit Groesse/mtime der Quelle.
+// Die Fusszeile wird zuletzt geschrieben, ein abgebrochener Schreibvorgang faellt damit auf.
+static constexpr uint32_t kThumbMagic = 0x31424D54;  // "TMB1"
+
+struct ThumbFooter {
+  uint32_t magic;
+  uint32_t src_size;
+  uint32_t src_mtime;
+};
+
+/* === Jobs === */
+enum ThumbOrigin : uint8_t {
+  THUMB_FAILED = 0,
+  THUMB_UNCHANGED,  // Pruefung: RAM-Stand ist aktuell
+  THUMB_FROM_SD,
+  THUMB_GENERATED
+};
+
+struct ThumbJob {
+  String source;
+  String thumb_path;
+  String key;
+  uint16_t w;
+  uint16_t h;
+  uint8_t radius;
+  uint32_t backdrop;
+  bool has_known;    // RAM-Stand vorhanden -> nur pruefen
+  bool force;        // Quelle neu geschrieben -> SD-Thumbnail ignorieren
+  uint32_t known_size;
+  uint32_t known_mtime;
+};
+
+struct ThumbResult {
+  String key;
+  uint32_t src_size = 0;
+  uint32_t src_mtime = 0;
+  uint8_t* buf = nullptr;
+  size_t bytes = 0;
+  lv_image_header_t header{};
+  uint8_t origin = THUMB_FAILED;
+  uint32_t ms = 0;
+  String error;
+};
+
+/* === Bindung pro Card === */
+struct ThumbBinding {
+  lv_obj_t* card;
+  lv_obj_t* icon;
+  lv_obj_t* title;
+  String source;  // SD-Datei
+  uint8_t radius;
+  uint16_t w = 0;
+  uint16_t h = 0;
+  String key;
+  const lv_image_dsc_t* dsc = nullptr;  // gepinnt im Image-Cache
+  uint32_t attach_ms = 0;
+};
+
+// Zuletzt bekannter Stand der Quelle je Schluessel (fuer RAM-Treffer ohne SD-Zugriff)
+struct ThumbKnown {
+  String key;
+  uint32_t size;
+  uint32_t mtime;
+};
+
+static constexpr size_t kThumbQueueLen = 24;
+static std::vector<ThumbBinding*> g_thumb_bindings;
+static std::vector<ThumbKnown> g_thumb_known;
+static std::vector<String> g_thumb_pending;
+static QueueHandle_t g_thumb_jobs = nullptr;
+static QueueHandle_t g_thumb_done = nullptr;
+static TaskHandle_t g_thumb_task = nullptr;
+
+static uint32_t g_thumb_ram_hits = 0;
+static uint32_t g_thumb_sd_loads = 0;
+static uint32_t g_thumb_generated = 0;
+static uint32_t g_thumb_verified = 0;
+static uint32_t g_thumb_failed = 0;
+static uint32_t g_thumb_dropped = 0;
+static uint32_t g_thumb_sd_ms = 0;
+static uint32_t g_thumb_gen_ms = 0;
+static uint32_t g_thumb_gen_max_ms = 0;
+static uint32_t g_thumb_bind_max_ms = 0;
+
+/* === Hilfen === */
+static bool has_image_extension(const String& path) {
+  String p = path;
+  p.toLowerCase();
+  return p.endsWith(".bin") || p.endsWith(".jpg") || p.endsWith(".jpeg");
+}
+
+static String make_thumb_path(const String& source, uint16_t w, uint16_t h) {
+  const uint32_t crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(source.c_str()), source.length());
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%s/t%08lX_%ux%u.bin", TILE_THUMB_DIR, static_cast<unsigned long>(crc),
+           static_cast<unsigned>(w), static_cast<unsigned>(h));
+  return String(buf);
+}
+
+// Ecken sind in den RAM-Stand eingerechnet -> Radius und Hintergrund gehoeren zum Schluessel
+static String make_cache_key(const String& thumb_path, uint8_t radius, uint32_t backdrop) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), "#r%u_%06lX", static_cast<unsigned>(radius), static_cast<unsigned long>(backdrop));
+  return thumb_path + buf;
+}
+
+static ThumbKnown* find_known(const String& key) {
+  for (ThumbKnown& k : g_thumb_known) {
+    if (k.key == key) return &k;
+  }
+  return nullptr;
+}
+
+static bool is_pending(const String& key) {
+  for (const String& k : g_thumb_pending) {
+    if (k == key) return true;
+  }
+  return false;
+}
+
+static void clear_pending(const String& key) {
+  for (size_t i = 0; i < g_thumb_pending.size(); ++i) {
+    if (g_thumb_pending[i] == key) {
+      g_thumb_pending.erase(g_thumb_pending.begin() + i);
+      return;
+    }
+  }
+}
+
+/* === Skalierung (Worker) === */
+static inline void read_rgb(const uint8_t* row, uint32_t x, lv_color_format_t cf, uint32_t& r, uint32_t& g, uint32_t& b) {
+  switch (cf) {
+    case LV_COLOR_FORMAT_RGB565:
+    case LV_COLOR_FORMAT_RGB565_SWAPPED: {
+      uint16_t v = reinterpret_cast<const uint16_t*>(row)[x];
+      if (cf == LV_COLOR_FORMAT_RGB565_SWAPPED) v = static_cast<uint16_t>((v >> 8) | (v << 8));
+      r = (v >> 8) & 0xF8;
+      g = (v >> 3) & 0xFC;
+      b = (v << 3) & 0xF8;
+      break;
+    }
+    case LV_COLOR_FORMAT_RGB888:
+      b = row[x * 3U];
+      g = row[x * 3U + 1U];
+      r = row[x * 3U + 2U];
+      break;
+    default:  // XRGB8888 / ARGB8888, Alpha wird ignoriert
+      b = row[x * 4U];
+      g = row[x * 4U + 1U];
+      r = row[x * 4U + 2U];
+      break;
+  }
+}
+
+static bool format_supported(lv_color_format_t cf) {
+  return cf == LV_COLOR_FORMAT_RGB565 || cf == LV_COLOR_FORMAT_RGB565_SWAPPED ||
+         cf == LV_COLOR_FORMAT_RGB888 || cf == LV_COLOR_FORMAT_XRGB8888 || cf == LV_COLOR_FORMAT_ARGB8888;
+}
+
+// Mittigen Ausschnitt im Seitenverhaeltnis des Ziels per Box-Filter verkleinern (cover)
+static void scale_cover(const uint8_t* src, const lv_image_header_t& hdr, uint16_t* dst, uint16_t dw, uint16_t dh) {
+  const lv_color_format_t cf = static_cast<lv_color_format_t>(hdr.cf);
+  const uint32_t sw = hdr.w;
+  const uint32_t sh = hdr.h;
+  uint32_t crop_w = sw;
+  uint32_t crop_h = sh;
+  if (sw * dh >= sh * dw) {
+    crop_w = sh * dw / dh;
+  } else {
+    crop_h = sw * dh / dw;
+  }
+  if (crop_w == 0) crop_w = 1;
+  if (crop_h == 0) crop_h = 1;
+  const uint32_t x0 = (sw - crop_w) / 2;
+  const uint32_t y0 = (sh - crop_h) / 2;
+
+  for (uint32_t dy = 0; dy < dh; ++dy) {
+    uint32_t sy0 = y0 + dy * crop_h / dh;
+    uint32_t sy1 = y0 + (dy + 1) * crop_h / dh;
+    if (sy1 <= sy0) sy1 = sy0 + 1;
+    uint16_t* out = dst + static_cast<size_t>(dy) * dw;
+    for (uint32_t dx = 0; dx < dw; ++dx) {
+      uint32_t sx0 = x0 + dx * crop_w / dw;
+      uint32_t sx1 = x0 + (dx + 1) * crop_w / dw;
+      if (sx1 <= sx0) sx1 = sx0 + 1;
+      uint32_t sr = 0, sg = 0, sb = 0;
+      for (uint32_t sy = sy0; sy < sy1; ++sy) {
+        const uint8_t* row = src + static_cast<size_t>(sy) * hdr.stride;
+        for (uint32_t sx = sx0; sx < sx1; ++sx) {
+          uint32_t r, g, b;
+          read_rgb(row, sx, cf, r, g, b);
+          sr += r;
+          sg += g;
+          sb += b;
+        }
+      }
+      const uint32_t n = (sy1 - sy0) * (sx1 - sx0);
+      const uint16_t v = static_cast<uint16_t>((((sr / n) & 0xF8) << 8) | (((sg / n) & 0xFC) << 3) | ((sb / n) >> 3));
+      out[dx] = static_cast<uint16_t>((v >> 8) | (v << 8));
+    }
+    if ((dy & 15) == 15) vTaskDelay(1);
+  }
+}
+
+/* === SD (Worker) === */
+static bool read_thumb_file(const String& path, uint16_t w, uint16_t h, uint32_t src_size, uint32_t src_mtime,
+                            uint8_t*& out_buf) {
+  out_buf = nullptr;
+  File f = SD.open(path, FILE_READ);
+  if (!f) return false;
+  const size_t data_size = static_cast<size_t>(w) * h * 2U;
+  lv_image_header_t header{};
+  ThumbFooter footer{};
+  bool ok = f.size() == sizeof(header) + data_size + sizeof(footer) &&
+            f.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) == sizeof(header) &&
+            header.magic == LV_IMAGE_HEADER_MAGIC && header.cf == LV_COLOR_FORMAT_RGB565_SWAPPED &&
+            header.w == w && header.h == h &&
+            f.seek(sizeof(header) + data_size) &&
+            f.read(reinterpret_cast<uint8_t*>(&footer), sizeof(footer)) == sizeof(footer) &&
+            footer.magic == kThumbMagic && footer.src_size == src_size && footer.src_mtime == src_mtime &&
+            f.seek(sizeof(header));
+  if (ok) {
+    out_buf = static_cast<uint8_t*>(heap_caps_malloc(data_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    const uint32_t read_start = micros();
+    ok = out_buf && f.read(out_buf, data_size) == data_size;
+    sd_io_record_read(ok ? data_size : 0, micros() - read_start);
+  }
+  f.close();
+  if (!ok && out_buf) {
+    heap_caps_free(out_buf);
+    out_buf = nullptr;
+  }
+  return ok;
+}
+
+static bool write_thumb_file(const String& path, const lv_image_header_t& header, const uint8_t* data, size_t data_size,
+                             uint32_t src_size, uint32_t src_mtime) {
+  if (!SD.exists(TILE_THUMB_DIR) && !SD.mkdir(TILE_THUMB_DIR)) return false;
+  if (SD.exists(path)) SD.remove(path);
+  File f = SD.open(path, FILE_WRITE);
+  if (!f) return false;
+  const ThumbFooter footer{kThumbMagic, src_size, src_mtime};
+  const uint32_t write_start = micros();
+  bool ok = f.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header) &&
+            f.write(data, data_size) == data_size &&
+            f.write(reinterpret_cast<const uint8_t*>(&footer), sizeof(footer)) == sizeof(footer);
+  f.close();
+  sd_io_record_write(sizeof(header) + data_size + sizeof(footer), micros() - write_start);
+  if (!ok) SD.remove(path);
+  return ok;
+}
+
+static bool generate_thumb(const ThumbJob& job, uint8_t*& out_buf, String& error) {
+  out_buf = nullptr;
+  uint8_t* src = nullptr;
+  size_t src_size = 0;
+  lv_image_header_t src_header{};
+  if (!image_popup_decode_fit(job.source, job.w, job.h, true, src, src_size, src_header, error)) return false;
+  if (!format_supported(static_cast<lv_color_format_t>(src_header.cf)) || src_header.w == 0 || src_header.h == 0) {
+    heap_caps_free(src);
+    error = "Format nicht unterstuetzt";
+    return false;
+  }
+  const size_t data_size = static_cast<size_t>(job.w) * job.h * 2U;
+  out_buf = static_cast<uint8_t*>(heap_caps_malloc(data_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  if (!out_buf) {
+    heap_caps_free(src);
+    error = "Kein RAM fuer Thumbnail";
+    return false;
+  }
+  scale_cover(src, src_header, reinterpret_cast<uint16_t*>(out_buf), job.w, job.h);
+  heap_caps_free(src);
+  return true;
+}
+
+static ThumbResult* run_job(const ThumbJob& job) {
+  ThumbResult* res = new ThumbResult();
+  res->key = job.key;
+  const uint32_t start_ms = millis();
+  if (!image_cache_stat(job.source, res->src_size, res->src_mtime)) {
+    res->error = "Quelle fehlt";
+    return res;
+  }
+  if (job.has_known && !job.force && res->src_size == job.known_size && res->src_mtime == job.known_mtime) {
+    res->origin = THUMB_UNCHANGED;
+    return res;
+  }
+
+  const size_t data_size = static_cast<size_t>(job.w) * job.h * 2U;
+  res->header.magic = LV_IMAGE_HEADER_MAGIC;
+  res->header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED;
+  res->header.w = job.w;
+  res->header.h = job.h;
+  res->header.stride = static_cast<uint32_t>(job.w) * 2U;
+
+  uint8_t* buf = nullptr;
+  if (!job.force && read_thumb_file(job.thumb_path, job.w, job.h, res->src_size, res->src_mtime, buf)) {
+    res->origin = THUMB_FROM_SD;
+  } else if (generate_thumb(job, buf, res->error)) {
+    res->origin = THUMB_GENERATED;
+    if (!write_thumb_file(job.thumb_path, res->header, buf, data_size, res->src_size, res->src_mtime)) {
+      Serial.printf("[Thumb] Speichern fehlgeschlagen: %s\n", job.thumb_path.c_str());
+    }
+  } else {
+    return res;
+  }
+
+  tile_card_cache_mask_corners(reinterpret_cast<uint16_t*>(buf), job.w, job.h, job.radius, job.backdrop);
+  res->buf = buf;
+  res->bytes = data_size;
+  res->ms = millis() - start_ms;
+  return res;
+}
+
+static void thumb_worker(void*) {
+  for (;;) {
+    ThumbJob* job = nullptr;
+    if (xQueueReceive(g_thumb_jobs, &job, portMAX_DELAY) != pdTRUE || !job) continue;
+    ThumbResult* res = run_job(*job);
+    delete job;
+    xQueueSend(g_thumb_done, &res, portMAX_DELAY);
+  }
+}
+
+static bool ensure_thumb_worker() {
+  if (g_thumb_task) return true;
+  if (!g_thumb_jobs) g_thumb_jobs = xQueueCreate(kThumbQueueLen, sizeof(ThumbJob*));
+  if (!g_thumb_done) g_thumb_done = xQueueCreate(kThumbQueueLen, sizeof(ThumbResult*));
+  if (!g_thumb_jobs || !g_thumb_done) return false;
+  int core = 1;
+#ifdef ARDUINO_RUNNING_CORE
+  core = (ARDUINO_RUNNING_CORE == 0) ? 1 : 0;
+#endif
+  if (xTaskCreatePinnedToCore(thumb_worker, "tileThumb", 8192, nullptr, 1, &g_thumb_task, core) != pdPASS) {
+    g_thumb_task = nullptr;
+    Serial.println("[Thumb] Worker-Task konnte nicht gestartet werden");
+    return false;
+  }
+  return true;
+}
+
+/* === LVGL-Kontext === */
+// Fuer DEFAULT und PRESSED setzen: tile_card_cache legt fuer PRESSED ein eigenes
+// Kartenbild ab, das sonst beim Druecken das Thumbnail ersetzt
+static void apply_thumb_src(lv_obj_t* card, const lv_image_dsc_t* dsc) {
+  lv_obj_set_style_bg_image_src(card, dsc, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_bg_image_src(card, dsc, LV_PART_MAIN | LV_STATE_PRESSED);
+  lv_obj_set_style_bg_image_recolor(card, lv_color_black(), LV_PART_MAIN | LV_STATE_PRESSED);
+  lv_obj_set_style_bg_image_recolor_opa(card, LV_OPA_20, LV_PART_MAIN | LV_STATE_PRESSED);
+}
+
+static void show_thumb(ThumbBinding* b, const lv_image_dsc_t* pinned) {
+  const lv_image_dsc_t* old = b->dsc;
+  b->dsc = pinned;
+  apply_thumb_src(b->card, pinned);
+  if (old) image_cache_release(old);
+
+  if (b->icon) lv_obj_add_flag(b->icon, LV_OBJ_FLAG_HIDDEN);
+  if (b->title) {
+    // Titel unten auf dunklem Streifen, damit er auf dem Bild lesbar bleibt
+    lv_obj_set_style_bg_color(b->title, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(b->title, LV_OPA_50, 0);
+    lv_obj_set_style_pad_hor(b->title, 10, 0);
+    lv_obj_set_style_pad_ver(b->title, 2, 0);
+    lv_obj_set_style_radius(b->title, 8, 0);
+    lv_obj_align(b->title, LV_ALIGN_BOTTOM_MID, 0, 0);
+  }
+
+  const uint32_t waited = millis() - b->attach_ms;
+  if (waited > g_thumb_bind_max_ms) g_thumb_bind_max_ms = waited;
+}
+
+static void queue_job(ThumbBinding* b, bool force) {
+  if (is_pending(b->key)) return;
+  if (!ensure_thumb_worker()) return;
+  ThumbJob* job = new ThumbJob();
+  job->source = b->source;
+  job->thumb_path = make_thumb_path(b->source, b->w, b->h);
+  job->key = b->key;
+  job->w = b->w;
+  job->h = b->h;
+  job->radius = b->radius;
+  job->backdrop = tile_card_cache_backdrop(b->card);
+  job->force = force;
+  const ThumbKnown* known = find_known(b->key);
+  job->has_known = known != nullptr;
+  job->known_size = known ? known->size : 0;
+  job->known_mtime = known ? known->mtime : 0;
+  if (xQueueSend(g_thumb_jobs, &job, 0) != pdTRUE) {
+    delete job;
+    g_thumb_dropped++;
+    return;
+  }
+  g_thumb_pending.push_back(b->key);
+}
+
+static void bind_size(ThumbBinding* b) {
+  const int32_t w = lv_obj_get_width(b->card);
+  const int32_t h = lv_obj_get_height(b->card);
+  if (w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF) return;
+  if (b->w == w && b->h == h) {
+    // tile_card_cache bindet bei jeder Groessenaenderung neu -> Thumbnail wieder drueberlegen
+    if (b->dsc) apply_thumb_src(b->card, b->dsc);
+    return;
+  }
+  if (b->dsc) {
+    image_cache_release(b->dsc);
+    b->dsc = nullptr;
+  }
+  b->w = static_cast<uint16_t>(w);
+  b->h = static_cast<uint16_t>(h);
+  b->key = make_cache_key(make_thumb_path(b->source, b->w, b->h), b->radius, tile_card_cache_backdrop(b->card));
+
+  // Schon im RAM: sofort blitten, Quelle im Hintergrund nur pruefen
+  const ThumbKnown* known = find_known(b->key);
+  if (known) {
+    const lv_image_dsc_t* hit = image_cache_acquire(b->key, known->size, known->mtime);
+    if (hit) {
+      g_thumb_ram_hits++;
+      show_thumb(b, hit);
+    }
+  }
+  queue_job(b, false);
+}
+
+static void thumb_event_cb(lv_event_t* e) {
+  lv_event_code_t code = lv_event_get_code(e);
+  ThumbBinding* b = static_cast<ThumbBinding*>(lv_event_get_user_data(e));
+  if (!b) return;
+  if (code == LV_EVENT_SIZE_CHANGED) {
+    bind_size(b);
+  } else if (code == LV_EVENT_DELETE) {
+    if (b->dsc) image_cache_release(b->dsc);
+    for (size_t i = 0; i < g_thumb_bindings.size(); ++i) {
+      if (g_thumb_bindings[i] == b) {
+        g_thumb_bindings.erase(g_thumb_bindings.begin() + i);
+        break;
+      }
+    }
+    delete b;
+  }
+}
+
+void tile_thumb_attach(lv_obj_t* card, const String& image_path, uint8_t radius,
+                       lv_obj_t* icon, lv_obj_t* title) {
+#if TILE_THUMB_ENABLED
+  if (!card) return;
+  String source = image_popup_resolve_sd_path(image_path);
+  if (source.length() == 0 || !has_image_extension(source)) return;
+  ThumbBinding* b = new ThumbBinding();
+  b->card = card;
+  b->icon = icon;
+  b->title = title;
+  b->source = source;
+  b->radius = radius;
+  b->attach_ms = millis();
+  g_thumb_bindings.push_back(b);
+  lv_obj_add_event_cb(card, thumb_event_cb, LV_EVENT_SIZE_CHANGED, b);
+  lv_obj_add_event_cb(card, thumb_event_cb, LV_EVENT_DELETE, b);
+#else
+  (void)card;
+  (void)image_path;
+  (void)radius;
+  (void)icon;
+  (void)title;
+#endif
+}
+
+static void apply_result(ThumbResult* res) {
+  clear_pending(res->key);
+  if (res->origin == THUMB_UNCHANGED) {
+    g_thumb_verified++;
+    return;
+  }
+  if (res->origin == THUMB_FAILED) {
+    g_thumb_failed++;
+    Serial.printf("[Thumb] %s: %s\n", res->key.c_str(), res->error.c_str());
+    return;
+  }
+  if (res->origin == THUMB_FROM_SD) {
+    g_thumb_sd_loads++;
+    g_thumb_sd_ms += res->ms;
+  } else {
+    g_thumb_generated++;
+    g_thumb_gen_ms += res->ms;
+    if (res->ms > g_thumb_gen_max_ms) g_thumb_gen_max_ms = res->ms;
+    Serial.printf("[Thumb] Erzeugt %ux%u in %lu ms: %s\n", res->header.w, res->header.h,
+                  static_cast<unsigned long>(res->ms), res->key.c_str());
+  }
+
+  ThumbKnown* known = find_known(res->key);
+  if (known) {
+    known->size = res->src_size;
+    known->mtime = res->src_mtime;
+  } else {
+    g_thumb_known.push_back({res->key, res->src_size, res->src_mtime});
+  }
+
+  // Neuer Stand ersetzt einen evtl. veralteten (z.B. nach neuem URL-Bild)
+  image_cache_drop(res->key);
+  const lv_image_dsc_t* pinned = image_cache_insert(res->key, res->src_size, res->src_mtime,
+                                                    res->buf, res->bytes, res->header);
+  res->buf = nullptr;
+  if (!pinned) return;
+  bool shown = false;
+  for (ThumbBinding* b : g_thumb_bindings) {
+    if (b->key != res->key || b->dsc == pinned) continue;
+    const lv_image_dsc_t* ref = image_cache_acquire(res->key, res->src_size, res->src_mtime);
+    if (!ref) continue;
+    show_thumb(b, ref);
+    shown = true;
+  }
+  image_cache_release(pinned);
+  if (shown) displayManager.markNextRender("Tile-Thumbnail");
+}
+
+void tile_thumb_service() {
+#if TILE_THUMB_ENABLED
+  if (!g_thumb_done || uxQueueMessagesWaiting(g_thumb_done) == 0) return;
+  LvglLock lock;
+  ThumbResult* res = nullptr;
+  while (xQueueReceive(g_thumb_done, &res, 0) == pdTRUE) {
+    if (!res) continue;
+    apply_result(res);
+    if (res->buf) heap_caps_free(res->buf);
+    delete res;
+  }
+#endif
+}
+
+void tile_thumb_source_changed(const String& sd_path) {
+#if TILE_THUMB_ENABLED
+  for (ThumbBinding* b : g_thumb_bindings) {
+    if (b->source != sd_path || b->key.length() == 0) continue;
+    for (size_t i = 0; i < g_thumb_known.size(); ++i) {
+      if (g_thumb_known[i].key == b->key) {
+        g_thumb_known.erase(g_thumb_known.begin() + i);
+        break;
+      }
+    }
+    queue_job(b, true);
+  }
+#else
+  (void)sd_path;
+#endif
+}
+
+void tile_thumb_log_stats() {
+  Serial.printf("[Thumb] %u Tiles | RAM-Hits: %lu, SD: %lu (avg %lu ms), neu: %lu (avg %lu / max %lu ms), "
+                "geprueft: %lu, Fehler: %lu, verworfen: %lu | Attach->Bild max %lu ms\n",
+                static_cast<unsigned>(g_thumb_bindings.size()),
+                static_cast<unsigned long>(g_thumb_ram_hits),
+                static_cast<unsigned long>(g_thumb_sd_loads),
+                static_cast<unsigned long>(g_thumb_sd_loads ? g_thumb_sd_ms / g_thumb_sd_loads : 0),
+                static_cast<unsigned long>(g_thumb_generated),
+                static_cast<unsigned long>(g_thumb_generated ? g_thumb_gen_ms / g_thumb_generated : 0),
+                static_cast<unsigned long>(g_thumb_gen_max_ms),
+                static_cast<unsigned long>(g_thumb_verified),
+                static_cast<unsigned long>(g_thumb_failed),
+                static_cast<unsigned long>(g_thumb_dropped),
+                static_cast<unsigned long>(g_thumb_bind_max_ms));
+}
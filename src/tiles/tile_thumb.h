@@ -0,0 +1,36 @@
+#ifndef TILE_THUMB_H
+#define TILE_THUMB_H
+
+#include <lvgl.h>
+#include <Arduino.h>
+
+// Thumbnails fuer Bild-Tiles: einmalig auf Card-Groesse skaliert (RGB565),
+// auf SD abgelegt und danach nur noch als Card-Hintergrund geblittet.
+// Erzeugen/Laden laeuft in einem Hintergrund-Task; bis das Thumbnail da ist,
+// zeigt das Tile wie bisher Icon und Titel.
+// 0 = keine Thumbnails (Vergleichsmessung Grid-Aufbau vorher/nachher).
+#ifndef TILE_THUMB_ENABLED
+#define TILE_THUMB_ENABLED 1
+#endif
+
+// Ablage: <Verzeichnis>/t<CRC32(Quelle)>_<B>x<H>.bin (LVGL-.bin + Quell-Groesse/mtime)
+#define TILE_THUMB_DIR "/_thumbs"
+
+// Haengt das Thumbnail an eine Bild-Card. image_path wie in der Tile-Konfiguration
+// (SD-Pfad oder URL; Diashow-Token bekommen kein Thumbnail). Die Groesse wird erst
+// nach dem Grid-Layout bekannt (LV_EVENT_SIZE_CHANGED), daher nach
+// tile_card_cache_attach aufrufen. icon/title werden beim Anzeigen umgestellt.
+void tile_thumb_attach(lv_obj_t* card, const String& image_path, uint8_t radius,
+                       lv_obj_t* icon, lv_obj_t* title);
+
+// Fertige Thumbnails an die Cards binden (Loop, holt selbst den LVGL-Lock)
+void tile_thumb_service();
+
+// Quelldatei wurde neu geschrieben (z.B. URL-Cache): Thumbnails neu erzeugen.
+// Nur im LVGL-Kontext aufrufen.
+void tile_thumb_source_changed(const String& sd_path);
+
+// Zaehler + Zeiten ins Serial-Log
+void tile_thumb_log_stats();
+
+#endif // TILE_THUMB_H
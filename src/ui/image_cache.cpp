@@ -0,0 +1,228 @@
+#include "src/ui/image_cache.h"
+#include <SD.h>
+#include <vector>
+#include <misc/cache/instance/lv_image_cache.h>
+#include "esp_heap_caps.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+/* === Cache-Eintraege === */
+struct ImageCacheEntry {
+  String path;
+  uint32_t file_size = 0;
+  uint32_t mtime = 0;
+  uint16_t refs = 0;
+  bool dropped = false;  // nicht mehr auffindbar, wird beim letzten release freigegeben
+  uint32_t last_use = 0;
+  uint8_t* buf = nullptr;
+  size_t bytes = 0;
+  lv_image_dsc_t dsc{};
+};
+
+static std::vector<ImageCacheEntry*> g_image_entries;
+static size_t g_image_cache_bytes = 0;
+static size_t g_image_cache_budget = IMAGE_CACHE_BUDGET_BYTES;
+static uint32_t g_image_cache_hits = 0;
+static uint32_t g_image_cache_misses = 0;
+static uint32_t g_image_cache_evictions = 0;
+static uint32_t g_image_cache_use_seq = 0;
+static SemaphoreHandle_t g_image_cache_mutex = nullptr;
+
+void image_cache_init() {
+  if (!g_image_cache_mutex) g_image_cache_mutex = xSemaphoreCreateMutex();
+  if (!g_image_cache_mutex) Serial.println("[ImageCache] Mutex konnte nicht angelegt werden");
+}
+
+// Mutex existiert seit image_cache_init(), also vor dem ersten Worker
+static void cache_lock() {
+  if (g_image_cache_mutex) xSemaphoreTake(g_image_cache_mutex, portMAX_DELAY);
+}
+
+static void cache_unlock() {
+  if (g_image_cache_mutex) xSemaphoreGive(g_image_cache_mutex);
+}
+
+static void free_entry(ImageCacheEntry* entry) {
+  if (!entry) return;
+  lv_image_cache_drop(&entry->dsc);
+  if (entry->buf) heap_caps_free(entry->buf);
+  g_image_cache_bytes -= entry->bytes;
+  delete entry;
+}
+
+static ImageCacheEntry* find_entry(const String& path, uint32_t size, uint32_t mtime) {
+  for (ImageCacheEntry* e : g_image_entries) {
+    if (!e->dropped && e->file_size == size && e->mtime == mtime && e->path == path) return e;
+  }
+  return nullptr;
+}
+
+static ImageCacheEntry* find_entry_by_dsc(const lv_image_dsc_t* dsc) {
+  for (ImageCacheEntry* e : g_image_entries) {
+    if (&e->dsc == dsc) return e;
+  }
+  return nullptr;
+}
+
+static void remove_entry(ImageCacheEntry* entry) {
+  for (size_t i = 0; i < g_image_entries.size(); ++i) {
+    if (g_image_entries[i] == entry) {
+      g_image_entries.erase(g_image_entries.begin() + i);
+      break;
+    }
+  }
+  free_entry(entry);
+}
+
+// Ungepinnte Eintraege nach LRU freigeben, bis der Cache ins Budget passt
+static void trim_to_budget() {
+  while (g_image_cache_bytes > g_image_cache_budget) {
+    size_t victim = g_image_entries.size();
+    for (size_t i = 0; i < g_image_entries.size(); ++i) {
+      ImageCacheEntry* e = g_image_entries[i];
+      if (e->refs != 0) continue;
+      if (victim == g_image_entries.size() || e->last_use < g_image_entries[victim]->last_use) {
+        victim = i;
+      }
+    }
+    if (victim == g_image_entries.size()) return;
+    free_entry(g_image_entries[victim]);
+    g_image_entries.erase(g_image_entries.begin() + victim);
+    g_image_cache_evictions++;
+  }
+}
+
+bool image_cache_stat(const String& path, uint32_t& size, uint32_t& mtime) {
+  File f = SD.open(path, FILE_READ);
+  if (!f) return false;
+  size = static_cast<uint32_t>(f.size());
+  mtime = static_cast<uint32_t>(f.getLastWrite());
+  f.close();
+  return true;
+}
+
+bool image_cache_contains(const String& path, uint32_t size, uint32_t mtime) {
+  cache_lock();
+  const bool found = find_entry(path, size, mtime) != nullptr;
+  cache_unlock();
+  return found;
+}
+
+const lv_image_dsc_t* image_cache_acquire(const String& path, uint32_t size, uint32_t mtime) {
+  cache_lock();
+  ImageCacheEntry* e = find_entry(path, size, mtime);
+  if (e) {
+    e->refs++;
+    e->last_use = ++g_image_cache_use_seq;
+    g_image_cache_hits++;
+  } else {
+    g_image_cache_misses++;
+  }
+  cache_unlock();
+  return e ? &e->dsc : nullptr;
+}
+
+const lv_image_dsc_t* image_cache_insert(const String& path, uint32_t size, uint32_t mtime,
+                                         uint8_t* buf, size_t bytes, const lv_image_header_t& header) {
+  if (!buf) return nullptr;
+  cache_lock();
+  ImageCacheEntry* existing = find_entry(path, size, mtime);
+  if (existing) {
+    // Parallel schon geladen (z.B. Prefetch + Popup): vorhandenen Eintrag nutzen
+    existing->refs++;
+    existing->last_use = ++g_image_cache_use_seq;
+    cache_unlock();
+    heap_caps_free(buf);
+    return &existing->dsc;
+  }
+
+  // Aeltere Versionen derselben Datei verwerfen
+  for (size_t i = 0; i < g_image_entries.size();) {
+    ImageCacheEntry* e = g_image_entries[i];
+    if (e->path == path && e->refs == 0) {
+      g_image_entries.erase(g_image_entries.begin() + i);
+      free_entry(e);
+      continue;
+    }
+    if (e->path == path) e->dropped = true;
+    ++i;
+  }
+
+  ImageCacheEntry* e = new ImageCacheEntry();
+  e->path = path;
+  e->file_size = size;
+  e->mtime = mtime;
+  e->refs = 1;
+  e->last_use = ++g_image_cache_use_seq;
+  e->buf = buf;
+  e->bytes = bytes;
+  e->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+  e->dsc.header.cf = header.cf;
+  e->dsc.header.w = header.w;
+  e->dsc.header.h = header.h;
+  e->dsc.header.stride = header.stride;
+  e->dsc.data = buf;
+  e->dsc.data_size = bytes;
+  g_image_entries.push_back(e);
+  g_image_cache_bytes += bytes;
+  trim_to_budget();
+  cache_unlock();
+  return &e->dsc;
+}
+
+void image_cache_release(const lv_image_dsc_t* dsc) {
+  if (!dsc) return;
+  cache_lock();
+  ImageCacheEntry* e = find_entry_by_dsc(dsc);
+  if (e) {
+    if (e->refs > 0) e->refs--;
+    if (e->refs == 0 && e->dropped) {
+      remove_entry(e);
+    } else {
+      trim_to_budget();
+    }
+  }
+  cache_unlock();
+}
+
+void image_cache_drop(const String& path) {
+  cache_lock();
+  for (size_t i = 0; i < g_image_entries.size();) {
+    ImageCacheEntry* e = g_image_entries[i];
+    if (e->path != path) {
+      ++i;
+      continue;
+    }
+    if (e->refs == 0) {
+      g_image_entries.erase(g_image_entries.begin() + i);
+      free_entry(e);
+      continue;
+    }
+    e->dropped = true;
+    ++i;
+  }
+  cache_unlock();
+}
+
+void image_cache_set_budget(size_t bytes) {
+  cache_lock();
+  g_image_cache_budget = bytes;
+  trim_to_budget();
+  cache_unlock();
+}
+
+ImageCacheStats image_cache_get_stats() {
+  ImageCacheStats s{};
+  cache_lock();
+  s.entries = static_cast<uint32_t>(g_image_entries.size());
+  for (ImageCacheEntry* e : g_image_entries) {
+    if (e->refs) s.pinned++;
+  }
+  s.bytes = g_image_cache_bytes;
+  s.budget = g_image_cache_budget;
+  s.hits = g_image_cache_hits;
+  s.misses = g_image_cache_misses;
+  s.evictions = g_image_cache_evictions;
+  cache_unlock();
+  return s;
+}
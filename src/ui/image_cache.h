@@ -0,0 +1,54 @@
+#ifndef IMAGE_CACHE_H
+#define IMAGE_CACHE_H
+
+#include <lvgl.h>
+#include <Arduino.h>
+
+// LRU-Cache fuer fertig dekodierte Bilder (RGB565 usw.) in PSRAM, gemeinsam fuer
+// Image-Popup, Diashow und Bild-Tiles. Schluessel: Pfad + Dateigroesse + mtime,
+// d.h. eine geaenderte Datei ergibt automatisch einen neuen Eintrag.
+// Angezeigte Bilder sind gepinnt (acquire/release) und werden nie verdraengt.
+#ifndef IMAGE_CACHE_BUDGET_BYTES
+#define IMAGE_CACHE_BUDGET_BYTES (12UL * 1024UL * 1024UL)
+#endif
+
+struct ImageCacheStats {
+  uint32_t entries;
+  uint32_t pinned;
+  size_t bytes;
+  size_t budget;
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+};
+
+// Legt den Mutex an; einmal in setup() aufrufen, bevor URL-Cache-, Prefetch- oder
+// Thumbnail-Worker starten
+void image_cache_init();
+
+// Groesse + mtime einer SD-Datei (Cache-Schluessel)
+bool image_cache_stat(const String& path, uint32_t& size, uint32_t& mtime);
+
+// Nur pruefen (zaehlt nicht als Hit/Miss, threadsicher)
+bool image_cache_contains(const String& path, uint32_t size, uint32_t mtime);
+
+// Folgende Funktionen nur im LVGL-Kontext aufrufen (Eintraege werden aus dem
+// LVGL-Image-Cache entfernt, sobald sie freigegeben werden).
+
+// Treffer: gepinnter Deskriptor, sonst nullptr
+const lv_image_dsc_t* image_cache_acquire(const String& path, uint32_t size, uint32_t mtime);
+
+// Uebernimmt buf (heap_caps_malloc) und liefert den gepinnten Deskriptor.
+// Ueberschreitet der Cache das Budget, werden ungepinnte Eintraege nach LRU verdraengt.
+const lv_image_dsc_t* image_cache_insert(const String& path, uint32_t size, uint32_t mtime,
+                                         uint8_t* buf, size_t bytes, const lv_image_header_t& header);
+
+void image_cache_release(const lv_image_dsc_t* dsc);
+
+// Alle Eintraege zu einem Pfad verwerfen (gepinnte erst beim letzten release)
+void image_cache_drop(const String& path);
+
+void image_cache_set_budget(size_t bytes);
+ImageCacheStats image_cache_get_stats();
+
+#endif // IMAGE_CACHE_H
@@ -2,7 +2,16 @@
 #include "sensor_popup.h"
 #include "light_popup.h"
 #include "src/core/display_manager.h"
+#include "src/core/metrics.h"
+#include "src/core/sd_io.h"
+#include "src/ui/image_cache.h"
+#include "src/ui/image_resample.h"
+#include "src/ui/image_rle.h"
+#include "src/ui/sd_image_index.h"
+#include "src/ui/url_cache_meta.h"
+#include "src/ui/url_refresh_sched.h"
 #include "src/tiles/tile_config.h"
+#include "src/tiles/tile_thumb.h"
 #include <SD.h>
 #include <M5Unified.h>
 #include <vector>
@@ -18,6 +27,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
+#include <freertos/semphr.h>
 
 // Globaler Context fuer das Image Popup
 static lv_obj_t* g_image_popup_overlay = nullptr;
@@ -44,59 +54,89 @@ static size_t g_slideshow_prev_lines = 0;
 static lv_display_render_mode_t g_slideshow_prev_mode = LV_DISPLAY_RENDER_MODE_PARTIAL;
 static bool g_slideshow_buffer_override = false;
 static constexpr size_t kJpegWorkbufSize = 4096;
-static lv_image_dsc_t g_image_ram_dsc;
-static uint8_t* g_image_ram_buf = nullptr;
-static size_t g_image_ram_buf_size = 0;
+static const lv_image_dsc_t* g_image_ram_dsc = nullptr;  // gepinnter Eintrag im Image-Cache
 static bool g_image_ram_active = false;
 static String g_image_ram_source;
 static String g_open_url;
 static const char* kUrlCacheDir = "/_url_cache";
-static constexpr uint32_t kUrlCacheIntervalMs = 1000UL;
+static constexpr uint32_t kUrlCacheIntervalMs = 5000UL;  // Abgleich mit der Tile-Konfiguration
 static constexpr uint32_t kUrlCacheInitialDelayMs = 30UL * 1000UL;
 static uint32_t g_url_cache_next_ms = 0;
 
-struct UrlCacheEntry {
-  String url;
-  String bin_path;
-  uint32_t interval_ms = 0;
-  uint32_t next_due_ms = 0;
-};
-
-static std::vector<UrlCacheEntry> g_url_cache_entries;
-static QueueHandle_t g_url_cache_queue = nullptr;
+// Refresh-Termine liegen im Scheduler (sichtbar zuerst, dann frueheste Faelligkeit);
+// Worker schlafen bis zum naechsten Termin oder bis zur Benachrichtigung.
+static UrlRefreshScheduler g_url_sched;
+static SemaphoreHandle_t g_url_sched_lock = nullptr;  // image_popup_init(), vor allen Workern
+static uint8_t g_url_visible_tab = 0xFF;               // Tab, dessen URL-Tiles sichtbar sind
 static QueueHandle_t g_url_cache_done_queue = nullptr;
-static TaskHandle_t g_url_cache_task = nullptr;
+static TaskHandle_t g_url_cache_tasks[URL_CACHE_MAX_INFLIGHT] = {};
 static bool g_url_cache_worker_ready = false;
 static portMUX_TYPE g_url_cache_mux = portMUX_INITIALIZER_UNLOCKED;
-static std::vector<String> g_url_cache_queued;
-static std::vector<String> g_url_cache_inflight;
 struct UrlCancelEntry {
   uint32_t hash;
   uint16_t len;
 };
 static std::vector<UrlCancelEntry> g_url_cache_cancel;
+static MetricCounter g_url_jobs_updated("tab5_url_cache_jobs_total", "Abgeschlossene URL-Cache-Jobs", "result=\"updated\"");
+static MetricCounter g_url_jobs_unchanged("tab5_url_cache_jobs_total", "Abgeschlossene URL-Cache-Jobs", "result=\"unchanged\"");
+static MetricCounter g_url_jobs_error("tab5_url_cache_jobs_total", "Abgeschlossene URL-Cache-Jobs", "result=\"error\"");
+static MetricCounter g_url_jobs_cancelled("tab5_url_cache_jobs_total", "Abgeschlossene URL-Cache-Jobs", "result=\"cancelled\"");
 static constexpr size_t kUrlJobMaxLen = 256;
 static constexpr UBaseType_t kUrlQueueLen = 32;
 
 struct UrlJob {
   char url[kUrlJobMaxLen];
 };
+
+// Diashow-Prefetch: Bild N+1 wird im Hintergrund in einen zweiten PSRAM-Puffer
+// geladen, waehrend Bild N angezeigt wird. slideshow_tick tauscht nur noch den Puffer.
+enum class SlidePrefetchState : uint8_t {
+  Idle,
+  Busy,
+  Ready,
+  Failed
+};
+
+struct SlidePrefetchSlot {
+  SlidePrefetchState state = SlidePrefetchState::Idle;
+  uint32_t gen = 0;
+  size_t index = 0;
+  uint32_t file_size = 0;  // Cache-Schluessel
+  uint32_t mtime = 0;
+  uint8_t* buf = nullptr;
+  size_t size = 0;
+  lv_image_header_t header{};
+};
+
+struct SlidePrefetchJob {
+  uint32_t gen;
+  size_t index;
+  char path[kUrlJobMaxLen];
+};
+
+static SlidePrefetchSlot g_slide_prefetch;
+static volatile uint32_t g_slide_prefetch_gen = 0;  // Erhoehen = laufenden Prefetch abbrechen
+static QueueHandle_t g_slide_prefetch_queue = nullptr;
+static TaskHandle_t g_slide_prefetch_task = nullptr;
+static portMUX_TYPE g_slide_prefetch_mux = portMUX_INITIALIZER_UNLOCKED;
+static constexpr uint32_t kSlidePrefetchRetryMs = 50UL;
+static constexpr size_t kBinReadChunk = 32 * 1024;
+static constexpr size_t kUrlStreamRingSize = 64 * 1024;
+static constexpr uint32_t kUrlStreamTimeoutMs = 15000UL;
 static void show_image_popup_error(const char* title, const char* path);
 static void apply_slideshow_display_mode(bool enable);
 static void schedule_popup_restore();
 static void cancel_popup_restore();
 static void free_image_ram();
+static void release_slide_prefetch();
 static String make_url_cache_bin_path(const String& url);
-static void register_url_cache_entry(const String& url);
-static bool update_url_cache(const String& url, String& out_bin_path, String& error);
+static bool update_url_cache(const String& url, String& out_bin_path, bool& changed, String& error);
 static void refresh_url_cache_entries(uint32_t now);
 static void ensure_url_cache_worker();
 static bool enqueue_url_job(const String& url);
+static void wake_url_cache_workers();
 static void url_cache_yield();
 static void process_url_cache_done();
-static void mark_url_cache_queued(const String& url, uint32_t now);
-static bool url_list_contains(const std::vector<String>& list, const String& url);
-static void url_list_remove(std::vector<String>& list, const String& url);
 static void request_url_cache_cancel(const String& url);
 static void clear_url_cache_cancel(const String& url);
 static bool url_cache_should_cancel(uint32_t hash, uint16_t len);
@@ -275,9 +315,12 @@ static void* alloc_image_buf(size_t size, bool prefer_psram) {
 }
 
 static void url_cache_yield() {
-  if (g_url_cache_task && xTaskGetCurrentTaskHandle() == g_url_cache_task) {
-    vTaskDelay(1);
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  bool background = g_slide_prefetch_task && self == g_slide_prefetch_task;
+  for (size_t i = 0; i < URL_CACHE_MAX_INFLIGHT && !background; ++i) {
+    background = g_url_cache_tasks[i] && self == g_url_cache_tasks[i];
   }
+  if (background) vTaskDelay(1);
 }
 
 static bool ensure_url_cache_dir() {
@@ -297,11 +340,38 @@ static String make_url_cache_bin_path(const String& url) {
   return make_url_cache_base(url) + ".bin";
 }
 
+static String make_url_cache_meta_path(const String& url) {
+  return make_url_cache_base(url) + ".meta";
+}
+
+static bool load_url_cache_meta(const String& meta_path, UrlCacheMeta& meta) {
+  meta = UrlCacheMeta();
+  File f = SD.open(meta_path, FILE_READ);
+  if (!f) return false;
+  String text = f.readString();
+  f.close();
+  return url_cache_meta_parse(text, meta);
+}
+
+static bool save_url_cache_meta(const String& meta_path, const UrlCacheMeta& meta) {
+  if (SD.exists(meta_path)) SD.remove(meta_path);
+  File f = SD.open(meta_path, FILE_WRITE);
+  if (!f) return false;
+  String body = url_cache_meta_format(meta);
+  bool ok = f.print(body) == body.length();
+  f.close();
+  return ok;
+}
+
 static bool write_bin_file(const String& bin_path, const lv_image_header_t& header, const uint8_t* data, size_t data_len, String& error) {
   if (!data || data_len == 0) {
     error = "Leere Bilddaten";
     return false;
   }
+  // Bevorzugt komprimiert; faellt auf das normale LVGL-.bin zurueck, wenn RLE nichts bringt
+  size_t rle_size = 0;
+  if (image_rle_write_file(bin_path, header, data, data_len, rle_size, error)) return true;
+  if (error.length()) return false;
   if (SD.exists(bin_path)) {
     SD.remove(bin_path);
   }
@@ -325,9 +395,14 @@ static bool write_bin_file(const String& bin_path, const lv_image_header_t& head
   return true;
 }
 
-static bool download_url_to_sd(const String& url, const String& target_base, String& out_path, String& error,
-                               uint32_t cancel_hash, uint16_t cancel_len) {
-  HTTPClient http;
+// Baut den GET-Request auf. cond: Validatoren des vorhandenen Cache-Eintrags
+// (nullptr = unbedingt laden). Bei 304 ist not_modified gesetzt und die Verbindung
+// bereits geschlossen; bei 200 liegt der Body in http.getStreamPtr().
+static bool begin_url_request(HTTPClient& http, WiFiClientSecure& secure_client, const String& url,
+                              uint32_t cancel_hash, uint16_t cancel_len, const UrlCacheMeta* cond,
+                              UrlCacheMeta& out_meta, bool& not_modified, String& out_ext, String& error) {
+  not_modified = false;
+  out_meta = UrlCacheMeta();
   bool https = false;
   String host;
   uint16_t port = 0;
@@ -338,11 +413,6 @@ static bool download_url_to_sd(const String& url, const String& target_base, Str
     url_cache_consume_cancel(cancel_hash, cancel_len);
     return false;
   }
-  if (!ensure_url_cache_dir()) {
-    error = "Cache Ordner Fehler";
-    return false;
-  }
-  WiFiClientSecure secure_client;
   if (https) {
     secure_client.setInsecure();
     if (!http.begin(secure_client, host, port, path, true)) {
@@ -367,10 +437,21 @@ static bool download_url_to_sd(const String& url, const String& target_base, Str
   http.setAcceptEncoding("identity");
   http.addHeader("Connection", "close");
   http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+  if (cond && cond->etag.length() > 0) {
+    http.addHeader("If-None-Match", cond->etag);
+  }
+  if (cond && cond->last_modified.length() > 0) {
+    http.addHeader("If-Modified-Since", cond->last_modified);
+  }
 
-  const char* headers[] = {"Content-Type"};
-  http.collectHeaders(headers, 1);
+  const char* headers[] = {"Content-Type", "ETag", "Last-Modified"};
+  http.collectHeaders(headers, 3);
   int code = http.GET();
+  if (code == HTTP_CODE_NOT_MODIFIED && cond) {
+    not_modified = true;
+    http.end();
+    return true;
+  }
   if (code != HTTP_CODE_OK) {
     if (code <= 0) {
       error = HTTPClient::errorToString(code);
@@ -388,13 +469,35 @@ static bool download_url_to_sd(const String& url, const String& target_base, Str
     return false;
   }
 
-  String ext = guess_url_extension(url, http.header("Content-Type"));
-  if (ext.length() == 0) {
+  out_ext = guess_url_extension(url, http.header("Content-Type"));
+  if (out_ext.length() == 0) {
     error = "Unbekannter Bildtyp";
     http.end();
     return false;
   }
 
+  out_meta.etag = http.header("ETag");
+  out_meta.last_modified = http.header("Last-Modified");
+  return true;
+}
+
+// Laedt den Body unveraendert nach <target_base>.<ext> (Fallback ohne Stream-Decode)
+static bool download_url_to_sd(const String& url, const String& target_base, String& out_path, String& error,
+                               uint32_t cancel_hash, uint16_t cancel_len, const UrlCacheMeta* cond,
+                               UrlCacheMeta& out_meta, bool& not_modified) {
+  if (!ensure_url_cache_dir()) {
+    error = "Cache Ordner Fehler";
+    return false;
+  }
+  HTTPClient http;
+  WiFiClientSecure secure_client;
+  String ext;
+  if (!begin_url_request(http, secure_client, url, cancel_hash, cancel_len, cond, out_meta, not_modified, ext,
+                         error)) {
+    return false;
+  }
+  if (not_modified) return true;
+
   out_path = target_base + ext;
   if (SD.exists(out_path)) {
     SD.remove(out_path);
@@ -409,9 +512,11 @@ static bool download_url_to_sd(const String& url, const String& target_base, Str
   WiFiClient* stream = http.getStreamPtr();
   int remaining = http.getSize();
   uint8_t buffer[1024];
+  SdBufferedWriter writer(f);
   while (http.connected() && (remaining > 0 || remaining == -1)) {
     if (url_cache_should_cancel(cancel_hash, cancel_len)) {
       error = "Abgebrochen";
+      writer.flush();
       f.close();
       http.end();
       SD.remove(out_path);
@@ -422,7 +527,8 @@ static bool download_url_to_sd(const String& url, const String& target_base, Str
     if (available) {
       int read_len = stream->readBytes(buffer, available > sizeof(buffer) ? sizeof(buffer) : available);
       if (read_len > 0) {
-        f.write(buffer, read_len);
+        writer.write(buffer, read_len);
+        url_cache_meta_add(out_meta, buffer, read_len);
         if (remaining > 0) remaining -= read_len;
       }
       url_cache_yield();
@@ -431,8 +537,14 @@ static bool download_url_to_sd(const String& url, const String& target_base, Str
     }
   }
 
+  const bool write_ok = writer.flush();
   f.close();
   http.end();
+  if (!write_ok) {
+    error = "SD Schreibfehler";
+    SD.remove(out_path);
+    return false;
+  }
   if (url_cache_should_cancel(cancel_hash, cancel_len)) {
     error = "Abgebrochen";
     SD.remove(out_path);
@@ -443,6 +555,7 @@ static bool download_url_to_sd(const String& url, const String& target_base, Str
     error = "Download fehlgeschlagen";
     return false;
   }
+  out_meta.valid = out_meta.size > 0;
   return true;
 }
 
@@ -458,29 +571,38 @@ static uint32_t normalize_url_cache_interval_ms(uint16_t sec) {
   return static_cast<uint32_t>(sec) * 1000;
 }
 
-static bool url_list_contains(const std::vector<String>& list, const String& url) {
-  for (const auto& entry : list) {
-    if (entry == url) return true;
+class UrlSchedLock {
+public:
+  UrlSchedLock() {
+    if (g_url_sched_lock) xSemaphoreTake(g_url_sched_lock, portMAX_DELAY);
   }
-  return false;
-}
-
-static void url_list_remove(std::vector<String>& list, const String& url) {
-  for (auto it = list.begin(); it != list.end(); ++it) {
-    if (*it == url) {
-      list.erase(it);
-      return;
-    }
+  ~UrlSchedLock() {
+    if (g_url_sched_lock) xSemaphoreGive(g_url_sched_lock);
   }
+  UrlSchedLock(const UrlSchedLock&) = delete;
+  UrlSchedLock& operator=(const UrlSchedLock&) = delete;
+};
+
+static UrlSchedStats url_sched_stats_locked() {
+  UrlSchedLock lock;
+  return g_url_sched.stats();
 }
+static MetricCallback g_url_sched_entries_metric("tab5_url_cache_entries", "Geplante URL-Cache-Eintraege", MetricType::Gauge,
+                                                 []() -> double { return url_sched_stats_locked().entries; });
+static MetricCallback g_url_sched_inflight_metric("tab5_url_cache_inflight", "Laufende URL-Cache-Jobs", MetricType::Gauge,
+                                                  []() -> double { return url_sched_stats_locked().inflight; });
 
 static void request_url_cache_cancel(const String& url) {
   String normalized = url;
   normalized.trim();
   if (!is_url_path(normalized)) return;
   uint32_t hash = hash_url(normalized);
+  bool pending;
+  {
+    UrlSchedLock lock;
+    pending = g_url_sched.isPending(normalized, millis());
+  }
   portENTER_CRITICAL(&g_url_cache_mux);
-  bool pending = url_list_contains(g_url_cache_queued, normalized) || url_list_contains(g_url_cache_inflight, normalized);
   if (pending) {
     uint16_t len = static_cast<uint16_t>(normalized.length());
     bool exists = false;
@@ -560,6 +682,7 @@ static void stop_slideshow(bool restore_display) {
     lv_timer_del(g_slideshow_timer);
     g_slideshow_timer = nullptr;
   }
+  release_slide_prefetch();
   g_slideshow_files.clear();
   g_slideshow_index = 0;
   if (restore_display) {
@@ -577,92 +700,108 @@ static bool ends_with_ignore_case(const String& value, const char* suffix) {
   return v.endsWith(s);
 }
 
-struct JpegDecodeContext {
-  File* file;
-  uint16_t src_w;
-  uint16_t src_h;
-  uint16_t dst_w;
-  uint16_t dst_h;
-  uint16_t* dst_buf;
-  uint16_t* x_start;
-  uint16_t* x_end;
-  uint16_t* y_start;
-  uint16_t* y_end;
+// JPEG-Pfad: tjpgd dekodiert mit 1/2, 1/4 oder 1/8 (naechste Stufe ueber Zielgroesse),
+// danach separabler Resampler (Box beim Verkleinern, bilinear beim Vergroessern)
+// auf kompletten MCU-Zeilen.
+// Eingabequelle fuer tjpgd: buf == nullptr bedeutet ueberspringen.
+// tjpgd liest strikt vorwaerts, daher genuegt auch ein nicht-seekbarer Stream.
+typedef size_t (*JpegInputFn)(void* arg, uint8_t* buf, size_t len);
+
+// Resampler-Zustand (image_resample.h) plus Eingabe, MCU-Band und Abbruchbedingungen
+struct JpegDecodeContext : RowResampler {
+  JpegInputFn input;
+  void* input_arg;
+  uint8_t* band;        // eine MCU-Zeile RGB888 (src_w x band_h)
+  uint16_t band_h;
   bool cancel_active;
   uint32_t cancel_hash;
   uint16_t cancel_len;
+  const volatile uint32_t* abort_gen;  // Prefetch: Abbruch sobald Generation wechselt
+  uint32_t abort_expect;
 };
 
+static inline bool jpeg_ctx_aborted(const JpegDecodeContext* ctx) {
+  if (ctx->abort_gen && *ctx->abort_gen != ctx->abort_expect) return true;
+  return ctx->cancel_active && url_cache_should_cancel(ctx->cancel_hash, ctx->cancel_len);
+}
+
 static size_t tjpgd_input(JDEC* jd, uint8_t* buff, size_t ndata) {
   JpegDecodeContext* ctx = static_cast<JpegDecodeContext*>(jd->device);
-  if (!ctx || !ctx->file) return 0;
-  if (buff) return ctx->file->read(buff, ndata);
-  uint32_t pos = ctx->file->position();
-  ctx->file->seek(pos + ndata);
-  return ndata;
+  if (!ctx || !ctx->input) return 0;
+  return ctx->input(ctx->input_arg, buff, ndata);
+}
+
+static size_t sd_reader_input(void* arg, uint8_t* buf, size_t len) {
+  SdBufferedReader* reader = static_cast<SdBufferedReader*>(arg);
+  if (buf) return reader->read(buf, len);
+  return reader->skip(len) ? len : 0;
 }
 
 static int tjpgd_output(JDEC* jd, void* bitmap, JRECT* rect) {
   JpegDecodeContext* ctx = static_cast<JpegDecodeContext*>(jd->device);
-  if (!ctx || !ctx->dst_buf || !ctx->x_start || !ctx->x_end || !ctx->y_start || !ctx->y_end) return 0;
-  if (!bitmap || !rect) return 0;
-  if (ctx->cancel_active && url_cache_should_cancel(ctx->cancel_hash, ctx->cancel_len)) return 0;
+  if (!ctx || !ctx->dst_buf || !ctx->band || !bitmap || !rect) return 0;
+  if (jpeg_ctx_aborted(ctx)) return 0;
 
   const uint16_t rect_w = rect->right - rect->left + 1;
   const uint16_t rect_h = rect->bottom - rect->top + 1;
   const uint8_t* src = static_cast<const uint8_t*>(bitmap);
 
-  for (uint16_t y = 0; y < rect_h; ++y) {
-    const uint16_t src_y = rect->top + y;
-    if (src_y >= ctx->src_h) continue;
-    uint16_t dst_y0 = ctx->y_start[src_y];
-    uint16_t dst_y1 = ctx->y_end[src_y];
-    if (dst_y0 >= ctx->dst_h) continue;
-    if (dst_y1 >= ctx->dst_h) dst_y1 = ctx->dst_h - 1;
-    if (dst_y1 < dst_y0) dst_y1 = dst_y0;
-    const uint8_t* src_row = src + (static_cast<size_t>(y) * rect_w * 3U);
-    for (uint16_t x = 0; x < rect_w; ++x) {
-      const uint16_t src_x = rect->left + x;
-      if (src_x >= ctx->src_w) continue;
-      uint16_t dst_x0 = ctx->x_start[src_x];
-      uint16_t dst_x1 = ctx->x_end[src_x];
-      if (dst_x0 >= ctx->dst_w) continue;
-      if (dst_x1 >= ctx->dst_w) dst_x1 = ctx->dst_w - 1;
-      if (dst_x1 < dst_x0) dst_x1 = dst_x0;
-      const uint8_t b = src_row[x * 3U + 0];
-      const uint8_t g = src_row[x * 3U + 1];
-      const uint8_t r = src_row[x * 3U + 2];
-      uint16_t rgb565 = static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
-      rgb565 = static_cast<uint16_t>((rgb565 >> 8) | (rgb565 << 8));
-      for (uint16_t dy = dst_y0; dy <= dst_y1; ++dy) {
-        uint16_t* dst_row = ctx->dst_buf + (static_cast<size_t>(dy) * ctx->dst_w);
-        for (uint16_t dx = dst_x0; dx <= dst_x1; ++dx) {
-          dst_row[dx] = rgb565;
-        }
-      }
-    }
-    if ((y & 0x0F) == 0) {
-      url_cache_yield();
+  // MCU-Block ins Band kopieren
+  for (uint16_t y = 0; y < rect_h && y < ctx->band_h; ++y) {
+    if (rect->left >= ctx->src_w) break;
+    uint16_t copy_w = rect_w;
+    if (rect->left + copy_w > ctx->src_w) copy_w = ctx->src_w - rect->left;
+    memcpy(ctx->band + (static_cast<size_t>(y) * ctx->src_w + rect->left) * 3U,
+           src + static_cast<size_t>(y) * rect_w * 3U, static_cast<size_t>(copy_w) * 3U);
+  }
+
+  // Letzter Block der MCU-Zeile -> ganze Zeile resamplen
+  if (rect->right + 1 >= ctx->src_w) {
+    const uint16_t rows = (rect_h < ctx->band_h) ? rect_h : ctx->band_h;
+    for (uint16_t y = 0; y < rows; ++y) {
+      image_resample_push_row(ctx, ctx->band + static_cast<size_t>(y) * ctx->src_w * 3U);
     }
+    url_cache_yield();
   }
   return 1;
 }
 
+// Gibt nur den Pin frei, das Bild bleibt im Image-Cache
 static void free_image_ram() {
-  if (g_image_ram_buf) {
-    lv_free(g_image_ram_buf);
-    g_image_ram_buf = nullptr;
+  if (g_image_ram_dsc) {
+    image_cache_release(g_image_ram_dsc);
+    g_image_ram_dsc = nullptr;
   }
-  g_image_ram_buf_size = 0;
   g_image_ram_active = false;
   g_image_ram_source = "";
-  memset(&g_image_ram_dsc, 0, sizeof(g_image_ram_dsc));
 }
 
-static bool calc_contain_size(uint16_t src_w, uint16_t src_h, uint16_t& dst_w, uint16_t& dst_h) {
-  if (src_w == 0 || src_h == 0) return false;
-  int32_t scale_x = static_cast<int32_t>(SCREEN_WIDTH) * LV_SCALE_NONE / static_cast<int32_t>(src_w);
-  int32_t scale_y = static_cast<int32_t>(SCREEN_HEIGHT) * LV_SCALE_NONE / static_cast<int32_t>(src_h);
+// Zielrahmen fuer den JPEG-Decode: Standard ist der ganze Bildschirm (contain).
+// cover: Ergebnis deckt den Rahmen mindestens ab (Tile-Thumbnails, Zuschnitt beim Aufrufer).
+struct JpegFitBox {
+  uint16_t w = SCREEN_WIDTH;
+  uint16_t h = SCREEN_HEIGHT;
+  bool cover = false;
+};
+
+static bool calc_fit_size(uint16_t src_w, uint16_t src_h, const JpegFitBox& fit, uint16_t& dst_w, uint16_t& dst_h) {
+  if (src_w == 0 || src_h == 0 || fit.w == 0 || fit.h == 0) return false;
+  if (fit.cover) {
+    // Exakt rechnen: bei kleinen Rahmen reicht die LV_SCALE-Aufloesung nicht
+    uint32_t w = fit.w;
+    uint32_t h = fit.h;
+    if (static_cast<uint32_t>(fit.w) * src_h >= static_cast<uint32_t>(fit.h) * src_w) {
+      h = (static_cast<uint32_t>(src_h) * fit.w + src_w - 1) / src_w;
+    } else {
+      w = (static_cast<uint32_t>(src_w) * fit.h + src_h - 1) / src_h;
+    }
+    if (w > 0xFFFF || h > 0xFFFF) return false;
+    dst_w = static_cast<uint16_t>(w);
+    dst_h = static_cast<uint16_t>(h);
+    return true;
+  }
+  int32_t scale_x = static_cast<int32_t>(fit.w) * LV_SCALE_NONE / static_cast<int32_t>(src_w);
+  int32_t scale_y = static_cast<int32_t>(fit.h) * LV_SCALE_NONE / static_cast<int32_t>(src_h);
   int32_t scale = LV_MIN(scale_x, scale_y);
   if (scale <= 0) scale = LV_SCALE_NONE;
   int32_t w = static_cast<int32_t>(src_w) * scale / LV_SCALE_NONE;
@@ -674,276 +813,281 @@ static bool calc_contain_size(uint16_t src_w, uint16_t src_h, uint16_t& dst_w, u
   return true;
 }
 
-static bool decode_jpeg_to_ram(const String& fullPath, lv_image_header_t& header, String& error) {
-  free_image_ram();
-  File f = SD.open(fullPath, FILE_READ);
-  if (!f) {
-    error = "JPEG Datei nicht lesbar";
-    return false;
-  }
+// Gepinnten Cache-Eintrag als aktuelles Popup-Bild uebernehmen (alter Pin wird danach freigegeben)
+static void set_image_ram(const lv_image_dsc_t* pinned, const String& source) {
+  const lv_image_dsc_t* old = g_image_ram_dsc;
+  g_image_ram_dsc = pinned;
+  g_image_ram_active = true;
+  g_image_ram_source = source;
+  if (old) image_cache_release(old);
+}
 
-  uint8_t* work = static_cast<uint8_t*>(lv_malloc(kJpegWorkbufSize));
+// Dekodiert ein JPEG passend auf den Zielrahmen (Standard: contain auf 1280x720).
+// Ziel-Puffer kommt aus alloc_dst.
+static bool decode_jpeg_source(JpegInputFn input, void* input_arg, void* (*alloc_dst)(size_t), void (*free_dst)(void*),
+                               bool cancel_active, uint32_t cancel_hash, uint16_t cancel_len,
+                               uint16_t*& out_buf, uint16_t& out_w, uint16_t& out_h, String& error,
+                               const volatile uint32_t* abort_gen, uint32_t abort_expect,
+                               const JpegFitBox& fit = JpegFitBox()) {
+  out_buf = nullptr;
+  out_w = 0;
+  out_h = 0;
+  const uint32_t start_ms = millis();
+  uint8_t* work = static_cast<uint8_t*>(alloc_image_buf(kJpegWorkbufSize, false));
   if (!work) {
-    f.close();
     error = "Kein RAM fuer JPEG";
     return false;
   }
 
   JDEC jd;
   JpegDecodeContext ctx{};
-  ctx.file = &f;
-  ctx.cancel_active = false;
-  ctx.cancel_hash = 0;
-  ctx.cancel_len = 0;
+  ctx.input = input;
+  ctx.input_arg = input_arg;
+  ctx.cancel_active = cancel_active;
+  ctx.cancel_hash = cancel_hash;
+  ctx.cancel_len = cancel_len;
+  ctx.abort_gen = abort_gen;
+  ctx.abort_expect = abort_expect;
 
   JRESULT rc = jd_prepare(&jd, tjpgd_input, work, kJpegWorkbufSize, &ctx);
   if (rc != JDR_OK) {
-    lv_free(work);
-    f.close();
+    heap_caps_free(work);
     error = "JPEG Header Fehler";
     return false;
   }
 
-  ctx.src_w = jd.width;
-  ctx.src_h = jd.height;
-  if (!calc_contain_size(ctx.src_w, ctx.src_h, ctx.dst_w, ctx.dst_h)) {
-    lv_free(work);
-    f.close();
+  if (!calc_fit_size(jd.width, jd.height, fit, ctx.dst_w, ctx.dst_h)) {
+    heap_caps_free(work);
     error = "JPEG Groesse ungueltig";
     return false;
   }
 
-  size_t dst_pixels = static_cast<size_t>(ctx.dst_w) * ctx.dst_h;
-  g_image_ram_buf_size = dst_pixels * 2U;
-  g_image_ram_buf = static_cast<uint8_t*>(lv_malloc(g_image_ram_buf_size));
-  if (!g_image_ram_buf) {
-    lv_free(work);
-    f.close();
-    error = "Kein RAM fuer Zielbild";
+#if JD_USE_SCALE
+  const uint8_t scale = jpeg_pick_scale(jd.width, jd.height, ctx.dst_w, ctx.dst_h);
+#else
+  const uint8_t scale = 0;
+#endif
+  ctx.src_w = jpeg_scaled_dim(jd.width, static_cast<uint16_t>(jd.msx * 8U), scale);
+  ctx.src_h = jpeg_scaled_dim(jd.height, static_cast<uint16_t>(jd.msy * 8U), scale);
+  if (ctx.src_w == 0 || ctx.src_h == 0) {
+    heap_caps_free(work);
+    error = "JPEG Groesse ungueltig";
     return false;
   }
-  memset(g_image_ram_buf, 0, g_image_ram_buf_size);
-  ctx.dst_buf = reinterpret_cast<uint16_t*>(g_image_ram_buf);
-
-  ctx.x_start = static_cast<uint16_t*>(lv_malloc(sizeof(uint16_t) * ctx.src_w));
-  ctx.x_end = static_cast<uint16_t*>(lv_malloc(sizeof(uint16_t) * ctx.src_w));
-  ctx.y_start = static_cast<uint16_t*>(lv_malloc(sizeof(uint16_t) * ctx.src_h));
-  ctx.y_end = static_cast<uint16_t*>(lv_malloc(sizeof(uint16_t) * ctx.src_h));
-  if (!ctx.x_start || !ctx.x_end || !ctx.y_start || !ctx.y_end) {
-    if (ctx.x_start) lv_free(ctx.x_start);
-    if (ctx.x_end) lv_free(ctx.x_end);
-    if (ctx.y_start) lv_free(ctx.y_start);
-    if (ctx.y_end) lv_free(ctx.y_end);
-    lv_free(work);
-    f.close();
-    free_image_ram();
-    error = "Kein RAM fuer Skalierung";
+  ctx.band_h = static_cast<uint16_t>((jd.msy * 8U) >> scale);
+  if (ctx.band_h == 0) ctx.band_h = 1;
+  ctx.h_box = ctx.src_w >= ctx.dst_w;
+  ctx.v_box = ctx.src_h >= ctx.dst_h;
+
+  const size_t buf_size = static_cast<size_t>(ctx.dst_w) * ctx.dst_h * 2U;
+  const size_t hrow_size = static_cast<size_t>(ctx.dst_w) * 3U;
+  ctx.dst_buf = static_cast<uint16_t*>(alloc_dst(buf_size));
+  ctx.band = static_cast<uint8_t*>(alloc_image_buf(static_cast<size_t>(ctx.src_w) * ctx.band_h * 3U, true));
+  ctx.hrow = static_cast<uint8_t*>(alloc_image_buf(hrow_size, false));
+  ctx.hrow_prev = static_cast<uint8_t*>(alloc_image_buf(hrow_size, false));
+  ctx.x_start = static_cast<uint16_t*>(alloc_image_buf(sizeof(uint16_t) * ctx.dst_w, false));
+  ctx.x_end = ctx.h_box ? static_cast<uint16_t*>(alloc_image_buf(sizeof(uint16_t) * ctx.dst_w, false)) : nullptr;
+  ctx.x_frac = ctx.h_box ? nullptr : static_cast<uint8_t*>(alloc_image_buf(ctx.dst_w, false));
+  ctx.vacc = ctx.v_box ? static_cast<uint32_t*>(alloc_image_buf(sizeof(uint32_t) * hrow_size, true)) : nullptr;
+  ctx.y_start = ctx.v_box ? nullptr : static_cast<uint16_t*>(alloc_image_buf(sizeof(uint16_t) * ctx.dst_h, false));
+  ctx.y_frac = ctx.v_box ? nullptr : static_cast<uint8_t*>(alloc_image_buf(ctx.dst_h, false));
+
+  auto free_scratch = [&]() {
+    if (ctx.band) heap_caps_free(ctx.band);
+    if (ctx.hrow) heap_caps_free(ctx.hrow);
+    if (ctx.hrow_prev) heap_caps_free(ctx.hrow_prev);
+    if (ctx.x_start) heap_caps_free(ctx.x_start);
+    if (ctx.x_end) heap_caps_free(ctx.x_end);
+    if (ctx.x_frac) heap_caps_free(ctx.x_frac);
+    if (ctx.vacc) heap_caps_free(ctx.vacc);
+    if (ctx.y_start) heap_caps_free(ctx.y_start);
+    if (ctx.y_frac) heap_caps_free(ctx.y_frac);
+    heap_caps_free(work);
+  };
+
+  const bool maps_ok = ctx.x_start && (ctx.h_box ? ctx.x_end != nullptr : ctx.x_frac != nullptr) &&
+                       (ctx.v_box ? ctx.vacc != nullptr : (ctx.y_start && ctx.y_frac));
+  if (!ctx.dst_buf || !ctx.band || !ctx.hrow || !ctx.hrow_prev || !maps_ok) {
+    if (ctx.dst_buf) free_dst(ctx.dst_buf);
+    free_scratch();
+    error = ctx.dst_buf ? "Kein RAM fuer Skalierung" : "Kein RAM fuer Zielbild";
+    return false;
+  }
+  memset(ctx.dst_buf, 0, buf_size);
+  if (ctx.vacc) memset(ctx.vacc, 0, sizeof(uint32_t) * hrow_size);
+  image_resample_build_axis_map(ctx.src_w, ctx.dst_w, ctx.h_box, ctx.x_start, ctx.x_end, ctx.x_frac);
+  if (!ctx.v_box) image_resample_build_axis_map(ctx.src_h, ctx.dst_h, false, ctx.y_start, nullptr, ctx.y_frac);
+
+  rc = jd_decomp(&jd, tjpgd_output, scale);
+  // Keine einzige Quellzeile: Breite passt nicht zu tjpgd, Zielbild waere schwarz
+  const bool no_rows = rc == JDR_OK && ctx.rows_done == 0;
+  if (rc == JDR_OK && !no_rows) image_resample_finish(&ctx);
+  free_scratch();
+
+  if (no_rows) {
+    free_dst(ctx.dst_buf);
+    Serial.printf("[ImagePopup] JPEG %ux%u: keine Zeilen dekodiert (1/%u, %ux%u)\n", jd.width, jd.height,
+                  1U << scale, ctx.src_w, ctx.src_h);
+    error = "JPEG Decode Fehler";
     return false;
   }
-
-  for (uint16_t x = 0; x < ctx.src_w; ++x) {
-    uint32_t start = (static_cast<uint32_t>(x) * ctx.dst_w) / ctx.src_w;
-    uint32_t end = (static_cast<uint32_t>(x + 1) * ctx.dst_w) / ctx.src_w;
-    if (end == 0) end = 1;
-    end -= 1;
-    if (end < start) end = start;
-    if (start >= ctx.dst_w) start = ctx.dst_w - 1;
-    if (end >= ctx.dst_w) end = ctx.dst_w - 1;
-    ctx.x_start[x] = static_cast<uint16_t>(start);
-    ctx.x_end[x] = static_cast<uint16_t>(end);
-    if ((x & 0x3F) == 0) url_cache_yield();
-  }
-  for (uint16_t y = 0; y < ctx.src_h; ++y) {
-    uint32_t start = (static_cast<uint32_t>(y) * ctx.dst_h) / ctx.src_h;
-    uint32_t end = (static_cast<uint32_t>(y + 1) * ctx.dst_h) / ctx.src_h;
-    if (end == 0) end = 1;
-    end -= 1;
-    if (end < start) end = start;
-    if (start >= ctx.dst_h) start = ctx.dst_h - 1;
-    if (end >= ctx.dst_h) end = ctx.dst_h - 1;
-    ctx.y_start[y] = static_cast<uint16_t>(start);
-    ctx.y_end[y] = static_cast<uint16_t>(end);
-    if ((y & 0x3F) == 0) url_cache_yield();
-  }
-
-  rc = jd_decomp(&jd, tjpgd_output, 0);
-
-  lv_free(ctx.x_start);
-  lv_free(ctx.x_end);
-  lv_free(ctx.y_start);
-  lv_free(ctx.y_end);
-  lv_free(work);
-  f.close();
 
   if (rc != JDR_OK) {
-    free_image_ram();
+    free_dst(ctx.dst_buf);
+    if (rc == JDR_INTR && cancel_active && url_cache_should_cancel(cancel_hash, cancel_len)) {
+      error = "Abgebrochen";
+      url_cache_consume_cancel(cancel_hash, cancel_len);
+      return false;
+    }
+    if (rc == JDR_INTR && abort_gen && *abort_gen != abort_expect) {
+      error = "Abgebrochen";
+      return false;
+    }
     error = "JPEG Decode Fehler";
     return false;
   }
 
-  memset(&g_image_ram_dsc, 0, sizeof(g_image_ram_dsc));
-  g_image_ram_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
-  g_image_ram_dsc.header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED;
-  g_image_ram_dsc.header.w = ctx.dst_w;
-  g_image_ram_dsc.header.h = ctx.dst_h;
-  g_image_ram_dsc.header.stride = ctx.dst_w * 2U;
-  g_image_ram_dsc.data_size = g_image_ram_buf_size;
-  g_image_ram_dsc.data = g_image_ram_buf;
-
-  g_image_ram_active = true;
-  g_image_ram_source = fullPath;
-  header.w = ctx.dst_w;
-  header.h = ctx.dst_h;
-  header.stride = ctx.dst_w * 2U;
-  header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED;
+  Serial.printf("[ImagePopup] JPEG %ux%u -> 1/%u (%ux%u) -> %ux%u in %lu ms\n",
+                jd.width, jd.height, 1U << scale, ctx.src_w, ctx.src_h, ctx.dst_w, ctx.dst_h,
+                (unsigned long)(millis() - start_ms));
+  out_buf = ctx.dst_buf;
+  out_w = ctx.dst_w;
+  out_h = ctx.dst_h;
   return true;
 }
 
+static bool decode_jpeg_scaled(const String& fullPath, void* (*alloc_dst)(size_t), void (*free_dst)(void*),
+                               bool cancel_active, uint32_t cancel_hash, uint16_t cancel_len,
+                               uint16_t*& out_buf, uint16_t& out_w, uint16_t& out_h, String& error,
+                               const volatile uint32_t* abort_gen = nullptr, uint32_t abort_expect = 0,
+                               const JpegFitBox& fit = JpegFitBox()) {
+  File f = SD.open(fullPath, FILE_READ);
+  if (!f) {
+    out_buf = nullptr;
+    error = "JPEG Datei nicht lesbar";
+    return false;
+  }
+  bool ok;
+  {
+    SdBufferedReader reader(f);
+    ok = decode_jpeg_source(sd_reader_input, &reader, alloc_dst, free_dst, cancel_active, cancel_hash, cancel_len,
+                            out_buf, out_w, out_h, error, abort_gen, abort_expect, fit);
+  }
+  f.close();
+  return ok;
+}
+
+static void* jpeg_alloc_psram(size_t size) {
+  return alloc_image_buf(size, true);
+}
+
+static void jpeg_free_heap(void* ptr) {
+  heap_caps_free(ptr);
+}
+
 static bool decode_jpeg_to_buffer(const String& fullPath, uint8_t*& out_buf, size_t& out_size, uint16_t& out_w,
                                   uint16_t& out_h, String& error, uint32_t cancel_hash, uint16_t cancel_len) {
   out_buf = nullptr;
   out_size = 0;
-  out_w = 0;
-  out_h = 0;
+  uint16_t* buf = nullptr;
+  if (!decode_jpeg_scaled(fullPath, jpeg_alloc_psram, jpeg_free_heap, true, cancel_hash, cancel_len,
+                          buf, out_w, out_h, error)) {
+    return false;
+  }
+  out_buf = reinterpret_cast<uint8_t*>(buf);
+  out_size = static_cast<size_t>(out_w) * out_h * 2U;
+  return true;
+}
+
+// Unkomprimierte LVGL .bin komplett in PSRAM lesen (Diashow-Prefetch)
+static bool read_bin_to_buffer(const String& fullPath, uint8_t*& out_buf, size_t& out_size, lv_image_header_t& header,
+                               String& error, const volatile uint32_t* abort_gen, uint32_t abort_expect) {
+  out_buf = nullptr;
+  out_size = 0;
+  const uint32_t start_ms = millis();
   File f = SD.open(fullPath, FILE_READ);
   if (!f) {
-    error = "JPEG Datei nicht lesbar";
+    error = "BIN Datei nicht lesbar";
     return false;
   }
-
-  uint8_t* work = static_cast<uint8_t*>(alloc_image_buf(kJpegWorkbufSize, false));
-  if (!work) {
+  if (image_rle_is_file(f)) {
+    const size_t file_size = f.size();
+    bool ok = image_rle_read_file(f, header, out_buf, out_size, error, abort_gen, abort_expect, url_cache_yield);
     f.close();
-    error = "Kein RAM fuer JPEG";
-    return false;
+    if (ok) {
+      Serial.printf("[ImagePopup] BIN (RLE) %u KB -> %u KB in %lu ms\n", static_cast<unsigned>(file_size / 1024),
+                    static_cast<unsigned>(out_size / 1024), (unsigned long)(millis() - start_ms));
+    }
+    return ok;
   }
-
-  JDEC jd;
-  JpegDecodeContext ctx{};
-  ctx.file = &f;
-  ctx.cancel_active = true;
-  ctx.cancel_hash = cancel_hash;
-  ctx.cancel_len = cancel_len;
-
-  JRESULT rc = jd_prepare(&jd, tjpgd_input, work, kJpegWorkbufSize, &ctx);
-  if (rc != JDR_OK) {
-    heap_caps_free(work);
+  if (f.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header) ||
+      header.magic != LV_IMAGE_HEADER_MAGIC) {
     f.close();
-    error = "JPEG Header Fehler";
+    error = "BIN Header Fehler";
     return false;
   }
-
-  ctx.src_w = jd.width;
-  ctx.src_h = jd.height;
-  if (!calc_contain_size(ctx.src_w, ctx.src_h, ctx.dst_w, ctx.dst_h)) {
-    heap_caps_free(work);
+  if ((header.flags & LV_IMAGE_FLAGS_COMPRESSED) || LV_COLOR_FORMAT_IS_INDEXED(header.cf)) {
     f.close();
-    error = "JPEG Groesse ungueltig";
+    error = "BIN Format nicht unterstuetzt";
     return false;
   }
-
-  size_t dst_pixels = static_cast<size_t>(ctx.dst_w) * ctx.dst_h;
-  size_t buf_size = dst_pixels * 2U;
-  ctx.dst_buf = static_cast<uint16_t*>(alloc_image_buf(buf_size, true));
-  if (!ctx.dst_buf) {
-    heap_caps_free(work);
+  if (header.stride == 0) {
+    header.stride = lv_draw_buf_width_to_stride(header.w, static_cast<lv_color_format_t>(header.cf));
+  }
+  const size_t data_size = static_cast<size_t>(header.stride) * header.h;
+  if (header.w == 0 || header.h == 0 || data_size == 0 || f.size() < sizeof(header) + data_size) {
     f.close();
-    error = "Kein RAM fuer Zielbild";
+    error = "BIN Groesse ungueltig";
     return false;
   }
-  memset(ctx.dst_buf, 0, buf_size);
 
-  ctx.x_start = static_cast<uint16_t*>(alloc_image_buf(sizeof(uint16_t) * ctx.src_w, false));
-  ctx.x_end = static_cast<uint16_t*>(alloc_image_buf(sizeof(uint16_t) * ctx.src_w, false));
-  ctx.y_start = static_cast<uint16_t*>(alloc_image_buf(sizeof(uint16_t) * ctx.src_h, false));
-  ctx.y_end = static_cast<uint16_t*>(alloc_image_buf(sizeof(uint16_t) * ctx.src_h, false));
-  if (!ctx.x_start || !ctx.x_end || !ctx.y_start || !ctx.y_end) {
-    if (ctx.x_start) heap_caps_free(ctx.x_start);
-    if (ctx.x_end) heap_caps_free(ctx.x_end);
-    if (ctx.y_start) heap_caps_free(ctx.y_start);
-    if (ctx.y_end) heap_caps_free(ctx.y_end);
-    heap_caps_free(ctx.dst_buf);
-    heap_caps_free(work);
+  uint8_t* buf = static_cast<uint8_t*>(alloc_image_buf(data_size, true));
+  if (!buf) {
     f.close();
-    error = "Kein RAM fuer Skalierung";
+    error = "Kein RAM fuer Zielbild";
     return false;
   }
-
-  for (uint16_t x = 0; x < ctx.src_w; ++x) {
-    uint32_t start = (static_cast<uint32_t>(x) * ctx.dst_w) / ctx.src_w;
-    uint32_t end = (static_cast<uint32_t>(x + 1) * ctx.dst_w) / ctx.src_w;
-    if (end == 0) end = 1;
-    end -= 1;
-    if (end < start) end = start;
-    if (start >= ctx.dst_w) start = ctx.dst_w - 1;
-    if (end >= ctx.dst_w) end = ctx.dst_w - 1;
-    ctx.x_start[x] = static_cast<uint16_t>(start);
-    ctx.x_end[x] = static_cast<uint16_t>(end);
-    if ((x & 0x3F) == 0 && url_cache_should_cancel(cancel_hash, cancel_len)) {
-      heap_caps_free(ctx.x_start);
-      heap_caps_free(ctx.x_end);
-      heap_caps_free(ctx.y_start);
-      heap_caps_free(ctx.y_end);
-      heap_caps_free(ctx.dst_buf);
-      heap_caps_free(work);
+  size_t done = 0;
+  while (done < data_size) {
+    if (abort_gen && *abort_gen != abort_expect) {
+      heap_caps_free(buf);
       f.close();
       error = "Abgebrochen";
-      url_cache_consume_cancel(cancel_hash, cancel_len);
       return false;
     }
-  }
-  for (uint16_t y = 0; y < ctx.src_h; ++y) {
-    uint32_t start = (static_cast<uint32_t>(y) * ctx.dst_h) / ctx.src_h;
-    uint32_t end = (static_cast<uint32_t>(y + 1) * ctx.dst_h) / ctx.src_h;
-    if (end == 0) end = 1;
-    end -= 1;
-    if (end < start) end = start;
-    if (start >= ctx.dst_h) start = ctx.dst_h - 1;
-    if (end >= ctx.dst_h) end = ctx.dst_h - 1;
-    ctx.y_start[y] = static_cast<uint16_t>(start);
-    ctx.y_end[y] = static_cast<uint16_t>(end);
-    if ((y & 0x3F) == 0 && url_cache_should_cancel(cancel_hash, cancel_len)) {
-      heap_caps_free(ctx.x_start);
-      heap_caps_free(ctx.x_end);
-      heap_caps_free(ctx.y_start);
-      heap_caps_free(ctx.y_end);
-      heap_caps_free(ctx.dst_buf);
-      heap_caps_free(work);
+    size_t chunk = data_size - done;
+    if (chunk > kBinReadChunk) chunk = kBinReadChunk;
+    const uint32_t read_start = micros();
+    size_t got = f.read(buf + done, chunk);
+    sd_io_record_read(got, micros() - read_start);
+    if (got != chunk) {
+      heap_caps_free(buf);
       f.close();
-      error = "Abgebrochen";
-      url_cache_consume_cancel(cancel_hash, cancel_len);
+      error = "BIN Daten Fehler";
       return false;
     }
+    done += got;
+    url_cache_yield();
   }
-
-  rc = jd_decomp(&jd, tjpgd_output, 0);
-
-  heap_caps_free(ctx.x_start);
-  heap_caps_free(ctx.x_end);
-  heap_caps_free(ctx.y_start);
-  heap_caps_free(ctx.y_end);
-  heap_caps_free(work);
   f.close();
-
-  if (rc != JDR_OK) {
-    if (rc == JDR_INTR && url_cache_should_cancel(cancel_hash, cancel_len)) {
-      heap_caps_free(ctx.dst_buf);
-      error = "Abgebrochen";
-      url_cache_consume_cancel(cancel_hash, cancel_len);
-      return false;
-    }
-    heap_caps_free(ctx.dst_buf);
-    error = "JPEG Decode Fehler";
-    return false;
-  }
-
-  out_buf = reinterpret_cast<uint8_t*>(ctx.dst_buf);
-  out_size = buf_size;
-  out_w = ctx.dst_w;
-  out_h = ctx.dst_h;
+  out_buf = buf;
+  out_size = data_size;
+  Serial.printf("[ImagePopup] BIN (roh) %u KB in %lu ms\n", static_cast<unsigned>(data_size / 1024),
+                (unsigned long)(millis() - start_ms));
   return true;
 }
 
+static void make_rgb565_bin_header(lv_image_header_t& header, uint16_t w, uint16_t h) {
+  header = lv_image_header_t{};
+  header.magic = LV_IMAGE_HEADER_MAGIC;
+  header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED;
+  header.flags = 0;
+  header.w = w;
+  header.h = h;
+  header.stride = w * 2U;
+  header.reserved_2 = 0;
+}
+
 static bool convert_jpeg_to_bin(const String& jpeg_path, const String& bin_path, String& error,
                                 uint32_t cancel_hash, uint16_t cancel_len) {
   uint8_t* buf = nullptr;
@@ -951,14 +1095,8 @@ static bool convert_jpeg_to_bin(const String& jpeg_path, const String& bin_path,
   uint16_t w = 0;
   uint16_t h = 0;
   if (!decode_jpeg_to_buffer(jpeg_path, buf, buf_size, w, h, error, cancel_hash, cancel_len)) return false;
-  lv_image_header_t bin_header{};
-  bin_header.magic = LV_IMAGE_HEADER_MAGIC;
-  bin_header.cf = LV_COLOR_FORMAT_RGB565_SWAPPED;
-  bin_header.flags = 0;
-  bin_header.w = w;
-  bin_header.h = h;
-  bin_header.stride = w * 2U;
-  bin_header.reserved_2 = 0;
+  lv_image_header_t bin_header;
+  make_rgb565_bin_header(bin_header, w, h);
   if (url_cache_should_cancel(cancel_hash, cancel_len)) {
     heap_caps_free(buf);
     error = "Abgebrochen";
@@ -970,7 +1108,183 @@ static bool convert_jpeg_to_bin(const String& jpeg_path, const String& bin_path,
   return ok;
 }
 
-static bool update_url_cache(const String& url, String& out_bin_path, String& error) {
+#if IMAGE_URL_STREAM_DECODE
+// HTTP-Body als tjpgd-Eingabe. Der Ringpuffer wird bei jedem Aufruf mit allem
+// aufgefuellt, was der Socket gerade liefert, damit das TCP-Fenster waehrend
+// des Dekodierens offen bleibt. CRC/Groesse laufen ueber die konsumierten Bytes.
+struct UrlJpegStream {
+  HTTPClient* http;
+  WiFiClient* client;
+  int remaining;        // -1 = ohne Content-Length (bis Verbindungsende)
+  uint8_t* ring;
+  size_t cap;
+  size_t head;          // Leseposition
+  size_t fill;          // belegte Bytes ab head
+  UrlCacheMeta* meta;
+  uint32_t cancel_hash;
+  uint16_t cancel_len;
+  uint32_t wait_ms;     // Zeit, in der tjpgd aufs Netz gewartet hat
+  bool timed_out;
+  bool cancelled;
+};
+
+static size_t url_stream_pull(UrlJpegStream& s) {
+  size_t added = 0;
+  while (s.fill < s.cap && s.remaining != 0) {
+    const int avail = s.client->available();
+    if (avail <= 0) break;
+    const size_t tail = (s.head + s.fill) % s.cap;
+    size_t n = (tail >= s.head) ? s.cap - tail : s.head - tail;
+    if (n > static_cast<size_t>(avail)) n = static_cast<size_t>(avail);
+    if (s.remaining > 0 && n > static_cast<size_t>(s.remaining)) n = static_cast<size_t>(s.remaining);
+    const int got = s.client->read(s.ring + tail, n);
+    if (got <= 0) break;
+    s.fill += static_cast<size_t>(got);
+    if (s.remaining > 0) s.remaining -= got;
+    added += static_cast<size_t>(got);
+  }
+  return added;
+}
+
+static bool url_stream_wait(UrlJpegStream& s) {
+  const uint32_t start_ms = millis();
+  while (s.fill == 0) {
+    if (s.remaining == 0) return false;
+    if (url_stream_pull(s) > 0) break;
+    if (!s.http->connected() && s.client->available() <= 0) return false;
+    if (url_cache_should_cancel(s.cancel_hash, s.cancel_len)) {
+      s.cancelled = true;
+      return false;
+    }
+    if (millis() - start_ms > kUrlStreamTimeoutMs) {
+      s.timed_out = true;
+      return false;
+    }
+    delay(2);
+  }
+  s.wait_ms += millis() - start_ms;
+  return true;
+}
+
+static size_t url_stream_input(void* arg, uint8_t* dst, size_t want) {
+  UrlJpegStream& s = *static_cast<UrlJpegStream*>(arg);
+  url_stream_pull(s);
+  size_t done = 0;
+  while (done < want) {
+    if (s.fill == 0 && !url_stream_wait(s)) break;
+    size_t n = want - done;
+    if (n > s.fill) n = s.fill;
+    if (n > s.cap - s.head) n = s.cap - s.head;
+    if (dst) memcpy(dst + done, s.ring + s.head, n);
+    url_cache_meta_add(*s.meta, s.ring + s.head, n);
+    s.head = (s.head + n) % s.cap;
+    s.fill -= n;
+    done += n;
+  }
+  return done;
+}
+
+// Ein Durchlauf HTTP -> Ringpuffer -> tjpgd -> PSRAM -> <tmp_path>, ohne JPEG auf SD.
+// fallback = true: Stream-Pfad nicht nutzbar (kein RAM), Aufrufer nimmt den Dateipfad.
+// unchanged = true: Inhalt identisch zu cond (CRC/Groesse), nichts geschrieben.
+static bool stream_url_to_bin(const String& url, const String& tmp_path, uint32_t cancel_hash, uint16_t cancel_len,
+                              const UrlCacheMeta* cond, UrlCacheMeta& out_meta, bool& not_modified, bool& unchanged,
+                              bool& fallback, String& error) {
+  not_modified = false;
+  unchanged = false;
+  fallback = false;
+  UrlJpegStream s{};
+  s.ring = static_cast<uint8_t*>(alloc_image_buf(kUrlStreamRingSize, true));
+  if (!s.ring) {
+    fallback = true;
+    error = "Kein RAM fuer Stream";
+    return false;
+  }
+  s.cap = kUrlStreamRingSize;
+
+  const uint32_t start_ms = millis();
+  HTTPClient http;
+  WiFiClientSecure secure_client;
+  String ext;
+  if (!begin_url_request(http, secure_client, url, cancel_hash, cancel_len, cond, out_meta, not_modified, ext,
+                         error)) {
+    heap_caps_free(s.ring);
+    return false;
+  }
+  if (not_modified) {
+    heap_caps_free(s.ring);
+    return true;
+  }
+  if (ext != ".jpg") {
+    http.end();
+    heap_caps_free(s.ring);
+    error = "Nur JPEG unterstuetzt";
+    return false;
+  }
+
+  s.http = &http;
+  s.client = http.getStreamPtr();
+  s.remaining = http.getSize();
+  s.meta = &out_meta;
+  s.cancel_hash = cancel_hash;
+  s.cancel_len = cancel_len;
+  uint16_t* buf16 = nullptr;
+  uint16_t w = 0;
+  uint16_t h = 0;
+  bool ok = decode_jpeg_source(url_stream_input, &s, jpeg_alloc_psram, jpeg_free_heap, true, cancel_hash, cancel_len,
+                               buf16, w, h, error, nullptr, 0);
+  if (ok) {
+    // tjpgd hoert nach der letzten MCU auf; Rest (EOI, Trailer) fuer CRC/Groesse lesen
+    uint8_t discard[256];
+    while (url_stream_input(&s, discard, sizeof(discard)) > 0) {
+    }
+    if (s.cancelled || s.timed_out) {
+      heap_caps_free(buf16);
+      ok = false;
+    }
+  }
+  http.end();
+  heap_caps_free(s.ring);
+  const uint32_t fetch_ms = millis() - start_ms;
+  if (!ok) {
+    if (s.cancelled) {
+      error = "Abgebrochen";
+      url_cache_consume_cancel(cancel_hash, cancel_len);
+    } else if (s.timed_out) {
+      error = "Stream Timeout";
+    }
+    return false;
+  }
+
+  out_meta.valid = out_meta.size > 0;
+  if (url_cache_meta_same_content(cond, out_meta)) {
+    heap_caps_free(buf16);
+    unchanged = true;
+    return true;
+  }
+  if (url_cache_should_cancel(cancel_hash, cancel_len)) {
+    heap_caps_free(buf16);
+    error = "Abgebrochen";
+    url_cache_consume_cancel(cancel_hash, cancel_len);
+    return false;
+  }
+  lv_image_header_t bin_header;
+  make_rgb565_bin_header(bin_header, w, h);
+  const uint32_t write_start_ms = millis();
+  ok = write_bin_file(tmp_path, bin_header, reinterpret_cast<const uint8_t*>(buf16),
+                      static_cast<size_t>(w) * h * 2U, error);
+  heap_caps_free(buf16);
+  Serial.printf("[ImagePopup] URL Stream %lu KB -> %ux%u: Laden+Decode %lu ms (Netz-Wartezeit %lu ms), "
+                "BIN %lu ms\n",
+                static_cast<unsigned long>(out_meta.size / 1024), w, h, static_cast<unsigned long>(fetch_ms),
+                static_cast<unsigned long>(s.wait_ms), static_cast<unsigned long>(millis() - write_start_ms));
+  return ok;
+}
+#endif
+
+// changed = false: Bild unveraendert (304 oder gleicher Inhalt), keine Konvertierung noetig
+static bool update_url_cache(const String& url, String& out_bin_path, bool& changed, String& error) {
+  changed = false;
   if (!ensure_sd_ready()) {
     error = "SD fehlt";
     return false;
@@ -987,8 +1301,64 @@ static bool update_url_cache(const String& url, String& out_bin_path, String& er
     return false;
   }
   String base = make_url_cache_base(url);
+  String bin_path = base + ".bin";
+  String meta_path = make_url_cache_meta_path(url);
+  UrlCacheMeta old_meta;
+  const bool have_cached = SD.exists(bin_path) && load_url_cache_meta(meta_path, old_meta);
+  UrlCacheMeta new_meta;
+  bool not_modified = false;
+  const uint32_t start_ms = millis();
+  String tmp_path = bin_path + ".tmp";
+#if IMAGE_URL_STREAM_DECODE
+  bool unchanged = false;
+  bool fallback = false;
+  if (stream_url_to_bin(url, tmp_path, cancel_hash, cancel_len, have_cached ? &old_meta : nullptr, new_meta,
+                        not_modified, unchanged, fallback, error)) {
+    if (not_modified || unchanged) {
+      if (unchanged) save_url_cache_meta(meta_path, new_meta);
+      Serial.printf("[ImagePopup] URL Cache unveraendert (%s): %s\n", not_modified ? "304" : "CRC", url.c_str());
+      out_bin_path = bin_path;
+      return true;
+    }
+    if (SD.exists(bin_path)) SD.remove(bin_path);
+    if (!SD.rename(tmp_path, bin_path)) {
+      SD.remove(tmp_path);
+      error = "BIN Rename Fehler";
+      return false;
+    }
+    if (!new_meta.valid || !save_url_cache_meta(meta_path, new_meta)) {
+      SD.remove(meta_path);
+    }
+    sd_image_index_invalidate();
+    Serial.printf("[ImagePopup] URL Cache aktualisiert (Stream) in %lu ms: %s\n",
+                  (unsigned long)(millis() - start_ms), url.c_str());
+    out_bin_path = bin_path;
+    changed = true;
+    return SD.exists(bin_path);
+  }
+  if (SD.exists(tmp_path)) SD.remove(tmp_path);
+  if (!fallback) return false;
+  Serial.printf("[ImagePopup] URL Stream nicht moeglich (%s), lade ueber Datei\n", error.c_str());
+  error = "";
+#endif
   String download_path;
-  if (!download_url_to_sd(url, base, download_path, error, cancel_hash, cancel_len)) return false;
+  if (!download_url_to_sd(url, base, download_path, error, cancel_hash, cancel_len,
+                          have_cached ? &old_meta : nullptr, new_meta, not_modified)) {
+    return false;
+  }
+  if (not_modified) {
+    Serial.printf("[ImagePopup] URL Cache unveraendert (304): %s\n", url.c_str());
+    out_bin_path = bin_path;
+    return true;
+  }
+  if (url_cache_meta_same_content(have_cached ? &old_meta : nullptr, new_meta)) {
+    // Server kennt keine Validatoren, Inhalt aber identisch -> Decode sparen
+    SD.remove(download_path);
+    save_url_cache_meta(meta_path, new_meta);
+    Serial.printf("[ImagePopup] URL Cache unveraendert (CRC): %s\n", url.c_str());
+    out_bin_path = bin_path;
+    return true;
+  }
   if (url_cache_should_cancel(cancel_hash, cancel_len)) {
     error = "Abgebrochen";
     SD.remove(download_path);
@@ -1000,8 +1370,6 @@ static bool update_url_cache(const String& url, String& out_bin_path, String& er
     error = "Nur JPEG unterstuetzt";
     return false;
   }
-  String bin_path = base + ".bin";
-  String tmp_path = bin_path + ".tmp";
   if (!convert_jpeg_to_bin(download_path, tmp_path, error, cancel_hash, cancel_len)) {
     SD.remove(download_path);
     return false;
@@ -1021,72 +1389,52 @@ static bool update_url_cache(const String& url, String& out_bin_path, String& er
     return false;
   }
   SD.remove(download_path);
+  if (!new_meta.valid || !save_url_cache_meta(meta_path, new_meta)) {
+    SD.remove(meta_path);
+  }
+  sd_image_index_invalidate();
+  Serial.printf("[ImagePopup] URL Cache aktualisiert (Datei) in %lu ms: %s\n",
+                (unsigned long)(millis() - start_ms), url.c_str());
   out_bin_path = bin_path;
+  changed = true;
   return SD.exists(bin_path);
 }
 
-static void register_url_cache_entry(const String& url) {
-  String normalized = url;
-  normalized.trim();
-  if (!is_url_path(normalized)) return;
-  for (const auto& entry : g_url_cache_entries) {
-    if (entry.url == normalized) return;
+// Sichtbar = URL-Tiles des aktiven Tabs + offenes URL-Popup (Aufrufer haelt UrlSchedLock)
+static void apply_url_visibility_locked() {
+  g_url_sched.clearVisible();
+  if (g_url_visible_tab < 3) {
+    const TileGridConfig& grid = (g_url_visible_tab == 0) ? tileConfig.getTab0Grid()
+                               : (g_url_visible_tab == 1) ? tileConfig.getTab1Grid()
+                                                          : tileConfig.getTab2Grid();
+    for (size_t i = 0; i < TILES_PER_GRID; ++i) {
+      const Tile& tile = grid.tiles[i];
+      if (tile.type != TILE_IMAGE) continue;
+      String normalized = tile.image_path;
+      normalized.trim();
+      if (is_url_path(normalized)) g_url_sched.setVisible(normalized, true);
+    }
   }
-  UrlCacheEntry entry;
-  entry.url = normalized;
-  entry.bin_path = make_url_cache_bin_path(normalized);
-  g_url_cache_entries.push_back(entry);
+  if (g_open_url.length() > 0) g_url_sched.setVisible(g_open_url, true);
 }
 
+// Tile-Konfiguration (+ offenes URL-Popup) in den Scheduler spiegeln.
+// Kuerzestes Intervall gewinnt, wenn dieselbe URL mehrfach vorkommt.
 static void refresh_url_cache_entries(uint32_t now) {
-  std::vector<UrlCacheEntry> updated;
+  std::vector<String> urls;
+  std::vector<uint32_t> intervals;
   auto add_entry = [&](const String& url, uint32_t interval_ms) {
     String normalized = url;
     normalized.trim();
     if (!is_url_path(normalized)) return;
-    for (auto& entry : updated) {
-      if (entry.url == normalized) {
-        if (interval_ms > 0 && (entry.interval_ms == 0 || interval_ms < entry.interval_ms)) {
-          entry.interval_ms = interval_ms;
-          uint32_t min_due = now + interval_ms;
-          if (entry.next_due_ms == 0 || (int32_t)(entry.next_due_ms - min_due) > 0) {
-            entry.next_due_ms = min_due;
-          }
-        }
+    for (size_t i = 0; i < urls.size(); ++i) {
+      if (urls[i] == normalized) {
+        if (interval_ms < intervals[i]) intervals[i] = interval_ms;
         return;
       }
     }
-    for (const auto& entry : g_url_cache_entries) {
-      if (entry.url == normalized) {
-        UrlCacheEntry copy = entry;
-        const uint32_t prev_interval = copy.interval_ms;
-        if (interval_ms > 0) {
-          copy.interval_ms = interval_ms;
-        }
-        if (copy.next_due_ms == 0) {
-          copy.next_due_ms = now + kUrlCacheInitialDelayMs;
-        } else if (interval_ms > 0) {
-          uint32_t target_due = now + interval_ms;
-          if (prev_interval == 0 || interval_ms > prev_interval) {
-            if ((int32_t)(target_due - copy.next_due_ms) > 0) {
-              copy.next_due_ms = target_due;
-            }
-          } else if (interval_ms < prev_interval) {
-            if ((int32_t)(copy.next_due_ms - target_due) > 0) {
-              copy.next_due_ms = target_due;
-            }
-          }
-        }
-        updated.push_back(copy);
-        return;
-      }
-    }
-    UrlCacheEntry entry;
-    entry.url = normalized;
-    entry.bin_path = make_url_cache_bin_path(normalized);
-    entry.interval_ms = interval_ms;
-    entry.next_due_ms = now + kUrlCacheInitialDelayMs;
-    updated.push_back(entry);
+    urls.push_back(normalized);
+    intervals.push_back(interval_ms);
   };
 
   const TileGridConfig* grids[] = {
@@ -1103,53 +1451,78 @@ static void refresh_url_cache_entries(uint32_t now) {
       add_entry(tile.image_path, interval_ms);
     }
   }
-  g_url_cache_entries.swap(updated);
+  if (g_open_url.length() > 0) add_entry(g_open_url, normalize_url_cache_interval_ms(0));
+
+  UrlSchedLock lock;
+  g_url_sched.beginSync();
+  for (size_t i = 0; i < urls.size(); ++i) {
+    g_url_sched.syncEntry(urls[i], intervals[i], now, kUrlCacheInitialDelayMs);
+  }
+  g_url_sched.endSync();
+  apply_url_visibility_locked();
 }
 
 static void url_cache_worker(void*) {
   for (;;) {
-    UrlJob job{};
-    if (xQueueReceive(g_url_cache_queue, &job, portMAX_DELAY) != pdTRUE) continue;
-    if (!job.url[0]) continue;
-    String url = String(job.url);
+    String url;
+    uint32_t wait_ms = UINT32_MAX;
+    bool have = false;
+    if (WiFi.status() == WL_CONNECTED) {
+      UrlSchedLock lock;
+      have = g_url_sched.take(millis(), url, wait_ms);
+    } else {
+      wait_ms = 1000;
+    }
+    if (!have) {
+      ulTaskNotifyTake(pdTRUE, wait_ms == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(wait_ms) + 1);
+      continue;
+    }
     uint32_t cancel_hash = hash_url(url);
     uint16_t cancel_len = static_cast<uint16_t>(url.length());
-    portENTER_CRITICAL(&g_url_cache_mux);
-    url_list_remove(g_url_cache_queued, url);
-    if (!url_list_contains(g_url_cache_inflight, url)) {
-      g_url_cache_inflight.push_back(url);
-    }
-    portEXIT_CRITICAL(&g_url_cache_mux);
     String err;
     String out_bin;
+    bool changed = false;
     Serial.printf("[ImagePopup] URL Cache Worker: %s\n", url.c_str());
     if (url_cache_should_cancel(cancel_hash, cancel_len)) {
       Serial.printf("[ImagePopup] URL Cache Abbruch: %s\n", url.c_str());
       url_cache_consume_cancel(cancel_hash, cancel_len);
-    } else if (!update_url_cache(url, out_bin, err)) {
+      g_url_jobs_cancelled.inc();
+    } else if (!update_url_cache(url, out_bin, changed, err)) {
       if (err == "Abgebrochen") {
         Serial.printf("[ImagePopup] URL Cache Abbruch: %s\n", url.c_str());
+        g_url_jobs_cancelled.inc();
       } else {
         Serial.printf("[ImagePopup] URL Cache Fehler: %s -> %s\n", url.c_str(), err.c_str());
+        g_url_jobs_error.inc();
       }
+    } else if (!changed) {
+      g_url_jobs_unchanged.inc();
     } else {
       Serial.printf("[ImagePopup] URL Cache OK: %s\n", out_bin.c_str());
+      g_url_jobs_updated.inc();
       if (g_url_cache_done_queue) {
         UrlJob done{};
         url.toCharArray(done.url, sizeof(done.url));
         xQueueSend(g_url_cache_done_queue, &done, 0);
       }
     }
-    portENTER_CRITICAL(&g_url_cache_mux);
-    url_list_remove(g_url_cache_inflight, url);
-    portEXIT_CRITICAL(&g_url_cache_mux);
+    {
+      UrlSchedLock lock;
+      g_url_sched.complete(url, millis());
+    }
+    wake_url_cache_workers();  // freier Slot: zurueckgestellte Jobs
+  }
+}
+
+static void wake_url_cache_workers() {
+  for (size_t i = 0; i < URL_CACHE_MAX_INFLIGHT; ++i) {
+    if (g_url_cache_tasks[i]) xTaskNotifyGive(g_url_cache_tasks[i]);
   }
 }
 
 static void ensure_url_cache_worker() {
   if (g_url_cache_worker_ready) return;
-  g_url_cache_queue = xQueueCreate(kUrlQueueLen, sizeof(UrlJob));
-  if (!g_url_cache_queue) return;
+  if (!g_url_sched_lock) return;
   if (!g_url_cache_done_queue) {
     g_url_cache_done_queue = xQueueCreate(kUrlQueueLen, sizeof(UrlJob));
   }
@@ -1157,92 +1530,203 @@ static void ensure_url_cache_worker() {
 #ifdef ARDUINO_RUNNING_CORE
   core = (ARDUINO_RUNNING_CORE == 0) ? 1 : 0;
 #endif
-  BaseType_t ok = xTaskCreatePinnedToCore(url_cache_worker, "urlCache", 8192, nullptr, 1, &g_url_cache_task, core);
-  if (ok == pdPASS) {
-    g_url_cache_worker_ready = true;
+  for (size_t i = 0; i < URL_CACHE_MAX_INFLIGHT; ++i) {
+    if (g_url_cache_tasks[i]) continue;
+    char name[12];
+    snprintf(name, sizeof(name), "urlCache%u", static_cast<unsigned>(i));
+    xTaskCreatePinnedToCore(url_cache_worker, name, 8192, nullptr, 1, &g_url_cache_tasks[i], core);
   }
+  g_url_cache_worker_ready = g_url_cache_tasks[0] != nullptr;
 }
 
+// Sofort faellig (fehlender Cache); Duplikate und laufende Jobs werden verworfen
 static bool enqueue_url_job(const String& url) {
   ensure_url_cache_worker();
-  if (!g_url_cache_worker_ready || !g_url_cache_queue) return false;
+  if (!g_url_cache_worker_ready) return false;
   String normalized = url;
   normalized.trim();
   if (!is_url_path(normalized)) return false;
-  bool already = false;
-  portENTER_CRITICAL(&g_url_cache_mux);
-  if (url_list_contains(g_url_cache_inflight, normalized) || url_list_contains(g_url_cache_queued, normalized)) {
-    already = true;
-  } else {
-    g_url_cache_queued.push_back(normalized);
-  }
-  portEXIT_CRITICAL(&g_url_cache_mux);
-  if (already) return false;
+  if (normalized.length() >= kUrlJobMaxLen) return false;
+  bool queued;
+  {
+    UrlSchedLock lock;
+    queued = g_url_sched.requestNow(normalized, millis());
+    if (normalized == g_open_url) g_url_sched.setVisible(normalized, true);
+  }
+  if (queued) wake_url_cache_workers();
+  return queued;
+}
 
-  UrlJob job{};
-  normalized.toCharArray(job.url, sizeof(job.url));
-  if (!job.url[0]) {
-    portENTER_CRITICAL(&g_url_cache_mux);
-    url_list_remove(g_url_cache_queued, normalized);
-    portEXIT_CRITICAL(&g_url_cache_mux);
-    return false;
+// JPEG dekodieren bzw. unkomprimierte .bin lesen -> heap_caps-Puffer fuer den Image-Cache
+static bool load_image_to_buffer(const String& fullPath, uint8_t*& out_buf, size_t& out_size, lv_image_header_t& header,
+                                 String& error, const volatile uint32_t* abort_gen = nullptr, uint32_t abort_expect = 0,
+                                 const JpegFitBox& fit = JpegFitBox()) {
+  const bool is_jpeg = ends_with_ignore_case(fullPath, ".jpg") || ends_with_ignore_case(fullPath, ".jpeg");
+  if (!is_jpeg) {
+    return read_bin_to_buffer(fullPath, out_buf, out_size, header, error, abort_gen, abort_expect);
   }
-  if (xQueueSend(g_url_cache_queue, &job, 0) != pdTRUE) {
-    portENTER_CRITICAL(&g_url_cache_mux);
-    url_list_remove(g_url_cache_queued, normalized);
-    portEXIT_CRITICAL(&g_url_cache_mux);
+  uint16_t* buf16 = nullptr;
+  uint16_t w = 0;
+  uint16_t h = 0;
+  if (!decode_jpeg_scaled(fullPath, jpeg_alloc_psram, jpeg_free_heap, false, 0, 0, buf16, w, h, error,
+                          abort_gen, abort_expect, fit)) {
     return false;
   }
+  out_buf = reinterpret_cast<uint8_t*>(buf16);
+  out_size = static_cast<size_t>(w) * h * 2U;
+  make_rgb565_bin_header(header, w, h);
   return true;
 }
 
-static void mark_url_cache_queued(const String& url, uint32_t now) {
-  String normalized = url;
-  normalized.trim();
-  if (!is_url_path(normalized)) return;
-  for (auto& entry : g_url_cache_entries) {
-    if (entry.url == normalized) {
-      uint32_t interval_ms = entry.interval_ms;
-      if (interval_ms == 0) interval_ms = normalize_url_cache_interval_ms(0);
-      entry.next_due_ms = now + interval_ms;
-      return;
-    }
+// Bild aus dem Image-Cache holen, sonst laden und einfuegen. Liefert einen gepinnten Deskriptor.
+static const lv_image_dsc_t* load_image_cached(const String& fullPath, bool force_reload, String& error) {
+  uint32_t file_size = 0;
+  uint32_t mtime = 0;
+  if (!image_cache_stat(fullPath, file_size, mtime)) {
+    error = "Datei nicht lesbar";
+    return nullptr;
   }
+  if (force_reload) {
+    image_cache_drop(fullPath);
+  } else {
+    const lv_image_dsc_t* hit = image_cache_acquire(fullPath, file_size, mtime);
+    if (hit) return hit;
+  }
+  uint8_t* buf = nullptr;
+  size_t size = 0;
+  lv_image_header_t header{};
+  if (!load_image_to_buffer(fullPath, buf, size, header, error)) return nullptr;
+  return image_cache_insert(fullPath, file_size, mtime, buf, size, header);
+}
+
+static void release_slide_prefetch() {
+  uint8_t* stale = nullptr;
+  portENTER_CRITICAL(&g_slide_prefetch_mux);
+  g_slide_prefetch_gen++;
+  stale = g_slide_prefetch.buf;
+  g_slide_prefetch.buf = nullptr;
+  g_slide_prefetch.size = 0;
+  g_slide_prefetch.state = SlidePrefetchState::Idle;
+  portEXIT_CRITICAL(&g_slide_prefetch_mux);
+  if (stale) heap_caps_free(stale);
 }
 
-static void collect_images(const String& dir, std::vector<String>& out, size_t max_entries, uint8_t depth, bool allow_bin, bool allow_jpeg) {
-  if (out.size() >= max_entries) return;
-  File root = SD.open(dir);
-  if (!root) return;
+static void slide_prefetch_worker(void*) {
+  SlidePrefetchJob job{};
+  for (;;) {
+    if (xQueueReceive(g_slide_prefetch_queue, &job, portMAX_DELAY) != pdTRUE) continue;
+    if (job.gen != g_slide_prefetch_gen) continue;
+
+    const String path = String(job.path);
+    const uint32_t start_ms = millis();
+    uint32_t file_size = 0;
+    uint32_t mtime = 0;
+    uint8_t* buf = nullptr;
+    size_t size = 0;
+    lv_image_header_t header{};
+    String err;
+    bool ok = image_cache_stat(path, file_size, mtime);
+    if (!ok) {
+      err = "Datei nicht lesbar";
+    } else if (image_cache_contains(path, file_size, mtime)) {
+      // Schon dekodiert: slideshow_tick holt es direkt aus dem Cache
+      portENTER_CRITICAL(&g_slide_prefetch_mux);
+      if (job.gen == g_slide_prefetch_gen) g_slide_prefetch.state = SlidePrefetchState::Idle;
+      portEXIT_CRITICAL(&g_slide_prefetch_mux);
+      continue;
+    } else {
+      ok = load_image_to_buffer(path, buf, size, header, err, &g_slide_prefetch_gen, job.gen);
+    }
 
-  File file = root.openNextFile();
-  while (file) {
-    if (out.size() >= max_entries) break;
-    const char* name_c = file.name();
-    String name = name_c ? String(name_c) : String();
-    if (file.isDirectory()) {
-      if (depth > 0 && name.length()) {
-        String next = dir == "/" ? "/" + name : dir + "/" + name;
-        collect_images(next, out, max_entries, depth - 1, allow_bin, allow_jpeg);
-      }
-    } else if (name.length() && ends_with_ignore_case(name, ".bin")) {
-      if (allow_bin) {
-        if (!name.startsWith("/")) {
-          name = dir == "/" ? "/" + name : dir + "/" + name;
-        }
-        out.push_back(name);
-      }
-    } else if (name.length() && allow_jpeg &&
-               (ends_with_ignore_case(name, ".jpg") || ends_with_ignore_case(name, ".jpeg"))) {
-      if (!name.startsWith("/")) {
-        name = dir == "/" ? "/" + name : dir + "/" + name;
-      }
-      out.push_back(name);
+    bool stale = false;
+    portENTER_CRITICAL(&g_slide_prefetch_mux);
+    if (job.gen != g_slide_prefetch_gen) {
+      stale = true;
+    } else {
+      g_slide_prefetch.file_size = file_size;
+      g_slide_prefetch.mtime = mtime;
+      g_slide_prefetch.buf = buf;
+      g_slide_prefetch.size = size;
+      g_slide_prefetch.header = header;
+      g_slide_prefetch.state = ok ? SlidePrefetchState::Ready : SlidePrefetchState::Failed;
+    }
+    portEXIT_CRITICAL(&g_slide_prefetch_mux);
+
+    if (stale) {
+      if (buf) heap_caps_free(buf);
+    } else if (ok) {
+      Serial.printf("[ImagePopup] Prefetch %s in %lu ms\n", path.c_str(), (unsigned long)(millis() - start_ms));
+    } else {
+      Serial.printf("[ImagePopup] Prefetch Fehler: %s -> %s\n", path.c_str(), err.c_str());
     }
-    file = root.openNextFile();
   }
 }
 
+static bool ensure_slide_prefetch_worker() {
+  if (g_slide_prefetch_task) return true;
+  if (!g_slide_prefetch_queue) {
+    g_slide_prefetch_queue = xQueueCreate(1, sizeof(SlidePrefetchJob));
+    if (!g_slide_prefetch_queue) return false;
+  }
+  int core = 1;
+#ifdef ARDUINO_RUNNING_CORE
+  core = (ARDUINO_RUNNING_CORE == 0) ? 1 : 0;
+#endif
+  BaseType_t ok = xTaskCreatePinnedToCore(slide_prefetch_worker, "slidePrefetch", 8192, nullptr, 1,
+                                          &g_slide_prefetch_task, core);
+  if (ok != pdPASS) {
+    g_slide_prefetch_task = nullptr;
+    return false;
+  }
+  return true;
+}
+
+// Naechstes Diashow-Bild im Hintergrund laden (verwirft einen aelteren Prefetch)
+static void request_slide_prefetch(size_t index) {
+  if (g_slideshow_files.size() < 2 || index >= g_slideshow_files.size()) return;
+  if (!ensure_slide_prefetch_worker()) return;
+  SlidePrefetchJob job{};
+  uint8_t* stale = nullptr;
+  portENTER_CRITICAL(&g_slide_prefetch_mux);
+  job.gen = ++g_slide_prefetch_gen;
+  stale = g_slide_prefetch.buf;
+  g_slide_prefetch.buf = nullptr;
+  g_slide_prefetch.size = 0;
+  g_slide_prefetch.gen = job.gen;
+  g_slide_prefetch.index = index;
+  g_slide_prefetch.state = SlidePrefetchState::Busy;
+  portEXIT_CRITICAL(&g_slide_prefetch_mux);
+  if (stale) heap_caps_free(stale);
+  job.index = index;
+  g_slideshow_files[index].toCharArray(job.path, sizeof(job.path));
+  xQueueOverwrite(g_slide_prefetch_queue, &job);
+}
+
+// Fertigen Prefetch-Puffer in den Image-Cache uebernehmen (nur im LVGL-Kontext).
+// Liefert einen gepinnten Deskriptor, damit der Eintrag bis zur Anzeige nicht verdraengt wird.
+static const lv_image_dsc_t* adopt_slide_prefetch(size_t index) {
+  uint8_t* buf = nullptr;
+  size_t size = 0;
+  uint32_t file_size = 0;
+  uint32_t mtime = 0;
+  lv_image_header_t header{};
+  portENTER_CRITICAL(&g_slide_prefetch_mux);
+  if (g_slide_prefetch.state == SlidePrefetchState::Ready && g_slide_prefetch.index == index &&
+      g_slide_prefetch.gen == g_slide_prefetch_gen) {
+    buf = g_slide_prefetch.buf;
+    size = g_slide_prefetch.size;
+    file_size = g_slide_prefetch.file_size;
+    mtime = g_slide_prefetch.mtime;
+    header = g_slide_prefetch.header;
+    g_slide_prefetch.buf = nullptr;
+    g_slide_prefetch.size = 0;
+    g_slide_prefetch.state = SlidePrefetchState::Idle;
+  }
+  portEXIT_CRITICAL(&g_slide_prefetch_mux);
+  if (!buf) return nullptr;
+  return image_cache_insert(g_slideshow_files[index], file_size, mtime, buf, size, header);
+}
+
 static bool show_image_popup_internal(const String& fullPath, bool allow_error, bool force_reload = false) {
   if (!SD.exists(fullPath)) {
     if (allow_error) show_image_popup_error("Bild nicht gefunden", fullPath.c_str());
@@ -1250,19 +1734,19 @@ static bool show_image_popup_internal(const String& fullPath, bool allow_error,
   }
 
   const bool is_jpeg = ends_with_ignore_case(fullPath, ".jpg") || ends_with_ignore_case(fullPath, ".jpeg");
+  // JPEG und unkomprimierte .bin kommen aus dem Image-Cache (PSRAM), der Rest ueber den LVGL-Decoder
+  String err;
+  const lv_image_dsc_t* pinned = load_image_cached(fullPath, force_reload, err);
+  const bool use_ram = pinned != nullptr;
   lv_image_header_t header{};
-  if (is_jpeg) {
-    if (!force_reload && g_image_ram_active && g_image_ram_source == fullPath && g_current_header_valid) {
-      header = g_current_header;
-    } else {
-      String err;
-      if (!decode_jpeg_to_ram(fullPath, header, err)) {
-        if (allow_error) show_image_popup_error("JPEG Fehler", err.c_str());
-        return false;
-      }
-      g_current_header = header;
-      g_current_header_valid = true;
-    }
+  if (use_ram) {
+    header = pinned->header;
+    set_image_ram(pinned, fullPath);
+    g_current_header = header;
+    g_current_header_valid = true;
+  } else if (is_jpeg) {
+    if (allow_error) show_image_popup_error("JPEG Fehler", err.c_str());
+    return false;
   } else {
     free_image_ram();
     String new_src = "S:" + fullPath;
@@ -1287,11 +1771,16 @@ static bool show_image_popup_internal(const String& fullPath, bool allow_error,
   lv_obj_set_style_bg_opa(g_image_popup_overlay, LV_OPA_COVER, 0);
   lv_obj_clear_flag(g_image_popup_overlay, LV_OBJ_FLAG_HIDDEN);
 
-  if (is_jpeg) {
+  if (use_ram) {
     g_current_image_path = fullPath;
-    lv_img_set_src(g_image_popup_img, &g_image_ram_dsc);
-    lv_obj_set_size(g_image_popup_img, header.w, header.h);
-    lv_image_set_inner_align(g_image_popup_img, LV_IMAGE_ALIGN_CENTER);
+    lv_img_set_src(g_image_popup_img, g_image_ram_dsc);
+    if (is_jpeg) {
+      lv_obj_set_size(g_image_popup_img, header.w, header.h);
+      lv_image_set_inner_align(g_image_popup_img, LV_IMAGE_ALIGN_CENTER);
+    } else {
+      lv_obj_set_size(g_image_popup_img, SCREEN_WIDTH, SCREEN_HEIGHT);
+      lv_image_set_inner_align(g_image_popup_img, LV_IMAGE_ALIGN_CONTAIN);
+    }
   } else {
     String new_src = "S:" + fullPath;
     if (force_reload || g_current_image_path != new_src) {
@@ -1313,6 +1802,7 @@ static bool show_image_popup_internal(const String& fullPath, bool allow_error,
 static void process_url_cache_done() {
   if (!g_url_cache_done_queue) return;
   if (!ensure_sd_ready()) return;
+  LvglLock lock;  // Cache-Drop + Re-Show laufen gegen die Draw-Units
   UrlJob job{};
   while (xQueueReceive(g_url_cache_done_queue, &job, 0) == pdTRUE) {
     if (!job.url[0]) continue;
@@ -1321,7 +1811,9 @@ static void process_url_cache_done() {
     String cached_src = "S:" + cached;
     lv_image_cache_drop(cached_src.c_str());
     lv_image_header_cache_drop(cached_src.c_str());
-    if (g_image_shown && g_current_image_path == cached_src) {
+    image_cache_drop(cached);
+    tile_thumb_source_changed(cached);
+    if (g_image_shown && (g_current_image_path == cached_src || g_current_image_path == cached)) {
       apply_slideshow_display_mode(true);
       displayManager.setReverseFlushOnce();
       show_image_popup_internal(cached, false, true);
@@ -1329,16 +1821,47 @@ static void process_url_cache_done() {
   }
 }
 
-static void slideshow_tick(lv_timer_t*) {
+static void slideshow_tick(lv_timer_t* timer) {
   if (g_slideshow_files.empty()) {
     stop_slideshow(true);
     return;
   }
+  const uint32_t tick_us = micros();
   const size_t count = g_slideshow_files.size();
+  const size_t next = (g_slideshow_index + 1) % count;
+
+  portENTER_CRITICAL(&g_slide_prefetch_mux);
+  const SlidePrefetchState pf_state = g_slide_prefetch.state;
+  const size_t pf_index = g_slide_prefetch.index;
+  portEXIT_CRITICAL(&g_slide_prefetch_mux);
+  if (count > 1 && pf_index == next && pf_state == SlidePrefetchState::Busy) {
+    // Prefetch laeuft noch: kurz nachfragen statt doppelt zu dekodieren
+    if (timer) lv_timer_set_period(timer, kSlidePrefetchRetryMs);
+    return;
+  }
+  if (timer) lv_timer_set_period(timer, g_slideshow_interval_ms);
+
+  const lv_image_dsc_t* prefetched = (count > 1) ? adopt_slide_prefetch(next) : nullptr;
+  if (prefetched) {
+    g_slideshow_index = next;
+    displayManager.setReverseFlushOnce();
+    const bool shown = show_image_popup_internal(g_slideshow_files[next], false);
+    image_cache_release(prefetched);
+    if (shown) {
+      displayManager.markNextRender("Diashow Prefetch", tick_us);
+      request_slide_prefetch((next + 1) % count);
+      return;
+    }
+  }
+
   for (size_t i = 0; i < count; ++i) {
     g_slideshow_index = (g_slideshow_index + 1) % count;
     displayManager.setReverseFlushOnce();
-    if (show_image_popup_internal(g_slideshow_files[g_slideshow_index], false)) return;
+    if (show_image_popup_internal(g_slideshow_files[g_slideshow_index], false)) {
+      displayManager.markNextRender("Diashow sync", tick_us);
+      request_slide_prefetch((g_slideshow_index + 1) % count);
+      return;
+    }
   }
   show_image_popup_error("Keine Bilder gefunden", "/");
   stop_slideshow(true);
@@ -1351,7 +1874,9 @@ static void start_slideshow(uint16_t interval_sec, SlideshowMode mode) {
   g_slideshow_interval_ms = normalize_slideshow_interval_ms(interval_sec);
   const bool allow_bin = (mode == SlideshowMode::Bin || mode == SlideshowMode::All);
   const bool allow_jpeg = (mode == SlideshowMode::Jpeg || mode == SlideshowMode::All);
-  collect_images("/", g_slideshow_files, 200, 3, allow_bin, allow_jpeg);
+  const uint8_t mask = (allow_bin ? SD_IMAGE_MASK_BIN : 0) | (allow_jpeg ? SD_IMAGE_MASK_JPEG : 0);
+  sd_image_index_refresh();
+  sd_image_index_paths(mask, 200, g_slideshow_files);
   if (g_slideshow_files.empty()) {
     const char* msg = (mode == SlideshowMode::Jpeg)
                         ? "Keine JPEG Bilder gefunden"
@@ -1366,6 +1891,8 @@ static void start_slideshow(uint16_t interval_sec, SlideshowMode mode) {
   displayManager.setReverseFlushOnce();
   if (!show_image_popup_internal(g_slideshow_files[0], true)) {
     slideshow_tick(nullptr);
+  } else {
+    request_slide_prefetch(1 % g_slideshow_files.size());
   }
   g_slideshow_timer = lv_timer_create(slideshow_tick, g_slideshow_interval_ms, nullptr);
 }
@@ -1405,7 +1932,6 @@ void show_image_popup(const char* path, uint16_t slideshow_sec) {
   rawPath.trim();
   if (is_url_path(rawPath)) {
     g_open_url = rawPath;
-    register_url_cache_entry(rawPath);
     ensure_url_cache_worker();
     uint32_t now = millis();
     refresh_url_cache_entries(now);
@@ -1421,7 +1947,6 @@ void show_image_popup(const char* path, uint16_t slideshow_sec) {
       }
       Serial.printf("[ImagePopup] URL Cache fehlte, Queue: %s\n", rawPath.c_str());
       enqueue_url_job(rawPath);
-      mark_url_cache_queued(rawPath, now);
       show_image_popup_error("URL Cache wird erstellt", rawPath.c_str());
       apply_slideshow_display_mode(false);
       return;
@@ -1454,6 +1979,10 @@ void hide_image_popup() {
     apply_slideshow_display_mode(true);
     displayManager.setReverseFlushOnce();
     lv_obj_add_flag(g_image_popup_overlay, LV_OBJ_FLAG_HIDDEN);
+    if (g_open_url.length() > 0) {
+      UrlSchedLock lock;
+      g_url_sched.setVisible(g_open_url, false);
+    }
     g_open_url = "";
     g_image_shown = false;
     free_image_ram();
@@ -1461,6 +1990,25 @@ void hide_image_popup() {
   }
 }
 
+String image_popup_resolve_sd_path(const String& path) {
+  String rawPath = path;
+  rawPath.trim();
+  if (rawPath.length() == 0) return String();
+  if (is_url_path(rawPath)) return make_url_cache_bin_path(rawPath);
+  String fullPath = normalize_sd_path(rawPath);
+  if (get_slideshow_mode(fullPath) != SlideshowMode::None) return String();
+  return fullPath;
+}
+
+bool image_popup_decode_fit(const String& fullPath, uint16_t box_w, uint16_t box_h, bool cover,
+                            uint8_t*& out_buf, size_t& out_size, lv_image_header_t& header, String& error) {
+  JpegFitBox fit;
+  fit.w = box_w;
+  fit.h = box_h;
+  fit.cover = cover;
+  return load_image_to_buffer(fullPath, out_buf, out_size, header, error, nullptr, 0, fit);
+}
+
 void preload_image_popup(const char* path) {
   if (!path || strlen(path) == 0) return;
 
@@ -1510,26 +2058,48 @@ void image_popup_service_url_cache() {
   }
   if ((int32_t)(now - g_url_cache_next_ms) < 0) return;
 
+  // Nur noch Konfig-Abgleich; die Termine selbst weckt der Worker
   ensure_url_cache_worker();
   refresh_url_cache_entries(now);
-  if (g_url_cache_entries.empty()) {
-    g_url_cache_next_ms = now + kUrlCacheIntervalMs;
-    return;
-  }
+  wake_url_cache_workers();
+  g_url_cache_next_ms = millis() + kUrlCacheIntervalMs;
+}
 
-  uint32_t queued = 0;
-  for (auto& entry : g_url_cache_entries) {
-    uint32_t interval_ms = entry.interval_ms;
-    if (interval_ms == 0) interval_ms = normalize_url_cache_interval_ms(0);
-    if (entry.next_due_ms == 0) entry.next_due_ms = now + kUrlCacheInitialDelayMs;
-    if ((int32_t)(now - entry.next_due_ms) < 0) continue;
-    enqueue_url_job(entry.url);
-    entry.next_due_ms = now + interval_ms;
-    queued++;
-  }
-  if (queued > 0) {
-    Serial.printf("[ImagePopup] URL Cache Queue (%u)\n", static_cast<unsigned int>(queued));
+void image_popup_init() {
+  if (!g_url_sched_lock) g_url_sched_lock = xSemaphoreCreateMutex();
+  if (!g_url_sched_lock) Serial.println("[ImagePopup] URL Scheduler Mutex FEHLER");
+}
+
+void image_popup_set_visible_tab(uint8_t tab_index) {
+  const uint8_t tab = (tab_index < 3) ? tab_index : 0xFF;
+  if (tab == g_url_visible_tab) return;
+  g_url_visible_tab = tab;
+  {
+    UrlSchedLock lock;
+    apply_url_visibility_locked();
   }
-  g_url_cache_next_ms = millis() + kUrlCacheIntervalMs;
+  wake_url_cache_workers();  // faellige Bilder des neuen Tabs zuerst
+}
+
+String image_popup_url_cache_stats_json() {
+  UrlSchedStats st;
+  {
+    UrlSchedLock lock;
+    st = g_url_sched.stats();
+  }
+  String json = "{";
+  json += "\"entries\":" + String(st.entries);
+  json += ",\"visible\":" + String(st.visible);
+  json += ",\"inflight\":" + String(st.inflight);
+  json += ",\"dispatched\":" + String(st.dispatched);
+  json += ",\"deduped\":" + String(st.deduped);
+  json += ",\"deferred\":" + String(st.deferred);
+  json += ",\"avg_lag_ms\":" + String(st.dispatched ? static_cast<uint32_t>(st.lag_sum_ms / st.dispatched) : 0);
+  json += ",\"max_lag_ms\":" + String(st.max_lag_ms);
+  json += ",\"visible_avg_lag_ms\":" +
+          String(st.dispatched_visible ? static_cast<uint32_t>(st.lag_sum_visible_ms / st.dispatched_visible) : 0);
+  json += ",\"visible_max_lag_ms\":" + String(st.max_lag_visible_ms);
+  json += "}";
+  return json;
 }
  
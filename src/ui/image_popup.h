@@ -4,11 +4,30 @@
 #include <lvgl.h>
 #include <Arduino.h>
 
+// URL-Bilder direkt aus dem HTTP-Stream dekodieren (kein JPEG-Zwischenstand auf SD).
+// 0 = alter Weg: Download nach SD, danach Konvertierung (Vergleichsmessung).
+#ifndef IMAGE_URL_STREAM_DECODE
+#define IMAGE_URL_STREAM_DECODE 1
+#endif
+
 // Zeigt ein Bild von der SD-Karte oder URL als Fullscreen-Popup an
 // path: Pfad zur Datei (z.B. "/bild.bin") oder URL (http/https)
 void show_image_popup(const char* path, uint16_t slideshow_sec = 10);
 void hide_image_popup();
 void preload_image_popup(const char* path);
 void image_popup_service_url_cache();
+// URL-Scheduler-Mutex anlegen (setup, vor dem ersten URL-Job)
+void image_popup_init();
+// URL-Tiles dieses Tabs im Scheduler bevorzugen (>= 3: kein Tile-Tab sichtbar)
+void image_popup_set_visible_tab(uint8_t tab_index);
+// Scheduler-Zaehler des URL-Caches (JSON fuer /api/perf)
+String image_popup_url_cache_stats_json();
+
+// SD-Datei hinter einem Tile-Bildpfad: URL -> Cache-.bin, Diashow-Token -> leer
+String image_popup_resolve_sd_path(const String& path);
+// Bild in PSRAM laden. JPEG wird schon beim Dekodieren auf box_w x box_h skaliert
+// (cover: deckt den Rahmen ab, sonst contain), .bin kommt in Originalgroesse.
+bool image_popup_decode_fit(const String& fullPath, uint16_t box_w, uint16_t box_h, bool cover,
+                            uint8_t*& out_buf, size_t& out_size, lv_image_header_t& header, String& error);
 
 #endif // IMAGE_POPUP_H
@@ -0,0 +1,149 @@
+#include "src/ui/image_resample.h"
+
+uint8_t jpeg_pick_scale(uint16_t src_w, uint16_t src_h, uint16_t dst_w, uint16_t dst_h) {
+  for (uint8_t s = 3; s > 0; --s) {
+    if ((src_w >> s) >= dst_w && (src_h >> s) >= dst_h) return s;
+  }
+  return 0;
+}
+
+// Die letzte MCU wird geclippt, und faellt ihr Rest beim Skalieren auf 0,
+// gibt tjpgds mcu_output sie gar nicht aus
+uint16_t jpeg_scaled_dim(uint16_t full, uint16_t mcu, uint8_t scale) {
+  if (full == 0 || mcu == 0) return 0;
+  uint16_t last = static_cast<uint16_t>(((full - 1) / mcu) * mcu);
+  uint16_t rest = static_cast<uint16_t>((full - last) >> scale);
+  if (rest == 0) return static_cast<uint16_t>(last >> scale);  // last == 0 -> 0 (Bild zu klein)
+  return static_cast<uint16_t>((last >> scale) + rest);
+}
+
+// Bilinear: Pixelmitten ausgerichtet
+void image_resample_build_axis_map(uint16_t src, uint16_t dst, bool box, uint16_t* start, uint16_t* end,
+                                   uint8_t* frac) {
+  for (uint16_t d = 0; d < dst; ++d) {
+    if (box) {
+      uint32_t s0 = (static_cast<uint32_t>(d) * src) / dst;
+      uint32_t s1 = (static_cast<uint32_t>(d + 1) * src) / dst;
+      if (s1 <= s0) s1 = s0 + 1;
+      if (s1 > src) s1 = src;
+      start[d] = static_cast<uint16_t>(s0);
+      if (end) end[d] = static_cast<uint16_t>(s1);
+    } else {
+      int32_t fp = static_cast<int32_t>(((2U * d + 1U) * static_cast<uint32_t>(src) * 256U) / (2U * dst)) - 128;
+      if (fp < 0) fp = 0;
+      int32_t s0 = fp >> 8;
+      uint8_t f = static_cast<uint8_t>(fp & 0xFF);
+      if (s0 >= src - 1) {
+        s0 = src - 1;
+        f = 0;
+      }
+      start[d] = static_cast<uint16_t>(s0);
+      if (frac) frac[d] = f;
+    }
+  }
+}
+
+static void resample_row_h(const RowResampler* rs, const uint8_t* src, uint8_t* out) {
+  if (rs->h_box) {
+    for (uint16_t x = 0; x < rs->dst_w; ++x) {
+      const uint16_t s0 = rs->x_start[x];
+      const uint16_t s1 = rs->x_end[x];
+      uint32_t c0 = 0, c1 = 0, c2 = 0;
+      const uint8_t* p = src + static_cast<size_t>(s0) * 3U;
+      for (uint16_t s = s0; s < s1; ++s, p += 3) {
+        c0 += p[0];
+        c1 += p[1];
+        c2 += p[2];
+      }
+      const uint32_t n = s1 - s0;
+      out[x * 3U + 0] = static_cast<uint8_t>(c0 / n);
+      out[x * 3U + 1] = static_cast<uint8_t>(c1 / n);
+      out[x * 3U + 2] = static_cast<uint8_t>(c2 / n);
+    }
+    return;
+  }
+  const uint16_t last = rs->src_w - 1;
+  for (uint16_t x = 0; x < rs->dst_w; ++x) {
+    const uint16_t s0 = rs->x_start[x];
+    const uint16_t s1 = (s0 < last) ? s0 + 1 : s0;
+    const uint32_t f = rs->x_frac[x];
+    const uint8_t* a = src + static_cast<size_t>(s0) * 3U;
+    const uint8_t* b = src + static_cast<size_t>(s1) * 3U;
+    out[x * 3U + 0] = static_cast<uint8_t>((a[0] * (256U - f) + b[0] * f) >> 8);
+    out[x * 3U + 1] = static_cast<uint8_t>((a[1] * (256U - f) + b[1] * f) >> 8);
+    out[x * 3U + 2] = static_cast<uint8_t>((a[2] * (256U - f) + b[2] * f) >> 8);
+  }
+}
+
+static inline uint16_t pack_rgb565_swapped(uint8_t b, uint8_t g, uint8_t r) {
+  uint16_t rgb565 = static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+  return static_cast<uint16_t>((rgb565 >> 8) | (rgb565 << 8));
+}
+
+static void emit_box_row(RowResampler* rs) {
+  if (rs->vacc_count == 0 || rs->vacc_dy >= rs->dst_h) return;
+  uint16_t* dst = rs->dst_buf + static_cast<size_t>(rs->vacc_dy) * rs->dst_w;
+  const uint32_t n = rs->vacc_count;
+  for (uint16_t x = 0; x < rs->dst_w; ++x) {
+    uint32_t* a = rs->vacc + x * 3U;
+    dst[x] = pack_rgb565_swapped(static_cast<uint8_t>(a[0] / n), static_cast<uint8_t>(a[1] / n),
+                                 static_cast<uint8_t>(a[2] / n));
+    a[0] = a[1] = a[2] = 0;
+  }
+  rs->vacc_count = 0;
+}
+
+static void emit_blend_row(RowResampler* rs, uint16_t dy, const uint8_t* top, const uint8_t* bottom, uint32_t f) {
+  uint16_t* dst = rs->dst_buf + static_cast<size_t>(dy) * rs->dst_w;
+  for (uint16_t x = 0; x < rs->dst_w; ++x) {
+    const uint8_t* a = top + x * 3U;
+    const uint8_t* b = bottom + x * 3U;
+    dst[x] = pack_rgb565_swapped(static_cast<uint8_t>((a[0] * (256U - f) + b[0] * f) >> 8),
+                                 static_cast<uint8_t>((a[1] * (256U - f) + b[1] * f) >> 8),
+                                 static_cast<uint8_t>((a[2] * (256U - f) + b[2] * f) >> 8));
+  }
+}
+
+void image_resample_push_row(RowResampler* rs, const uint8_t* src_row) {
+  const uint16_t sy = rs->rows_done++;
+  if (sy >= rs->src_h) return;
+  resample_row_h(rs, src_row, rs->hrow);
+
+  if (rs->v_box) {
+    uint16_t dy = static_cast<uint16_t>((static_cast<uint32_t>(sy) * rs->dst_h) / rs->src_h);
+    if (rs->vacc_count && dy != rs->vacc_dy) emit_box_row(rs);
+    rs->vacc_dy = dy;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(rs->dst_w) * 3U; ++i) {
+      rs->vacc[i] += rs->hrow[i];
+    }
+    rs->vacc_count++;
+    return;
+  }
+
+  while (rs->next_dy < rs->dst_h) {
+    const uint16_t y0 = rs->y_start[rs->next_dy];
+    if (y0 + 1 == sy && sy > 0) {
+      emit_blend_row(rs, rs->next_dy, rs->hrow_prev, rs->hrow, rs->y_frac[rs->next_dy]);
+    } else if (y0 == sy && (sy + 1 >= rs->src_h || rs->y_frac[rs->next_dy] == 0)) {
+      emit_blend_row(rs, rs->next_dy, rs->hrow, rs->hrow, 0);
+    } else {
+      break;
+    }
+    rs->next_dy++;
+  }
+  uint8_t* tmp = rs->hrow_prev;
+  rs->hrow_prev = rs->hrow;
+  rs->hrow = tmp;
+}
+
+void image_resample_finish(RowResampler* rs) {
+  if (rs->v_box) {
+    emit_box_row(rs);
+    return;
+  }
+  // Restliche Zielzeilen (unterer Rand) mit letzter Quellzeile auffuellen
+  while (rs->next_dy < rs->dst_h && rs->rows_done > 0) {
+    emit_blend_row(rs, rs->next_dy, rs->hrow_prev, rs->hrow_prev, 0);
+    rs->next_dy++;
+  }
+}
@@ -0,0 +1,49 @@
+#ifndef IMAGE_RESAMPLE_H
+#define IMAGE_RESAMPLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Separabler Resampler fuer den JPEG-Pfad: Quellzeilen (RGB888 in tjpgd-Reihenfolge
+// B,G,R) kommen zeilenweise rein, Zielbild ist RGB565 byte-getauscht.
+// Box beim Verkleinern, 8.8-Fixpunkt-bilinear beim Vergroessern, je Achse getrennt.
+// Kein Arduino/LVGL - die Puffer stellt der Aufrufer bereit.
+struct RowResampler {
+  uint16_t src_w;       // Ausgabegroesse von tjpgd (nach Skalierung)
+  uint16_t src_h;
+  uint16_t dst_w;
+  uint16_t dst_h;
+  uint16_t* dst_buf;
+  bool h_box;
+  bool v_box;
+  uint16_t* x_start;    // Box: Start, Bilinear: linkes Pixel
+  uint16_t* x_end;      // Box: Ende (exklusiv)
+  uint8_t* x_frac;      // Bilinear: Gewicht rechts (0..255)
+  uint16_t* y_start;    // Bilinear: obere Zeile pro Zielzeile
+  uint8_t* y_frac;
+  uint8_t* hrow;        // Quellzeile, horizontal skaliert (RGB888, dst_w)
+  uint8_t* hrow_prev;
+  uint32_t* vacc;       // Box vertikal: Akkumulator (dst_w * 3, genullt)
+  uint16_t vacc_count;
+  uint16_t vacc_dy;
+  uint16_t next_dy;
+  uint16_t rows_done;
+};
+
+// Groesste tjpgd-Skalierung (0..3 = 1/1..1/8), die den Zielrahmen noch abdeckt
+uint8_t jpeg_pick_scale(uint16_t src_w, uint16_t src_h, uint16_t dst_w, uint16_t dst_h);
+
+// Ausgabegroesse wie tjpgd sie bei Skalierung liefert (0 = Bild zu klein fuer die Stufe)
+uint16_t jpeg_scaled_dim(uint16_t full, uint16_t mcu, uint8_t scale);
+
+// Achsen-Tabelle: Box -> [start, end) pro Zielpixel, Bilinear -> linkes Pixel + Gewicht
+void image_resample_build_axis_map(uint16_t src, uint16_t dst, bool box, uint16_t* start, uint16_t* end,
+                                   uint8_t* frac);
+
+// Eine Quellzeile einarbeiten; fertige Zielzeilen werden sofort geschrieben
+void image_resample_push_row(RowResampler* rs, const uint8_t* src_row);
+
+// Nach der letzten Quellzeile: offene Box-Zeile bzw. unteren Rand schreiben
+void image_resample_finish(RowResampler* rs);
+
+#endif // IMAGE_RESAMPLE_H
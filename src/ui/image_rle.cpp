@@ -0,0 +1,332 @@
+#include "src/ui/image_rle.h"
+#include "src/ui/rle565.h"
+#include "src/core/sd_io.h"
+#include <draw/lv_image_decoder.h>
+#include <draw/lv_image_decoder_private.h>
+#include "esp_heap_caps.h"
+
+/* Dateiformat und Zeilen-Codec: src/ui/rle565.h */
+static constexpr uint8_t kRleMinSavingPercent = 10;  // darunter lohnt RLE nicht
+static constexpr size_t kRleReadChunk = 32 * 1024;
+static constexpr int32_t kRleBandRows = 32;  // Zeilen pro get_area im LVGL-Decoder
+
+static void rle_fill_lv_header(const Rle565Header& hdr, lv_image_header_t& header) {
+  memset(&header, 0, sizeof(header));
+  header.magic = LV_IMAGE_HEADER_MAGIC;
+  header.cf = hdr.cf;
+  header.w = hdr.w;
+  header.h = hdr.h;
+  header.stride = hdr.stride;
+}
+
+bool image_rle_write_file(const String& path, const lv_image_header_t& header, const uint8_t* data, size_t data_len,
+                          size_t& out_file_size, String& error) {
+  out_file_size = 0;
+#if IMAGE_BIN_RLE_ENABLED
+  if (!data || (header.cf != LV_COLOR_FORMAT_RGB565 && header.cf != LV_COLOR_FORMAT_RGB565_SWAPPED) ||
+      (header.flags & LV_IMAGE_FLAGS_COMPRESSED) || header.w == 0 || header.h == 0 ||
+      header.stride < static_cast<uint32_t>(header.w) * 2U ||
+      data_len < static_cast<size_t>(header.stride) * header.h) {
+    return false;
+  }
+
+  // Pass 1: Zeilengroessen -> Offset-Tabelle
+  const size_t table_bytes = sizeof(uint32_t) * (static_cast<size_t>(header.h) + 1U);
+  uint32_t* offsets = static_cast<uint32_t*>(heap_caps_malloc(table_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  if (!offsets) return false;
+  uint32_t total = 0;
+  for (uint16_t y = 0; y < header.h; ++y) {
+    offsets[y] = total;
+    const uint16_t* row = reinterpret_cast<const uint16_t*>(data + static_cast<size_t>(y) * header.stride);
+    total += static_cast<uint32_t>(rle565_encode_row(row, header.w, nullptr));
+  }
+  offsets[header.h] = total;
+
+  const size_t file_size = sizeof(Rle565Header) + table_bytes + total;
+  const size_t raw_size = sizeof(lv_image_header_t) + static_cast<size_t>(header.stride) * header.h;
+  if (file_size * 100U > raw_size * (100U - kRleMinSavingPercent)) {
+    heap_caps_free(offsets);
+    return false;
+  }
+
+  uint8_t* row_buf = static_cast<uint8_t*>(heap_caps_malloc(rle565_row_bound(header.w), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+  if (!row_buf) {
+    heap_caps_free(offsets);
+    return false;
+  }
+
+  if (SD.exists(path)) SD.remove(path);
+  File f = SD.open(path, FILE_WRITE);
+  if (!f) {
+    heap_caps_free(row_buf);
+    heap_caps_free(offsets);
+    error = "SD Schreibfehler";
+    return false;
+  }
+
+  Rle565Header hdr{};
+  hdr.magic = kRle565Magic;
+  hdr.cf = header.cf;
+  hdr.version = kRle565Version;
+  hdr.w = header.w;
+  hdr.h = header.h;
+  hdr.stride = static_cast<uint32_t>(header.w) * 2U;
+  hdr.data_size = total;
+  bool ok = f.write(reinterpret_cast<const uint8_t*>(&hdr), sizeof(hdr)) == sizeof(hdr) &&
+            f.write(reinterpret_cast<const uint8_t*>(offsets), table_bytes) == table_bytes;
+  for (uint16_t y = 0; ok && y < header.h; ++y) {
+    const uint16_t* row = reinterpret_cast<const uint16_t*>(data + static_cast<size_t>(y) * header.stride);
+    const size_t n = rle565_encode_row(row, header.w, row_buf);
+    ok = f.write(row_buf, n) == n;
+  }
+  f.close();
+  heap_caps_free(row_buf);
+  heap_caps_free(offsets);
+  if (!ok) {
+    SD.remove(path);
+    error = "RLE Schreibfehler";
+    return false;
+  }
+  out_file_size = file_size;
+  Serial.printf("[ImageRLE] %s: %u KB -> %u KB (%u%%)\n", path.c_str(),
+                static_cast<unsigned>(raw_size / 1024), static_cast<unsigned>(file_size / 1024),
+                static_cast<unsigned>(file_size * 100U / raw_size));
+  return true;
+#else
+  (void)path;
+  (void)header;
+  (void)data;
+  (void)data_len;
+  (void)error;
+  return false;
+#endif
+}
+
+bool image_rle_is_file(File& f) {
+  const uint32_t pos = f.position();
+  f.seek(0);
+  const int magic = f.read();
+  f.seek(pos);
+  return magic == kRle565Magic;
+}
+
+bool image_rle_read_info(File& f, lv_image_header_t& header) {
+  Rle565Header hdr{};
+  const uint32_t pos = f.position();
+  f.seek(0);
+  const bool ok = f.read(reinterpret_cast<uint8_t*>(&hdr), sizeof(hdr)) == sizeof(hdr) && rle565_header_valid(hdr);
+  f.seek(pos);
+  if (ok) rle_fill_lv_header(hdr, header);
+  return ok;
+}
+
+bool image_rle_read_file(File& f, lv_image_header_t& header, uint8_t*& out_buf, size_t& out_size, String& error,
+                         const volatile uint32_t* abort_gen, uint32_t abort_expect, void (*yield_cb)()) {
+  out_buf = nullptr;
+  out_size = 0;
+  Rle565Header hdr{};
+  f.seek(0);
+  if (f.read(reinterpret_cast<uint8_t*>(&hdr), sizeof(hdr)) != sizeof(hdr) || !rle565_header_valid(hdr)) {
+    error = "RLE Header Fehler";
+    return false;
+  }
+  const size_t table_bytes = sizeof(uint32_t) * (static_cast<size_t>(hdr.h) + 1U);
+  const size_t data_start = sizeof(hdr) + table_bytes;
+  if (f.size() < data_start + hdr.data_size) {
+    error = "RLE Groesse ungueltig";
+    return false;
+  }
+
+  uint32_t* offsets = static_cast<uint32_t*>(heap_caps_malloc(table_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  const size_t data_size = static_cast<size_t>(hdr.stride) * hdr.h;
+  uint8_t* buf = static_cast<uint8_t*>(heap_caps_malloc(data_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  size_t chunk_cap = kRleReadChunk;
+  if (chunk_cap < rle565_row_bound(hdr.w)) chunk_cap = rle565_row_bound(hdr.w);
+  uint8_t* chunk = static_cast<uint8_t*>(heap_caps_malloc(chunk_cap, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+  if (!chunk) chunk = static_cast<uint8_t*>(heap_caps_malloc(chunk_cap, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  auto cleanup = [&](bool keep_buf) {
+    if (offsets) heap_caps_free(offsets);
+    if (chunk) heap_caps_free(chunk);
+    if (buf && !keep_buf) heap_caps_free(buf);
+  };
+  if (!offsets || !buf || !chunk) {
+    cleanup(false);
+    error = "Kein RAM fuer Zielbild";
+    return false;
+  }
+  if (f.read(reinterpret_cast<uint8_t*>(offsets), table_bytes) != table_bytes || offsets[hdr.h] != hdr.data_size) {
+    cleanup(false);
+    error = "RLE Tabelle Fehler";
+    return false;
+  }
+
+  uint16_t y = 0;
+  while (y < hdr.h) {
+    if (abort_gen && *abort_gen != abort_expect) {
+      cleanup(false);
+      error = "Abgebrochen";
+      return false;
+    }
+    // So viele ganze Zeilen wie in den Chunk passen
+    uint16_t y_end = y + 1;
+    while (y_end < hdr.h && offsets[y_end + 1] - offsets[y] <= chunk_cap) y_end++;
+    const size_t span = offsets[y_end] - offsets[y];
+    const uint32_t read_start = micros();
+    const bool read_ok = span <= chunk_cap && f.seek(data_start + offsets[y]) && f.read(chunk, span) == span;
+    sd_io_record_read(read_ok ? span : 0, micros() - read_start);
+    if (!read_ok) {
+      cleanup(false);
+      error = "RLE Daten Fehler";
+      return false;
+    }
+    for (uint16_t r = y; r < y_end; ++r) {
+      if (!rle565_decode_row(chunk + (offsets[r] - offsets[y]), offsets[r + 1] - offsets[r],
+                          buf + static_cast<size_t>(r) * hdr.stride, hdr.w)) {
+        cleanup(false);
+        error = "RLE Daten Fehler";
+        return false;
+      }
+    }
+    y = y_end;
+    if (yield_cb) yield_cb();
+  }
+
+  cleanup(true);
+  rle_fill_lv_header(hdr, header);
+  out_buf = buf;
+  out_size = data_size;
+  return true;
+}
+
+/* === LVGL-Decoder (Fallback fuer direkte "S:"-Quellen) ===
+ * Dekodiert bandweise direkt in einen kleinen Draw-Buffer, ohne das ganze Bild zu halten.
+ */
+struct RleDecoderState {
+  lv_fs_file_t file;
+  Rle565Header hdr;
+  uint32_t data_start;
+  uint32_t* offsets;
+  uint8_t* chunk;
+  size_t chunk_cap;
+  lv_draw_buf_t* band;
+};
+
+static bool rle_src_is_candidate(lv_image_decoder_dsc_t* dsc) {
+  if (dsc->src_type != LV_IMAGE_SRC_FILE) return false;
+  const char* ext = lv_fs_get_ext(static_cast<const char*>(dsc->src));
+  return ext && (strcmp(ext, "bin") == 0 || strcmp(ext, "BIN") == 0);
+}
+
+static bool rle_read_lv_header(lv_fs_file_t* f, Rle565Header& hdr) {
+  uint32_t rn = 0;
+  if (lv_fs_seek(f, 0, LV_FS_SEEK_SET) != LV_FS_RES_OK) return false;
+  if (lv_fs_read(f, &hdr, sizeof(hdr), &rn) != LV_FS_RES_OK || rn != sizeof(hdr)) return false;
+  return rle565_header_valid(hdr);
+}
+
+static lv_result_t rle_decoder_info(lv_image_decoder_t*, lv_image_decoder_dsc_t* dsc, lv_image_header_t* header) {
+  if (!rle_src_is_candidate(dsc)) return LV_RESULT_INVALID;
+  lv_fs_file_t f;
+  if (lv_fs_open(&f, static_cast<const char*>(dsc->src), LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RESULT_INVALID;
+  Rle565Header hdr{};
+  const bool ok = rle_read_lv_header(&f, hdr);
+  lv_fs_close(&f);
+  if (!ok) return LV_RESULT_INVALID;
+  rle_fill_lv_header(hdr, *header);
+  return LV_RESULT_OK;
+}
+
+static void rle_state_free(RleDecoderState* st) {
+  if (!st) return;
+  lv_fs_close(&st->file);
+  if (st->offsets) lv_free(st->offsets);
+  if (st->chunk) lv_free(st->chunk);
+  if (st->band) lv_draw_buf_destroy(st->band);
+  lv_free(st);
+}
+
+static lv_result_t rle_decoder_open(lv_image_decoder_t*, lv_image_decoder_dsc_t* dsc) {
+  if (!rle_src_is_candidate(dsc)) return LV_RESULT_INVALID;
+  RleDecoderState* st = static_cast<RleDecoderState*>(lv_malloc_zeroed(sizeof(RleDecoderState)));
+  if (!st) return LV_RESULT_INVALID;
+  if (lv_fs_open(&st->file, static_cast<const char*>(dsc->src), LV_FS_MODE_RD) != LV_FS_RES_OK) {
+    lv_free(st);
+    return LV_RESULT_INVALID;
+  }
+  if (!rle_read_lv_header(&st->file, st->hdr)) {
+    rle_state_free(st);
+    return LV_RESULT_INVALID;
+  }
+
+  const uint32_t table_bytes = sizeof(uint32_t) * (static_cast<uint32_t>(st->hdr.h) + 1U);
+  st->data_start = sizeof(Rle565Header) + table_bytes;
+  st->offsets = static_cast<uint32_t*>(lv_malloc(table_bytes));
+  st->chunk_cap = kRleReadChunk;
+  if (st->chunk_cap < rle565_row_bound(st->hdr.w)) st->chunk_cap = rle565_row_bound(st->hdr.w);
+  st->chunk = static_cast<uint8_t*>(lv_malloc(st->chunk_cap));
+  st->band = lv_draw_buf_create(st->hdr.w, kRleBandRows, static_cast<lv_color_format_t>(st->hdr.cf), st->hdr.stride);
+  uint32_t rn = 0;
+  if (!st->offsets || !st->chunk || !st->band ||
+      lv_fs_read(&st->file, st->offsets, table_bytes, &rn) != LV_FS_RES_OK || rn != table_bytes) {
+    rle_state_free(st);
+    return LV_RESULT_INVALID;
+  }
+
+  dsc->user_data = st;
+  dsc->decoded = nullptr;  // Dekodiert wird in get_area
+  return LV_RESULT_OK;
+}
+
+static lv_result_t rle_decoder_get_area(lv_image_decoder_t*, lv_image_decoder_dsc_t* dsc,
+                                        const lv_area_t* full_area, lv_area_t* decoded_area) {
+  RleDecoderState* st = static_cast<RleDecoderState*>(dsc->user_data);
+  if (!st) return LV_RESULT_INVALID;
+
+  int32_t y = (decoded_area->y1 == LV_COORD_MIN) ? full_area->y1 : decoded_area->y2 + 1;
+  int32_t y_last = LV_MIN(full_area->y2, static_cast<int32_t>(st->hdr.h) - 1);
+  if (y < 0) y = 0;
+  if (y > y_last) return LV_RESULT_INVALID;
+  int32_t y_end = LV_MIN(y + kRleBandRows - 1, y_last);
+  // Band auf Chunk-Groesse begrenzen
+  while (y_end > y && st->offsets[y_end + 1] - st->offsets[y] > st->chunk_cap) y_end--;
+
+  const uint32_t span = st->offsets[y_end + 1] - st->offsets[y];
+  uint32_t rn = 0;
+  if (span > st->chunk_cap ||
+      lv_fs_seek(&st->file, st->data_start + st->offsets[y], LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+      lv_fs_read(&st->file, st->chunk, span, &rn) != LV_FS_RES_OK || rn != span) {
+    return LV_RESULT_INVALID;
+  }
+  for (int32_t r = y; r <= y_end; ++r) {
+    if (!rle565_decode_row(st->chunk + (st->offsets[r] - st->offsets[y]), st->offsets[r + 1] - st->offsets[r],
+                        st->band->data + static_cast<size_t>(r - y) * st->band->header.stride, st->hdr.w)) {
+      return LV_RESULT_INVALID;
+    }
+  }
+
+  decoded_area->x1 = 0;
+  decoded_area->x2 = st->hdr.w - 1;
+  decoded_area->y1 = y;
+  decoded_area->y2 = y_end;
+  dsc->decoded = st->band;
+  return LV_RESULT_OK;
+}
+
+static void rle_decoder_close(lv_image_decoder_t*, lv_image_decoder_dsc_t* dsc) {
+  rle_state_free(static_cast<RleDecoderState*>(dsc->user_data));
+  dsc->user_data = nullptr;
+  dsc->decoded = nullptr;
+}
+
+void image_rle_decoder_init() {
+  static bool registered = false;
+  if (registered) return;
+  lv_image_decoder_t* dec = lv_image_decoder_create();
+  if (!dec) return;
+  lv_image_decoder_set_info_cb(dec, rle_decoder_info);
+  lv_image_decoder_set_open_cb(dec, rle_decoder_open);
+  lv_image_decoder_set_get_area_cb(dec, rle_decoder_get_area);
+  lv_image_decoder_set_close_cb(dec, rle_decoder_close);
+  registered = true;
+  Serial.println("[ImageRLE] LVGL Decoder registriert");
+}
@@ -0,0 +1,36 @@
+#ifndef IMAGE_RLE_H
+#define IMAGE_RLE_H
+
+#include <lvgl.h>
+#include <Arduino.h>
+#include <SD.h>
+
+// Komprimierter RGB565-Container fuer SD-Bilder (.bin), zeilenweise RLE.
+// Eigene Magic statt LV_IMAGE_HEADER_MAGIC, damit der LVGL-Bin-Decoder die Datei
+// ablehnt und unser Decoder (image_rle_decoder_init) sie uebernimmt.
+// Dank Zeilen-Offset-Tabelle kann jede Zeile einzeln dekodiert werden.
+// 0 = immer unkomprimiertes LVGL-.bin schreiben (Vergleichsmessung).
+#ifndef IMAGE_BIN_RLE_ENABLED
+#define IMAGE_BIN_RLE_ENABLED 1
+#endif
+
+// Schreibt data als RLE-Datei. false + leerer error: Format passt nicht oder
+// Ersparnis zu gering -> Aufrufer schreibt das normale .bin.
+bool image_rle_write_file(const String& path, const lv_image_header_t& header, const uint8_t* data, size_t data_len,
+                          size_t& out_file_size, String& error);
+
+// Prueft die Magic am Dateianfang (Position wird zurueckgesetzt)
+bool image_rle_is_file(File& f);
+
+// Nur den Header lesen (Groesse/Format fuer den SD-Index)
+bool image_rle_read_info(File& f, lv_image_header_t& header);
+
+// Dekodiert die komplette Datei in einen heap_caps-Puffer (PSRAM)
+bool image_rle_read_file(File& f, lv_image_header_t& header, uint8_t*& out_buf, size_t& out_size, String& error,
+                         const volatile uint32_t* abort_gen = nullptr, uint32_t abort_expect = 0,
+                         void (*yield_cb)() = nullptr);
+
+// LVGL-Decoder fuer "S:...bin" im RLE-Format registrieren (nach lv_init)
+void image_rle_decoder_init();
+
+#endif // IMAGE_RLE_H
@@ -0,0 +1,66 @@
+#include "src/ui/rle565.h"
+#include <string.h>
+
+static_assert(sizeof(Rle565Header) == 16, "Rle565Header ist Dateiformat");
+
+size_t rle565_row_bound(uint16_t w) {
+  return static_cast<size_t>(w) * 2U + (w + 127U) / 128U + 1U;
+}
+
+size_t rle565_encode_row(const uint16_t* px, uint16_t w, uint8_t* out) {
+  size_t o = 0;
+  uint16_t x = 0;
+  while (x < w) {
+    uint16_t run = 1;
+    while (x + run < w && run < 128 && px[x + run] == px[x]) run++;
+    if (run >= 2) {
+      if (out) {
+        out[o] = static_cast<uint8_t>(run - 1);
+        memcpy(out + o + 1, &px[x], 2);
+      }
+      o += 3;
+      x += run;
+      continue;
+    }
+    // Literal bis zum Beginn der naechsten Wiederholung
+    uint16_t lit = 1;
+    while (x + lit < w && lit < 128 && !(x + lit + 1 < w && px[x + lit] == px[x + lit + 1])) lit++;
+    if (out) {
+      out[o] = static_cast<uint8_t>(0x80 | (lit - 1));
+      memcpy(out + o + 1, &px[x], static_cast<size_t>(lit) * 2U);
+    }
+    o += 1 + static_cast<size_t>(lit) * 2U;
+    x += lit;
+  }
+  return o;
+}
+
+bool rle565_decode_row(const uint8_t* in, size_t in_len, uint8_t* out, uint16_t w) {
+  size_t i = 0;
+  uint32_t x = 0;
+  uint16_t* dst = reinterpret_cast<uint16_t*>(out);
+  while (x < w) {
+    if (i >= in_len) return false;
+    const uint8_t token = in[i++];
+    const uint32_t n = (token & 0x7F) + 1U;
+    if (x + n > w) return false;
+    if (token & 0x80) {
+      if (i + n * 2U > in_len) return false;
+      memcpy(dst + x, in + i, n * 2U);
+      i += n * 2U;
+    } else {
+      if (i + 2U > in_len) return false;
+      uint16_t v;
+      memcpy(&v, in + i, 2);
+      i += 2;
+      for (uint32_t k = 0; k < n; ++k) dst[x + k] = v;
+    }
+    x += n;
+  }
+  return true;
+}
+
+bool rle565_header_valid(const Rle565Header& hdr) {
+  return hdr.magic == kRle565Magic && hdr.version == kRle565Version && hdr.w > 0 && hdr.h > 0 &&
+         hdr.stride >= static_cast<uint32_t>(hdr.w) * 2U;
+}
@@ -0,0 +1,38 @@
+#ifndef RLE565_H
+#define RLE565_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* === Zeilen-RLE fuer RGB565 (Container: image_rle.cpp) ===
+ * Rle565Header (16 Byte)
+ * uint32_t row_offsets[h + 1]   (relativ zum Datenanfang, letzter Eintrag = Datengroesse)
+ * Daten: pro Zeile Tokens, Bit 7 = Literal, Bits 0..6 = Anzahl - 1 (1..128 Pixel)
+ *   Literal: Token + n Pixel, Wiederholung: Token + 1 Pixel
+ */
+struct Rle565Header {
+  uint8_t magic;
+  uint8_t cf;
+  uint8_t version;
+  uint8_t reserved;
+  uint16_t w;
+  uint16_t h;
+  uint32_t stride;
+  uint32_t data_size;
+};
+
+static constexpr uint8_t kRle565Magic = 0x52;  // 'R' (LVGL nutzt 0x19)
+static constexpr uint8_t kRle565Version = 1;
+
+// Obergrenze der kodierten Zeile (reine Literale + Reserve)
+size_t rle565_row_bound(uint16_t w);
+
+// Kodiert eine Zeile; out == nullptr zaehlt nur die Bytes
+size_t rle565_encode_row(const uint16_t* px, uint16_t w, uint8_t* out);
+
+// false bei abgeschnittenen Daten oder Token ueber das Zeilenende hinaus
+bool rle565_decode_row(const uint8_t* in, size_t in_len, uint8_t* out, uint16_t w);
+
+bool rle565_header_valid(const Rle565Header& hdr);
+
+#endif // RLE565_H
@@ -0,0 +1,559 @@
+#include "src/ui/sd_image_index.h"
+#include "src/ui/image_rle.h"
+#include "src/core/sd_io.h"
+#include "src/tiles/tile_thumb.h"
+#include <SD.h>
+#include <lvgl.h>
+#include <algorithm>
+#include "esp_heap_caps.h"
+
+/* === Datensaetze + Pfad-Pool in PSRAM (5000 Bilder ~ 300 KB) === */
+static constexpr uint8_t kRecProbed = 0x01;
+static constexpr uint32_t kProbeBudgetMs = 15;
+static constexpr uint32_t kProbeSaveEvery = 250;  // Zwischenstand sichern
+static constexpr uint32_t kJpegProbeLimit = 512 * 1024;
+
+struct ImgRec {
+  uint32_t path_off;
+  uint16_t path_len;
+  uint8_t format;
+  uint8_t flags;
+  uint32_t size;
+  uint32_t mtime;
+  uint16_t w;
+  uint16_t h;
+  uint32_t name_hash;  // Abgleich innerhalb eines Verzeichnisses
+};
+
+struct DirRec {
+  String path;
+  uint32_t mtime = 0;
+  uint32_t sig = 0;    // Signatur der Namensliste
+  uint8_t depth = 0;
+  uint32_t first = 0;  // Datensaetze des Verzeichnisses liegen am Stueck
+  uint32_t count = 0;
+  std::vector<String> subdirs;
+};
+
+struct IndexData {
+  ImgRec* recs = nullptr;
+  size_t count = 0;
+  size_t cap = 0;
+  char* pool = nullptr;
+  size_t pool_len = 0;
+  size_t pool_cap = 0;
+  std::vector<DirRec> dirs;
+};
+
+static IndexData g_index;
+static bool g_index_loaded = false;
+static volatile bool g_index_need_verify = true;  // erster Abgleich nach dem Start
+static bool g_index_dirty = false;
+static size_t g_probe_cursor = 0;
+static uint32_t g_probe_since_save = 0;
+static SdImageIndexStats g_index_stats = {};
+
+static void* psram_realloc(void* ptr, size_t size) {
+  void* p = heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!p) p = heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT);
+  return p;
+}
+
+static void index_free(IndexData& idx) {
+  if (idx.recs) heap_caps_free(idx.recs);
+  if (idx.pool) heap_caps_free(idx.pool);
+  idx.recs = nullptr;
+  idx.pool = nullptr;
+  idx.count = idx.cap = 0;
+  idx.pool_len = idx.pool_cap = 0;
+  idx.dirs.clear();
+}
+
+static ImgRec* index_add(IndexData& idx, const char* path, size_t path_len) {
+  if (idx.count == idx.cap) {
+    const size_t cap = idx.cap ? idx.cap * 2 : 256;
+    ImgRec* recs = static_cast<ImgRec*>(psram_realloc(idx.recs, cap * sizeof(ImgRec)));
+    if (!recs) return nullptr;
+    idx.recs = recs;
+    idx.cap = cap;
+  }
+  if (idx.pool_len + path_len + 1 > idx.pool_cap) {
+    size_t cap = idx.pool_cap ? idx.pool_cap * 2 : 16 * 1024;
+    while (cap < idx.pool_len + path_len + 1) cap *= 2;
+    char* pool = static_cast<char*>(psram_realloc(idx.pool, cap));
+    if (!pool) return nullptr;
+    idx.pool = pool;
+    idx.pool_cap = cap;
+  }
+  memcpy(idx.pool + idx.pool_len, path, path_len);
+  idx.pool[idx.pool_len + path_len] = '\0';
+  ImgRec* rec = &idx.recs[idx.count++];
+  memset(rec, 0, sizeof(*rec));
+  rec->path_off = static_cast<uint32_t>(idx.pool_len);
+  rec->path_len = static_cast<uint16_t>(path_len);
+  idx.pool_len += path_len + 1;
+  return rec;
+}
+
+static inline const char* rec_path(const IndexData& idx, const ImgRec& rec) {
+  return idx.pool + rec.path_off;
+}
+
+/* === Hilfen === */
+static uint32_t fnv_mix(uint32_t h, const char* s, size_t len) {
+  for (size_t i = 0; i < len; ++i) {
+    h ^= static_cast<uint8_t>(s[i]);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static const char* base_name(const char* path) {
+  const char* slash = strrchr(path, '/');
+  return slash ? slash + 1 : path;
+}
+
+static uint32_t name_hash(const char* path) {
+  const char* name = base_name(path);
+  return fnv_mix(2166136261u, name, strlen(name));
+}
+
+static bool ends_with_ci(const char* s, size_t len, const char* suffix) {
+  const size_t n = strlen(suffix);
+  return len >= n && strncasecmp(s + len - n, suffix, n) == 0;
+}
+
+static uint8_t format_from_name(const char* path, size_t len) {
+  if (ends_with_ci(path, len, ".bin")) return SD_IMAGE_BIN;
+  if (ends_with_ci(path, len, ".jpg") || ends_with_ci(path, len, ".jpeg")) return SD_IMAGE_JPEG;
+  return SD_IMAGE_UNKNOWN;
+}
+
+static String join_path(const String& dir, const String& name) {
+  if (name.startsWith("/")) return name;
+  if (dir == "/") return String("/") + name;
+  return dir + "/" + name;
+}
+
+static bool contains_ci(const char* hay, const String& needle) {
+  const size_t n = needle.length();
+  for (; *hay; ++hay) {
+    if (strncasecmp(hay, needle.c_str(), n) == 0) return true;
+  }
+  return n == 0;
+}
+
+static bool format_matches(uint8_t format, uint8_t mask) {
+  if (format == SD_IMAGE_JPEG) return (mask & SD_IMAGE_MASK_JPEG) != 0;
+  return (mask & SD_IMAGE_MASK_BIN) != 0;
+}
+
+// SOFn-Marker suchen (APPn/EXIF werden per seek uebersprungen)
+static bool jpeg_read_size(File& f, uint16_t& w, uint16_t& h) {
+  uint8_t b[5];
+  if (f.read(b, 2) != 2 || b[0] != 0xFF || b[1] != 0xD8) return false;
+  uint32_t pos = 2;
+  const uint32_t limit = std::min<uint32_t>(f.size(), kJpegProbeLimit);
+  while (pos + 4 <= limit) {
+    if (!f.seek(pos) || f.read(b, 4) != 4 || b[0] != 0xFF) return false;
+    const uint8_t marker = b[1];
+    if (marker == 0xFF) {  // Fuellbyte
+      pos++;
+      continue;
+    }
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8)) {
+      pos += 2;
+      continue;
+    }
+    if (marker == 0xD9 || marker == 0xDA) return false;
+    const uint16_t len = static_cast<uint16_t>((b[2] << 8) | b[3]);
+    if (len < 2) return false;
+    if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+      if (f.read(b, 5) != 5) return false;
+      h = static_cast<uint16_t>((b[1] << 8) | b[2]);
+      w = static_cast<uint16_t>((b[3] << 8) | b[4]);
+      return true;
+    }
+    pos += 2U + len;
+  }
+  return false;
+}
+
+static void probe_rec(const IndexData& idx, ImgRec& rec) {
+  rec.flags |= kRecProbed;
+  File f = SD.open(rec_path(idx, rec), FILE_READ);
+  if (!f) return;
+  if (rec.format == SD_IMAGE_JPEG) {
+    jpeg_read_size(f, rec.w, rec.h);
+  } else {
+    lv_image_header_t header{};
+    if (f.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) == sizeof(header) &&
+        header.magic == LV_IMAGE_HEADER_MAGIC) {
+      rec.format = SD_IMAGE_BIN;
+      rec.w = header.w;
+      rec.h = header.h;
+    } else if (image_rle_read_info(f, header)) {
+      rec.format = SD_IMAGE_BIN_RLE;
+      rec.w = header.w;
+      rec.h = header.h;
+    }
+  }
+  f.close();
+}
+
+/* === Indexdatei === */
+// #IDX1
+// D <depth> <mtime> <sig> <pfad>          Verzeichnis, danach seine Eintraege
+// S <pfad>                                Unterverzeichnis
+// F <size> <mtime> <w> <h> <fmt> <flags> <pfad>
+static bool parse_u32(char*& p, uint32_t& out, int base = 10) {
+  char* end = nullptr;
+  out = strtoul(p, &end, base);
+  if (end == p || *end != '\t') return false;
+  p = end + 1;
+  return true;
+}
+
+static bool index_load(IndexData& idx) {
+  File f = SD.open(SD_IMAGE_INDEX_PATH, FILE_READ);
+  if (!f) return false;
+  const size_t size = f.size();
+  char* buf = size > 6 ? static_cast<char*>(psram_realloc(nullptr, size + 1)) : nullptr;
+  if (!buf) {
+    f.close();
+    return false;
+  }
+  const uint32_t start = micros();
+  const size_t got = f.read(reinterpret_cast<uint8_t*>(buf), size);
+  sd_io_record_read(got, micros() - start);
+  f.close();
+  buf[got] = '\0';
+
+  bool ok = strncmp(buf, "#IDX1\n", 6) == 0;
+  char* line = buf + 6;
+  while (ok && *line) {
+    char* nl = strchr(line, '\n');
+    if (nl) *nl = '\0';
+    char* p = line + 2;
+    if (line[0] == 'D' && line[1] == '\t') {
+      DirRec dir;
+      uint32_t depth = 0;
+      ok = parse_u32(p, depth) && parse_u32(p, dir.mtime) && parse_u32(p, dir.sig, 16);
+      dir.depth = static_cast<uint8_t>(depth);
+      dir.path = p;
+      dir.first = static_cast<uint32_t>(idx.count);
+      idx.dirs.push_back(dir);
+    } else if (line[0] == 'S' && line[1] == '\t' && !idx.dirs.empty()) {
+      idx.dirs.back().subdirs.push_back(String(p));
+    } else if (line[0] == 'F' && line[1] == '\t' && !idx.dirs.empty()) {
+      uint32_t size_v = 0, mtime = 0, w = 0, h = 0, fmt = 0, flags = 0;
+      ok = parse_u32(p, size_v) && parse_u32(p, mtime) && parse_u32(p, w) && parse_u32(p, h) &&
+           parse_u32(p, fmt) && parse_u32(p, flags);
+      ImgRec* rec = ok ? index_add(idx, p, strlen(p)) : nullptr;
+      if (rec) {
+        rec->size = size_v;
+        rec->mtime = mtime;
+        rec->w = static_cast<uint16_t>(w);
+        rec->h = static_cast<uint16_t>(h);
+        rec->format = static_cast<uint8_t>(fmt);
+        rec->flags = static_cast<uint8_t>(flags);
+        rec->name_hash = name_hash(rec_path(idx, *rec));
+        idx.dirs.back().count++;
+      } else {
+        ok = false;
+      }
+    }
+    if (!nl) break;
+    line = nl + 1;
+  }
+  heap_caps_free(buf);
+  if (!ok) index_free(idx);
+  return ok;
+}
+
+static bool index_save(const IndexData& idx) {
+  const char* tmp_path = SD_IMAGE_INDEX_PATH ".tmp";
+  if (SD.exists(tmp_path)) SD.remove(tmp_path);
+  File f = SD.open(tmp_path, FILE_WRITE);
+  if (!f) return false;
+  bool ok;
+  {
+    SdBufferedWriter writer(f);
+    char head[80];
+    writer.write(reinterpret_cast<const uint8_t*>("#IDX1\n"), 6);
+    for (const DirRec& dir : idx.dirs) {
+      int n = snprintf(head, sizeof(head), "D\t%u\t%lu\t%08lX\t", static_cast<unsigned>(dir.depth),
+                       static_cast<unsigned long>(dir.mtime), static_cast<unsigned long>(dir.sig));
+      writer.write(reinterpret_cast<const uint8_t*>(head), n);
+      writer.write(reinterpret_cast<const uint8_t*>(dir.path.c_str()), dir.path.length());
+      writer.write(reinterpret_cast<const uint8_t*>("\n"), 1);
+      for (const String& sub : dir.subdirs) {
+        writer.write(reinterpret_cast<const uint8_t*>("S\t"), 2);
+        writer.write(reinterpret_cast<const uint8_t*>(sub.c_str()), sub.length());
+        writer.write(reinterpret_cast<const uint8_t*>("\n"), 1);
+      }
+      for (uint32_t i = dir.first; i < dir.first + dir.count; ++i) {
+        const ImgRec& rec = idx.recs[i];
+        n = snprintf(head, sizeof(head), "F\t%lu\t%lu\t%u\t%u\t%u\t%u\t", static_cast<unsigned long>(rec.size),
+                     static_cast<unsigned long>(rec.mtime), rec.w, rec.h, rec.format, rec.flags);
+        writer.write(reinterpret_cast<const uint8_t*>(head), n);
+        writer.write(reinterpret_cast<const uint8_t*>(rec_path(idx, rec)), rec.path_len);
+        writer.write(reinterpret_cast<const uint8_t*>("\n"), 1);
+      }
+    }
+    ok = writer.flush();
+  }
+  f.close();
+  if (!ok) {
+    SD.remove(tmp_path);
+    return false;
+  }
+  if (SD.exists(SD_IMAGE_INDEX_PATH)) SD.remove(SD_IMAGE_INDEX_PATH);
+  return SD.rename(tmp_path, SD_IMAGE_INDEX_PATH);
+}
+
+/* === Abgleich === */
+struct RefreshCtx {
+  const IndexData* old;
+  IndexData* next;
+  bool force;
+  bool verify;
+  bool changed;
+  uint32_t dirs_listed;
+  uint32_t files_stat;
+};
+
+static const DirRec* find_dir(const IndexData& idx, const String& path) {
+  for (const DirRec& dir : idx.dirs) {
+    if (dir.path == path) return &dir;
+  }
+  return nullptr;
+}
+
+static bool copy_rec(IndexData& next, const IndexData& old, const ImgRec& src) {
+  ImgRec* rec = index_add(next, rec_path(old, src), src.path_len);
+  if (!rec) return false;
+  const uint32_t off = rec->path_off;
+  *rec = src;
+  rec->path_off = off;
+  return true;
+}
+
+// Namensliste per readdir (ohne open pro Datei)
+static uint32_t list_signature(File& dir) {
+  uint32_t sig = 2166136261u;
+  bool is_dir = false;
+  for (;;) {
+    String name = dir.getNextFileName(&is_dir);
+    if (name.length() == 0) break;
+    sig = fnv_mix(sig, name.c_str(), name.length());
+    sig = fnv_mix(sig, is_dir ? "/" : "|", 1);
+  }
+  return sig;
+}
+
+static bool walk_dir(RefreshCtx& ctx, const String& path, uint8_t depth) {
+  const DirRec* old = ctx.old ? find_dir(*ctx.old, path) : nullptr;
+  File d = SD.open(path);
+  if (!d || !d.isDirectory()) {
+    if (old) ctx.changed = true;
+    return true;
+  }
+  DirRec rec;
+  rec.path = path;
+  rec.depth = depth;
+  rec.mtime = static_cast<uint32_t>(d.getLastWrite());
+  rec.first = static_cast<uint32_t>(ctx.next->count);
+
+  bool reuse = old && !ctx.force && !ctx.verify && rec.mtime != 0 && rec.mtime == old->mtime;
+  if (!reuse) {
+    ctx.dirs_listed++;
+    rec.sig = list_signature(d);
+    reuse = old && !ctx.force && rec.sig == old->sig;
+    if (old && rec.mtime != old->mtime) ctx.changed = true;  // nur mtime nachtragen
+  } else {
+    rec.sig = old->sig;
+  }
+
+  if (reuse) {
+    d.close();
+    for (uint32_t i = old->first; i < old->first + old->count; ++i) {
+      if (!copy_rec(*ctx.next, *ctx.old, ctx.old->recs[i])) return false;
+    }
+    rec.subdirs = old->subdirs;
+  } else {
+    // Verzeichnis neu lesen; bekannte Dateien (Name, Groesse, mtime gleich) behalten ihre Abmessungen
+    ctx.changed = true;
+    std::vector<std::pair<uint32_t, uint32_t>> known;
+    if (old) {
+      known.reserve(old->count);
+      for (uint32_t i = old->first; i < old->first + old->count; ++i) {
+        known.push_back({ctx.old->recs[i].name_hash, i});
+      }
+      std::sort(known.begin(), known.end());
+    }
+    d.rewindDirectory();
+    File file = d.openNextFile();
+    while (file) {
+      const char* name_c = file.name();
+      String name = name_c ? String(name_c) : String();
+      if (name.length()) {
+        String full = join_path(path, name);
+        if (file.isDirectory()) {
+          // Thumbnail-Cache ist kein eigenes Bild (Diashow/Web-Auswahl)
+          if (depth < SD_IMAGE_INDEX_DEPTH && full != TILE_THUMB_DIR) rec.subdirs.push_back(full);
+        } else {
+          const uint8_t format = format_from_name(full.c_str(), full.length());
+          if (format != SD_IMAGE_UNKNOWN) {
+            ctx.files_stat++;
+            const uint32_t size = file.size();
+            const uint32_t mtime = static_cast<uint32_t>(file.getLastWrite());
+            const uint32_t h = name_hash(full.c_str());
+            const ImgRec* prev = nullptr;
+            if (!ctx.force) {
+              auto it = std::lower_bound(known.begin(), known.end(), std::make_pair(h, static_cast<uint32_t>(0)));
+              for (; it != known.end() && it->first == h; ++it) {
+                const ImgRec& cand = ctx.old->recs[it->second];
+                if (cand.size == size && cand.mtime == mtime && full == rec_path(*ctx.old, cand)) {
+                  prev = &cand;
+                  break;
+                }
+              }
+            }
+            if (prev) {
+              if (!copy_rec(*ctx.next, *ctx.old, *prev)) return false;
+            } else {
+              ImgRec* r = index_add(*ctx.next, full.c_str(), full.length());
+              if (!r) return false;
+              r->format = format;
+              r->size = size;
+              r->mtime = mtime;
+              r->name_hash = h;
+            }
+          }
+        }
+      }
+      file = d.openNextFile();
+    }
+    d.close();
+  }
+  rec.count = static_cast<uint32_t>(ctx.next->count) - rec.first;
+  const std::vector<String> subdirs = rec.subdirs;
+  ctx.next->dirs.push_back(rec);
+  yield();
+  if (depth >= SD_IMAGE_INDEX_DEPTH) return true;
+  for (const String& sub : subdirs) {
+    if (!walk_dir(ctx, sub, depth + 1)) return false;
+  }
+  return true;
+}
+
+bool sd_image_index_refresh(bool force) {
+  if (SD.cardType() == CARD_NONE) return false;
+  const uint32_t start_ms = millis();
+  bool cold = false;
+  if (!g_index_loaded) {
+    cold = !index_load(g_index);
+    g_index_loaded = true;
+  }
+  const bool verify = g_index_need_verify;
+  g_index_need_verify = false;
+
+  IndexData next;
+  RefreshCtx ctx{};
+  ctx.old = g_index.dirs.empty() ? nullptr : &g_index;
+  ctx.next = &next;
+  ctx.force = force;
+  ctx.verify = verify;
+  if (!walk_dir(ctx, "/", 0)) {
+    index_free(next);
+    Serial.println("[SdIndex] Kein RAM fuer Index");
+    return false;
+  }
+  if (ctx.changed || cold || next.count != g_index.count) {
+    index_free(g_index);
+    g_index = next;
+    g_probe_cursor = 0;
+    g_index_dirty = true;
+  } else {
+    index_free(next);
+  }
+
+  g_index_stats.refreshes++;
+  g_index_stats.last_refresh_ms = millis() - start_ms;
+  g_index_stats.last_dirs_listed = ctx.dirs_listed;
+  g_index_stats.last_files_stat = ctx.files_stat;
+  g_index_stats.last_cold = cold;
+  Serial.printf("[SdIndex] %s: %u Bilder in %u Ordnern, %lu ms (%lu Ordner gelistet, %lu Dateien geoeffnet)\n",
+                cold ? "Kalt" : (verify ? "Pruefung" : "Warm"), static_cast<unsigned>(g_index.count),
+                static_cast<unsigned>(g_index.dirs.size()), static_cast<unsigned long>(g_index_stats.last_refresh_ms),
+                static_cast<unsigned long>(ctx.dirs_listed), static_cast<unsigned long>(ctx.files_stat));
+  if (g_index_dirty && index_save(g_index)) g_index_dirty = false;
+  return true;
+}
+
+void sd_image_index_service() {
+  if (!g_index_loaded || !g_index.count) return;
+  if (g_probe_cursor >= g_index.count && !g_index_dirty) return;
+  if (SD.cardType() == CARD_NONE) return;
+  const uint32_t start_ms = millis();
+  while (g_probe_cursor < g_index.count && millis() - start_ms < kProbeBudgetMs) {
+    ImgRec& rec = g_index.recs[g_probe_cursor++];
+    if (rec.flags & kRecProbed) continue;
+    probe_rec(g_index, rec);
+    g_index_dirty = true;
+    g_probe_since_save++;
+  }
+  const bool done = g_probe_cursor >= g_index.count;
+  if (g_index_dirty && (done || g_probe_since_save >= kProbeSaveEvery)) {
+    if (index_save(g_index)) g_index_dirty = false;
+    g_probe_since_save = 0;
+    if (done) Serial.printf("[SdIndex] Abmessungen fuer %u Bilder aktuell\n", static_cast<unsigned>(g_index.count));
+  }
+}
+
+void sd_image_index_invalidate() {
+  g_index_need_verify = true;
+}
+
+size_t sd_image_index_query(uint8_t mask, const String& contains, size_t offset, size_t limit,
+                            std::vector<SdImageInfo>& out) {
+  size_t total = 0;
+  for (size_t i = 0; i < g_index.count; ++i) {
+    const ImgRec& rec = g_index.recs[i];
+    if (!format_matches(rec.format, mask)) continue;
+    const char* path = rec_path(g_index, rec);
+    if (contains.length() && !contains_ci(path, contains)) continue;
+    if (total >= offset && out.size() < limit) {
+      SdImageInfo info;
+      info.path = path;
+      info.size = rec.size;
+      info.mtime = rec.mtime;
+      info.w = rec.w;
+      info.h = rec.h;
+      info.format = rec.format;
+      out.push_back(info);
+    }
+    total++;
+  }
+  return total;
+}
+
+size_t sd_image_index_paths(uint8_t mask, size_t limit, std::vector<String>& out) {
+  for (size_t i = 0; i < g_index.count && out.size() < limit; ++i) {
+    const ImgRec& rec = g_index.recs[i];
+    if (format_matches(rec.format, mask)) out.push_back(String(rec_path(g_index, rec)));
+  }
+  return out.size();
+}
+
+SdImageIndexStats sd_image_index_get_stats() {
+  SdImageIndexStats s = g_index_stats;
+  s.entries = static_cast<uint32_t>(g_index.count);
+  s.dirs = static_cast<uint32_t>(g_index.dirs.size());
+  s.probe_pending = 0;
+  for (size_t i = 0; i < g_index.count; ++i) {
+    if (!(g_index.recs[i].flags & kRecProbed)) s.probe_pending++;
+  }
+  return s;
+}
@@ -0,0 +1,66 @@
+#ifndef SD_IMAGE_INDEX_H
+#define SD_IMAGE_INDEX_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Persistenter Bild-Index der SD-Karte (/_image_index.txt) fuer Diashow und
+// Web-Bildauswahl, statt bei jedem Aufruf rekursiv openNextFile.
+// Abgleich pro Verzeichnis ueber dessen mtime. FAT pflegt die Verzeichnis-mtime
+// nicht zuverlaessig (Root hat gar keine), daher vergleicht der erste Abgleich
+// nach dem Start bzw. nach sd_image_index_invalidate() zusaetzlich eine
+// Signatur der Namensliste (nur readdir, kein open pro Datei).
+// Bildgroessen werden nicht beim Listen gelesen, sondern nachgelagert in
+// kleinen Zeitscheiben (sd_image_index_service aus dem Loop).
+#define SD_IMAGE_INDEX_PATH "/_image_index.txt"
+#define SD_IMAGE_INDEX_DEPTH 3
+
+enum SdImageFormat : uint8_t {
+  SD_IMAGE_UNKNOWN = 0,
+  SD_IMAGE_BIN = 1,      // LVGL .bin unkomprimiert
+  SD_IMAGE_BIN_RLE = 2,  // .bin im RLE-Container (image_rle)
+  SD_IMAGE_JPEG = 3
+};
+
+#define SD_IMAGE_MASK_BIN 0x01   // .bin (roh + RLE)
+#define SD_IMAGE_MASK_JPEG 0x02
+#define SD_IMAGE_MASK_ALL (SD_IMAGE_MASK_BIN | SD_IMAGE_MASK_JPEG)
+
+struct SdImageInfo {
+  String path;
+  uint32_t size;
+  uint32_t mtime;
+  uint16_t w;
+  uint16_t h;       // 0 = noch nicht gelesen
+  uint8_t format;
+};
+
+struct SdImageIndexStats {
+  uint32_t entries;
+  uint32_t dirs;
+  uint32_t refreshes;
+  uint32_t last_refresh_ms;
+  uint32_t last_dirs_listed;   // Verzeichnisse, deren Namensliste gelesen wurde
+  uint32_t last_files_stat;    // Dateien, die geoeffnet werden mussten (Groesse/mtime)
+  uint32_t probe_pending;      // Header (Abmessungen) noch nicht gelesen
+  bool last_cold;              // ohne gueltige Indexdatei gestartet
+};
+
+// Index laden bzw. abgleichen; force = alle Verzeichnisse und Header neu lesen
+bool sd_image_index_refresh(bool force = false);
+
+// Gefiltert + seitenweise. contains: Teilstring im Pfad (ohne Gross/Klein), leer = alle.
+// Rueckgabe: Gesamtzahl der Treffer (fuer Paging).
+size_t sd_image_index_query(uint8_t mask, const String& contains, size_t offset, size_t limit,
+                            std::vector<SdImageInfo>& out);
+size_t sd_image_index_paths(uint8_t mask, size_t limit, std::vector<String>& out);
+
+// Abmessungen nachtragen (Zeitbudget pro Aufruf), Index bei Bedarf speichern
+void sd_image_index_service();
+
+// Naechster Abgleich prueft alle Verzeichnisse (z.B. nach eigenem Schreiben)
+void sd_image_index_invalidate();
+
+SdImageIndexStats sd_image_index_get_stats();
+
+#endif // SD_IMAGE_INDEX_H
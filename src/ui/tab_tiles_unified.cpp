@@ -2,8 +2,11 @@
 #include "src/core/display_manager.h"
 #include "src/tiles/tile_config.h"
 #include "src/tiles/tile_renderer.h"
+#include "src/tiles/tile_card_cache.h"
+#include "src/tiles/tile_thumb.h"
 #include "src/ui/sensor_popup.h"
 #include "src/network/ha_bridge_config.h"
+#include "src/network/entity_table.h"
 #include <Arduino.h>
 
 /* === Layout-Konstanten === */
@@ -20,54 +23,16 @@ static bool g_tiles_reload_requested[3] = {false, false, false};
 static bool g_tiles_reload_only_if_loaded[3] = {true, true, true};
 static bool g_tiles_release_requested[3] = {false, false, false};
 
-/* === Entity-State Cache (for lazy-loaded tabs) === */
-struct EntityCacheEntry {
-  String entity_id;
-  String payload;
-  bool valid = false;
-};
-
-static constexpr size_t kEntityCacheSize = TILES_PER_GRID * 3;
-static EntityCacheEntry g_entity_cache[kEntityCacheSize];
-static size_t g_entity_cache_cursor = 0;
-
-static void cache_entity_payload(const char* entity_id, const char* payload) {
-  if (!entity_id || !payload || entity_id[0] == '\0') return;
-
-  for (size_t i = 0; i < kEntityCacheSize; ++i) {
-    EntityCacheEntry& entry = g_entity_cache[i];
-    if (entry.valid && entry.entity_id.equalsIgnoreCase(entity_id)) {
-      entry.payload = payload;
-      return;
-    }
-  }
-
-  for (size_t i = 0; i < kEntityCacheSize; ++i) {
-    if (!g_entity_cache[i].valid) {
-      g_entity_cache[i].entity_id = entity_id;
-      g_entity_cache[i].payload = payload;
-      g_entity_cache[i].valid = true;
-      return;
-    }
-  }
-
-  size_t idx = g_entity_cache_cursor++ % kEntityCacheSize;
-  g_entity_cache[idx].entity_id = entity_id;
-  g_entity_cache[idx].payload = payload;
-  g_entity_cache[idx].valid = true;
-}
-
-static bool get_cached_entity_payload(const char* entity_id, String& out) {
-  if (!entity_id || entity_id[0] == '\0') return false;
-  for (size_t i = 0; i < kEntityCacheSize; ++i) {
-    const EntityCacheEntry& entry = g_entity_cache[i];
-    if (entry.valid && entry.entity_id.equalsIgnoreCase(entity_id)) {
-      out = entry.payload;
-      return true;
-    }
-  }
-  return false;
-}
+/* === Zeitgesteuerter Grid-Builder (Tiles verteilt auf lv_timer-Ticks) === */
+static constexpr uint32_t kBuildBudgetUs = 6000;   // Max. Bauzeit pro Tick
+static constexpr uint32_t kBuildTimerPeriodMs = 1;
+static lv_timer_t* g_tiles_build_timer = nullptr;
+static bool g_tiles_building[3] = {false, false, false};
+static uint8_t g_tiles_build_next[3] = {0, 0, 0};
+static uint32_t g_tiles_build_start_ms[3] = {0, 0, 0};
+static uint16_t g_tiles_build_ticks[3] = {0, 0, 0};
+static uint32_t g_tiles_build_max_tick_us[3] = {0, 0, 0};
+static uint8_t g_tiles_visible = 0;  // Sichtbares Grid wird zuerst gebaut (0xFF = keins)
 
 /* === Helper: Get grid config by type === */
 static const TileGridConfig& getGridConfig(GridType type) {
@@ -122,14 +87,15 @@ static void apply_cached_states(GridType grid_type, const TileGridConfig& config
     if (tile.type != TILE_SENSOR && tile.type != TILE_SWITCH) continue;
     if (tile.sensor_entity.length() == 0) continue;
 
-    String payload;
-    if (!get_cached_entity_payload(tile.sensor_entity.c_str(), payload)) continue;
+    // Lazy-Tab: letzter Zustand aus dem Entity-Cache, bereits geparst
+    const EntityEntry* entry = entity_state_lookup(tile.sensor_entity.c_str());
+    if (!entry) continue;
 
     if (tile.type == TILE_SENSOR) {
       const char* unit = tile.sensor_unit.length() > 0 ? tile.sensor_unit.c_str() : nullptr;
-      queue_sensor_tile_update(grid_type, i, payload.c_str(), unit);
-    } else if (tile.type == TILE_SWITCH) {
-      queue_switch_tile_update(grid_type, i, payload.c_str());
+      queue_sensor_tile_update(grid_type, i, entry->value.c_str(), unit, entry->stale);
+    } else if (tile.type == TILE_SWITCH && entry->has_switch) {
+      queue_switch_tile_state(grid_type, i, entry->sw, entry->stale);
     }
   }
 }
@@ -149,57 +115,104 @@ void build_tiles_tab(lv_obj_t *parent, GridType grid_type, scene_publish_cb_t sc
   lv_obj_set_style_pad_all(parent, OUTER, 0);
 
   g_tiles_grids[idx] = create_tiles_grid(parent);
-  if (grid_type == GridType::TAB0) {
-    tiles_reload_layout(grid_type);
-  } else {
-    g_tiles_loaded[idx] = false;
+  // Alle Grids per Builder aufbauen; das sichtbare hat Vorrang, der Rest folgt im Hintergrund
+  tiles_reload_layout(grid_type);
+}
+
+/* === Builder === */
+static bool grid_active(uint8_t idx) {
+  return g_tiles_loaded[idx] || g_tiles_building[idx];
+}
+
+static void finish_build(uint8_t idx) {
+  GridType grid_type = static_cast<GridType>(idx);
+  g_tiles_building[idx] = false;
+  g_tiles_loaded[idx] = true;
+  apply_cached_states(grid_type, getGridConfig(grid_type));
+  Serial.printf("[%s] Layout aufgebaut in %lu ms (%u Ticks, max %lu us/Tick)\n",
+                getGridName(grid_type),
+                (unsigned long)(millis() - g_tiles_build_start_ms[idx]),
+                (unsigned)g_tiles_build_ticks[idx],
+                (unsigned long)g_tiles_build_max_tick_us[idx]);
+  tile_card_cache_log_stats();
+  tile_thumb_log_stats();
+}
+
+static int8_t pick_build_grid() {
+  if (g_tiles_visible < 3 && g_tiles_building[g_tiles_visible]) {
+    return static_cast<int8_t>(g_tiles_visible);
+  }
+  for (uint8_t i = 0; i < 3; ++i) {
+    if (g_tiles_building[i]) return static_cast<int8_t>(i);
+  }
+  return -1;
+}
+
+static void tiles_build_tick(lv_timer_t* timer) {
+  int8_t pick = pick_build_grid();
+  if (pick < 0) {
+    lv_timer_pause(timer);
+    return;
+  }
+  uint8_t idx = static_cast<uint8_t>(pick);
+  GridType grid_type = static_cast<GridType>(idx);
+  const TileGridConfig& config = getGridConfig(grid_type);
+  uint32_t start_us = micros();
+  g_tiles_build_ticks[idx]++;
+
+  // Mindestens ein Tile pro Tick, danach solange das Zeitbudget reicht
+  do {
+    uint8_t i = g_tiles_build_next[idx];
+    lv_obj_t* placeholder = g_tiles_objs[idx][i];
+    g_tiles_objs[idx][i] = render_tile(g_tiles_grids[idx], i % 3, i / 3, config.tiles[i], i, grid_type, g_tiles_scene_cbs[idx]);
+    if (placeholder) lv_obj_delete(placeholder);
+    g_tiles_build_next[idx] = i + 1;
+    if (g_tiles_build_next[idx] >= TILES_PER_GRID) break;
+  } while ((micros() - start_us) < kBuildBudgetUs);
+
+  uint32_t tick_us = micros() - start_us;
+  if (tick_us > g_tiles_build_max_tick_us[idx]) g_tiles_build_max_tick_us[idx] = tick_us;
+  if (g_tiles_build_next[idx] >= TILES_PER_GRID) {
+    finish_build(idx);
   }
 }
 
 /* === Reload layout (unified) === */
+// Startet den Aufbau: Platzhalter sofort, echte Tiles verteilt auf die naechsten Ticks
 void tiles_reload_layout(GridType grid_type) {
   uint8_t idx = (uint8_t)grid_type;
   if (!g_tiles_grids[idx]) return;
 
-  displayManager.debugFlushNext(40);
-
-  lv_display_t* disp = lv_obj_get_display(g_tiles_grids[idx]);
-  if (disp) {
-    lv_display_enable_invalidation(disp, false);
-  }
-
   reset_sensor_widgets(grid_type);
   reset_switch_widgets(grid_type);
-  for (size_t i = 0; i < TILES_PER_GRID; ++i) {
-    g_tiles_objs[idx][i] = nullptr;
-  }
   lv_obj_clean(g_tiles_grids[idx]);
-
-  // Render tile grid using unified system
-  const TileGridConfig& config = getGridConfig(grid_type);
   for (uint8_t i = 0; i < TILES_PER_GRID; ++i) {
-    int row = i / 3;
-    int col = i % 3;
-    g_tiles_objs[idx][i] = render_tile(g_tiles_grids[idx], col, row, config.tiles[i], i, grid_type, g_tiles_scene_cbs[idx]);
-    if ((i % 3) == 2) {
-      yield();
-      delay(1);
-    }
+    g_tiles_objs[idx][i] = render_placeholder_tile(g_tiles_grids[idx], i % 3, i / 3);
   }
 
-  g_tiles_loaded[idx] = true;
-  apply_cached_states(grid_type, config);
-  if (disp) {
-    lv_display_enable_invalidation(disp, true);
-    lv_obj_invalidate(g_tiles_grids[idx]);
-    lv_refr_now(disp);
+  g_tiles_loaded[idx] = false;
+  g_tiles_building[idx] = true;
+  g_tiles_build_next[idx] = 0;
+  g_tiles_build_start_ms[idx] = millis();
+  g_tiles_build_ticks[idx] = 0;
+  g_tiles_build_max_tick_us[idx] = 0;
+
+  if (!g_tiles_build_timer) {
+    g_tiles_build_timer = lv_timer_create(tiles_build_tick, kBuildTimerPeriodMs, nullptr);
+  } else {
+    lv_timer_resume(g_tiles_build_timer);
   }
-  Serial.printf("[%s] Layout neu geladen\n", getGridName(grid_type));
+  Serial.printf("[%s] Layout-Aufbau gestartet\n", getGridName(grid_type));
+}
+
+void tiles_set_visible_tab(uint8_t tab_index) {
+  g_tiles_visible = (tab_index < 3) ? tab_index : 0xFF;
 }
 
 void tiles_release_layout(GridType grid_type) {
   uint8_t idx = (uint8_t)grid_type;
-  if (!g_tiles_grids[idx] || !g_tiles_loaded[idx]) return;
+  if (!g_tiles_grids[idx] || !grid_active(idx)) return;
+  g_tiles_building[idx] = false;
 
   reset_sensor_widgets(grid_type);
   reset_switch_widgets(grid_type);
@@ -221,7 +234,7 @@ void tiles_release_all() {
 bool tiles_is_loaded(GridType grid_type) {
   uint8_t idx = (uint8_t)grid_type;
   if (idx >= 3) return false;
-  return g_tiles_loaded[idx];
+  return grid_active(idx);
 }
 
 void tiles_request_reload(GridType grid_type) {
@@ -266,7 +279,7 @@ void tiles_process_reload_requests() {
     if (!g_tiles_release_requested[i]) continue;
     g_tiles_release_requested[i] = false;
     GridType grid_type = static_cast<GridType>(i);
-    if (g_tiles_grids[i] && g_tiles_loaded[i]) {
+    if (g_tiles_grids[i] && grid_active(i)) {
       tiles_release_layout(grid_type);
     }
     return;  // nur ein Release pro Loop
@@ -276,7 +289,7 @@ void tiles_process_reload_requests() {
     if (!g_tiles_reload_requested[i]) continue;
     GridType grid_type = static_cast<GridType>(i);
     bool only_if_loaded = g_tiles_reload_only_if_loaded[i];
-    if (only_if_loaded && !g_tiles_loaded[i]) {
+    if (only_if_loaded && !grid_active(i)) {
       g_tiles_reload_requested[i] = false;
       g_tiles_reload_only_if_loaded[i] = true;
       continue;
@@ -294,8 +307,10 @@ void tiles_process_reload_requests() {
 void tiles_update_tile(GridType grid_type, uint8_t index) {
   uint8_t idx = (uint8_t)grid_type;
   if (!g_tiles_grids[idx]) return;
-  if (!g_tiles_loaded[idx]) return;
+  if (!grid_active(idx)) return;
   if (index >= TILES_PER_GRID) return;
+  // Noch nicht gebaut -> Builder rendert spaeter direkt aus der aktuellen Config
+  if (g_tiles_building[idx] && index >= g_tiles_build_next[idx]) return;
 
   const TileGridConfig& config = getGridConfig(grid_type);
   const Tile& tile = config.tiles[index];
@@ -307,13 +322,13 @@ void tiles_update_tile(GridType grid_type, uint8_t index) {
   lv_obj_t* new_tile = render_tile(g_tiles_grids[idx], col, row, tile, index, grid_type, g_tiles_scene_cbs[idx]);
   g_tiles_objs[idx][index] = new_tile;
   if (tile.type == TILE_SENSOR || tile.type == TILE_SWITCH) {
-    String payload;
-    if (get_cached_entity_payload(tile.sensor_entity.c_str(), payload)) {
+    const EntityEntry* entry = entity_state_lookup(tile.sensor_entity.c_str());
+    if (entry) {
       if (tile.type == TILE_SENSOR) {
         const char* unit = tile.sensor_unit.length() > 0 ? tile.sensor_unit.c_str() : nullptr;
-        queue_sensor_tile_update(grid_type, index, payload.c_str(), unit);
-      } else {
-        queue_switch_tile_update(grid_type, index, payload.c_str());
+        queue_sensor_tile_update(grid_type, index, entry->value.c_str(), unit, entry->stale);
+      } else if (entry->has_switch) {
+        queue_switch_tile_state(grid_type, index, entry->sw, entry->stale);
       }
     }
   }
@@ -326,11 +341,13 @@ void tiles_update_tile(GridType grid_type, uint8_t index) {
 void tiles_update_sensor_by_entity(GridType grid_type, const char* entity_id, const char* value) {
   if (!entity_id || !value) return;
 
-  cache_entity_payload(entity_id, value);
+  // Zustand liegt bereits geparst in der Entity-Tabelle (entity_state_update im MQTT-Handler)
   if (!tiles_is_loaded(grid_type)) return;
 
   const TileGridConfig& config = getGridConfig(grid_type);
   bool popup_queued = false;
+  const EntityEntry* entry = nullptr;
+  bool entry_looked_up = false;
 
   // Find tile with matching sensor_entity
   for (uint8_t i = 0; i < TILES_PER_GRID; i++) {
@@ -349,7 +366,12 @@ void tiles_update_sensor_by_entity(GridType grid_type, const char* entity_id, co
       }
     }
     if (tile.type == TILE_SWITCH && tile.sensor_entity.equalsIgnoreCase(entity_id)) {
-      queue_switch_tile_update(grid_type, i, value);
+      if (!entry_looked_up) {
+        entry = entityTable.find(entity_id);
+        entry_looked_up = true;
+      }
+      if (!entry || !entry->has_switch) continue;
+      queue_switch_tile_state(grid_type, i, entry->sw);
       Serial.printf("[%s] Switch %s@%u queued: %s\n", getGridName(grid_type), entity_id, i, value);
     }
   }
@@ -17,6 +17,8 @@ void tiles_request_release(GridType grid_type);
 void tiles_request_release_all();
 void tiles_process_reload_requests();
 void tiles_update_tile(GridType grid_type, uint8_t index);
+// Sichtbarer Tab (0-2) wird vom Builder priorisiert, >2 = kein Tiles-Tab
+void tiles_set_visible_tab(uint8_t tab_index);
 void tiles_update_sensor_by_entity(GridType grid_type, const char* entity_id, const char* value);
 
 #endif // TAB_TILES_UNIFIED_H
@@ -145,9 +145,7 @@ void UIManager::buildUI(scene_publish_cb_t scene_cb, hotspot_start_cb_t hotspot_
   }
   switchToTab(0);
 
-  // Preload hidden tabs and popup so first use is instant.
-  tiles_reload_layout(GridType::TAB1);
-  tiles_reload_layout(GridType::TAB2);
+  // Hidden tabs werden vom Tile-Builder im Hintergrund aufgebaut (nicht blockierend).
   preload_light_popup();
   preload_sensor_popup();
   preload_image_tiles_from_grid(tileConfig.getTab0Grid());
@@ -330,6 +328,8 @@ void UIManager::switchToTab(uint8_t index) {
     // Label bleibt IMMER weiss - nicht aendern!
   }
 
+  tiles_set_visible_tab(index);
+  image_popup_set_visible_tab(index);
   if (index <= 2) {
     GridType grid_type = static_cast<GridType>(index);
     if (!tiles_is_loaded(grid_type)) {
@@ -0,0 +1,41 @@
+#include "src/ui/url_cache_meta.h"
+#include "esp_rom_crc.h"
+
+bool url_cache_meta_parse(const String& text, UrlCacheMeta& meta) {
+  meta = UrlCacheMeta();
+  int pos = 0;
+  const int len = static_cast<int>(text.length());
+  while (pos < len) {
+    int nl = text.indexOf('\n', pos);
+    if (nl < 0) nl = len;
+    String line = text.substring(pos, nl);
+    pos = nl + 1;
+    int eq = line.indexOf('=');
+    if (eq <= 0) continue;
+    String key = line.substring(0, eq);
+    String value = line.substring(eq + 1);
+    value.trim();
+    if (key == "etag") meta.etag = value;
+    else if (key == "lm") meta.last_modified = value;
+    else if (key == "crc") meta.crc = strtoul(value.c_str(), nullptr, 16);
+    else if (key == "size") meta.size = strtoul(value.c_str(), nullptr, 10);
+  }
+  meta.valid = meta.size > 0;
+  return meta.valid;
+}
+
+String url_cache_meta_format(const UrlCacheMeta& meta) {
+  char crc_buf[12];
+  snprintf(crc_buf, sizeof(crc_buf), "%08lX", static_cast<unsigned long>(meta.crc));
+  return "etag=" + meta.etag + "\nlm=" + meta.last_modified + "\ncrc=" + String(crc_buf) +
+         "\nsize=" + String(meta.size) + "\n";
+}
+
+void url_cache_meta_add(UrlCacheMeta& meta, const uint8_t* data, size_t len) {
+  meta.crc = esp_rom_crc32_le(meta.crc, data, len);
+  meta.size += len;
+}
+
+bool url_cache_meta_same_content(const UrlCacheMeta* cached, const UrlCacheMeta& fresh) {
+  return cached && cached->valid && fresh.valid && fresh.size == cached->size && fresh.crc == cached->crc;
+}
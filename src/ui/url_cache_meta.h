@@ -0,0 +1,28 @@
+#ifndef URL_CACHE_META_H
+#define URL_CACHE_META_H
+
+#include <Arduino.h>
+
+// Sidecar pro URL (<base>.meta): Validatoren fuer bedingte Requests + Inhalts-CRC.
+// Textformat, eine Zeile pro Feld: etag=, lm=, crc= (hex), size= (dezimal).
+struct UrlCacheMeta {
+  String etag;
+  String last_modified;
+  uint32_t crc = 0;
+  uint32_t size = 0;
+  bool valid = false;
+};
+
+// Sidecar-Text lesen; unbekannte Zeilen werden ignoriert. valid = size > 0
+bool url_cache_meta_parse(const String& text, UrlCacheMeta& meta);
+
+String url_cache_meta_format(const UrlCacheMeta& meta);
+
+// Empfangene Body-Bytes in CRC und Groesse einrechnen (beliebig gestueckelt)
+void url_cache_meta_add(UrlCacheMeta& meta, const uint8_t* data, size_t len);
+
+// 200 mit identischem Inhalt wie der Cache-Eintrag (Server ohne Validatoren):
+// Konvertierung und Schreiben koennen entfallen
+bool url_cache_meta_same_content(const UrlCacheMeta* cached, const UrlCacheMeta& fresh);
+
+#endif // URL_CACHE_META_H
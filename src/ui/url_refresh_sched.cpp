@@ -0,0 +1,407 @@
+#include "src/ui/url_refresh_sched.h"
+#include <algorithm>
+
+static uint32_t sched_hash(const String& url) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < url.length(); ++i) {
+    h ^= static_cast<uint8_t>(url[i]);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static inline bool due_before(uint32_t a, uint32_t b) {
+  return (int32_t)(a - b) < 0;
+}
+
+UrlRefreshScheduler::UrlRefreshScheduler(uint8_t max_inflight)
+    : max_inflight_(max_inflight ? max_inflight : 1) {
+  rehash(16);
+}
+
+// ========== Hash-Index ==========
+void UrlRefreshScheduler::rehash(size_t capacity) {
+  index_.assign(capacity, kNoSlot);
+  const size_t mask = capacity - 1;
+  for (size_t slot = 0; slot < entries_.size(); ++slot) {
+    if (!entries_[slot].used) continue;
+    size_t i = entries_[slot].hash & mask;
+    while (index_[i] != kNoSlot) i = (i + 1) & mask;
+    index_[i] = static_cast<uint16_t>(slot);
+  }
+}
+
+uint16_t UrlRefreshScheduler::find(const String& url, uint32_t hash) const {
+  const size_t mask = index_.size() - 1;
+  size_t i = hash & mask;
+  while (index_[i] != kNoSlot) {
+    const Entry& e = entries_[index_[i]];
+    if (e.hash == hash && e.url == url) return index_[i];
+    i = (i + 1) & mask;
+  }
+  return kNoSlot;
+}
+
+uint16_t UrlRefreshScheduler::insert(const String& url, uint32_t hash) {
+  if ((live_ + 1) * 2 > index_.size()) rehash(index_.size() * 2);
+  uint16_t slot;
+  if (!free_.empty()) {
+    slot = free_.back();
+    free_.pop_back();
+  } else {
+    slot = static_cast<uint16_t>(entries_.size());
+    entries_.emplace_back();
+  }
+  Entry& e = entries_[slot];
+  reset(e);
+  e.url = url;
+  e.hash = hash;
+  e.used = true;
+  live_++;
+  const size_t mask = index_.size() - 1;
+  size_t i = hash & mask;
+  while (index_[i] != kNoSlot) i = (i + 1) & mask;
+  index_[i] = slot;
+  return slot;
+}
+
+// Slot leeren, seq aber weiterzaehlen: ein alter Heap-Eintrag darf nach
+// Wiederverwendung des Slots nicht zur neuen URL passen
+void UrlRefreshScheduler::reset(Entry& e) {
+  const uint32_t seq = e.seq;
+  e = Entry();
+  e.seq = seq + 1;
+}
+
+void UrlRefreshScheduler::erase(uint16_t slot) {
+  reset(entries_[slot]);  // alte Heap-Eintraege werden ueber used/seq verworfen
+  free_.push_back(slot);
+  live_--;
+  rehash(index_.size());     // selten (Konfig-Aenderung), dafuer ohne Tombstones
+}
+
+// ========== Heaps ==========
+// std::*_heap baut Max-Heaps: "kleiner" = spaeter faellig
+bool UrlRefreshScheduler::heapLater(const HeapItem& a, const HeapItem& b) {
+  return due_before(b.due_ms, a.due_ms);
+}
+
+void UrlRefreshScheduler::arm(uint16_t slot, uint32_t due_ms) {
+  Entry& e = entries_[slot];
+  e.due_ms = due_ms;
+  e.seq++;
+  e.armed = true;
+  std::vector<HeapItem>& heap = e.visible ? visible_heap_ : background_heap_;
+  heap.push_back({due_ms, e.seq, slot});
+  std::push_heap(heap.begin(), heap.end(), heapLater);
+}
+
+bool UrlRefreshScheduler::topValid(std::vector<HeapItem>& heap) {
+  while (!heap.empty()) {
+    const HeapItem& top = heap.front();
+    const Entry& e = entries_[top.slot];
+    if (e.used && e.armed && !e.inflight && e.seq == top.seq) return true;
+    std::pop_heap(heap.begin(), heap.end(), heapLater);
+    heap.pop_back();
+  }
+  return false;
+}
+
+// heap: der Heap, dessen Spitze take() geprueft hat (nicht aus e.visible ableiten)
+uint16_t UrlRefreshScheduler::dispatch(std::vector<HeapItem>& heap, uint32_t now) {
+  const uint16_t slot = heap.front().slot;
+  Entry& e = entries_[slot];
+  std::pop_heap(heap.begin(), heap.end(), heapLater);
+  heap.pop_back();
+
+  const uint32_t lag = due_before(e.due_ms, now) ? now - e.due_ms : 0;
+  stats_.dispatched++;
+  stats_.lag_sum_ms += lag;
+  if (lag > stats_.max_lag_ms) stats_.max_lag_ms = lag;
+  if (e.visible) {
+    stats_.dispatched_visible++;
+    stats_.lag_sum_visible_ms += lag;
+    if (lag > stats_.max_lag_visible_ms) stats_.max_lag_visible_ms = lag;
+    inflight_visible_++;
+  }
+  e.armed = false;
+  e.inflight = true;
+  e.inflight_visible = e.visible;
+  // Naechster Termin ab Start (wie bisher beim Einreihen), aktiv erst nach complete
+  if (e.interval_ms > 0) e.due_ms = now + e.interval_ms;
+  inflight_++;
+  return slot;
+}
+
+// ========== Konfig-Abgleich ==========
+void UrlRefreshScheduler::beginSync() {
+  for (auto& e : entries_) e.seen = false;
+}
+
+void UrlRefreshScheduler::syncEntry(const String& url, uint32_t interval_ms, uint32_t now, uint32_t initial_delay_ms) {
+  const uint32_t hash = sched_hash(url);
+  uint16_t slot = find(url, hash);
+  if (slot == kNoSlot) {
+    slot = insert(url, hash);
+    Entry& e = entries_[slot];
+    e.interval_ms = interval_ms;
+    e.in_config = true;
+    e.seen = true;
+    arm(slot, now + initial_delay_ms);
+    return;
+  }
+  Entry& e = entries_[slot];
+  e.seen = true;
+  e.in_config = true;
+  const uint32_t prev = e.interval_ms;
+  if (interval_ms == prev) return;
+  e.interval_ms = interval_ms;
+  if (e.inflight || interval_ms == 0) return;
+  const uint32_t target = now + interval_ms;
+  if (!e.armed) {
+    arm(slot, target);
+  } else if (prev == 0 || interval_ms > prev) {
+    if (due_before(e.due_ms, target)) arm(slot, target);
+  } else if (due_before(target, e.due_ms)) {
+    arm(slot, target);
+  }
+}
+
+void UrlRefreshScheduler::endSync() {
+  for (size_t slot = 0; slot < entries_.size(); ++slot) {
+    Entry& e = entries_[slot];
+    if (!e.used || e.seen) continue;
+    e.in_config = false;
+    if (e.inflight) continue;                         // complete() raeumt auf
+    if (e.armed && e.interval_ms == 0) continue;      // einmalige Anforderung steht noch aus
+    erase(static_cast<uint16_t>(slot));
+  }
+}
+
+// ========== Anforderungen ==========
+bool UrlRefreshScheduler::requestNow(const String& url, uint32_t now) {
+  const uint32_t hash = sched_hash(url);
+  uint16_t slot = find(url, hash);
+  if (slot == kNoSlot) {
+    slot = insert(url, hash);
+    arm(slot, now);
+    return true;
+  }
+  Entry& e = entries_[slot];
+  if (e.inflight || (e.armed && !due_before(now, e.due_ms))) {
+    stats_.deduped++;
+    return false;
+  }
+  arm(slot, now);
+  return true;
+}
+
+void UrlRefreshScheduler::setVisible(const String& url, bool visible) {
+  const uint16_t slot = find(url, sched_hash(url));
+  if (slot == kNoSlot) return;
+  Entry& e = entries_[slot];
+  if (e.visible == visible) return;
+  e.visible = visible;
+  if (e.armed && !e.inflight) arm(slot, e.due_ms);  // in den anderen Heap umhaengen
+}
+
+void UrlRefreshScheduler::clearVisible() {
+  for (size_t slot = 0; slot < entries_.size(); ++slot) {
+    Entry& e = entries_[slot];
+    if (!e.used || !e.visible) continue;
+    e.visible = false;
+    if (e.armed && !e.inflight) arm(static_cast<uint16_t>(slot), e.due_ms);
+  }
+}
+
+bool UrlRefreshScheduler::take(uint32_t now, String& out_url, uint32_t& wait_ms) {
+  wait_ms = UINT32_MAX;
+  if (inflight_ >= max_inflight_) return false;
+
+  const bool vis = topValid(visible_heap_);
+  if (vis && !due_before(now, visible_heap_.front().due_ms)) {
+    const uint16_t slot = dispatch(visible_heap_, now);
+    out_url = entries_[slot].url;
+    return true;
+  }
+  const bool bg = topValid(background_heap_);
+  if (bg && !due_before(now, background_heap_.front().due_ms)) {
+    if (inflight_visible_ == 0) {
+      const uint16_t slot = dispatch(background_heap_, now);
+      out_url = entries_[slot].url;
+      return true;
+    }
+    // Sichtbares Bild laeuft noch: Hintergrund wartet auf complete()
+    stats_.deferred++;
+  } else if (bg) {
+    wait_ms = background_heap_.front().due_ms - now;
+  }
+  if (vis) {
+    const uint32_t vis_wait = visible_heap_.front().due_ms - now;
+    if (vis_wait < wait_ms) wait_ms = vis_wait;
+  }
+  return false;
+}
+
+void UrlRefreshScheduler::complete(const String& url, uint32_t now) {
+  (void)now;
+  const uint16_t slot = find(url, sched_hash(url));
+  if (slot == kNoSlot) return;
+  Entry& e = entries_[slot];
+  if (!e.inflight) return;
+  e.inflight = false;
+  if (inflight_ > 0) inflight_--;
+  if (e.inflight_visible && inflight_visible_ > 0) inflight_visible_--;
+  e.inflight_visible = false;
+  if (!e.in_config) {
+    erase(slot);
+    return;
+  }
+  if (e.interval_ms > 0) arm(slot, e.due_ms);
+}
+
+bool UrlRefreshScheduler::isPending(const String& url, uint32_t now) const {
+  const uint16_t slot = find(url, sched_hash(url));
+  if (slot == kNoSlot) return false;
+  const Entry& e = entries_[slot];
+  return e.inflight || (e.armed && !due_before(now, e.due_ms));
+}
+
+UrlSchedStats UrlRefreshScheduler::stats() const {
+  UrlSchedStats s = stats_;
+  s.entries = live_;
+  s.inflight = inflight_;
+  s.visible = 0;
+  for (const auto& e : entries_) {
+    if (e.used && e.visible) s.visible++;
+  }
+  return s;
+}
+
+// ========== Simulation ==========
+// Bedienzeit pro URL deterministisch (200..2000 ms), identisch fuer beide Varianten
+static uint32_t sim_service_ms(uint16_t i) {
+  uint32_t x = (static_cast<uint32_t>(i) + 1U) * 2654435761u;
+  return 200U + (x >> 8) % 1800U;
+}
+
+static uint32_t sim_interval_ms(uint16_t i) {
+  static const uint32_t kIntervals[] = {60000U, 120000U, 300000U, 600000U, 1800000U};
+  return kIntervals[i % (sizeof(kIntervals) / sizeof(kIntervals[0]))];
+}
+
+static constexpr uint16_t kSimVisible = 3;
+
+static String sim_lag_json(uint32_t jobs, uint64_t lag_sum, uint32_t lag_max, uint32_t vjobs, uint64_t vlag_sum,
+                           uint32_t vlag_max) {
+  String json = "{\"jobs\":" + String(jobs);
+  json += ",\"avg_lag_ms\":" + String(jobs ? static_cast<uint32_t>(lag_sum / jobs) : 0);
+  json += ",\"max_lag_ms\":" + String(lag_max);
+  json += ",\"visible_jobs\":" + String(vjobs);
+  json += ",\"visible_avg_lag_ms\":" + String(vjobs ? static_cast<uint32_t>(vlag_sum / vjobs) : 0);
+  json += ",\"visible_max_lag_ms\":" + String(vlag_max);
+  return json;
+}
+
+String url_refresh_sched_simulate(uint16_t url_count, uint32_t duration_s) {
+  if (url_count == 0) url_count = 1;
+  const uint32_t end_ms = duration_s * 1000U;
+  const uint32_t start_us = micros();
+
+  // --- Deadline-Scheduler (ein Worker) ---
+  UrlRefreshScheduler sched(1);
+  std::vector<String> urls;
+  urls.reserve(url_count);
+  sched.beginSync();
+  for (uint16_t i = 0; i < url_count; ++i) {
+    urls.push_back("http://sim/" + String(i) + ".jpg");
+    sched.syncEntry(urls[i], sim_interval_ms(i), 0, (sim_service_ms(i) * 7U) % sim_interval_ms(i));
+  }
+  sched.endSync();
+  for (uint16_t i = 0; i < kSimVisible && i < url_count; ++i) sched.setVisible(urls[i], true);
+
+  uint32_t now = 0;
+  String url;
+  while (now < end_ms) {
+    uint32_t wait_ms = 0;
+    if (sched.take(now, url, wait_ms)) {
+      const uint16_t i = static_cast<uint16_t>(url.substring(11).toInt());
+      now += sim_service_ms(i);
+      sched.complete(url, now);
+      continue;
+    }
+    if (wait_ms == UINT32_MAX) break;
+    now += wait_ms;
+  }
+  const UrlSchedStats ds = sched.stats();
+
+  // --- Alte FIFO-Queue: 1 s Polling, Queue-Laenge 32, Duplikate verworfen ---
+  struct FifoUrl {
+    uint32_t due;
+    uint32_t queued_due;
+    bool pending;
+  };
+  std::vector<FifoUrl> fifo_urls(url_count);
+  for (uint16_t i = 0; i < url_count; ++i) {
+    fifo_urls[i].due = (sim_service_ms(i) * 7U) % sim_interval_ms(i);
+    fifo_urls[i].pending = false;
+  }
+  std::vector<uint16_t> fifo;
+  size_t head = 0;
+  uint32_t jobs = 0, lag_max = 0, vjobs = 0, vlag_max = 0, dropped = 0;
+  uint64_t lag_sum = 0, vlag_sum = 0;
+  uint32_t t = 0;
+  uint32_t next_poll = 0;
+  uint32_t worker_free = 0;
+  int32_t running = -1;
+  while (t < end_ms) {
+    if (running >= 0 && !due_before(t, worker_free)) {
+      fifo_urls[running].pending = false;
+      running = -1;
+    }
+    if (!due_before(t, next_poll)) {
+      for (uint16_t i = 0; i < url_count; ++i) {
+        FifoUrl& u = fifo_urls[i];
+        if (due_before(t, u.due)) continue;
+        if (!u.pending) {
+          if (fifo.size() - head >= 32) {
+            dropped++;
+          } else {
+            u.pending = true;
+            u.queued_due = u.due;
+            fifo.push_back(i);
+          }
+        }
+        u.due = t + sim_interval_ms(i);
+      }
+      next_poll += 1000U;
+    }
+    if (running < 0 && head < fifo.size()) {
+      const uint16_t i = fifo[head++];
+      const uint32_t lag = t - fifo_urls[i].queued_due;
+      jobs++;
+      lag_sum += lag;
+      if (lag > lag_max) lag_max = lag;
+      if (i < kSimVisible) {
+        vjobs++;
+        vlag_sum += lag;
+        if (lag > vlag_max) vlag_max = lag;
+      }
+      running = i;
+      worker_free = t + sim_service_ms(i);
+    }
+    t = (running >= 0 && due_before(worker_free, next_poll)) ? worker_free : next_poll;
+  }
+
+  String json = "{\"urls\":" + String(url_count);
+  json += ",\"duration_s\":" + String(duration_s);
+  json += ",\"deadline\":" + sim_lag_json(ds.dispatched, ds.lag_sum_ms, ds.max_lag_ms, ds.dispatched_visible,
+                                          ds.lag_sum_visible_ms, ds.max_lag_visible_ms);
+  json += ",\"deferred\":" + String(ds.deferred) + "}";
+  json += ",\"fifo\":" + sim_lag_json(jobs, lag_sum, lag_max, vjobs, vlag_sum, vlag_max);
+  json += ",\"dropped\":" + String(dropped) + "}";
+  json += ",\"sim_ms\":" + String((micros() - start_us) / 1000U);
+  json += "}";
+  Serial.printf("[UrlSched] Simulation: %s\n", json.c_str());
+  return json;
+}
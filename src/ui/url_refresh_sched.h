@@ -0,0 +1,108 @@
+#ifndef URL_REFRESH_SCHED_H
+#define URL_REFRESH_SCHED_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Termin-Scheduler fuer den URL-Cache: sichtbare Bilder vor allen anderen,
+// innerhalb einer Klasse der frueheste Termin zuerst. Eintraege sind per
+// URL-Hash dedupliziert, gleichzeitig laufende Jobs sind begrenzt.
+// Kennt weder Uhr noch Tasks (Zeit als Parameter, Locking beim Aufrufer),
+// dadurch auch mit simulierter Zeit nutzbar (url_refresh_sched_simulate).
+#ifndef URL_CACHE_MAX_INFLIGHT
+#define URL_CACHE_MAX_INFLIGHT 1
+#endif
+
+struct UrlSchedStats {
+  uint32_t entries;
+  uint32_t visible;
+  uint32_t inflight;
+  uint32_t dispatched;
+  uint32_t deduped;         // requestNow fuer bereits wartende/laufende URL
+  uint32_t deferred;        // Hintergrund-Job wegen sichtbarem Job zurueckgestellt
+  uint32_t max_lag_ms;      // Faelligkeit -> Start
+  uint64_t lag_sum_ms;
+  uint32_t max_lag_visible_ms;
+  uint64_t lag_sum_visible_ms;
+  uint32_t dispatched_visible;
+};
+
+class UrlRefreshScheduler {
+public:
+  explicit UrlRefreshScheduler(uint8_t max_inflight = URL_CACHE_MAX_INFLIGHT);
+
+  // Abgleich mit der Konfiguration: beginSync, syncEntry je URL, endSync.
+  // Neue URLs werden nach initial_delay_ms faellig; kuerzeres Intervall zieht
+  // den Termin vor, laengeres schiebt ihn nach hinten.
+  void beginSync();
+  void syncEntry(const String& url, uint32_t interval_ms, uint32_t now, uint32_t initial_delay_ms);
+  void endSync();
+
+  // Sofort faellig (z.B. Cache fehlt). false: wartet bereits oder laeuft.
+  bool requestNow(const String& url, uint32_t now);
+  void setVisible(const String& url, bool visible);
+  void clearVisible();
+
+  // Naechsten Job holen. false: nichts faellig, wait_ms bis zum naechsten
+  // Termin (UINT32_MAX = erst nach Aenderung/complete wieder fragen).
+  bool take(uint32_t now, String& out_url, uint32_t& wait_ms);
+  void complete(const String& url, uint32_t now);
+
+  // Faellig oder in Arbeit (fuer Abbruch-Anforderungen)
+  bool isPending(const String& url, uint32_t now) const;
+
+  UrlSchedStats stats() const;
+
+private:
+  enum : uint16_t { kNoSlot = 0xFFFF };
+
+  struct Entry {
+    String url;
+    uint32_t hash = 0;
+    uint32_t interval_ms = 0;  // 0 = nur auf Anforderung
+    uint32_t due_ms = 0;
+    uint32_t seq = 0;          // ungueltig machen alter Heap-Eintraege
+    bool used = false;
+    bool armed = false;        // hat gueltigen Heap-Eintrag
+    bool inflight = false;
+    bool inflight_visible = false;  // Sichtbarkeit beim Start (fuer Zaehler)
+    bool visible = false;
+    bool in_config = false;
+    bool seen = false;         // Markierung waehrend Sync
+  };
+
+  struct HeapItem {
+    uint32_t due_ms;
+    uint32_t seq;
+    uint16_t slot;
+  };
+
+  static bool heapLater(const HeapItem& a, const HeapItem& b);
+  uint16_t find(const String& url, uint32_t hash) const;
+  uint16_t insert(const String& url, uint32_t hash);
+  static void reset(Entry& e);
+  void erase(uint16_t slot);
+  void arm(uint16_t slot, uint32_t due_ms);
+  bool topValid(std::vector<HeapItem>& heap);
+  uint16_t dispatch(std::vector<HeapItem>& heap, uint32_t now);
+
+  std::vector<Entry> entries_;
+  std::vector<uint16_t> free_;
+  std::vector<uint16_t> index_;  // offene Adressierung: Hash -> Slot
+  std::vector<HeapItem> visible_heap_;
+  std::vector<HeapItem> background_heap_;
+  uint8_t max_inflight_;
+  uint8_t inflight_ = 0;
+  uint8_t inflight_visible_ = 0;
+  uint32_t live_ = 0;
+  UrlSchedStats stats_{};
+
+  void rehash(size_t capacity);
+};
+
+// Simulation mit virtueller Uhr: url_count URLs mit gemischten Intervallen,
+// Vergleich Deadline-Scheduler gegen die alte FIFO-Queue mit 1 s Polling.
+// Liefert JSON (Lag in ms, getrennt nach sichtbar/Hintergrund).
+String url_refresh_sched_simulate(uint16_t url_count, uint32_t duration_s);
+
+#endif // URL_REFRESH_SCHED_H
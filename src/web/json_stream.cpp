@@ -0,0 +1,193 @@
+#include "src/web/json_stream.h"
+#include "esp_rom_crc.h"
+#include <math.h>
+
+static JsonStreamStats g_stats = {};
+
+const JsonStreamStats& json_stream_stats() {
+  return g_stats;
+}
+
+JsonStreamWriter::JsonStreamWriter(WebServer& server, int code)
+    : server(&server), heap_base(ESP.getFreeHeap()), start_us(micros()) {
+  buf.reserve(kChunkSize + 64);
+  server.sendHeader("Cache-Control", "no-cache");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(code, "application/json", "");
+}
+
+JsonStreamWriter::JsonStreamWriter(String* capture)
+    : capture(capture), heap_base(ESP.getFreeHeap()), start_us(micros()) {
+  buf.reserve(kChunkSize + 64);
+}
+
+JsonStreamWriter::~JsonStreamWriter() {
+  finish();
+}
+
+void JsonStreamWriter::separator() {
+  if (after_key) {
+    after_key = false;
+    return;
+  }
+  // Jenseits von JSON_STREAM_MAX_DEPTH keine Kommas (first[] gehoert der Elternebene)
+  if (depth == 0 || overflow > 0) return;
+  bool& is_first = first[depth - 1];
+  if (!is_first) append(',');
+  is_first = false;
+}
+
+void JsonStreamWriter::push(bool object) {
+  append(object ? '{' : '[');
+  if (depth >= JSON_STREAM_MAX_DEPTH) {
+    // Kommas sind ab hier nicht mehr korrekt; nur Klammern zaehlen
+    if (overflow++ == 0) Serial.println("[JsonStream] Verschachtelung zu tief");
+    return;
+  }
+  first[depth++] = true;
+}
+
+void JsonStreamWriter::pop() {
+  if (overflow > 0) overflow--;
+  else if (depth > 0) depth--;
+}
+
+JsonStreamWriter& JsonStreamWriter::beginObject() {
+  separator();
+  push(true);
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::endObject() {
+  pop();
+  append('}');
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::beginArray() {
+  separator();
+  push(false);
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::endArray() {
+  pop();
+  append(']');
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::key(const char* name) {
+  separator();
+  append('"');
+  writeEscaped(name);
+  append("\":");
+  after_key = true;
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::value(const char* s) {
+  separator();
+  append('"');
+  writeEscaped(s ? s : "");
+  append('"');
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::value(bool b) {
+  separator();
+  append(b ? "true" : "false");
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::value(long v) {
+  separator();
+  char tmp[12];
+  snprintf(tmp, sizeof(tmp), "%ld", v);
+  append(tmp);
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::value(unsigned long v) {
+  separator();
+  char tmp[12];
+  snprintf(tmp, sizeof(tmp), "%lu", v);
+  append(tmp);
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::value(float v, uint8_t decimals) {
+  if (isnan(v) || isinf(v)) return null();  // JSON kennt weder NaN noch Inf
+  separator();
+  append(String(v, static_cast<unsigned int>(decimals)).c_str());
+  return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::null() {
+  separator();
+  append("null");
+  return *this;
+}
+
+void JsonStreamWriter::writeEscaped(const char* s) {
+  for (; *s; ++s) {
+    const char c = *s;
+    switch (c) {
+      case '"':  append("\\\""); break;
+      case '\\': append("\\\\"); break;
+      case '\n': append("\\n"); break;
+      case '\r': append("\\r"); break;
+      case '\t': append("\\t"); break;
+      case '\b': append("\\b"); break;
+      case '\f': append("\\f"); break;
+      default:
+        if (static_cast<uint8_t>(c) < 0x20) {
+          char tmp[7];
+          snprintf(tmp, sizeof(tmp), "\\u%04x", static_cast<unsigned>(static_cast<uint8_t>(c)));
+          append(tmp);
+        } else {
+          append(c);  // UTF-8 unveraendert durchreichen
+        }
+        break;
+    }
+  }
+}
+
+void JsonStreamWriter::sampleHeap() {
+  const uint32_t free_now = ESP.getFreeHeap();
+  if (heap_base > free_now && heap_base - free_now > peak_heap) {
+    peak_heap = heap_base - free_now;
+  }
+}
+
+void JsonStreamWriter::flush() {
+  if (!buf.length()) return;
+  sampleHeap();
+  if (server) {
+    server->sendContent(buf);
+  } else if (capture) {
+    *capture += buf;
+  } else {
+    crc_acc = esp_rom_crc32_le(crc_acc, reinterpret_cast<const uint8_t*>(buf.c_str()), buf.length());
+  }
+  total_bytes += buf.length();
+  chunk_count++;
+  buf = "";
+}
+
+void JsonStreamWriter::finish() {
+  if (finished) return;
+  finished = true;
+  if (depth != 0 || overflow != 0) Serial.printf("[JsonStream] %u offene Klammern bei finish()\n", static_cast<unsigned>(depth + overflow));
+  flush();
+  if (!server) return;
+  server->sendContent("");  // Ende der chunked-Uebertragung
+
+  const uint32_t elapsed = micros() - start_us;
+  g_stats.responses++;
+  g_stats.bytes += total_bytes;
+  g_stats.chunks += chunk_count;
+  g_stats.last_bytes = total_bytes;
+  g_stats.last_us = elapsed;
+  if (elapsed > g_stats.max_us) g_stats.max_us = elapsed;
+  if (peak_heap > g_stats.peak_heap_bytes) g_stats.peak_heap_bytes = peak_heap;
+}
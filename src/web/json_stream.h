@@ -0,0 +1,103 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// Streamender JSON-Writer fuer die Web-API: schreibt in ~1460-Byte-Chunks direkt
+// an den Client (Transfer-Encoding: chunked), Kommas und Escaping erledigt der
+// Writer. Eine Antwort braucht damit nie einen Puffer in Groesse des Dokuments.
+//
+//   JsonStreamWriter json(server);
+//   json.beginObject();
+//   json.field("title", tile.title).field("type", (int)tile.type);
+//   json.endObject();
+//   json.finish();
+
+#ifndef JSON_STREAM_MAX_DEPTH
+#define JSON_STREAM_MAX_DEPTH 8
+#endif
+
+struct JsonStreamStats {
+  uint32_t responses;
+  uint32_t bytes;
+  uint32_t chunks;
+  uint32_t last_bytes;
+  uint32_t last_us;
+  uint32_t max_us;
+  uint32_t peak_heap_bytes;  // hoechster Heap-Verbrauch waehrend einer Antwort
+};
+
+class JsonStreamWriter {
+public:
+  static constexpr size_t kChunkSize = 1460;
+
+  // Sendet sofort den Header (chunked); Body folgt mit jedem vollen Chunk
+  explicit JsonStreamWriter(WebServer& server, int code = 200);
+  // Ohne Client: capture != nullptr sammelt die Ausgabe, sonst wird nur gezaehlt
+  // (CRC ueber alle Bytes) - fuer den Vergleich in /api/perf/json_bench
+  explicit JsonStreamWriter(String* capture);
+  // Schliesst eine nicht per finish() beendete Antwort ab (z.B. fruehes return)
+  ~JsonStreamWriter();
+
+  JsonStreamWriter(const JsonStreamWriter&) = delete;
+  JsonStreamWriter& operator=(const JsonStreamWriter&) = delete;
+
+  JsonStreamWriter& beginObject();
+  JsonStreamWriter& endObject();
+  JsonStreamWriter& beginArray();
+  JsonStreamWriter& endArray();
+  JsonStreamWriter& key(const char* name);
+
+  JsonStreamWriter& value(const char* s);
+  JsonStreamWriter& value(const String& s) { return value(s.c_str()); }
+  JsonStreamWriter& value(bool b);
+  JsonStreamWriter& value(int v) { return value(static_cast<long>(v)); }
+  JsonStreamWriter& value(unsigned v) { return value(static_cast<unsigned long>(v)); }
+  JsonStreamWriter& value(long v);
+  JsonStreamWriter& value(unsigned long v);
+  JsonStreamWriter& value(float v, uint8_t decimals = 2);
+  JsonStreamWriter& null();
+
+  template <typename T>
+  JsonStreamWriter& field(const char* name, const T& v) { return key(name).value(v); }
+
+  // Letzten Chunk senden und die chunked-Uebertragung abschliessen
+  void finish();
+
+  uint32_t bytes() const { return total_bytes + buf.length(); }
+  uint16_t chunks() const { return chunk_count; }
+  uint32_t crc() const { return crc_acc; }
+  uint32_t peakHeapBytes() const { return peak_heap; }
+
+private:
+  void separator();
+  void push(bool object);
+  void pop();
+  void writeEscaped(const char* s);
+  void append(char c) { buf += c; if (buf.length() >= kChunkSize) flush(); }
+  void append(const char* s) { buf += s; if (buf.length() >= kChunkSize) flush(); }
+  void flush();
+  void sampleHeap();
+
+  WebServer* server = nullptr;
+  String* capture = nullptr;
+  String buf;
+  uint32_t total_bytes = 0;
+  uint16_t chunk_count = 0;
+  uint32_t crc_acc = 0;
+  uint32_t heap_base = 0;
+  uint32_t peak_heap = 0;
+  uint32_t start_us = 0;
+  bool finished = false;
+
+  uint8_t depth = 0;
+  uint8_t overflow = 0;      // Ebenen jenseits von JSON_STREAM_MAX_DEPTH
+  bool first[JSON_STREAM_MAX_DEPTH] = {};
+  bool after_key = false;
+};
+
+// Summen ueber alle gestreamten Antworten (GET /api/perf "json_stream")
+const JsonStreamStats& json_stream_stats();
+
+#endif // JSON_STREAM_H
@@ -1,4 +1,6 @@
 #include "src/web/web_admin.h"
+#include "src/web/web_live.h"
+#include "src/core/ui_loop.h"
 #include <WiFi.h>
 
 WebAdminServer webAdminServer;
@@ -15,41 +17,173 @@ bool WebAdminServer::start() {
     return false;
   }
 
+  // Im Web-Task: statische Dateien, Seite und Lese-APIs auf Web-eigenen Daten
+  // (Tiles/Tabs werden nur von Loop-Handlern geschrieben, auf die dieser Task wartet)
   server.on("/", [this]() { this->handleRoot(); });
-  server.on("/mqtt", HTTP_POST, [this]() { this->handleSaveMQTT(); });
-  server.on("/status", [this]() { this->handleStatus(); });
-  server.on("/bridge_refresh", HTTP_POST, [this]() { this->handleBridgeRefresh(); });
-  server.on("/bridge", HTTP_POST, [this]() { this->handleSaveBridge(); });
-  server.on("/game_controls", HTTP_POST, [this]() { this->handleSaveGameControls(); });
-  server.on("/restart", HTTP_POST, [this]() { this->handleRestart(); });
-  server.on("/api/status", [this]() { this->handleStatus(); });
+  server.on(WEB_ASSET_ADMIN_CSS.path, HTTP_GET, [this]() { this->handleAsset(WEB_ASSET_ADMIN_CSS); });
+  server.on(WEB_ASSET_ADMIN_JS.path, HTTP_GET, [this]() { this->handleAsset(WEB_ASSET_ADMIN_JS); });
   server.on("/api/tiles", HTTP_GET, [this]() { this->handleGetTiles(); });
-  server.on("/api/tiles", HTTP_POST, [this]() { this->handleSaveTiles(); });
-  server.on("/api/tiles/reorder", HTTP_POST, [this]() { this->handleReorderTiles(); });
+  server.on("/api/layout", HTTP_GET, [this]() { this->handleGetLayout(); });
   server.on("/api/tabs", HTTP_GET, [this]() { this->handleGetTabs(); });
-  server.on("/api/tabs/rename", HTTP_POST, [this]() { this->handleRenameTab(); });
   server.on("/api/sensor_values", HTTP_GET, [this]() { this->handleGetSensorValues(); });
   server.on("/api/sd_images", HTTP_GET, [this]() { this->handleGetSdImages(); });
+  server.on("/api/perf/url_sched_sim", HTTP_GET, [this]() { this->handleUrlSchedSim(); });
+  server.on("/api/perf/entity_bench", HTTP_GET, [this]() { this->handleEntityBench(); });
+  server.on("/api/perf/page_load", HTTP_POST, [this]() { this->handlePageLoadReport(); });
+  server.on("/api/metrics", HTTP_GET, [this]() { this->handleMetrics(); });
 
+  // Im UI-Loop: alles, was Zustand aendert oder LVGL/MQTT/Entity-Tabelle anfasst.
+  // Gesendet wird danach im Web-Task (reply/replyRedirect).
+  onLoop("/mqtt", HTTP_POST, &WebAdminServer::handleSaveMQTT);
+  onLoop("/status", HTTP_ANY, &WebAdminServer::handleStatus);
+  onLoop("/bridge_refresh", HTTP_POST, &WebAdminServer::handleBridgeRefresh);
+  onLoop("/bridge", HTTP_POST, &WebAdminServer::handleSaveBridge);
+  onLoop("/game_controls", HTTP_POST, &WebAdminServer::handleSaveGameControls);
+  onLoop("/restart", HTTP_POST, &WebAdminServer::handleRestart);
+  onLoop("/api/status", HTTP_ANY, &WebAdminServer::handleStatus);
+  onLoop("/api/tiles", HTTP_POST, &WebAdminServer::handleSaveTiles);
+  onLoop("/api/tiles/reorder", HTTP_POST, &WebAdminServer::handleReorderTiles);
+  onLoop("/api/layout", HTTP_POST, &WebAdminServer::handlePutLayout);
+  onLoop("/api/tabs/rename", HTTP_POST, &WebAdminServer::handleRenameTab);
+  onLoop("/api/render_bench", HTTP_GET, &WebAdminServer::handleGetRenderBench);
+  onLoop("/api/render_bench", HTTP_POST, &WebAdminServer::handleRunRenderBench);
+  onLoop("/api/perf", HTTP_GET, &WebAdminServer::handleGetPerf);
+  onLoop("/api/config/commit", HTTP_POST, &WebAdminServer::handleConfigCommit);
+  onLoop("/api/perf/json_bench", HTTP_GET, &WebAdminServer::handleJsonBench);
+
+  static const char* kHeaderKeys[] = {"If-None-Match"};
+  server.collectHeaders(kHeaderKeys, 1);
   server.begin();
+  adminLiveServer.start();
   running = true;
+#if WEB_ADMIN_TASK
+  if (!startTask()) Serial.println("[WebAdmin] Kein eigener Task - Requests laufen im Loop");
+#endif
   IPAddress ip = WiFi.localIP();
   Serial.printf("[WebAdmin] erreichbar unter http://%s\n", ip.toString().c_str());
   return true;
 }
 
+bool WebAdminServer::startTask() {
+  int core = 0;
+#ifdef ARDUINO_RUNNING_CORE
+  core = (ARDUINO_RUNNING_CORE == 0) ? 1 : 0;
+#endif
+  stop_requested = false;
+  stop_waiter = nullptr;
+  if (xTaskCreatePinnedToCore(taskMain, "webAdmin", WEB_ADMIN_TASK_STACK, this, WEB_ADMIN_TASK_PRIO,
+                              &task, core) != pdPASS) {
+    task = nullptr;
+    return false;
+  }
+  Serial.printf("[WebAdmin] Requests im eigenen Task (Core %d)\n", core);
+  return true;
+}
+
+void WebAdminServer::taskMain(void* arg) {
+  WebAdminServer* self = static_cast<WebAdminServer*>(arg);
+  while (!self->stop_requested) {
+    self->server.handleClient();
+    vTaskDelay(pdMS_TO_TICKS(2));  // ohne Client kehrt handleClient sofort zurueck
+  }
+  TaskHandle_t waiter = self->stop_waiter;
+  self->task = nullptr;
+  if (waiter) xTaskNotifyGive(waiter);
+  vTaskDelete(nullptr);
+}
+
 void WebAdminServer::stop() {
   if (!running) return;
+  if (task) {
+    // Laufenden Request zu Ende bringen lassen; wartet er auf den Loop (der gerade
+    // hier steht), zieht ui_loop_call den Auftrag nach UI_LOOP_CALL_TIMEOUT_MS zurueck
+    stop_waiter = xTaskGetCurrentTaskHandle();
+    stop_requested = true;
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WEB_ADMIN_STOP_TIMEOUT_MS)) == 0 && task) {
+      Serial.println("[WebAdmin] WARNUNG: Task beendet sich nicht - wird geloescht");
+      vTaskDelete(task);
+      task = nullptr;
+    }
+  }
   server.stop();
+  adminLiveServer.stop();
   running = false;
   Serial.println("[WebAdmin] Server gestoppt");
 }
 
 void WebAdminServer::handle() {
   if (!running) return;
-  server.handleClient();
+  if (!task) server.handleClient();
+  adminLiveServer.handle();
+}
+
+uint32_t WebAdminServer::taskStackFree() const {
+  return task ? uxTaskGetStackHighWaterMark(task) : 0;
+}
+
+void WebAdminServer::onLoop(const char* uri, HTTPMethod method, Handler handler) {
+  server.on(uri, method, [this, handler]() { this->runInLoop(handler); });
+}
+
+void WebAdminServer::runInLoop(Handler handler) {
+  // Handler laeuft im Loop und legt seine Antwort nur ab; Senden hier im Web-Task.
+  // Dieser Task bearbeitet eine Anfrage nach der anderen - ein Puffer genuegt.
+  LoopReply r;
+  const bool ran = ui_loop_call([this, handler, &r]() {
+    loop_reply = &r;
+    (this->*handler)();
+    loop_reply = nullptr;
+  });
+  if (!ran) {
+    server.send(503, "application/json", "{\"success\":false,\"error\":\"UI beschaeftigt\"}");
+    return;
+  }
+  sendReply(r);
+}
+
+void WebAdminServer::reply(int code, const char* content_type, const String& body) {
+  if (!loop_reply) {
+    server.send(code, content_type, body);  // nicht ueber onLoop aufgerufen
+    return;
+  }
+  loop_reply->code = code;
+  loop_reply->content_type = content_type;
+  loop_reply->body = body;
+}
+
+void WebAdminServer::replyRedirect(const char* location) {
+  if (!loop_reply) {
+    server.sendHeader("Location", location);
+    server.send(303, "text/plain", "");
+    return;
+  }
+  loop_reply->code = 303;
+  loop_reply->location = location;
+  loop_reply->body = "";
+}
+
+void WebAdminServer::restartAfterReply() {
+  if (loop_reply) {
+    loop_reply->restart = true;
+    return;
+  }
+  delay(200);  // Antwort noch rausschicken
+  ESP.restart();
+}
+
+void WebAdminServer::sendReply(const LoopReply& r) {
+  if (r.code == 0) {
+    server.send(500, "application/json", "{\"success\":false,\"error\":\"Keine Antwort\"}");
+    return;
+  }
+  if (r.location.length()) server.sendHeader("Location", r.location);
+  server.send(r.code, r.content_type, r.body);
+  if (r.restart) {
+    delay(200);  // Antwort noch rausschicken
+    ESP.restart();
+  }
 }
 
 void WebAdminServer::handleRoot() {
-  server.send(200, "text/html", getAdminPage());
+  sendAdminPage();
 }
@@ -3,8 +3,31 @@
 
 #include <Arduino.h>
 #include <WebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include "src/core/config_manager.h"
 #include "src/network/ha_bridge_config.h"
+#include "src/web/web_admin_assets.h"
+
+class JsonStreamWriter;
+
+// Web-Admin in eigenem Task (anderer Core als der UI-Loop): langsame Clients und
+// grosse Antworten blockieren weder Touch noch Rendering. Handler, die LVGL,
+// MQTT oder die Entity-Tabelle anfassen, laufen per ui_loop_call im UI-Loop.
+// 0 = wie bisher handleClient() im Loop.
+#ifndef WEB_ADMIN_TASK
+#define WEB_ADMIN_TASK 1
+#endif
+#ifndef WEB_ADMIN_TASK_STACK
+#define WEB_ADMIN_TASK_STACK (16 * 1024)
+#endif
+#ifndef WEB_ADMIN_TASK_PRIO
+#define WEB_ADMIN_TASK_PRIO 1
+#endif
+// stop() wartet so lange auf das Ende des laufenden Requests
+#ifndef WEB_ADMIN_STOP_TIMEOUT_MS
+#define WEB_ADMIN_STOP_TIMEOUT_MS 5000
+#endif
 
 // Webinterface für MQTT-Konfiguration im normalen Netzwerk
 // Läuft wenn das Gerät bereits mit WiFi verbunden ist
@@ -13,7 +36,23 @@
 // - web_admin.cpp/h: Core server class (start/stop/handle)
 // - web_admin_utils.cpp/h: Utility functions (parsing, escaping, etc.)
 // - web_admin_handlers.cpp/h: HTTP request handlers
-// - web_admin_html.cpp/h: HTML page generation with tab navigation
+// - web_admin_html.cpp/h: HTML page generation with tab navigation (chunked)
+// - web_admin_assets.cpp/h: CSS/JS als gzip-PROGMEM (generiert aus web-assets/)
+// - json_stream.cpp/h: streamender JSON-Writer fuer die API-Antworten
+
+// Messwerte der Admin-Seite (GET /api/perf -> admin_page)
+struct AdminPagePerf {
+  uint32_t requests;
+  uint32_t last_us;         // Aufbau + Senden der HTML-Seite (ohne Web-Task = Loop-Blockade)
+  uint32_t max_us;
+  uint32_t last_bytes;
+  uint16_t last_chunks;
+  uint32_t peak_heap_bytes; // max. zusaetzlich belegter Heap waehrend des Sendens
+  uint32_t asset_sent;      // Assets mit 200 ausgeliefert
+  uint32_t asset_not_modified;  // 304 (ETag passt)
+  uint32_t client_load_ms;  // vom Browser gemeldet (navigation timing)
+  uint32_t client_html_ms;
+};
 
 class WebAdminServer {
 public:
@@ -25,7 +64,7 @@ public:
   // Stoppt Webserver
   void stop();
 
-  // Muss regelmäßig in loop() aufgerufen werden
+  // Muss regelmäßig in loop() aufgerufen werden (Live-WebSocket; HTTP nur ohne Task)
   void handle();
 
   // Prüft ob Server läuft
@@ -42,22 +81,62 @@ public:
   void handleGetTiles();
   void handleSaveTiles();
   void handleReorderTiles();
+  void handleGetLayout();
+  void handlePutLayout();
   void handleGetTabs();
   void handleRenameTab();
   void handleGetSensorValues();
   void handleGetSdImages();
+  void handleGetRenderBench();
+  void handleRunRenderBench();
+  void handleGetPerf();
+  void handleUrlSchedSim();
+  void handleConfigCommit();
+  void handleEntityBench();
+  void handleJsonBench();
+  void handleMetrics();
+  void handleAsset(const WebAsset& asset);
+  void handlePageLoadReport();
 
   // HTML-Seiten (implemented in web_admin_html.cpp)
-  String getAdminPage();
+  void sendAdminPage();  // streamt die Seite chunked (sendContent)
   String getSuccessPage();
   String getBridgeSuccessPage();
-  String getStatusJSON();
+  void writeStatusJSON(JsonStreamWriter& json);
 
   // Public access to server for handler methods
   WebServer server;
+  AdminPagePerf page_perf = {};
+
+  bool hasTask() const { return task != nullptr; }
+  uint32_t taskStackFree() const;
 
 private:
+  typedef void (WebAdminServer::*Handler)();
+  // Antwort eines Loop-Handlers: im Loop gebaut, danach vom Web-Task gesendet,
+  // damit ein langsamer Client nie den UI-Loop am Socket festhaelt
+  struct LoopReply {
+    int code = 0;  // 0 = Handler hat keine Antwort gesetzt
+    const char* content_type = "text/plain";
+    String body;
+    String location;  // bei 303
+    bool restart = false;  // nach dem Senden neu starten
+  };
+  // Route, deren Handler im UI-Loop laeuft; Antwort ueber reply()/replyRedirect()
+  void onLoop(const char* uri, HTTPMethod method, Handler handler);
+  void runInLoop(Handler handler);
+  void reply(int code, const char* content_type, const String& body);
+  void replyRedirect(const char* location);
+  void restartAfterReply();
+  void sendReply(const LoopReply& r);
+  bool startTask();
+  static void taskMain(void* arg);
+
   bool running;
+  TaskHandle_t task = nullptr;
+  LoopReply* loop_reply = nullptr;  // gesetzt, solange ein Loop-Handler laeuft
+  volatile bool stop_requested = false;
+  volatile TaskHandle_t stop_waiter = nullptr;
 };
 
 // Globale Instanz
@@ -0,0 +1,958 @@
+// AUTOMATISCH ERZEUGT von web-assets/build.js - nicht von Hand bearbeiten.
+// Quellen: web-assets/*.css, web-assets/*.js (cd web-assets && npm run build)
+#include "src/web/web_admin_assets.h"
+
+// admin.css: 8766 Bytes -> 2492 Bytes gzip
+static const uint8_t ADMIN_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x59, 0x5b, 0x8f, 0xdb, 0x36,
+  0x16, 0x7e, 0xf7, 0xaf, 0xe0, 0x22, 0x28, 0x6a, 0x07, 0x96, 0x47, 0x92, 0x2d, 0x8f, 0x2d, 0xa3,
+  0x0f, 0x41, 0x93, 0xc9, 0x0e, 0xba, 0x49, 0x8b, 0x26, 0xdd, 0xcb, 0x53, 0x41, 0x49, 0x94, 0xcc,
+  0x1d, 0x9a, 0x14, 0x44, 0x7a, 0xc6, 0xce, 0x20, 0xff, 0x6c, 0xdf, 0xf6, 0x8f, 0x2d, 0x78, 0x93,
+  0x48, 0x49, 0x9e, 0x4c, 0x83, 0x14, 0x0b, 0xa3, 0xcd, 0x48, 0x24, 0xcf, 0xfd, 0x1c, 0x7e, 0xe7,
+  0x28, 0x63, 0xc5, 0x19, 0x3c, 0x82, 0x92, 0x51, 0x11, 0x94, 0xf0, 0x80, 0xc9, 0x39, 0x05, 0xdf,
+  0x7f, 0x40, 0x15, 0x43, 0xe0, 0xb7, 0xdb, 0xef, 0xe7, 0xe0, 0x55, 0x83, 0x21, 0x99, 0x03, 0x0e,
+  0x29, 0x0f, 0x38, 0x6a, 0x70, 0xb9, 0x03, 0x19, 0xcc, 0xef, 0xaa, 0x86, 0x1d, 0x69, 0x91, 0xbe,
+  0x40, 0xa8, 0x8c, 0xcb, 0x72, 0x07, 0x0e, 0xb0, 0xa9, 0x30, 0x4d, 0xc3, 0x1d, 0xa8, 0x61, 0x51,
+  0x60, 0x5a, 0xc9, 0x3f, 0x3f, 0x4f, 0x16, 0x0f, 0x0d, 0xac, 0x6b, 0xd4, 0x80, 0x47, 0x70, 0x80,
+  0xa7, 0xe0, 0x01, 0x17, 0x62, 0x9f, 0x46, 0x71, 0x18, 0xd6, 0xa7, 0xf6, 0x4c, 0x1c, 0xd6, 0x27,
+  0x00, 0x8f, 0x82, 0x75, 0x67, 0x63, 0xb5, 0xfe, 0x79, 0xb2, 0xc8, 0x61, 0x53, 0x80, 0x47, 0x8f,
+  0x63, 0x29, 0xd9, 0x65, 0xac, 0x29, 0x50, 0x13, 0x34, 0xb0, 0xc0, 0x47, 0x9e, 0x46, 0x6b, 0xb9,
+  0x3d, 0x63, 0xa7, 0x80, 0xef, 0x61, 0xc1, 0x1e, 0xd2, 0x10, 0x28, 0xa2, 0xab, 0xa4, 0x3e, 0x81,
+  0xa6, 0xca, 0xe0, 0x34, 0x4a, 0xe6, 0xf1, 0x72, 0xbe, 0x8a, 0xe7, 0xe1, 0x22, 0x4a, 0x66, 0x1d,
+  0xa3, 0x65, 0xac, 0x19, 0xed, 0x23, 0x25, 0xa1, 0xd6, 0x01, 0x84, 0x60, 0x23, 0x5f, 0x2b, 0x9b,
+  0x70, 0xfc, 0x09, 0xa5, 0xb1, 0x7a, 0xce, 0x19, 0x61, 0x4d, 0xfa, 0x22, 0x42, 0xf1, 0x76, 0x99,
+  0x29, 0xf1, 0xf8, 0x31, 0x13, 0x58, 0x10, 0x04, 0x1e, 0xed, 0xe2, 0xea, 0x3a, 0x49, 0xd6, 0x5b,
+  0xab, 0x5b, 0x90, 0x31, 0x21, 0xd8, 0x21, 0x8d, 0x57, 0x46, 0x1f, 0x2e, 0xa0, 0x38, 0x72, 0xf0,
+  0x08, 0x0a, 0xcc, 0x6b, 0x02, 0xcf, 0x69, 0xd5, 0xe0, 0x62, 0x07, 0xe4, 0xff, 0x03, 0x81, 0x0e,
+  0x35, 0x81, 0x02, 0x05, 0x39, 0x23, 0xc7, 0x03, 0xe5, 0x69, 0x83, 0x6a, 0x04, 0xc5, 0x54, 0x9a,
+  0x26, 0x28, 0xb1, 0x98, 0x1f, 0x30, 0x3d, 0xc0, 0xd3, 0x34, 0x96, 0xba, 0xcd, 0xa3, 0xb2, 0x99,
+  0xcd, 0x76, 0xa0, 0x82, 0x75, 0x1a, 0xc5, 0x9d, 0x35, 0x5b, 0x8e, 0x1b, 0x9f, 0x63, 0x81, 0xef,
+  0xfb, 0x76, 0xdc, 0x94, 0xb0, 0xcc, 0x07, 0xa6, 0x54, 0xb4, 0xac, 0x79, 0xa2, 0x95, 0x36, 0xac,
+  0xdc, 0x91, 0x46, 0xf5, 0x09, 0x70, 0x46, 0x70, 0x01, 0x5e, 0xa0, 0x18, 0x6d, 0xca, 0xd0, 0xa1,
+  0x1f, 0x10, 0x98, 0x21, 0x62, 0xe3, 0x48, 0xd9, 0x4c, 0x53, 0x12, 0xe8, 0x24, 0x02, 0xd1, 0x40,
+  0xca, 0x4b, 0xd6, 0x1c, 0xd2, 0xa3, 0x0c, 0x86, 0x1c, 0x72, 0xd4, 0x5a, 0x73, 0xbd, 0xba, 0x5e,
+  0x6d, 0xb2, 0x1d, 0x20, 0x48, 0x08, 0xd4, 0x04, 0xbc, 0x86, 0xb9, 0xe4, 0xbc, 0x08, 0x37, 0xe8,
+  0xe0, 0x32, 0xb8, 0x87, 0xe4, 0x88, 0x7c, 0x06, 0x6b, 0xc7, 0x29, 0x61, 0x19, 0x5d, 0xc7, 0xd0,
+  0xf8, 0xec, 0x01, 0xe1, 0x6a, 0x2f, 0xd2, 0x75, 0xa8, 0x44, 0x9c, 0x5c, 0xbd, 0x04, 0x1f, 0x61,
+  0x06, 0xde, 0xc3, 0x7b, 0x5c, 0x41, 0x81, 0x19, 0x05, 0x2f, 0xaf, 0x26, 0x0b, 0x01, 0xb3, 0x80,
+  0xc2, 0x7b, 0xc7, 0x17, 0x25, 0x41, 0x27, 0x6d, 0xd1, 0xcd, 0x88, 0x41, 0x1d, 0x53, 0xb4, 0xef,
+  0x46, 0x2d, 0x22, 0x09, 0x67, 0x82, 0x82, 0xc7, 0x09, 0xe8, 0x0c, 0x29, 0xb7, 0xaa, 0xa8, 0x9e,
+  0x00, 0x6b, 0x4f, 0xca, 0x28, 0x52, 0x8f, 0x9d, 0x53, 0x94, 0xa1, 0x6a, 0xd8, 0x20, 0x2a, 0xe4,
+  0x8a, 0x6f, 0xa2, 0x09, 0x70, 0x95, 0x4f, 0x34, 0xad, 0xbe, 0xbe, 0xf2, 0xd4, 0xb1, 0xe1, 0xac,
+  0x49, 0x6b, 0x86, 0xa9, 0x40, 0x4d, 0xc7, 0xd0, 0x4a, 0xbd, 0x6c, 0xa5, 0xee, 0xb1, 0x53, 0x8f,
+  0x58, 0x1a, 0x28, 0x85, 0x84, 0x80, 0x70, 0xb1, 0xe4, 0xf2, 0xb5, 0x67, 0x1e, 0xc9, 0x92, 0xa0,
+  0x53, 0x50, 0xe0, 0x06, 0xe5, 0x6a, 0x6b, 0xc3, 0x1e, 0xe4, 0x5b, 0x48, 0x70, 0x45, 0x03, 0x2c,
+  0xd0, 0x81, 0xa7, 0x39, 0xb2, 0x9c, 0xff, 0x7d, 0xe4, 0x02, 0x97, 0xe7, 0x20, 0x67, 0x54, 0x20,
+  0x2a, 0x9c, 0x15, 0x6b, 0xe6, 0x49, 0x67, 0xb1, 0x74, 0xcf, 0xee, 0x55, 0xa9, 0xb0, 0xb9, 0x54,
+  0xae, 0xd6, 0x28, 0xd9, 0x8d, 0x46, 0x6d, 0x77, 0x6a, 0x01, 0x73, 0x81, 0xef, 0xd1, 0xc8, 0x31,
+  0x57, 0xeb, 0xa0, 0xb7, 0xf8, 0x79, 0xb2, 0x40, 0x05, 0x16, 0x01, 0xce, 0x19, 0x1d, 0x09, 0x5b,
+  0xe3, 0x7b, 0x82, 0x4a, 0x91, 0xaa, 0x30, 0x63, 0x32, 0x2e, 0xc5, 0x39, 0x0d, 0x17, 0xc9, 0xae,
+  0x6f, 0x61, 0xd7, 0x70, 0x66, 0x1f, 0x08, 0x17, 0x31, 0xf7, 0xb9, 0xb4, 0xda, 0x59, 0x52, 0x51,
+  0xab, 0x85, 0xb1, 0x8e, 0x13, 0x8a, 0x2a, 0x36, 0x7a, 0xcb, 0x9d, 0xa2, 0x76, 0x57, 0x46, 0x58,
+  0x7e, 0xa7, 0x42, 0x5c, 0x26, 0xd7, 0xb0, 0xaa, 0xc8, 0xda, 0xb0, 0x1e, 0x86, 0xb2, 0x2d, 0x7a,
+  0x23, 0x39, 0xbb, 0x6c, 0xeb, 0x9e, 0x9b, 0x43, 0xbd, 0xda, 0xd6, 0x63, 0xef, 0x13, 0x5f, 0x6b,
+  0xda, 0x98, 0xd6, 0x47, 0xa9, 0x90, 0xa9, 0xf8, 0x61, 0xf8, 0xdd, 0xce, 0x4b, 0x86, 0xb1, 0xaa,
+  0x92, 0x67, 0x45, 0x52, 0x26, 0x83, 0x8a, 0x14, 0xfa, 0xb5, 0x58, 0x45, 0xbe, 0x2e, 0xf6, 0xf8,
+  0x93, 0x24, 0xd7, 0xfa, 0x59, 0x31, 0xe6, 0x88, 0xa0, 0x5c, 0xf8, 0xf7, 0x8d, 0xe2, 0xfe, 0x79,
+  0xb2, 0x50, 0x59, 0xe9, 0xe7, 0x64, 0xb4, 0x71, 0x64, 0xd1, 0x56, 0x1f, 0x63, 0xef, 0x86, 0xa0,
+  0x0d, 0x21, 0x63, 0x15, 0x75, 0x1f, 0x0d, 0xaa, 0xd2, 0xe5, 0x08, 0xe9, 0x48, 0x75, 0x41, 0xe2,
+  0x06, 0xbf, 0xc7, 0x6a, 0xb9, 0xdc, 0xe4, 0xd0, 0x6e, 0x09, 0x38, 0xca, 0x19, 0x2d, 0x60, 0x73,
+  0xee, 0x6d, 0xdb, 0xae, 0xe0, 0x32, 0xdb, 0xb4, 0x9e, 0x10, 0xcc, 0xde, 0x09, 0x3d, 0xfd, 0xb9,
+  0x4e, 0xd9, 0xc0, 0xde, 0x59, 0xe6, 0xc2, 0x93, 0xf1, 0x00, 0x42, 0xf0, 0xa5, 0x82, 0xdd, 0xcf,
+  0x91, 0x7e, 0xc5, 0x8e, 0x64, 0xc1, 0x36, 0x46, 0x81, 0x11, 0x8c, 0xa0, 0x16, 0x7c, 0x8f, 0x55,
+  0x64, 0xf7, 0xca, 0xbd, 0x43, 0x6c, 0xe5, 0x60, 0x81, 0x8d, 0x96, 0xc4, 0x04, 0xd1, 0x82, 0x60,
+  0x2e, 0x02, 0x15, 0x66, 0x5f, 0x73, 0x79, 0xad, 0xbf, 0x78, 0x79, 0x39, 0xf4, 0xb9, 0x68, 0x18,
+  0xad, 0x86, 0xc9, 0x65, 0x04, 0x8b, 0xb4, 0x8d, 0xd6, 0xe3, 0x38, 0x40, 0xd2, 0x01, 0x8f, 0x40,
+  0x91, 0xe3, 0xe2, 0x4c, 0x90, 0x09, 0x25, 0x23, 0x8a, 0xae, 0x23, 0x91, 0x73, 0xab, 0xa4, 0x1d,
+  0x7f, 0x40, 0xb0, 0x13, 0x94, 0x2b, 0xc9, 0x66, 0xe7, 0xc1, 0xb1, 0x03, 0xa3, 0x4c, 0x1a, 0x19,
+  0x0d, 0x2e, 0x3b, 0x49, 0x01, 0x9e, 0xd9, 0x51, 0x04, 0x32, 0xe1, 0xff, 0x18, 0xaa, 0x58, 0x5a,
+  0x38, 0x11, 0x7a, 0x50, 0xc2, 0x5a, 0x9e, 0x13, 0x26, 0x9e, 0xb4, 0xf9, 0x98, 0x45, 0x9f, 0xf4,
+  0x46, 0xec, 0x50, 0x0e, 0x78, 0x8e, 0x28, 0x1a, 0x02, 0xbb, 0x6b, 0x54, 0xb4, 0x54, 0x6c, 0x7a,
+  0xa1, 0xe2, 0xda, 0x44, 0x92, 0x3a, 0xf9, 0xb5, 0x45, 0xcb, 0xaf, 0x52, 0x1b, 0x57, 0x4d, 0x5d,
+  0x32, 0xe6, 0x40, 0x3f, 0x8d, 0x55, 0xae, 0x8b, 0xd5, 0xc6, 0x25, 0xe0, 0x96, 0x96, 0xf0, 0x1b,
+  0x54, 0xb8, 0x3e, 0xe6, 0x7d, 0x42, 0x03, 0x2b, 0xb3, 0xe5, 0xbf, 0x1d, 0x67, 0x5f, 0xac, 0x0b,
+  0x54, 0xc2, 0x2f, 0xb2, 0x5f, 0x0e, 0xaf, 0x8c, 0x36, 0x21, 0x51, 0x05, 0xf3, 0x73, 0x97, 0x92,
+  0x1d, 0x8b, 0x02, 0xf2, 0x3d, 0x72, 0x55, 0xfc, 0xa3, 0xd9, 0x3a, 0x02, 0x62, 0x6d, 0x34, 0x5a,
+  0x04, 0xf7, 0x01, 0x09, 0x81, 0x69, 0xc5, 0xc1, 0xab, 0x8c, 0xdd, 0x23, 0xf0, 0x56, 0x06, 0xbd,
+  0x85, 0x72, 0xdc, 0xac, 0xc9, 0xea, 0xa7, 0xa0, 0xd7, 0x88, 0x00, 0x1d, 0x14, 0x72, 0x45, 0x70,
+  0x61, 0xda, 0x5a, 0x3f, 0xf7, 0xa0, 0x9f, 0x8f, 0xdb, 0x86, 0x81, 0xaf, 0x4e, 0xd8, 0xdb, 0x66,
+  0xad, 0x9a, 0x9b, 0x89, 0x91, 0x1a, 0x13, 0x04, 0xde, 0x14, 0x58, 0xb0, 0x06, 0x04, 0xe0, 0x5d,
+  0xf2, 0x41, 0xc0, 0xfc, 0x4e, 0xea, 0x92, 0xa4, 0xe0, 0x47, 0x73, 0xeb, 0x47, 0x51, 0x18, 0x9e,
+  0xae, 0xe3, 0x10, 0x4c, 0x93, 0xf0, 0x3b, 0xf0, 0x0f, 0x94, 0x05, 0x1f, 0xee, 0x20, 0xc1, 0xa8,
+  0x39, 0xd2, 0x6a, 0x26, 0xf5, 0xbb, 0x7a, 0x09, 0x7e, 0x6e, 0x70, 0x85, 0x29, 0x24, 0xa9, 0xa6,
+  0xb8, 0x5c, 0x26, 0xa7, 0x28, 0x91, 0x6d, 0x00, 0x78, 0x0b, 0x6b, 0x20, 0xb1, 0x29, 0x90, 0x27,
+  0xcd, 0x72, 0xb4, 0xde, 0x9c, 0xae, 0x13, 0xbb, 0xaa, 0x4a, 0x97, 0x32, 0x13, 0x26, 0x28, 0x40,
+  0x5a, 0x98, 0xe7, 0xd5, 0x0a, 0xd9, 0x7a, 0x80, 0x65, 0xa2, 0x02, 0x44, 0x96, 0x07, 0x0d, 0x82,
+  0x5d, 0xa8, 0xc7, 0x05, 0x6c, 0x84, 0x46, 0x2a, 0x92, 0xba, 0xae, 0x43, 0x0e, 0x68, 0x54, 0xd4,
+  0x25, 0xdc, 0x7b, 0xba, 0x16, 0x49, 0x91, 0xeb, 0xd3, 0x6c, 0xb8, 0xb3, 0x61, 0x0f, 0xed, 0xb6,
+  0xd5, 0x1c, 0x48, 0xad, 0x66, 0x16, 0x3e, 0x0e, 0xbc, 0x67, 0x9e, 0x5d, 0xcf, 0x87, 0x1a, 0x13,
+  0xfb, 0x6e, 0xdf, 0xe8, 0x7d, 0xda, 0x5f, 0x25, 0x16, 0x16, 0x61, 0xc9, 0x97, 0x7b, 0x5d, 0x42,
+  0xbc, 0xb7, 0xda, 0x97, 0xaf, 0xb5, 0x4a, 0x01, 0x44, 0x7b, 0x4a, 0x70, 0xbe, 0x47, 0xe0, 0x27,
+  0x98, 0xef, 0x11, 0xa1, 0xda, 0x71, 0x43, 0xa7, 0x99, 0x03, 0xd2, 0x29, 0x82, 0xa0, 0x1f, 0x3e,
+  0xfe, 0xfc, 0xcb, 0xef, 0x7f, 0x7b, 0x73, 0xf3, 0x71, 0x0e, 0xfe, 0x2e, 0x7b, 0x99, 0x1f, 0x7e,
+  0x7c, 0xf3, 0xfe, 0xe3, 0x9b, 0x5f, 0xa7, 0xc1, 0x32, 0x9c, 0x47, 0x9b, 0xd9, 0x1c, 0xfc, 0x46,
+  0xb1, 0xf8, 0xe1, 0xd7, 0xdb, 0xb7, 0x7f, 0xfd, 0xf8, 0xfb, 0xbb, 0xdb, 0xd7, 0xad, 0xc7, 0x06,
+  0xc1, 0x1c, 0xbf, 0x92, 0xbf, 0x91, 0x60, 0x8e, 0xb4, 0x5a, 0x97, 0xf0, 0xff, 0x65, 0xe0, 0xef,
+  0x23, 0x22, 0x13, 0xed, 0x35, 0x33, 0x80, 0xa5, 0x41, 0x04, 0x4a, 0xe0, 0xa9, 0x29, 0x8d, 0x15,
+  0xc2, 0x09, 0x00, 0x12, 0xbc, 0x94, 0x84, 0x3d, 0xa4, 0x7b, 0x5c, 0x14, 0x88, 0xfa, 0x6e, 0x08,
+  0x72, 0x82, 0xeb, 0xd4, 0x5e, 0x86, 0xe6, 0x84, 0x7c, 0x17, 0xd4, 0x50, 0xec, 0x53, 0x80, 0x29,
+  0x47, 0x62, 0x1a, 0x02, 0x8d, 0x8a, 0xa4, 0x1e, 0x33, 0xdd, 0x17, 0x60, 0x82, 0x34, 0x2e, 0x4a,
+  0x29, 0x13, 0x53, 0x03, 0x80, 0x67, 0xda, 0x22, 0x9d, 0x4e, 0xa6, 0xf4, 0xa8, 0x46, 0xff, 0x7a,
+  0x35, 0x8f, 0x92, 0xcd, 0x3c, 0x4e, 0x92, 0x79, 0xb8, 0x58, 0xcf, 0x5a, 0x99, 0xed, 0x5c, 0x40,
+  0xfe, 0x62, 0x3b, 0x15, 0xf0, 0x36, 0x47, 0xf1, 0x4c, 0x0b, 0x72, 0xd9, 0xb2, 0xdf, 0x46, 0xa3,
+  0x05, 0x47, 0x94, 0x7f, 0x31, 0x05, 0x55, 0xe0, 0xab, 0xfc, 0x8b, 0xca, 0xe6, 0x52, 0x7e, 0xaa,
+  0xa5, 0x96, 0xac, 0xbc, 0x53, 0xe7, 0xe6, 0xe1, 0x0e, 0x9d, 0xed, 0x9f, 0x54, 0xf7, 0xbd, 0xed,
+  0x12, 0x7f, 0xc0, 0x22, 0xdf, 0xdb, 0x27, 0x7c, 0x80, 0x15, 0x1a, 0x34, 0xc1, 0xbd, 0x1e, 0x4f,
+  0xf3, 0xdb, 0x8d, 0x35, 0x79, 0x97, 0x5a, 0xbc, 0x56, 0x2c, 0xdb, 0xb5, 0x8c, 0xc5, 0xe1, 0x8b,
+  0xd5, 0xab, 0xed, 0x9b, 0x9b, 0x9b, 0x11, 0x2f, 0x45, 0xe3, 0x4e, 0xb2, 0x1e, 0xfd, 0x13, 0xbd,
+  0x53, 0x34, 0xb0, 0xaa, 0xb0, 0x84, 0x82, 0x32, 0xac, 0xdb, 0xb6, 0x6f, 0xbd, 0x1b, 0x0d, 0x3a,
+  0x4f, 0x83, 0x3f, 0x55, 0x2a, 0x56, 0x07, 0x02, 0x36, 0x15, 0x12, 0x4a, 0xb0, 0xa7, 0x45, 0x71,
+  0xeb, 0xc5, 0x68, 0xa4, 0xeb, 0x4d, 0xcf, 0x4b, 0x0c, 0x37, 0x2f, 0x2e, 0x28, 0xf9, 0x25, 0x2d,
+  0x9f, 0xad, 0x26, 0x3a, 0xd4, 0xe2, 0xfc, 0x4d, 0x95, 0x0d, 0x37, 0x0e, 0x79, 0x1d, 0x8b, 0x63,
+  0x9d, 0x78, 0x89, 0x89, 0x68, 0x3b, 0x40, 0x4f, 0x1a, 0x1f, 0xa5, 0x3a, 0x95, 0x13, 0xfc, 0x05,
+  0x1f, 0x6a, 0xd6, 0x08, 0x48, 0xc5, 0xee, 0xe9, 0x12, 0xeb, 0x13, 0xec, 0xfa, 0xf8, 0x8b, 0xf9,
+  0xf0, 0xfc, 0x6c, 0xf0, 0x49, 0x8f, 0x16, 0x4b, 0x1f, 0x50, 0x0f, 0xa9, 0xac, 0x3a, 0x2a, 0xb6,
+  0x33, 0xec, 0x66, 0x4f, 0x12, 0x79, 0xf6, 0xc6, 0x4c, 0x94, 0x35, 0x07, 0x48, 0x7a, 0xe3, 0x28,
+  0x73, 0xf5, 0xaa, 0xee, 0x51, 0x55, 0x89, 0x54, 0xf6, 0x3c, 0x17, 0x6e, 0x06, 0xb5, 0xab, 0x7d,
+  0x8f, 0x08, 0xc1, 0x35, 0xc7, 0x6a, 0xd6, 0xf4, 0xb0, 0xc7, 0x02, 0xa9, 0x96, 0x52, 0xb6, 0x50,
+  0x72, 0x78, 0xdc, 0xcd, 0x96, 0x38, 0x22, 0xa5, 0xc1, 0x1b, 0xfd, 0x52, 0xda, 0x17, 0x7e, 0x44,
+  0x8c, 0x21, 0x0d, 0xe0, 0x42, 0xfc, 0x89, 0x57, 0x45, 0x5d, 0x82, 0x4e, 0x45, 0x1d, 0x7b, 0x6d,
+  0xab, 0xeb, 0xd8, 0x9a, 0xae, 0xb4, 0x63, 0x2b, 0xba, 0xea, 0x7a, 0x62, 0xbb, 0x42, 0xdb, 0x1a,
+  0xea, 0x08, 0xad, 0x07, 0xe4, 0xbd, 0x86, 0x5e, 0x9d, 0x37, 0x93, 0xd1, 0x71, 0x9f, 0xe9, 0xf1,
+  0xf5, 0x6a, 0x38, 0x2c, 0xec, 0xbc, 0x38, 0xe4, 0xeb, 0x15, 0xbe, 0x6d, 0x22, 0x9f, 0x09, 0xa6,
+  0x28, 0x30, 0xd8, 0x28, 0xea, 0xd9, 0x73, 0x38, 0xee, 0xeb, 0xbd, 0x76, 0xa7, 0x69, 0x81, 0x9d,
+  0x5c, 0x3a, 0xc3, 0x8a, 0xad, 0x9d, 0x03, 0xb6, 0xea, 0x18, 0xc7, 0xea, 0x07, 0xa5, 0x44, 0x20,
+  0x5b, 0x97, 0x23, 0x11, 0x5e, 0xeb, 0xd7, 0x4e, 0xb9, 0x9f, 0x3c, 0x19, 0xaf, 0xfc, 0x43, 0xab,
+  0x67, 0x1d, 0x0a, 0xfd, 0x43, 0xa1, 0x7b, 0xe8, 0x48, 0xb1, 0x33, 0xd3, 0x40, 0x6b, 0xf9, 0x1b,
+  0xce, 0x34, 0x3c, 0x1b, 0x7a, 0x46, 0xb8, 0x76, 0xfa, 0x1a, 0x09, 0xf1, 0x6e, 0x73, 0x46, 0x39,
+  0x98, 0xbe, 0x7b, 0x7d, 0x3b, 0xeb, 0x90, 0xba, 0x1e, 0x4d, 0x3e, 0xc3, 0xad, 0x3d, 0xdf, 0x7c,
+  0x96, 0x64, 0x3f, 0x28, 0x85, 0x52, 0x45, 0x19, 0x34, 0x28, 0xdf, 0x0b, 0x9e, 0xfd, 0xf7, 0x3f,
+  0xb4, 0xc0, 0xd5, 0x5c, 0xc2, 0x51, 0x44, 0xe4, 0xa9, 0x3b, 0xfb, 0xae, 0x65, 0xea, 0x27, 0x54,
+  0x2b, 0x41, 0x8b, 0x05, 0x61, 0xc6, 0x19, 0x39, 0x0a, 0x85, 0x05, 0xd5, 0x98, 0xc9, 0x80, 0xc5,
+  0x46, 0x31, 0x37, 0xf3, 0x5c, 0xc9, 0x5e, 0x66, 0xd1, 0xd5, 0x4f, 0xe8, 0x7c, 0x65, 0xa6, 0xee,
+  0xe8, 0xea, 0x56, 0x86, 0xbc, 0x11, 0x88, 0x65, 0x88, 0x06, 0x07, 0x2c, 0x04, 0xae, 0xc0, 0x54,
+  0x62, 0x8d, 0x8c, 0x9d, 0xc0, 0x27, 0x44, 0x45, 0x83, 0x51, 0x23, 0xd4, 0xc7, 0xa0, 0x03, 0x14,
+  0x98, 0xe7, 0xfb, 0x99, 0x23, 0x9a, 0x93, 0x99, 0x52, 0xb2, 0x61, 0x62, 0xba, 0x6f, 0x7b, 0x79,
+  0xe9, 0x2e, 0x79, 0x69, 0xe9, 0x2e, 0xb8, 0x59, 0xd9, 0xea, 0xee, 0xf7, 0x82, 0x2b, 0x27, 0x54,
+  0xff, 0x7f, 0xb5, 0xc2, 0x4f, 0x1f, 0x5f, 0x26, 0x45, 0xc7, 0xfc, 0x13, 0x08, 0x56, 0x55, 0x04,
+  0x7d, 0x7b, 0xa8, 0x39, 0xc6, 0xe4, 0x62, 0x35, 0x53, 0x25, 0x78, 0x58, 0x80, 0xbd, 0x62, 0xe6,
+  0xa8, 0x13, 0x3e, 0x8b, 0x8f, 0x19, 0xdc, 0x0f, 0x23, 0xb3, 0x8b, 0x4b, 0x27, 0x2a, 0xfd, 0xb1,
+  0x9b, 0x22, 0x60, 0x0c, 0xfe, 0xd8, 0xde, 0x03, 0x89, 0x69, 0x0b, 0x4d, 0x26, 0xc5, 0x1b, 0xb7,
+  0xeb, 0xb7, 0x88, 0x67, 0xbb, 0xdd, 0x0e, 0x9b, 0xcc, 0x24, 0x49, 0x2e, 0x76, 0x4c, 0x5f, 0x51,
+  0x27, 0xdd, 0xc4, 0x72, 0x80, 0x80, 0x46, 0x4e, 0x40, 0x43, 0xb5, 0xc8, 0x02, 0x02, 0x79, 0x87,
+  0xdb, 0xff, 0x24, 0x56, 0xeb, 0x0a, 0xa9, 0x17, 0x51, 0xc6, 0x84, 0x77, 0x94, 0x65, 0x4f, 0x67,
+  0xf4, 0xd2, 0xd4, 0x14, 0x59, 0xa6, 0x96, 0x6e, 0x9f, 0x1c, 0xc7, 0xbe, 0x79, 0xe2, 0x31, 0xf3,
+  0x24, 0xf2, 0x2a, 0xbd, 0x34, 0x7b, 0x71, 0x86, 0xe0, 0xed, 0x80, 0x19, 0xc8, 0x0f, 0xb2, 0x1c,
+  0x20, 0xc8, 0xd1, 0x1c, 0x78, 0xa3, 0x71, 0xfb, 0xba, 0xaf, 0xd0, 0x02, 0xf3, 0x40, 0xb9, 0xde,
+  0x61, 0x02, 0xee, 0x61, 0x33, 0x0d, 0xac, 0x92, 0x8c, 0x6a, 0xac, 0x33, 0x07, 0x2f, 0x6e, 0x6e,
+  0x5e, 0x27, 0xab, 0x9b, 0x59, 0xdf, 0xeb, 0x86, 0xc6, 0x88, 0x69, 0x40, 0x37, 0xfa, 0xd6, 0x7f,
+  0xca, 0x24, 0xf8, 0xe7, 0x74, 0x19, 0x4a, 0x98, 0x6a, 0x4a, 0x76, 0x3b, 0x86, 0xfa, 0x05, 0x52,
+  0x44, 0xba, 0x82, 0x6d, 0x47, 0x50, 0x5f, 0x3d, 0x7e, 0xb2, 0x83, 0xa6, 0xb1, 0x19, 0x84, 0xe3,
+  0x32, 0x2e, 0x70, 0x7e, 0x77, 0xb6, 0x0e, 0x8b, 0x43, 0xf7, 0xf6, 0xb4, 0x32, 0x2c, 0x34, 0xda,
+  0x1a, 0xfd, 0xa4, 0xe4, 0xc9, 0xaa, 0x46, 0x87, 0x73, 0xd0, 0x7b, 0xeb, 0x7c, 0x45, 0xf1, 0x06,
+  0x72, 0xb1, 0x7b, 0x0b, 0xb6, 0xbb, 0xf7, 0x4b, 0xff, 0xeb, 0x79, 0x34, 0x36, 0x26, 0x77, 0x6e,
+  0xc7, 0xf6, 0xd6, 0x3e, 0xd7, 0x28, 0x28, 0x31, 0x22, 0x05, 0x1f, 0x08, 0x3a, 0xf8, 0x96, 0xe1,
+  0xef, 0x5f, 0xf0, 0x3d, 0x7b, 0x18, 0xfd, 0x14, 0x76, 0xf5, 0x12, 0xbc, 0x67, 0x02, 0x97, 0x38,
+  0xef, 0xbe, 0xf5, 0x52, 0xf7, 0x85, 0x17, 0xfe, 0x25, 0x3e, 0xa1, 0x42, 0x7b, 0xa6, 0xfb, 0xcc,
+  0xdb, 0x5e, 0x68, 0xf6, 0xc9, 0x75, 0x66, 0x14, 0x66, 0xdb, 0x4d, 0xb4, 0x1b, 0xdc, 0xcb, 0xee,
+  0x0c, 0x11, 0xb4, 0x07, 0x47, 0xfd, 0xed, 0xa1, 0x7b, 0x99, 0xe9, 0x40, 0xc6, 0x97, 0xce, 0xe7,
+  0x70, 0xae, 0x7e, 0x0b, 0xdd, 0xa3, 0x8d, 0x7c, 0xde, 0x6d, 0x51, 0x45, 0x9b, 0x52, 0x2a, 0x5a,
+  0xdb, 0x60, 0xfd, 0xd7, 0x34, 0x0e, 0xcd, 0x90, 0xec, 0xc2, 0x07, 0xdd, 0x4f, 0x01, 0xa6, 0x05,
+  0x3a, 0xc9, 0xca, 0x1b, 0xaa, 0xc8, 0x71, 0xcd, 0x63, 0x0d, 0xeb, 0xf4, 0x46, 0xa3, 0x4c, 0x42,
+  0x95, 0x0e, 0xff, 0x03, 0x8c, 0x01, 0x79, 0x34, 0x3e, 0x22, 0x00, 0x00,
+};
+const WebAsset WEB_ASSET_ADMIN_CSS = {
+  "/admin.css", "text/css", ADMIN_CSS_GZ, sizeof(ADMIN_CSS_GZ), 8766, "75dfdb3c0cc2", "\"75dfdb3c0cc2\""
+};
+
+// admin.js: 59470 Bytes -> 12555 Bytes gzip
+static const uint8_t ADMIN_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdb, 0x72, 0xdc, 0x38,
+  0x92, 0xe8, 0xbb, 0xbe, 0x02, 0x76, 0x9f, 0x63, 0x92, 0xeb, 0xba, 0x49, 0xbe, 0xc4, 0xb6, 0xd4,
+  0xb2, 0xc2, 0xd7, 0x69, 0xcd, 0x7a, 0x6c, 0x87, 0x25, 0x77, 0x9f, 0x08, 0x8d, 0x56, 0xc1, 0x2a,
+  0xa2, 0xaa, 0x30, 0x62, 0x91, 0xb5, 0x24, 0x4a, 0x97, 0x76, 0xeb, 0x4f, 0xf6, 0xf1, 0x7c, 0xc3,
+  0x3e, 0xcd, 0x5b, 0xff, 0xd8, 0x89, 0x4c, 0xdc, 0x41, 0xb0, 0x6e, 0x56, 0xf7, 0x4c, 0x9c, 0x98,
+  0x9d, 0xd8, 0xb6, 0x8a, 0x00, 0x32, 0x13, 0x40, 0x22, 0x81, 0x4c, 0x64, 0x26, 0xc6, 0x8b, 0x62,
+  0xc4, 0x59, 0x59, 0x90, 0xfa, 0x9a, 0xf1, 0xd1, 0xf4, 0x34, 0x1d, 0xc6, 0x3c, 0x1d, 0x7e, 0x48,
+  0x67, 0x34, 0x21, 0x5f, 0x77, 0x08, 0x19, 0x95, 0x45, 0xcd, 0x09, 0x4f, 0x87, 0x35, 0x39, 0x24,
+  0x59, 0x39, 0x5a, 0xcc, 0x68, 0xc1, 0x7b, 0xff, 0xb5, 0xa0, 0xd5, 0xed, 0x09, 0xcd, 0xe9, 0x88,
+  0x97, 0xd5, 0xcb, 0x3c, 0x8f, 0xa3, 0x1e, 0x4f, 0x87, 0xdd, 0x51, 0x59, 0x70, 0x5a, 0xf0, 0x28,
+  0x39, 0xd8, 0x21, 0xd8, 0xa6, 0x37, 0x2e, 0xab, 0xb7, 0xe9, 0x68, 0x0a, 0x30, 0xc9, 0xe1, 0x0b,
+  0xf8, 0xd6, 0x1b, 0xe5, 0x69, 0x5d, 0xbf, 0x67, 0x35, 0xef, 0x55, 0x74, 0x56, 0x5e, 0xd1, 0x38,
+  0x4a, 0x47, 0x9c, 0x5d, 0xd1, 0x28, 0xc1, 0x66, 0x02, 0xe1, 0x90, 0x17, 0xeb, 0x20, 0x1c, 0xf2,
+  0x42, 0x20, 0x83, 0xfa, 0x1a, 0xd9, 0x90, 0x17, 0x80, 0x6c, 0xc8, 0x8b, 0xf5, 0x90, 0xf1, 0xb4,
+  0x9a, 0x50, 0x6e, 0xa3, 0x9b, 0x50, 0xfe, 0x36, 0xa7, 0xf0, 0xe7, 0xab, 0xdb, 0xe3, 0x4c, 0x8f,
+  0x08, 0x34, 0x61, 0x63, 0x12, 0x8b, 0x06, 0x89, 0x6c, 0x68, 0x21, 0x49, 0xb3, 0xcc, 0x60, 0x80,
+  0xda, 0xfd, 0x3e, 0x79, 0xc7, 0x8a, 0x8c, 0xa4, 0xf0, 0xff, 0xf0, 0x3d, 0xe5, 0x94, 0xf0, 0x29,
+  0x25, 0xc3, 0x05, 0xe7, 0x65, 0x41, 0xf8, 0x34, 0xe5, 0x72, 0xe8, 0x69, 0x4d, 0x78, 0x49, 0xf8,
+  0x94, 0xd5, 0x30, 0x4c, 0x9a, 0x38, 0x01, 0xed, 0x15, 0x74, 0x89, 0xbc, 0xac, 0xaa, 0xf4, 0xb6,
+  0x37, 0xae, 0xca, 0x19, 0xf4, 0xb1, 0x4e, 0x7a, 0x63, 0x56, 0x64, 0x76, 0x77, 0x27, 0x94, 0xbf,
+  0xe4, 0xbc, 0x62, 0xc3, 0x05, 0xa7, 0x71, 0x54, 0x16, 0xa3, 0x9c, 0x8d, 0x2e, 0xa3, 0xe4, 0xa8,
+  0xc7, 0x8a, 0x51, 0xbe, 0xc8, 0x68, 0x1d, 0x3f, 0x8c, 0x1e, 0x92, 0xc7, 0x44, 0x76, 0x88, 0x3c,
+  0x26, 0x0f, 0xa3, 0x87, 0x89, 0xee, 0x97, 0xc6, 0x95, 0x18, 0xb4, 0xcb, 0x7a, 0xc7, 0xab, 0x5b,
+  0xf2, 0x95, 0xe4, 0xe5, 0x28, 0xcd, 0x4f, 0x78, 0x59, 0xa5, 0x13, 0xda, 0xab, 0x29, 0x3f, 0xe6,
+  0x74, 0xa6, 0xea, 0xbd, 0xcc, 0x66, 0xac, 0x38, 0x4d, 0x87, 0x51, 0x87, 0xe8, 0x41, 0x24, 0x77,
+  0x64, 0x94, 0xf2, 0xd1, 0x94, 0xc4, 0xc0, 0x63, 0x77, 0x3b, 0x77, 0x3b, 0x3b, 0xfd, 0x3e, 0xf9,
+  0x13, 0xad, 0xe7, 0x94, 0x8d, 0xa6, 0xb4, 0xe2, 0x94, 0x9c, 0xa6, 0xc3, 0xee, 0x9b, 0x94, 0xd3,
+  0x82, 0xc4, 0x57, 0xb4, 0x9a, 0xb2, 0x22, 0xa3, 0x15, 0x27, 0xbf, 0xfd, 0xf7, 0x90, 0x56, 0xf5,
+  0x68, 0x5a, 0x51, 0x36, 0xa4, 0x05, 0x19, 0x52, 0x46, 0xea, 0xd1, 0xb4, 0xa0, 0x79, 0x4e, 0x67,
+  0xe4, 0x94, 0xcd, 0xe7, 0xb4, 0x48, 0x76, 0xc4, 0xa8, 0xd5, 0xe9, 0x15, 0xcd, 0x4e, 0xd3, 0xe1,
+  0x9b, 0x94, 0xa7, 0xe4, 0x10, 0x39, 0x79, 0xb0, 0x4f, 0xbe, 0x16, 0xe9, 0x8c, 0xee, 0x93, 0x28,
+  0xea, 0x10, 0x36, 0x2a, 0x0b, 0xf8, 0xeb, 0xae, 0xb3, 0x43, 0xc8, 0x6e, 0x7b, 0xd1, 0x5e, 0x7b,
+  0xd1, 0x93, 0x70, 0xd1, 0xce, 0xdd, 0x01, 0x76, 0xe8, 0xb8, 0x60, 0x9c, 0xa5, 0x39, 0xab, 0x19,
+  0xad, 0x16, 0xc5, 0x04, 0xc8, 0x9d, 0x91, 0xf7, 0x69, 0x46, 0x0b, 0x92, 0xd1, 0x8a, 0x9c, 0x50,
+  0xc6, 0xe9, 0xce, 0x58, 0x2d, 0x3f, 0x56, 0x30, 0x7e, 0x62, 0x11, 0x1d, 0x9b, 0xe5, 0x57, 0xe6,
+  0xb4, 0x97, 0x97, 0x93, 0x38, 0x3a, 0x7b, 0xf3, 0xf6, 0xd5, 0x97, 0x3f, 0x9d, 0x87, 0xea, 0x8e,
+  0xd2, 0x3c, 0xa7, 0x99, 0x98, 0x95, 0x71, 0x59, 0x91, 0x38, 0xa7, 0x9c, 0x30, 0x72, 0x48, 0x06,
+  0x07, 0x84, 0x91, 0x1f, 0xc8, 0xd3, 0x03, 0xc2, 0x1e, 0x3f, 0x16, 0x30, 0x15, 0x67, 0x01, 0xed,
+  0xc7, 0xc5, 0x7c, 0xb1, 0x8c, 0xf3, 0x23, 0x9e, 0x0e, 0x23, 0xf2, 0x98, 0x30, 0xf2, 0x98, 0x44,
+  0x17, 0x3c, 0x1d, 0x5e, 0x40, 0x2b, 0x81, 0x47, 0xc1, 0x81, 0x9e, 0x6f, 0x0e, 0x07, 0x5a, 0x29,
+  0x38, 0xc0, 0x7b, 0x9a, 0x9a, 0xc4, 0x99, 0xbc, 0x33, 0x76, 0xde, 0x83, 0x22, 0x72, 0x68, 0xe8,
+  0xed, 0x5d, 0xa5, 0xf9, 0x82, 0xf6, 0x78, 0xc5, 0x66, 0xb1, 0x05, 0x41, 0xd3, 0xd1, 0x84, 0x00,
+  0x45, 0xe4, 0xd0, 0x50, 0x1a, 0x80, 0x10, 0x1c, 0xe9, 0xd3, 0x74, 0x48, 0x34, 0xd9, 0x38, 0xee,
+  0x30, 0xa3, 0xbf, 0xd0, 0x6c, 0x1f, 0xa9, 0x39, 0x7c, 0x08, 0x85, 0x41, 0x72, 0x1f, 0x93, 0xe8,
+  0xa1, 0x60, 0x8a, 0x70, 0x25, 0xa4, 0x08, 0x2a, 0x89, 0x31, 0x50, 0xab, 0xe0, 0x0d, 0x1d, 0x96,
+  0x8b, 0x62, 0x44, 0xc9, 0x8f, 0x34, 0x9f, 0xd3, 0x8a, 0xc4, 0xcf, 0x06, 0x83, 0x59, 0x4d, 0x7e,
+  0xa2, 0xd5, 0x2f, 0xbf, 0xfd, 0xcf, 0x04, 0x19, 0x29, 0x21, 0x5d, 0xf2, 0xe1, 0xcb, 0x67, 0xf2,
+  0xf6, 0xf8, 0xc3, 0xdb, 0xcf, 0x64, 0xfc, 0xdb, 0xdf, 0x2b, 0x60, 0xad, 0x8c, 0x92, 0x77, 0x34,
+  0xcf, 0x68, 0xf5, 0x60, 0x47, 0x8b, 0x6c, 0xe0, 0x91, 0x53, 0x36, 0xa3, 0x15, 0x88, 0xd2, 0xaf,
+  0xc0, 0x96, 0x9a, 0xdd, 0x32, 0x89, 0x27, 0xc3, 0x3a, 0x42, 0xe8, 0x1f, 0x17, 0x19, 0xbd, 0x11,
+  0x2c, 0xd2, 0xef, 0x93, 0xd7, 0xe9, 0x68, 0x4a, 0xc9, 0xc9, 0xc7, 0x77, 0x1f, 0x3f, 0x9f, 0x92,
+  0xf4, 0x92, 0x2f, 0x24, 0x2b, 0xd3, 0x82, 0xa4, 0x8b, 0x9a, 0xe0, 0x30, 0x76, 0x05, 0xca, 0x62,
+  0x67, 0x1b, 0x96, 0x52, 0x18, 0x03, 0x9c, 0xb5, 0x39, 0x5f, 0x35, 0x80, 0x29, 0xf6, 0x6a, 0x5b,
+  0x43, 0x8d, 0x01, 0xf0, 0xa1, 0x24, 0xfb, 0x56, 0x6f, 0xc6, 0xe5, 0xa2, 0xc8, 0x0e, 0xa1, 0x8a,
+  0xe1, 0x53, 0xf2, 0xe0, 0xf0, 0x90, 0x14, 0x8b, 0x3c, 0x4f, 0xa0, 0x7a, 0x87, 0x20, 0x4b, 0x89,
+  0xc9, 0xb6, 0x2a, 0x1d, 0xf9, 0x6c, 0x4b, 0xf6, 0x49, 0xf4, 0xe1, 0xcb, 0xfb, 0xf7, 0x51, 0x62,
+  0x4d, 0xff, 0xd6, 0x24, 0x9a, 0x31, 0xb2, 0x48, 0x34, 0x1f, 0x97, 0x90, 0x68, 0x2a, 0x1d, 0xf9,
+  0xeb, 0x22, 0x40, 0xe2, 0x0e, 0x71, 0x39, 0x58, 0x91, 0xd1, 0x5c, 0x9c, 0xcd, 0x1e, 0xcb, 0x65,
+  0x06, 0x50, 0xa3, 0x83, 0x76, 0x40, 0xfe, 0x1a, 0x6d, 0xd2, 0xe5, 0x03, 0xda, 0x7a, 0xd4, 0x04,
+  0x6f, 0x2f, 0xe6, 0x59, 0xca, 0x69, 0x06, 0xbb, 0x6e, 0xcb, 0x62, 0xf6, 0x7a, 0xb9, 0x74, 0x4d,
+  0x7b, 0x1d, 0xb1, 0x06, 0x0e, 0x16, 0x53, 0x4e, 0xd3, 0x8a, 0xd0, 0x1b, 0x56, 0x73, 0x56, 0x4c,
+  0x08, 0x87, 0x45, 0x89, 0x72, 0xda, 0xda, 0xee, 0xc5, 0xc1, 0xc2, 0x5a, 0xb4, 0x06, 0xa4, 0x96,
+  0xdb, 0x00, 0x06, 0x0a, 0xcb, 0x05, 0x6f, 0xad, 0x2b, 0xc4, 0x09, 0xa2, 0x3d, 0xa1, 0x9c, 0x14,
+  0xf4, 0x5a, 0xe2, 0xeb, 0xa2, 0xc8, 0x20, 0xef, 0x16, 0xc5, 0x25, 0xca, 0x80, 0x80, 0xe8, 0x20,
+  0xa4, 0x05, 0x2a, 0x39, 0x24, 0x35, 0xe5, 0x0a, 0x75, 0x9c, 0xc0, 0x81, 0x43, 0xd0, 0x54, 0xfb,
+  0x02, 0x04, 0xf1, 0x77, 0xc8, 0xb3, 0xc1, 0x20, 0x39, 0x50, 0x52, 0x8d, 0xd1, 0x9a, 0x6a, 0xc4,
+  0xb4, 0x20, 0xd5, 0x62, 0x0c, 0xdb, 0x20, 0xa3, 0x64, 0x42, 0x67, 0x94, 0x15, 0x35, 0x0c, 0xaf,
+  0x9e, 0x39, 0x43, 0x62, 0xba, 0x18, 0xb7, 0xcb, 0x2c, 0x38, 0x4d, 0x68, 0xb4, 0x1d, 0xe8, 0xa8,
+  0x39, 0xb6, 0xb6, 0xcb, 0x37, 0xa4, 0xa9, 0x15, 0xe6, 0xf1, 0xa8, 0x2c, 0x5c, 0x98, 0xf0, 0x65,
+  0x2d, 0x98, 0xfd, 0xbe, 0x18, 0x5f, 0xab, 0x47, 0x50, 0xb1, 0xdb, 0x3e, 0xde, 0x24, 0xbe, 0x66,
+  0x14, 0x8f, 0x31, 0xa7, 0x2c, 0xa7, 0xf5, 0x83, 0xc4, 0xd0, 0x55, 0x07, 0xc5, 0xb2, 0x96, 0xec,
+  0x1f, 0xc4, 0xa2, 0x5b, 0xc2, 0xac, 0xae, 0x18, 0x5d, 0x5e, 0x1f, 0x6a, 0xb4, 0xae, 0xa7, 0x7a,
+  0xb9, 0x7c, 0x14, 0x2b, 0xc1, 0x9c, 0x27, 0xdd, 0x15, 0xa2, 0x71, 0x5b, 0xcb, 0x61, 0x4c, 0xf9,
+  0x68, 0x1a, 0x47, 0xfd, 0x74, 0xce, 0xfa, 0xa0, 0x23, 0xf4, 0x2b, 0x8a, 0x92, 0xbf, 0x23, 0x19,
+  0x6a, 0x46, 0xf9, 0xb4, 0xcc, 0xf6, 0x49, 0xf4, 0xe9, 0xe3, 0xc9, 0x69, 0xd4, 0xc1, 0x6f, 0x53,
+  0x9a, 0x66, 0xb4, 0xaa, 0xf7, 0xc9, 0xd7, 0xe8, 0xb5, 0xd0, 0x31, 0xba, 0xa7, 0xb7, 0x73, 0x1a,
+  0xed, 0x93, 0x28, 0x9d, 0xcf, 0x73, 0x36, 0x4a, 0x61, 0xd4, 0xfa, 0x37, 0xdd, 0xeb, 0xeb, 0xeb,
+  0xee, 0xb8, 0xac, 0x66, 0xdd, 0x45, 0x95, 0xd3, 0x62, 0x54, 0x66, 0x34, 0x13, 0x87, 0x35, 0x42,
+  0x86, 0x65, 0x76, 0xbb, 0x4f, 0x60, 0xc3, 0x38, 0xf4, 0xfb, 0xf2, 0x08, 0x7b, 0x02, 0x5f, 0x45,
+  0x9b, 0x2f, 0x9f, 0x8f, 0x5f, 0x97, 0xb3, 0x39, 0xb0, 0x2a, 0x37, 0xea, 0x10, 0x54, 0x84, 0x0e,
+  0x5d, 0x2c, 0xab, 0xad, 0x7a, 0x9c, 0xc0, 0x2a, 0x80, 0xff, 0xf4, 0xf8, 0x94, 0x16, 0x71, 0x05,
+  0x0b, 0xa6, 0xea, 0xfd, 0xad, 0x2e, 0x8b, 0x38, 0x31, 0x9f, 0x33, 0x3c, 0x9e, 0xaa, 0xa5, 0x04,
+  0x12, 0x00, 0xbe, 0xf4, 0xea, 0xc5, 0x68, 0x44, 0xeb, 0x5a, 0x2d, 0x7b, 0x22, 0x45, 0xd5, 0x69,
+  0x3a, 0x7c, 0x85, 0x6a, 0x83, 0xc5, 0xa1, 0x92, 0xba, 0x8e, 0x1e, 0x6a, 0x79, 0x9c, 0xf1, 0x66,
+  0x53, 0x1d, 0x64, 0xec, 0x5e, 0x0b, 0x76, 0xd8, 0x6a, 0x1a, 0x01, 0xfe, 0x1d, 0xa1, 0x79, 0x4d,
+  0x35, 0x89, 0x0a, 0x1d, 0xad, 0xaa, 0xb2, 0x8a, 0xa3, 0xb7, 0xf0, 0x8f, 0xa0, 0x1b, 0x25, 0x5e,
+  0x3a, 0xdc, 0x8f, 0x3a, 0x04, 0x7b, 0x87, 0x35, 0x34, 0x99, 0x69, 0x4e, 0x2b, 0x1e, 0x47, 0xef,
+  0xe8, 0x34, 0xa7, 0x95, 0x38, 0x24, 0xbf, 0xb4, 0x4f, 0x1b, 0xfb, 0x48, 0x77, 0x6c, 0x5a, 0x92,
+  0x5f, 0x7f, 0x25, 0xd1, 0x97, 0x62, 0x48, 0x2f, 0xd3, 0x02, 0x74, 0x4d, 0x45, 0x8e, 0x1e, 0x70,
+  0x54, 0x2e, 0x62, 0x6a, 0xc6, 0x75, 0x2d, 0xd2, 0xd4, 0xc0, 0xad, 0x47, 0x8f, 0xa8, 0x7d, 0xe7,
+  0x49, 0x93, 0x4d, 0xa6, 0xa9, 0xfd, 0x78, 0xef, 0x43, 0x09, 0xac, 0x3c, 0x09, 0xae, 0x6d, 0xd6,
+  0x4c, 0x59, 0x68, 0x01, 0xf6, 0xfb, 0xe4, 0x0b, 0xa2, 0x80, 0x96, 0x5a, 0x11, 0x2d, 0x49, 0x3d,
+  0x2d, 0xaf, 0xb1, 0x01, 0x6a, 0xab, 0xb8, 0xe3, 0xc5, 0x42, 0x5c, 0x95, 0x73, 0xe8, 0x5e, 0x9a,
+  0x27, 0xbe, 0x0c, 0x3a, 0x99, 0xa7, 0xc5, 0x8a, 0xd3, 0x59, 0x17, 0x00, 0x75, 0xed, 0x3e, 0xe0,
+  0xd0, 0x81, 0x7e, 0xc2, 0xd3, 0xe1, 0x2b, 0x5e, 0x20, 0x4d, 0x72, 0xf3, 0x53, 0x30, 0x15, 0xe7,
+  0x8b, 0x1a, 0xe4, 0xd0, 0xc6, 0xd7, 0x9b, 0xa7, 0x15, 0x2d, 0x14, 0x1e, 0x9c, 0x06, 0x9b, 0x13,
+  0x41, 0xe3, 0x4e, 0xf3, 0x7c, 0x98, 0x8e, 0x2e, 0xf7, 0x89, 0x18, 0x41, 0x92, 0xb1, 0x8a, 0x5e,
+  0x72, 0x02, 0xda, 0x32, 0x2d, 0xc8, 0x6f, 0x7f, 0x1f, 0xd2, 0x8a, 0x28, 0x3d, 0xb9, 0x0b, 0x56,
+  0x85, 0x4b, 0x5e, 0x56, 0x96, 0x46, 0x93, 0xe6, 0xf9, 0xab, 0x0d, 0x0d, 0x10, 0x52, 0x81, 0x16,
+  0x0d, 0x9b, 0x3b, 0xb7, 0xd5, 0x95, 0x46, 0x1d, 0x8b, 0x7f, 0xd5, 0x50, 0x3c, 0x10, 0xb5, 0x13,
+  0x52, 0x51, 0xbe, 0xa8, 0x0a, 0x35, 0x6d, 0x1f, 0xca, 0x6a, 0x86, 0xfa, 0x87, 0x98, 0x26, 0x18,
+  0x59, 0x39, 0x94, 0x85, 0x2a, 0xc9, 0x8e, 0xc5, 0x31, 0x4a, 0x0b, 0x22, 0x5c, 0x2e, 0x51, 0x22,
+  0xcf, 0x4e, 0x3d, 0x5e, 0xbe, 0x2f, 0xaf, 0x69, 0xf5, 0x3a, 0xad, 0x69, 0xac, 0xf5, 0x7e, 0xb7,
+  0x75, 0xaf, 0xe6, 0x69, 0xc5, 0xeb, 0x9f, 0x19, 0x9f, 0xc6, 0xd1, 0x2c, 0x63, 0xfb, 0x51, 0x92,
+  0x34, 0x11, 0xf8, 0x6d, 0x16, 0xc3, 0x9a, 0x57, 0xac, 0x98, 0xc4, 0x4f, 0x11, 0x2c, 0xce, 0xc8,
+  0x6a, 0xd8, 0xdd, 0xcd, 0x61, 0x07, 0x4f, 0x54, 0xd2, 0xf2, 0xb4, 0xa3, 0xc6, 0xb9, 0xc7, 0x8a,
+  0x82, 0x56, 0x3f, 0x9e, 0xfe, 0xe5, 0x3d, 0x39, 0xc4, 0xd3, 0xa2, 0xe6, 0xdc, 0x69, 0x5a, 0x07,
+  0xb1, 0x90, 0x47, 0x8f, 0x7c, 0xbc, 0x39, 0x2d, 0x26, 0x7c, 0x4a, 0x5e, 0x90, 0xc1, 0x81, 0xdd,
+  0x5c, 0x6e, 0xa6, 0x6a, 0xd9, 0x3d, 0x7a, 0xa4, 0xfe, 0x54, 0x63, 0xdc, 0x6c, 0xb7, 0xcd, 0x1a,
+  0x97, 0x84, 0xe2, 0x46, 0xa3, 0x88, 0xc6, 0x53, 0xbc, 0x24, 0x41, 0x15, 0xa8, 0xe5, 0xdd, 0xf1,
+  0xc8, 0x17, 0x02, 0xc0, 0xeb, 0xa4, 0x2b, 0x06, 0x5e, 0x66, 0x99, 0xe0, 0x24, 0x36, 0x26, 0xf3,
+  0x8a, 0xd6, 0x62, 0x04, 0x61, 0xd6, 0x24, 0x42, 0xd7, 0x60, 0x00, 0x55, 0xdf, 0xe6, 0xf6, 0xaa,
+  0x18, 0x55, 0x34, 0xe5, 0x54, 0x2e, 0xc5, 0x38, 0x62, 0x7a, 0x2d, 0x60, 0x4d, 0x61, 0x3a, 0x92,
+  0xc3, 0x05, 0xb3, 0x4d, 0x70, 0xc6, 0x1b, 0x54, 0x39, 0x6d, 0x6a, 0x7e, 0x9b, 0xd3, 0xde, 0xa8,
+  0xae, 0x4f, 0xe9, 0x0d, 0x68, 0x7e, 0xd1, 0xb8, 0x2c, 0x78, 0xb7, 0x66, 0xbf, 0xd0, 0xfd, 0xbd,
+  0xa7, 0xf3, 0x9b, 0x83, 0xe8, 0xc0, 0x92, 0x0c, 0xbd, 0x14, 0x8c, 0x3e, 0xd9, 0xeb, 0x29, 0xcb,
+  0xb3, 0x58, 0x00, 0x90, 0xe7, 0x5f, 0xd3, 0x41, 0x4e, 0x6f, 0x78, 0x87, 0x94, 0x15, 0x19, 0x4b,
+  0xb1, 0x40, 0x8a, 0xc5, 0x0c, 0x24, 0x00, 0x1b, 0x93, 0x61, 0xc9, 0xa7, 0x84, 0xce, 0xe6, 0xfc,
+  0xd6, 0xf4, 0xdb, 0x48, 0x67, 0x2d, 0xec, 0xe8, 0x0d, 0xf7, 0x25, 0x9d, 0xd7, 0xf3, 0x7a, 0x9e,
+  0x6a, 0x41, 0xa0, 0xaa, 0xf7, 0x58, 0x06, 0xf4, 0x07, 0x65, 0xa0, 0x57, 0x13, 0xfe, 0x90, 0x07,
+  0x1b, 0xc3, 0x59, 0x5e, 0x9d, 0x25, 0x03, 0xb3, 0x0b, 0x03, 0x83, 0x3f, 0xaf, 0x29, 0x9b, 0x4c,
+  0xf9, 0xfe, 0xf3, 0xc1, 0x60, 0xc9, 0x40, 0x29, 0x90, 0x89, 0x25, 0x3c, 0x51, 0xea, 0x28, 0x36,
+  0x13, 0x2c, 0x2d, 0x98, 0xf1, 0x07, 0xf2, 0x24, 0x09, 0x89, 0xd6, 0x9f, 0x69, 0x51, 0x88, 0xd3,
+  0x6c, 0x4d, 0x72, 0x4a, 0xab, 0x0e, 0xf9, 0x85, 0xb2, 0x09, 0x25, 0x1f, 0x16, 0x33, 0x50, 0x36,
+  0x1e, 0xee, 0x3e, 0xec, 0x90, 0x87, 0x7b, 0xf0, 0x9f, 0x27, 0x0f, 0xff, 0x81, 0x63, 0x79, 0x22,
+  0x04, 0x87, 0xb5, 0xb6, 0x76, 0x93, 0x3f, 0x74, 0x60, 0xf5, 0xd0, 0xbd, 0xa7, 0xb4, 0x02, 0xbb,
+  0x1f, 0x74, 0x1e, 0x55, 0x81, 0xe3, 0x37, 0x70, 0xac, 0x99, 0x31, 0xae, 0xb6, 0xa9, 0x7a, 0xfe,
+  0xdb, 0xff, 0xe5, 0xb4, 0x22, 0x13, 0x3a, 0x5e, 0xe0, 0x4e, 0x75, 0x4d, 0x2b, 0xf8, 0x07, 0x0e,
+  0x3a, 0xc9, 0x3f, 0x70, 0x0c, 0xa3, 0x68, 0xd5, 0x88, 0x65, 0xac, 0x9e, 0xe7, 0xe9, 0xed, 0x7e,
+  0x51, 0x16, 0x74, 0xed, 0xf1, 0x91, 0x4a, 0x13, 0xe8, 0x3e, 0xe4, 0x6d, 0xc6, 0x78, 0x59, 0x91,
+  0x13, 0x9e, 0x72, 0xaa, 0x0c, 0x58, 0x2c, 0x07, 0x01, 0x09, 0xbb, 0xf0, 0x19, 0x10, 0x3d, 0x88,
+  0x3a, 0x48, 0xfc, 0xae, 0xfc, 0x77, 0x2f, 0x3a, 0x3f, 0xd8, 0x81, 0xbd, 0x6f, 0xb4, 0xa8, 0xe0,
+  0x40, 0x70, 0x2a, 0xea, 0xcb, 0x2e, 0x0e, 0xa2, 0x46, 0xa1, 0x60, 0x80, 0x43, 0xd2, 0xdd, 0x15,
+  0x45, 0x59, 0x95, 0x8e, 0x39, 0x9a, 0xc6, 0x80, 0x56, 0x30, 0x0f, 0xdf, 0xe1, 0x41, 0x6d, 0x57,
+  0xff, 0x05, 0xc6, 0xdf, 0x3b, 0x72, 0x27, 0xaa, 0x43, 0x1d, 0xd4, 0xd3, 0xa4, 0x4d, 0xf9, 0xec,
+  0x5c, 0x7f, 0xdf, 0x6d, 0xf9, 0xbe, 0xe7, 0x7f, 0x87, 0xfe, 0xbe, 0x67, 0x57, 0xb4, 0x7b, 0x42,
+  0x8b, 0xba, 0xac, 0xae, 0xd1, 0xd8, 0x1d, 0xff, 0x4c, 0x87, 0x27, 0xe5, 0xe8, 0x92, 0xf2, 0xee,
+  0xa7, 0x45, 0x3d, 0xed, 0x58, 0x8b, 0xec, 0x53, 0x99, 0xe7, 0xac, 0x98, 0x24, 0x08, 0x30, 0x67,
+  0x57, 0x54, 0xb4, 0xfb, 0x09, 0xac, 0x21, 0xca, 0xa8, 0xa7, 0x8b, 0x10, 0x04, 0x11, 0x06, 0x1f,
+  0xf3, 0x19, 0x40, 0xa0, 0x36, 0xaf, 0x4b, 0xa4, 0x85, 0x3c, 0x87, 0xa5, 0x3b, 0x2d, 0xaf, 0x4f,
+  0xcb, 0x4b, 0x5a, 0xbc, 0xa7, 0x93, 0x74, 0x74, 0x0b, 0x63, 0x77, 0x71, 0xa1, 0x4b, 0x2e, 0x2e,
+  0xa2, 0x70, 0xed, 0x57, 0xac, 0xf0, 0xab, 0x0e, 0x59, 0xd1, 0x5a, 0xfd, 0xcf, 0x73, 0x3a, 0xf1,
+  0xeb, 0xff, 0x6d, 0x4e, 0x27, 0x56, 0x03, 0x36, 0x4b, 0x27, 0xf4, 0x4b, 0x95, 0x63, 0x7d, 0x51,
+  0x77, 0x51, 0xe5, 0x56, 0x85, 0x45, 0x95, 0x1f, 0x17, 0x9c, 0x56, 0x57, 0x69, 0xfe, 0x86, 0x8e,
+  0xd3, 0x45, 0x8e, 0x7c, 0xf7, 0xe4, 0xf9, 0x60, 0xd0, 0x44, 0x1a, 0xa8, 0xb8, 0xab, 0xf8, 0xa1,
+  0xce, 0x8e, 0x01, 0x15, 0xdc, 0x67, 0x58, 0x73, 0x65, 0x7d, 0x7d, 0x5f, 0xa6, 0x19, 0x85, 0x85,
+  0x32, 0x4e, 0xf3, 0x9a, 0x1e, 0x58, 0x16, 0xfa, 0xfa, 0x58, 0x12, 0x19, 0xa3, 0x35, 0x4a, 0x48,
+  0x45, 0x71, 0x40, 0x23, 0xfd, 0xff, 0x9c, 0x72, 0x3e, 0xaf, 0x8f, 0xf6, 0xff, 0xda, 0xff, 0x6b,
+  0xbf, 0xcf, 0x7a, 0x9c, 0xd6, 0x3c, 0x96, 0xb2, 0x47, 0xd8, 0xd4, 0x9c, 0x63, 0x18, 0xea, 0x0d,
+  0x1a, 0xb2, 0xde, 0x0d, 0x11, 0x01, 0x0e, 0x81, 0x8d, 0x02, 0x45, 0xb3, 0xfc, 0x2d, 0xd1, 0x89,
+  0x15, 0x09, 0x05, 0x02, 0xf8, 0xe1, 0xe1, 0x61, 0x70, 0x42, 0x75, 0x83, 0xc6, 0xfc, 0x1d, 0x18,
+  0xda, 0x11, 0x84, 0xab, 0xc8, 0xcc, 0xcb, 0xf9, 0x22, 0x4f, 0xb9, 0x20, 0x48, 0x9c, 0x7a, 0x41,
+  0x84, 0x76, 0x48, 0xce, 0x6a, 0x6e, 0xdb, 0x22, 0xe6, 0x15, 0x1d, 0xb3, 0x1b, 0xb1, 0x67, 0x99,
+  0x43, 0x52, 0x8d, 0x2d, 0x96, 0x28, 0x06, 0xb2, 0x19, 0x18, 0x6b, 0x71, 0xe6, 0x2f, 0x44, 0x8b,
+  0x48, 0x9f, 0x48, 0x1f, 0x88, 0x0f, 0xe6, 0x00, 0xac, 0x40, 0xcb, 0xf5, 0x8c, 0xf6, 0x28, 0xa8,
+  0xd1, 0x93, 0xd4, 0xeb, 0x33, 0x0a, 0x98, 0x0b, 0x7f, 0x4a, 0xf3, 0x4d, 0x90, 0xcf, 0x53, 0x3e,
+  0x85, 0x4b, 0x32, 0x6b, 0xa2, 0x0c, 0x40, 0x64, 0xbc, 0xe5, 0x46, 0xe8, 0x06, 0xc0, 0x45, 0x95,
+  0x3b, 0x86, 0x6c, 0x4e, 0x67, 0xb5, 0xbe, 0xbe, 0x63, 0x35, 0xfe, 0x1b, 0x8b, 0xa1, 0x3c, 0xc2,
+  0x21, 0x25, 0xfb, 0xc8, 0x8a, 0x44, 0x75, 0xca, 0x3f, 0xbd, 0xea, 0x81, 0x55, 0xd3, 0xf8, 0x8a,
+  0x15, 0x1f, 0xe7, 0x7c, 0xc9, 0x06, 0x20, 0x54, 0x36, 0x41, 0x85, 0xd7, 0x4a, 0xf6, 0xf3, 0x30,
+  0xcc, 0x14, 0x7e, 0x65, 0x6f, 0x2b, 0x78, 0x99, 0xe7, 0x94, 0xf4, 0x86, 0xac, 0x20, 0xf1, 0x1b,
+  0x96, 0x42, 0xbd, 0x24, 0xb2, 0x08, 0xb7, 0xa5, 0xbd, 0x07, 0x29, 0x09, 0x74, 0x03, 0x24, 0xc3,
+  0x16, 0xfd, 0x90, 0xcd, 0x5a, 0x3a, 0x02, 0xa5, 0xc1, 0xea, 0xa1, 0xae, 0xfc, 0xf9, 0xd3, 0xdb,
+  0x3f, 0x6d, 0xd0, 0x15, 0x09, 0x2a, 0x71, 0xf8, 0x63, 0xfd, 0x1e, 0x88, 0xca, 0x9a, 0x6e, 0x47,
+  0xea, 0x59, 0xe5, 0x1e, 0xa1, 0x5f, 0x3e, 0xbf, 0x27, 0xf1, 0x8f, 0xa7, 0xa7, 0x9f, 0xfa, 0xf0,
+  0x9f, 0x93, 0x56, 0x2a, 0x45, 0x6b, 0xb1, 0x86, 0x80, 0xe5, 0xf4, 0x85, 0xf8, 0xdc, 0xb5, 0x85,
+  0x70, 0x50, 0xe8, 0xd7, 0xa4, 0x98, 0x40, 0x5d, 0x4d, 0xf0, 0xdc, 0x7c, 0x72, 0x69, 0x94, 0x05,
+  0x01, 0xa2, 0x4a, 0x49, 0xd1, 0x9d, 0x35, 0x66, 0xb0, 0x60, 0x68, 0x55, 0xa1, 0x98, 0x0d, 0x09,
+  0x3f, 0xbd, 0x88, 0x7f, 0xfd, 0x55, 0x2f, 0x78, 0x21, 0x3f, 0xad, 0x45, 0x55, 0x7f, 0xa9, 0xf2,
+  0x9f, 0xd4, 0x40, 0x1a, 0xd9, 0xac, 0x61, 0x27, 0xd0, 0xc4, 0xc2, 0x74, 0x18, 0x18, 0x6f, 0x01,
+  0xea, 0x2a, 0xcd, 0xf1, 0x68, 0xe4, 0x56, 0x6e, 0x6e, 0x79, 0x0d, 0x78, 0x81, 0x6d, 0xee, 0xd7,
+  0x5f, 0xe5, 0xd8, 0xeb, 0x1b, 0x77, 0x97, 0x20, 0x43, 0xb6, 0x25, 0xc1, 0x59, 0xa6, 0x8e, 0xd8,
+  0xb6, 0x50, 0xc3, 0x7e, 0xe9, 0x4e, 0x1e, 0x79, 0x7b, 0xe4, 0xbe, 0xa1, 0xc5, 0x3f, 0xc6, 0xeb,
+  0xe1, 0x7b, 0xf4, 0x88, 0x3c, 0x90, 0xe3, 0xd7, 0x82, 0x20, 0x28, 0x02, 0xa0, 0x16, 0xc7, 0x01,
+  0xfd, 0x94, 0xf2, 0xa9, 0x10, 0xfc, 0x8d, 0x8a, 0x1d, 0xb1, 0x41, 0x36, 0x8f, 0xba, 0xeb, 0x60,
+  0xb8, 0x93, 0x7d, 0xb7, 0xfa, 0xf7, 0xe8, 0x91, 0x11, 0xb5, 0x8f, 0x1e, 0x69, 0x39, 0x9e, 0xe8,
+  0xaf, 0x66, 0x50, 0x64, 0x11, 0x2e, 0x18, 0xd4, 0xa3, 0xd5, 0xe4, 0xff, 0xc4, 0x6a, 0x36, 0x64,
+  0x39, 0xe3, 0xb7, 0x92, 0x68, 0x8b, 0x94, 0x0e, 0xb1, 0xb9, 0x0a, 0x59, 0xc9, 0xde, 0xf1, 0x2a,
+  0x3a, 0xae, 0x68, 0x3d, 0x6d, 0x6c, 0x78, 0xe3, 0xb2, 0x1a, 0xd9, 0xfb, 0x30, 0xfe, 0x06, 0x02,
+  0x1b, 0x47, 0x06, 0x35, 0xc2, 0xad, 0x7b, 0xa7, 0xd5, 0x42, 0x2e, 0x2d, 0xb3, 0xb9, 0xdd, 0x79,
+  0x86, 0xf1, 0x3a, 0x13, 0x5b, 0x49, 0x1d, 0x89, 0x83, 0xbf, 0xb4, 0x22, 0xc3, 0xa1, 0xef, 0x05,
+  0xa9, 0x68, 0x6d, 0x59, 0x92, 0x55, 0x21, 0xee, 0x23, 0x7a, 0x9d, 0x13, 0xef, 0xa4, 0xb3, 0xc6,
+  0xde, 0xe3, 0x35, 0xd2, 0x07, 0x21, 0x5e, 0x2d, 0xa8, 0x2a, 0xdf, 0xa0, 0x73, 0x77, 0x92, 0x38,
+  0x61, 0x8e, 0xb5, 0xaf, 0x8c, 0xc8, 0xb2, 0xf3, 0x96, 0x68, 0xea, 0x4e, 0x0e, 0xd8, 0xf8, 0x6f,
+  0xc5, 0x24, 0x33, 0x54, 0x11, 0x04, 0x4e, 0xd8, 0xb7, 0xff, 0xa1, 0x87, 0x91, 0x6f, 0x3a, 0x1b,
+  0x20, 0x64, 0xd3, 0x85, 0x8d, 0x17, 0x9d, 0xcf, 0x3e, 0xf2, 0x06, 0x5e, 0x5b, 0x56, 0x5a, 0x64,
+  0x2b, 0x62, 0x3c, 0xd0, 0xeb, 0x4f, 0xcb, 0x4d, 0xd3, 0x10, 0xe5, 0x94, 0x0d, 0xc7, 0x97, 0x9c,
+  0x6d, 0xc2, 0xca, 0x97, 0xae, 0x02, 0x87, 0x1a, 0xa4, 0xc0, 0x4a, 0x5e, 0x86, 0x84, 0x1c, 0x91,
+  0x28, 0x22, 0xfb, 0x56, 0x9d, 0x55, 0x92, 0xc6, 0xad, 0x29, 0x90, 0x3b, 0x55, 0xf0, 0x36, 0xdc,
+  0xea, 0xe6, 0x7a, 0xb2, 0x70, 0x45, 0x1f, 0xc4, 0xf1, 0xec, 0x6e, 0x43, 0x59, 0x24, 0x67, 0xc1,
+  0x66, 0xf2, 0xe6, 0xf4, 0xcb, 0xba, 0xe9, 0x82, 0x97, 0x70, 0x55, 0x23, 0x97, 0xe2, 0x6a, 0x8e,
+  0x67, 0x9b, 0xf2, 0xa4, 0x38, 0x00, 0x6b, 0xa6, 0x64, 0xa2, 0xab, 0x3e, 0xb7, 0xaf, 0x64, 0x2d,
+  0x5b, 0xd1, 0x41, 0x60, 0x2d, 0x93, 0x7d, 0x8f, 0x0b, 0x68, 0xe5, 0xc4, 0xdc, 0x97, 0x0c, 0x50,
+  0x22, 0x20, 0xcc, 0xf9, 0x06, 0xf1, 0x12, 0xd6, 0xb3, 0x6a, 0x25, 0x6b, 0xef, 0x92, 0xeb, 0x30,
+  0x15, 0x39, 0x72, 0xc1, 0x49, 0x87, 0x34, 0x0b, 0x9d, 0x76, 0xf0, 0x93, 0xac, 0xa4, 0xfa, 0x21,
+  0xcd, 0xd0, 0x2c, 0xa7, 0x9f, 0x2a, 0x7a, 0xc5, 0xe8, 0x35, 0x80, 0x95, 0xd2, 0x45, 0x94, 0xbd,
+  0x01, 0x23, 0x89, 0xf5, 0xb5, 0x1e, 0x4d, 0x69, 0xb6, 0xc8, 0xe9, 0xcb, 0x05, 0x2f, 0xe1, 0x7a,
+  0x5b, 0x17, 0xdd, 0x05, 0x99, 0x19, 0x24, 0x0b, 0x52, 0xba, 0xa8, 0xf2, 0x7f, 0x52, 0x4e, 0x96,
+  0x5a, 0xfa, 0xa2, 0xca, 0x5d, 0x1d, 0xfd, 0x1f, 0xcf, 0xc1, 0x21, 0x7c, 0xf7, 0xc7, 0xc9, 0xab,
+  0xa4, 0xf7, 0x72, 0xce, 0x73, 0xaa, 0xdb, 0x57, 0x0f, 0x7f, 0x3c, 0xaf, 0xad, 0xb3, 0x44, 0x68,
+  0xf6, 0x93, 0x10, 0xa6, 0xf2, 0x38, 0xfc, 0x69, 0xad, 0xa3, 0xc3, 0x75, 0x95, 0xce, 0x37, 0x9c,
+  0xd8, 0x8b, 0x31, 0xa3, 0x79, 0x56, 0x5b, 0x3c, 0x08, 0x40, 0x9a, 0x2c, 0x88, 0x97, 0xad, 0x87,
+  0x2e, 0x75, 0x81, 0x4d, 0x10, 0x35, 0x06, 0xbd, 0x92, 0x2c, 0xe2, 0x2d, 0x31, 0x0b, 0x08, 0xa4,
+  0x49, 0x56, 0xda, 0x61, 0x01, 0x30, 0xc0, 0x3f, 0x22, 0xd1, 0x30, 0x2f, 0x47, 0x97, 0xb0, 0x8f,
+  0x46, 0x60, 0x9b, 0xb5, 0x44, 0x62, 0x9e, 0x0e, 0xe9, 0x46, 0x56, 0x12, 0x26, 0xad, 0x6a, 0x17,
+  0xd8, 0xd2, 0x74, 0x10, 0x7f, 0xaa, 0x49, 0xc6, 0x1f, 0x9e, 0x6e, 0xa8, 0x48, 0x01, 0x35, 0x56,
+  0x78, 0x5e, 0x29, 0x03, 0x5d, 0x4e, 0xe2, 0x13, 0x7a, 0x89, 0xb6, 0xee, 0x04, 0x69, 0x94, 0x7a,
+  0x78, 0xb8, 0x82, 0x7b, 0xd0, 0x51, 0xe4, 0x6c, 0xbc, 0xfa, 0x8c, 0x0d, 0xb2, 0xa6, 0x23, 0x6b,
+  0x59, 0x00, 0x5e, 0x54, 0x3c, 0x2c, 0xb8, 0xee, 0x3d, 0xd0, 0x15, 0x9a, 0x95, 0xa4, 0xbc, 0x70,
+  0xea, 0xf5, 0x02, 0x36, 0x3e, 0xb3, 0x13, 0x60, 0xbb, 0x43, 0xd8, 0x91, 0xa0, 0x86, 0xfa, 0xd5,
+  0x66, 0xae, 0x34, 0x57, 0xc6, 0x21, 0x14, 0x87, 0x01, 0x4b, 0xa8, 0x7d, 0x81, 0xec, 0x58, 0xf1,
+  0x68, 0x55, 0xb3, 0x9a, 0xe3, 0xb2, 0xaa, 0xc1, 0xa1, 0x78, 0xa9, 0xc3, 0x36, 0xd8, 0xdb, 0x45,
+  0xd5, 0xa8, 0x43, 0xfe, 0x7c, 0xf2, 0xf1, 0x43, 0x4f, 0x5c, 0xba, 0xb2, 0xf1, 0x6d, 0x2c, 0x4c,
+  0xe5, 0x49, 0xc3, 0x77, 0x9b, 0x58, 0x56, 0xcc, 0xbc, 0x4c, 0x33, 0xd1, 0xfe, 0x5d, 0x55, 0xce,
+  0x24, 0x78, 0xe9, 0xc6, 0x8c, 0x78, 0xad, 0x91, 0xac, 0x52, 0x60, 0x7e, 0x87, 0x8e, 0x49, 0x80,
+  0x0e, 0x6b, 0x0c, 0xab, 0xf4, 0xda, 0x0c, 0x8c, 0xb6, 0xdc, 0x23, 0x99, 0xf3, 0xb4, 0xaa, 0x29,
+  0x56, 0x50, 0x5a, 0x0a, 0xb8, 0x9c, 0x89, 0x2a, 0x75, 0x99, 0xe7, 0x14, 0x6e, 0xca, 0x47, 0x53,
+  0xf2, 0x29, 0x9d, 0xd0, 0xee, 0x67, 0xa1, 0xe7, 0x91, 0x82, 0x8d, 0xa6, 0x9c, 0x4c, 0x6c, 0xa7,
+  0xf3, 0x9f, 0xf1, 0xbf, 0x0b, 0x6a, 0x3b, 0x99, 0xf7, 0x24, 0x44, 0xf4, 0xa9, 0xd6, 0xae, 0x0f,
+  0x84, 0x15, 0x92, 0x06, 0x43, 0x93, 0xe5, 0x19, 0xf1, 0x46, 0x91, 0x27, 0xea, 0xc0, 0x4d, 0xbf,
+  0x56, 0xb0, 0xcc, 0xfd, 0xfe, 0x1b, 0x09, 0x00, 0xae, 0xae, 0x59, 0x61, 0x54, 0x2c, 0x42, 0x3e,
+  0x0e, 0xff, 0x06, 0x92, 0xf9, 0x92, 0xde, 0xd6, 0xb1, 0xa9, 0xa8, 0xad, 0x39, 0x97, 0xf4, 0xd6,
+  0xd6, 0xa5, 0x14, 0x4c, 0x5d, 0xf3, 0xec, 0x92, 0xde, 0x9e, 0x27, 0xc4, 0xfd, 0xdd, 0xbb, 0xc8,
+  0x58, 0xc5, 0x6f, 0x5d, 0x3d, 0x4b, 0xe9, 0x5a, 0xf2, 0x2f, 0xc3, 0x46, 0xf6, 0x24, 0xef, 0x38,
+  0x23, 0xbe, 0xfa, 0xae, 0x44, 0x70, 0xa1, 0x66, 0x0b, 0xf4, 0x59, 0xd4, 0x92, 0x1d, 0x8e, 0x25,
+  0xda, 0x9d, 0x0d, 0xfd, 0x9d, 0xcc, 0x10, 0xc1, 0xea, 0xb3, 0x7e, 0x9e, 0x31, 0xc7, 0x83, 0x22,
+  0xa3, 0x39, 0xe5, 0x34, 0x50, 0x41, 0x90, 0xef, 0xf1, 0x7a, 0xe0, 0x44, 0x72, 0x9d, 0xce, 0x65,
+  0xa9, 0x50, 0xec, 0xab, 0x72, 0x76, 0x9c, 0x81, 0x6b, 0x4e, 0x79, 0x9c, 0x59, 0x04, 0x3d, 0xb0,
+  0x30, 0x34, 0xc5, 0x36, 0xb4, 0x92, 0xd6, 0x65, 0x8b, 0x10, 0x09, 0xeb, 0xdc, 0x0a, 0x29, 0x29,
+  0x9b, 0xb5, 0x10, 0xd1, 0xb9, 0x92, 0x37, 0x1a, 0xd2, 0xe1, 0x21, 0x01, 0x01, 0x37, 0x66, 0x05,
+  0xcd, 0xf0, 0xe6, 0xb5, 0x6c, 0x7c, 0xb6, 0xe9, 0x68, 0x42, 0x84, 0x39, 0x15, 0xc0, 0x74, 0x7c,
+  0x4a, 0x08, 0x44, 0x60, 0x00, 0x6d, 0xba, 0x51, 0xaf, 0x0a, 0x15, 0xc2, 0xa6, 0x58, 0x4a, 0xe0,
+  0x8d, 0x51, 0x6e, 0xee, 0xc3, 0x66, 0x13, 0xd7, 0x43, 0xda, 0xbc, 0x83, 0x3b, 0x84, 0x5b, 0x38,
+  0xbb, 0x57, 0xcd, 0x91, 0xb7, 0x19, 0x43, 0x5c, 0x74, 0x2d, 0xdf, 0xab, 0x33, 0x19, 0xe6, 0x41,
+  0x08, 0xbf, 0x9d, 0xd3, 0xfd, 0x75, 0xf6, 0x03, 0x90, 0x34, 0x17, 0x50, 0xdb, 0x35, 0xfe, 0x0f,
+  0xa4, 0xd3, 0x21, 0x67, 0x3c, 0xdf, 0x04, 0x10, 0x54, 0xf7, 0xae, 0x11, 0x3a, 0xda, 0xb3, 0x61,
+  0x7d, 0x38, 0xc2, 0x73, 0x3d, 0x00, 0x66, 0x54, 0xe6, 0x65, 0xb5, 0x3e, 0x1c, 0xac, 0xee, 0x02,
+  0xfa, 0x6e, 0xef, 0x25, 0xfc, 0x4f, 0xc2, 0xab, 0xf1, 0x2e, 0xf1, 0x82, 0x16, 0x9c, 0xf1, 0xdb,
+  0xb5, 0xe0, 0x3a, 0x2d, 0x82, 0x34, 0xca, 0x1a, 0x8b, 0x82, 0xf1, 0x4d, 0x20, 0x42, 0xfd, 0x65,
+  0xf0, 0x32, 0x3a, 0x62, 0xb3, 0x34, 0xaf, 0x37, 0x81, 0xa9, 0xda, 0x2c, 0x83, 0x8b, 0xdf, 0x2f,
+  0xe0, 0x82, 0x7f, 0x13, 0xc8, 0xa6, 0x55, 0x98, 0x71, 0xea, 0x11, 0x2d, 0xe8, 0x45, 0x9a, 0xb3,
+  0x74, 0x4d, 0x82, 0x4d, 0xfd, 0x20, 0xb1, 0x97, 0xf4, 0xf6, 0x62, 0x96, 0x8e, 0xaa, 0x72, 0x2d,
+  0x68, 0xba, 0x76, 0x10, 0x56, 0x91, 0x5e, 0xb1, 0x49, 0xca, 0xe9, 0x85, 0x88, 0x5d, 0x5b, 0x0b,
+  0xa2, 0xd7, 0xa6, 0xa5, 0xd3, 0x18, 0xc4, 0xb6, 0x11, 0x37, 0xd9, 0x2d, 0xc2, 0xb3, 0x24, 0x6a,
+  0xe0, 0xd9, 0x76, 0x13, 0x90, 0xd8, 0x20, 0x4c, 0xa6, 0x51, 0x13, 0xf7, 0xbf, 0xe9, 0x82, 0xd0,
+  0x86, 0xe6, 0x9c, 0x28, 0xf7, 0xb7, 0x3e, 0x89, 0xda, 0xf0, 0x77, 0x15, 0xbd, 0x62, 0xdb, 0xde,
+  0x47, 0x7d, 0x19, 0xf6, 0x34, 0x7f, 0x0b, 0xf0, 0x65, 0x2b, 0x08, 0xcb, 0x6c, 0xa5, 0xa8, 0x46,
+  0x83, 0x6a, 0x78, 0x53, 0x36, 0xd2, 0x74, 0xe5, 0xd6, 0x6c, 0x04, 0x37, 0xd0, 0xfc, 0x20, 0x93,
+  0x67, 0x0c, 0x7d, 0xe9, 0xac, 0x4f, 0x1a, 0x61, 0xb9, 0xbd, 0x99, 0x84, 0xd6, 0xe7, 0xdf, 0xac,
+  0x07, 0x1f, 0xe4, 0xa4, 0x1a, 0x45, 0x15, 0xdd, 0x3f, 0x6e, 0xe7, 0x46, 0x49, 0xdc, 0x50, 0x6e,
+  0xdb, 0xf0, 0xe1, 0x8b, 0xb9, 0x07, 0xde, 0x4c, 0x70, 0x5b, 0x70, 0xd0, 0xb5, 0x6e, 0x63, 0x30,
+  0x52, 0x6e, 0x5b, 0x70, 0xf0, 0x8b, 0x23, 0xc0, 0xd5, 0xc8, 0xcb, 0xb1, 0x40, 0xe5, 0x62, 0x37,
+  0xd2, 0x47, 0xa5, 0x8d, 0x25, 0xb9, 0x85, 0xcc, 0x29, 0x31, 0xd4, 0x93, 0x8d, 0xa5, 0x79, 0x13,
+  0x26, 0x7c, 0xb7, 0x21, 0x4a, 0x56, 0xa3, 0xa3, 0xb7, 0x6b, 0x2a, 0xa2, 0x0d, 0xc9, 0x6e, 0xf4,
+  0x03, 0x84, 0x92, 0x08, 0x60, 0x4d, 0xcc, 0xaa, 0x45, 0x13, 0x3b, 0x48, 0xf1, 0x0d, 0xd1, 0xdb,
+  0xe2, 0xdf, 0x10, 0x20, 0x00, 0x25, 0x12, 0x60, 0x93, 0x04, 0xd3, 0xca, 0x62, 0x5d, 0xeb, 0xd6,
+  0xce, 0x9e, 0xca, 0xbd, 0x8d, 0xa6, 0xd2, 0xde, 0x3d, 0x6c, 0xbc, 0xe6, 0xbb, 0xe9, 0x76, 0x0b,
+  0xc2, 0x27, 0x9b, 0x20, 0xb4, 0x36, 0x18, 0x0b, 0x9d, 0xfe, 0xba, 0x12, 0xd9, 0xd3, 0xc8, 0x8f,
+  0x43, 0xbd, 0x5a, 0x77, 0x06, 0x1a, 0x3b, 0x91, 0x1d, 0x3f, 0x7a, 0x05, 0xc3, 0x8f, 0xff, 0x58,
+  0x64, 0x79, 0x2d, 0x56, 0x8f, 0xfd, 0xb3, 0x8d, 0xc6, 0xde, 0xdd, 0xc2, 0xec, 0xd1, 0xb7, 0x4b,
+  0x9a, 0x6c, 0x87, 0x3b, 0xd4, 0xda, 0x7c, 0xe7, 0xec, 0x6a, 0x96, 0x85, 0x59, 0x00, 0x49, 0x14,
+  0xb4, 0x26, 0x7a, 0x2c, 0x58, 0xdd, 0xe7, 0xe7, 0x9b, 0xf4, 0xd9, 0xde, 0x12, 0x6d, 0x61, 0xa7,
+  0x3f, 0x37, 0x7b, 0xab, 0x0c, 0x19, 0x6f, 0xf3, 0x6f, 0x34, 0xd4, 0xc8, 0x5b, 0x2b, 0x03, 0x0e,
+  0xf6, 0xa5, 0x5e, 0xa0, 0x3a, 0x1a, 0xdc, 0x1d, 0xb5, 0xaa, 0xbd, 0x1a, 0x78, 0xc5, 0x41, 0x0d,
+  0x69, 0xd8, 0x09, 0x56, 0xb4, 0x9d, 0xba, 0x9b, 0x06, 0x1a, 0x67, 0xe8, 0x03, 0xad, 0x8d, 0x81,
+  0x86, 0xb4, 0xdd, 0x65, 0x36, 0x07, 0x50, 0x5f, 0xf2, 0xb5, 0x5c, 0x4c, 0x9b, 0xdb, 0xf7, 0x9d,
+  0x65, 0xc6, 0x55, 0xb9, 0x17, 0x8b, 0x4b, 0xdc, 0xbb, 0x1d, 0xe1, 0x9a, 0xc8, 0x72, 0xfa, 0x3a,
+  0x67, 0xf3, 0x61, 0x99, 0x56, 0x99, 0xf6, 0x0b, 0xf4, 0xed, 0x46, 0xa7, 0x76, 0xad, 0xb5, 0xcc,
+  0x47, 0xba, 0x76, 0xd3, 0x82, 0xe4, 0x14, 0xaf, 0x36, 0x24, 0x35, 0x70, 0x6f, 0x61, 0x44, 0x32,
+  0xd4, 0xf8, 0x76, 0x24, 0xbf, 0xff, 0x01, 0x33, 0x52, 0xd3, 0x04, 0x12, 0x1e, 0x34, 0xdf, 0xcc,
+  0x30, 0x02, 0x83, 0xd3, 0x08, 0xc7, 0xee, 0x5d, 0x59, 0xcd, 0x30, 0x3c, 0x5f, 0x2b, 0xc3, 0xe1,
+  0x73, 0x90, 0x9c, 0xa1, 0x7f, 0x29, 0xaf, 0xff, 0x52, 0x5e, 0xff, 0xa5, 0xbc, 0xfe, 0x4b, 0x79,
+  0xfd, 0xff, 0x42, 0x79, 0x15, 0xaa, 0x6a, 0x43, 0xe5, 0xf4, 0xc5, 0xa2, 0x88, 0x08, 0xb5, 0x8d,
+  0xaf, 0xf8, 0xd3, 0xb7, 0xba, 0x86, 0x2d, 0x7e, 0x20, 0xfc, 0x94, 0x03, 0x20, 0x86, 0x87, 0x7a,
+  0x7a, 0xa1, 0xa9, 0xb5, 0xee, 0xb9, 0xc3, 0x92, 0xa9, 0xda, 0x94, 0x8a, 0xcd, 0x13, 0x09, 0x46,
+  0x6f, 0xf3, 0x1a, 0x77, 0xab, 0x02, 0x6a, 0x08, 0x00, 0xd1, 0xba, 0x19, 0x05, 0x42, 0x18, 0x6b,
+  0x12, 0x04, 0x80, 0x44, 0x41, 0x32, 0x67, 0x0d, 0xec, 0xb4, 0xab, 0xac, 0xb6, 0x45, 0x6a, 0xad,
+  0x25, 0xb7, 0xb5, 0x5b, 0x90, 0x88, 0xa4, 0x52, 0x21, 0x59, 0x0e, 0x3e, 0x57, 0xa9, 0x95, 0x4e,
+  0xd9, 0x20, 0xad, 0x37, 0xc2, 0x27, 0xe5, 0xbb, 0x42, 0x28, 0x01, 0x24, 0x0a, 0x92, 0x8b, 0x32,
+  0xa4, 0xff, 0x5a, 0x17, 0xe2, 0x20, 0xd6, 0xde, 0xe2, 0x3a, 0xdc, 0x50, 0x91, 0x53, 0x8b, 0xd7,
+  0xdc, 0x8c, 0xdb, 0xa0, 0x12, 0x0f, 0xb4, 0x4b, 0x53, 0x8b, 0x9a, 0x6c, 0xd3, 0xf4, 0xa5, 0x60,
+  0x9b, 0xaa, 0x96, 0x62, 0x2b, 0x71, 0xe9, 0x11, 0x60, 0x12, 0x07, 0x68, 0x90, 0x16, 0x57, 0xbd,
+  0xb6, 0x29, 0x79, 0xf3, 0x8d, 0x2a, 0xb6, 0x21, 0xe6, 0x8d, 0x50, 0xb3, 0xad, 0x1f, 0x41, 0x52,
+  0x9a, 0xfa, 0xb6, 0x4d, 0xce, 0xbb, 0x6f, 0xd7, 0xb9, 0x0d, 0x45, 0xef, 0xa4, 0xde, 0x6d, 0xff,
+  0x0a, 0xd2, 0x14, 0x50, 0xc0, 0x0d, 0x5d, 0xb0, 0x89, 0xad, 0x4d, 0x92, 0xbd, 0xe3, 0x69, 0x62,
+  0x04, 0x84, 0x44, 0x81, 0xf2, 0x48, 0x08, 0xe9, 0xe2, 0x02, 0xf5, 0x25, 0x5d, 0x9b, 0x6d, 0xad,
+  0xcd, 0x51, 0xa1, 0xc5, 0xd6, 0x89, 0x00, 0xe2, 0xa2, 0x0c, 0xe8, 0xe3, 0xf7, 0xa3, 0x6e, 0xb7,
+  0x2b, 0xdb, 0x80, 0xb6, 0x4d, 0xdf, 0x36, 0x43, 0x8d, 0xbb, 0xdc, 0x86, 0xeb, 0xd5, 0xdd, 0x6c,
+  0xf5, 0x98, 0x3b, 0xa0, 0x12, 0x0f, 0xb4, 0x37, 0x03, 0x61, 0x7d, 0xdc, 0xa6, 0xe9, 0xe4, 0xdb,
+  0x74, 0x72, 0x43, 0xd1, 0x89, 0xd6, 0xcb, 0xed, 0x9f, 0x41, 0x7a, 0x7c, 0x05, 0x5d, 0x6d, 0x39,
+  0xc6, 0x1f, 0xc4, 0x52, 0xce, 0xad, 0x50, 0x29, 0x70, 0x01, 0x79, 0x9b, 0x6f, 0xe7, 0x19, 0x25,
+  0x65, 0xbc, 0x01, 0x93, 0xd8, 0x30, 0x3d, 0x69, 0xff, 0x8f, 0xd0, 0xea, 0x93, 0xa0, 0x62, 0x6d,
+  0xc8, 0x71, 0x55, 0x78, 0x79, 0xe2, 0x38, 0x58, 0xaa, 0x5d, 0x87, 0xfa, 0xb2, 0x81, 0x82, 0xed,
+  0x6a, 0x78, 0x73, 0x3c, 0xc7, 0xac, 0x75, 0xc7, 0x69, 0x45, 0x30, 0xa8, 0xf8, 0x44, 0x30, 0x39,
+  0xe8, 0xa6, 0x04, 0xbd, 0x63, 0x3e, 0x94, 0x9c, 0x8d, 0x65, 0x12, 0x93, 0x38, 0x7a, 0xc5, 0x38,
+  0xa7, 0xe4, 0x97, 0x05, 0xad, 0x6a, 0x4e, 0x28, 0x2b, 0x28, 0xf9, 0x0f, 0xf0, 0x9a, 0xc9, 0xc9,
+  0x75, 0x0a, 0x49, 0x29, 0x8a, 0x68, 0x99, 0x17, 0xb0, 0xaf, 0xa5, 0xb6, 0xe9, 0xa3, 0xd6, 0x15,
+  0x81, 0xa7, 0x6b, 0x63, 0x70, 0x49, 0x83, 0x28, 0x49, 0xc2, 0x65, 0x39, 0x67, 0xb4, 0xe2, 0xbe,
+  0xf7, 0xfc, 0x3c, 0xad, 0xc5, 0x01, 0xe8, 0x9f, 0x73, 0x50, 0x84, 0xcb, 0x85, 0x63, 0x81, 0x68,
+  0x45, 0xf4, 0x1f, 0x08, 0x5c, 0xf6, 0x53, 0x63, 0xb9, 0x2a, 0xab, 0x69, 0x0a, 0x6e, 0x48, 0x4b,
+  0xf1, 0xb4, 0x9c, 0x71, 0x5d, 0xcc, 0x07, 0x4b, 0xcd, 0x35, 0x21, 0x4f, 0xb8, 0x56, 0x3f, 0xb8,
+  0xd6, 0x69, 0xa2, 0xac, 0x80, 0x20, 0x62, 0x3a, 0x69, 0xcc, 0x94, 0x70, 0x38, 0xc3, 0xa9, 0x62,
+  0x3a, 0x35, 0x89, 0xb4, 0x4e, 0x34, 0x43, 0x65, 0x99, 0x8a, 0x0d, 0x6e, 0xc4, 0xd8, 0xfa, 0x77,
+  0x38, 0xa1, 0xfc, 0x18, 0x0c, 0xef, 0x55, 0x74, 0x0a, 0x50, 0x4c, 0x00, 0xda, 0x9e, 0x91, 0xb3,
+  0x43, 0xa2, 0xac, 0x2a, 0xe7, 0x5d, 0xb9, 0xd7, 0xe0, 0xcf, 0x74, 0x32, 0x61, 0xc5, 0xc4, 0x4d,
+  0xd6, 0x09, 0xe4, 0x65, 0x82, 0x02, 0x10, 0x2b, 0x5d, 0xf8, 0x80, 0xb1, 0xcc, 0x9a, 0xd8, 0xd6,
+  0x34, 0x9e, 0xd8, 0x34, 0x39, 0x5a, 0x96, 0xd2, 0x52, 0x9d, 0x53, 0x38, 0xa4, 0x95, 0xa8, 0x6d,
+  0x44, 0x27, 0xf2, 0x5b, 0xd4, 0xac, 0xf6, 0x29, 0x2d, 0x96, 0xfa, 0xd2, 0x19, 0x70, 0xd6, 0xe1,
+  0xc5, 0x6a, 0xea, 0xa5, 0x1b, 0x60, 0x39, 0x3d, 0x99, 0xd3, 0x11, 0x4c, 0xab, 0xc8, 0xbb, 0x65,
+  0x6a, 0xba, 0xe3, 0x2c, 0x07, 0xb9, 0x5b, 0xcb, 0xda, 0x5d, 0x55, 0xd7, 0x96, 0xab, 0x36, 0xb8,
+  0xc4, 0x01, 0x1e, 0x98, 0x8b, 0x29, 0xcb, 0x80, 0xc9, 0xb5, 0x5d, 0x51, 0xd9, 0xe2, 0x90, 0x99,
+  0x2d, 0x86, 0x11, 0x11, 0x68, 0x7c, 0x31, 0x87, 0x68, 0x66, 0x97, 0x87, 0x6d, 0x6e, 0x9b, 0xa5,
+  0xb7, 0x43, 0xfa, 0x8e, 0x41, 0x04, 0x32, 0xcf, 0x29, 0xfa, 0x85, 0xc1, 0x49, 0x68, 0x95, 0x45,
+  0xcc, 0x68, 0x6e, 0x27, 0x74, 0x3b, 0xd5, 0xcd, 0x52, 0xbd, 0x36, 0x70, 0x10, 0xf4, 0xb5, 0x2f,
+  0xeb, 0x70, 0xb8, 0x36, 0x21, 0xc1, 0xd3, 0xe1, 0x03, 0xd5, 0x17, 0xb8, 0x27, 0xb5, 0xa8, 0x82,
+  0x9f, 0x0a, 0xbc, 0xef, 0x0e, 0x23, 0x9b, 0x58, 0x0e, 0xe4, 0x78, 0x2f, 0xe4, 0x55, 0xd2, 0xb0,
+  0x64, 0x3d, 0x70, 0x20, 0xf2, 0xbe, 0xb9, 0x69, 0x49, 0x9a, 0xda, 0xb5, 0x08, 0x06, 0x54, 0x64,
+  0xf4, 0x94, 0x4b, 0xea, 0x47, 0x8c, 0x02, 0xac, 0x31, 0xd6, 0xa9, 0xa5, 0xec, 0x6c, 0x60, 0xee,
+  0x80, 0x21, 0xce, 0xaf, 0x01, 0x5a, 0x39, 0x99, 0xfa, 0x01, 0x83, 0xbf, 0xfe, 0x8a, 0x9f, 0x30,
+  0xcc, 0x15, 0x73, 0x08, 0x78, 0x07, 0x32, 0xa1, 0xd4, 0x1e, 0x4a, 0x77, 0xd2, 0x7a, 0x9e, 0x33,
+  0x1e, 0x47, 0xa4, 0x4b, 0xa2, 0xe4, 0x6c, 0x70, 0xae, 0x5a, 0x7b, 0xe1, 0xba, 0x7a, 0x38, 0xfc,
+  0xfe, 0x36, 0xc6, 0xe8, 0x90, 0xd8, 0xf5, 0x5c, 0x8e, 0xe5, 0x8a, 0x51, 0x45, 0x17, 0x63, 0x11,
+  0x0b, 0x69, 0x59, 0x28, 0xd4, 0x07, 0x27, 0x12, 0xdb, 0xed, 0xad, 0xbc, 0x48, 0x10, 0x35, 0x03,
+  0xfd, 0x86, 0xaf, 0x5e, 0xd7, 0x1d, 0xa7, 0x73, 0x40, 0x23, 0x7a, 0xee, 0x4e, 0x99, 0xa7, 0x4a,
+  0xcd, 0xf5, 0x00, 0xe1, 0xc2, 0xfc, 0x38, 0x96, 0x43, 0x64, 0x44, 0xcc, 0x5c, 0x5c, 0x57, 0xc8,
+  0xd6, 0x72, 0x30, 0x75, 0x32, 0x9d, 0x01, 0x38, 0x47, 0xcf, 0x6d, 0xcc, 0x76, 0xc5, 0x96, 0x61,
+  0x11, 0xa7, 0xeb, 0x58, 0x9c, 0xa3, 0xc5, 0xb0, 0x60, 0xfe, 0x21, 0x91, 0xe4, 0x45, 0xf6, 0xdc,
+  0x3e, 0x65, 0x37, 0x7a, 0x06, 0x55, 0x97, 0x75, 0x2c, 0x2b, 0xb9, 0xcc, 0x27, 0x69, 0xfa, 0xd5,
+  0x33, 0xbd, 0x82, 0xe2, 0x07, 0xd2, 0x7f, 0xcc, 0xca, 0x3d, 0x69, 0xf5, 0x0b, 0x6a, 0xa8, 0x34,
+  0x1f, 0x76, 0x8d, 0x8a, 0xce, 0xf3, 0x74, 0x44, 0xe3, 0xfe, 0xd9, 0x45, 0xf7, 0xfc, 0x71, 0x7f,
+  0xd2, 0x21, 0x11, 0xd9, 0x84, 0x3c, 0xf9, 0xc3, 0x85, 0xf5, 0xd7, 0xe1, 0x5f, 0xaf, 0x01, 0x54,
+  0x3c, 0xc3, 0x00, 0xb7, 0x59, 0x8f, 0x97, 0x5f, 0xe6, 0x73, 0x95, 0x60, 0x69, 0xa5, 0x38, 0x94,
+  0xc3, 0x69, 0x79, 0xaa, 0x9f, 0x2c, 0xc6, 0x63, 0x76, 0xb3, 0x86, 0x74, 0xbc, 0x1f, 0xd9, 0x86,
+  0x38, 0xd7, 0x3b, 0xc1, 0x3b, 0xf4, 0x19, 0xc9, 0xe6, 0x49, 0x33, 0x09, 0xf0, 0x77, 0x14, 0x54,
+  0x12, 0x43, 0x50, 0x50, 0xb5, 0x94, 0x49, 0x41, 0x25, 0xee, 0xbe, 0x84, 0x68, 0x09, 0x2c, 0x74,
+  0xaf, 0x53, 0xae, 0x00, 0xb1, 0x9b, 0xc8, 0x59, 0xd3, 0xd8, 0xdc, 0x20, 0x9b, 0x40, 0xe3, 0x80,
+  0xf4, 0x59, 0xb9, 0x51, 0xa2, 0xd5, 0xc2, 0xec, 0x94, 0xcb, 0x79, 0x27, 0x60, 0xd3, 0x5a, 0x01,
+  0x1e, 0xf5, 0xcf, 0x0d, 0xc0, 0xfb, 0x2a, 0xb8, 0x17, 0xed, 0xd3, 0x3c, 0x09, 0x2c, 0xe1, 0x60,
+  0xed, 0x7c, 0x81, 0xb1, 0x12, 0x90, 0x87, 0x43, 0x5e, 0xa8, 0x3a, 0x6c, 0xda, 0x71, 0x6c, 0x85,
+  0x1d, 0x7b, 0x8f, 0xef, 0xf8, 0xfd, 0xed, 0xb8, 0x26, 0xb4, 0x8e, 0x86, 0xe7, 0xdb, 0xb3, 0x3a,
+  0x21, 0x93, 0x52, 0xc7, 0xdd, 0xb6, 0x3b, 0xb6, 0xa9, 0xa5, 0xd3, 0x34, 0x83, 0x74, 0xfc, 0xe1,
+  0xe8, 0x78, 0xf6, 0x00, 0x83, 0xde, 0xd2, 0xbd, 0x3b, 0x5e, 0x40, 0x4e, 0x27, 0xac, 0x11, 0x77,
+  0xec, 0x28, 0x21, 0x84, 0x83, 0xac, 0x2b, 0x86, 0x4a, 0x1f, 0xa6, 0x21, 0x5e, 0xdd, 0x0d, 0xe9,
+  0x5f, 0xef, 0x7c, 0xc2, 0x32, 0xeb, 0x64, 0x08, 0x67, 0x0e, 0x9a, 0x2b, 0x59, 0x86, 0x39, 0xd9,
+  0x28, 0x24, 0xed, 0x2a, 0x0b, 0xfa, 0xa1, 0xcc, 0x68, 0x8c, 0x31, 0x5a, 0x3a, 0x78, 0xff, 0x9e,
+  0x25, 0xcf, 0x3a, 0xd9, 0x9d, 0xdb, 0xad, 0xd4, 0x96, 0xdd, 0x79, 0x53, 0x20, 0x96, 0xe9, 0xd9,
+  0x39, 0x67, 0xae, 0x1d, 0x56, 0xe5, 0x1d, 0x35, 0xf5, 0x04, 0x20, 0x2f, 0x6c, 0x02, 0x28, 0x60,
+  0x86, 0xd6, 0x61, 0x65, 0x05, 0xe3, 0x1b, 0x74, 0xac, 0x61, 0x3e, 0xb6, 0x9c, 0xab, 0x90, 0xef,
+  0x37, 0x87, 0xe5, 0x3b, 0x59, 0xe9, 0x10, 0x98, 0x05, 0x05, 0x23, 0xeb, 0x16, 0xfd, 0x6c, 0xfa,
+  0x4d, 0x59, 0xe7, 0xeb, 0x4d, 0x08, 0xf4, 0x4f, 0xd8, 0xda, 0x90, 0xba, 0x01, 0x10, 0xcf, 0x96,
+  0xaa, 0x4d, 0xa3, 0xb8, 0xd0, 0x37, 0xe9, 0x5c, 0xd0, 0x46, 0xea, 0x98, 0x15, 0x37, 0x19, 0xa9,
+  0xa6, 0xa1, 0xb3, 0x61, 0xa1, 0xdc, 0x02, 0x9e, 0x65, 0xa5, 0xb4, 0x6c, 0x88, 0x27, 0xdf, 0x14,
+  0x4a, 0xe8, 0xe6, 0x6d, 0xfa, 0xe6, 0x14, 0x39, 0xf0, 0xf1, 0xf8, 0xde, 0x42, 0xba, 0x1a, 0x87,
+  0x0e, 0x67, 0x1f, 0x4e, 0xb3, 0xec, 0xed, 0x15, 0x2d, 0x38, 0x68, 0xbe, 0xb4, 0xa0, 0x55, 0x1c,
+  0x61, 0x9c, 0x67, 0xd4, 0x21, 0x32, 0x4b, 0x41, 0x9b, 0x7d, 0xa6, 0x69, 0x9d, 0x69, 0xb1, 0xcd,
+  0xc8, 0xa8, 0x1a, 0xef, 0x55, 0x02, 0x93, 0xce, 0xfc, 0x0f, 0xa5, 0xc0, 0x48, 0xc9, 0xc4, 0x92,
+  0x98, 0x7f, 0x2c, 0x0d, 0x46, 0xc6, 0x26, 0x96, 0xbc, 0x0d, 0xd0, 0x30, 0x9a, 0xa6, 0xc5, 0x84,
+  0xfe, 0x3e, 0x44, 0xd8, 0x12, 0x3a, 0x71, 0xe4, 0xf5, 0x3a, 0x84, 0x2c, 0x3d, 0xa2, 0x1d, 0xac,
+  0xa0, 0xd3, 0xca, 0xdb, 0xf6, 0x4d, 0xdd, 0x90, 0x31, 0xc3, 0x6a, 0x77, 0x48, 0xcc, 0x46, 0xb1,
+  0xf6, 0x7c, 0xde, 0x2f, 0x29, 0xce, 0x06, 0x93, 0xb8, 0xfb, 0xcd, 0x3f, 0x88, 0x24, 0x6f, 0x8f,
+  0x4a, 0xfc, 0x4d, 0xeb, 0x0f, 0xe6, 0x3a, 0xb3, 0xbd, 0x25, 0xd6, 0x56, 0xb7, 0xc6, 0xd8, 0x2c,
+  0x33, 0x9e, 0x1d, 0xdc, 0x27, 0x85, 0x6a, 0xe7, 0x4c, 0xf4, 0x1e, 0xfa, 0xc7, 0x0a, 0x07, 0x77,
+  0xdb, 0x4d, 0xbc, 0x6d, 0xf8, 0x8f, 0x9e, 0x2e, 0x6b, 0xd3, 0x4e, 0x9c, 0x2d, 0x7c, 0x4b, 0x21,
+  0x61, 0x14, 0xad, 0x83, 0xdf, 0x81, 0x4e, 0x73, 0x22, 0x48, 0x9a, 0x87, 0x84, 0x3f, 0x78, 0xe8,
+  0xac, 0x53, 0x45, 0x62, 0x1f, 0x31, 0x02, 0x64, 0x8c, 0xcb, 0xd1, 0xa2, 0xb6, 0xa8, 0x68, 0xbb,
+  0x84, 0x43, 0x15, 0x64, 0x4b, 0x1c, 0x7e, 0x57, 0xed, 0x23, 0xa7, 0x34, 0x0f, 0xa8, 0xbc, 0x07,
+  0x27, 0x76, 0x2e, 0x04, 0xeb, 0xa2, 0xd3, 0xe4, 0x4b, 0x58, 0x96, 0x07, 0x87, 0x34, 0xd3, 0x5d,
+  0xb8, 0xe7, 0xa2, 0x23, 0xf7, 0xb7, 0x95, 0xa6, 0x23, 0x9c, 0x4b, 0x3f, 0x90, 0x09, 0x48, 0x12,
+  0xe1, 0x24, 0xbb, 0x77, 0xc6, 0xe4, 0x8b, 0xce, 0x23, 0xe1, 0xe2, 0x5a, 0xb9, 0x92, 0x77, 0x56,
+  0x77, 0xa0, 0xe7, 0x67, 0x76, 0xf1, 0x70, 0x1f, 0xbb, 0x31, 0xf3, 0xcd, 0x6f, 0x6b, 0xcb, 0x93,
+  0x35, 0xf9, 0xcd, 0x36, 0x3e, 0xc0, 0x73, 0x0f, 0x29, 0xb7, 0xb6, 0x90, 0x58, 0xe6, 0xcd, 0x51,
+  0x7b, 0x91, 0x31, 0xde, 0x9a, 0x64, 0x99, 0xc6, 0x35, 0x5c, 0x44, 0xe4, 0xcb, 0xcf, 0xe2, 0xad,
+  0x1c, 0x65, 0xf5, 0xeb, 0x76, 0x23, 0x6d, 0x35, 0x12, 0x89, 0x6e, 0xed, 0x8c, 0x9e, 0x0d, 0xcb,
+  0x21, 0xd4, 0x69, 0x58, 0x0e, 0x25, 0x0c, 0x69, 0x20, 0x86, 0xd4, 0xeb, 0x60, 0x06, 0x81, 0x9a,
+  0xc1, 0x4c, 0xec, 0xb2, 0x06, 0x18, 0xfb, 0x17, 0x45, 0x7a, 0x95, 0xb2, 0x3c, 0x1d, 0xe6, 0x14,
+  0xf3, 0x06, 0x38, 0x45, 0x97, 0x45, 0x79, 0x5d, 0xf8, 0x9f, 0x31, 0xc3, 0x43, 0x03, 0xb5, 0xbd,
+  0x4b, 0x37, 0xfb, 0xee, 0x94, 0xa0, 0x27, 0xbc, 0xff, 0x51, 0x64, 0x2d, 0xf8, 0x80, 0x39, 0xb3,
+  0x63, 0x33, 0xa6, 0x6e, 0x0c, 0x2f, 0x76, 0xc9, 0x52, 0xa4, 0x16, 0x33, 0xc8, 0xa7, 0x07, 0x1e,
+  0xd5, 0xef, 0xf2, 0x32, 0xe5, 0x98, 0xf9, 0x57, 0x1b, 0x4d, 0xa3, 0x0e, 0xdc, 0xee, 0xf5, 0xa2,
+  0xc4, 0xca, 0x43, 0xf5, 0x21, 0xfd, 0x10, 0x17, 0x8b, 0x19, 0xe6, 0x9e, 0x7a, 0xc0, 0xea, 0x77,
+  0xf0, 0xd6, 0x16, 0xc5, 0x2f, 0x2d, 0x28, 0x60, 0xed, 0xfe, 0x25, 0xe5, 0xd3, 0xde, 0x2c, 0xbd,
+  0x01, 0x53, 0xb6, 0xf8, 0x9b, 0x15, 0xf1, 0xf3, 0x8e, 0x40, 0x7c, 0x5c, 0x70, 0x4d, 0x6e, 0x87,
+  0xec, 0x0e, 0x10, 0xf4, 0x20, 0xb1, 0x0d, 0xdd, 0xc5, 0x02, 0xec, 0xb5, 0xef, 0xd8, 0x0d, 0xcd,
+  0xe2, 0x4c, 0xb0, 0x95, 0x00, 0x7e, 0xf2, 0xf3, 0xf1, 0xe9, 0xeb, 0x1f, 0x2f, 0x8e, 0x5f, 0x7f,
+  0xfc, 0x70, 0xf1, 0xf1, 0x03, 0x24, 0x13, 0xfa, 0xee, 0xdd, 0xbb, 0x37, 0xcf, 0x9e, 0xbe, 0xd3,
+  0xc9, 0x66, 0x9d, 0x1a, 0xef, 0xde, 0x61, 0x95, 0x57, 0x03, 0xf8, 0x5f, 0x74, 0xe0, 0x5c, 0x8c,
+  0x57, 0x35, 0xfd, 0x58, 0x7c, 0x1c, 0x8f, 0x71, 0x08, 0x6c, 0xa3, 0x98, 0x62, 0x06, 0x95, 0xa1,
+  0xba, 0x71, 0x17, 0x10, 0xe6, 0x90, 0xb3, 0xa8, 0x2c, 0x30, 0x03, 0x72, 0xb5, 0xc0, 0x3b, 0x53,
+  0x4c, 0x87, 0x7c, 0x4b, 0xeb, 0xe8, 0xdc, 0xa4, 0x1c, 0x44, 0xd0, 0xd6, 0xc0, 0x55, 0x26, 0xdb,
+  0xe0, 0x59, 0x54, 0x8e, 0xc7, 0xd0, 0x04, 0x6f, 0xb1, 0xe1, 0x0f, 0xcc, 0xab, 0x5c, 0x94, 0x4b,
+  0xda, 0xeb, 0x38, 0x3e, 0x3d, 0x6c, 0x79, 0xee, 0xdf, 0xff, 0x57, 0x35, 0xfd, 0x91, 0xde, 0xbc,
+  0x06, 0xf5, 0xc2, 0xea, 0x29, 0x2e, 0x9d, 0x65, 0x7d, 0xd4, 0xfa, 0x81, 0xf3, 0x30, 0xc0, 0x77,
+  0xf0, 0x2a, 0x00, 0x66, 0x42, 0xb7, 0xcc, 0xfa, 0xbb, 0x2d, 0x95, 0x07, 0x37, 0x11, 0x4e, 0xad,
+  0xf7, 0xf5, 0xff, 0x84, 0x60, 0xec, 0x59, 0x30, 0x64, 0x40, 0x07, 0xdc, 0x25, 0x3c, 0x4f, 0xdc,
+  0xae, 0xc9, 0x05, 0xdd, 0xff, 0xcf, 0xb3, 0x41, 0xf7, 0xfb, 0xb4, 0x3b, 0x7e, 0xd9, 0x7d, 0x77,
+  0xfe, 0xf5, 0xf9, 0xdd, 0xff, 0xea, 0x8b, 0xbc, 0xbe, 0x3c, 0x69, 0xd4, 0x57, 0x6b, 0xee, 0x3b,
+  0x4c, 0xaa, 0xed, 0xcf, 0x9c, 0x93, 0x68, 0x70, 0x32, 0x3c, 0x2d, 0xf5, 0x50, 0x55, 0x1d, 0x32,
+  0xe9, 0x10, 0xc7, 0x58, 0x3a, 0xca, 0xd3, 0x19, 0x5c, 0xed, 0xc4, 0x57, 0x28, 0x19, 0x83, 0x3c,
+  0xbe, 0xf7, 0xec, 0x59, 0x87, 0x5c, 0xd9, 0xd7, 0xe2, 0x15, 0xb0, 0x12, 0x36, 0x8d, 0x2b, 0xe0,
+  0x1c, 0x39, 0xe2, 0xbb, 0xcf, 0x93, 0xde, 0x3c, 0xcd, 0x4e, 0x60, 0x64, 0xe2, 0x3d, 0x9c, 0x6d,
+  0xab, 0xd1, 0x64, 0xa2, 0x1b, 0x4d, 0xd6, 0x6e, 0x34, 0x1c, 0xea, 0x46, 0xc3, 0x35, 0x1a, 0x39,
+  0x23, 0x53, 0x55, 0xe4, 0x31, 0x60, 0x7d, 0x4c, 0x86, 0xc3, 0x00, 0x07, 0x7d, 0x9e, 0x0c, 0x61,
+  0x83, 0x88, 0x4d, 0x96, 0x61, 0x98, 0x87, 0x50, 0xea, 0xc2, 0x47, 0x8f, 0x30, 0x77, 0xa1, 0x8e,
+  0xca, 0x39, 0x34, 0x59, 0xea, 0x25, 0x42, 0x77, 0x9c, 0xa5, 0xf8, 0x82, 0x36, 0x67, 0x83, 0xf3,
+  0xa4, 0x43, 0xec, 0x0f, 0xbb, 0xfe, 0x87, 0xbd, 0xf3, 0x24, 0x71, 0xb3, 0xcd, 0xcc, 0x81, 0xb3,
+  0x0c, 0x23, 0x63, 0xde, 0x44, 0xc9, 0xc8, 0xf2, 0x76, 0xb2, 0x63, 0xae, 0xa8, 0xb0, 0xb2, 0x22,
+  0x0d, 0xf3, 0xe7, 0x87, 0xb9, 0xc5, 0x25, 0x51, 0x0b, 0x2d, 0x6c, 0x7e, 0x36, 0x38, 0x47, 0xa1,
+  0x65, 0x09, 0x33, 0xf1, 0x7d, 0xb7, 0xe5, 0xfb, 0x9e, 0xf8, 0xee, 0x71, 0xdb, 0xb4, 0x3e, 0x2d,
+  0x3f, 0x4f, 0x86, 0xf1, 0xb4, 0x43, 0x6a, 0x9b, 0xc9, 0xa6, 0x53, 0xe0, 0xb0, 0x78, 0x4a, 0xfe,
+  0x37, 0x79, 0xf2, 0x7c, 0x00, 0x6f, 0x1b, 0xe1, 0x3f, 0xf8, 0xcb, 0xb2, 0x3a, 0xa5, 0xbc, 0x4d,
+  0xca, 0xee, 0x0e, 0xe0, 0xfa, 0x30, 0x49, 0x48, 0x9f, 0xec, 0x0e, 0xac, 0x26, 0xe8, 0xb1, 0x90,
+  0x5a, 0x72, 0x1a, 0xcc, 0xfe, 0x23, 0xf2, 0x6f, 0x24, 0xde, 0x25, 0x5d, 0xd1, 0x3c, 0x1d, 0xd6,
+  0x71, 0x3c, 0x9d, 0x92, 0x3e, 0x11, 0x28, 0xf7, 0x48, 0x97, 0xec, 0xda, 0xbc, 0x0c, 0x7b, 0x07,
+  0xd4, 0x1e, 0xa9, 0xdd, 0xb7, 0xda, 0x85, 0x97, 0x2c, 0x3b, 0x64, 0x22, 0xff, 0x1d, 0xe2, 0xbf,
+  0x6a, 0xb8, 0xa7, 0x30, 0xc8, 0x00, 0xea, 0xab, 0xa8, 0x38, 0x3a, 0x10, 0x15, 0x6f, 0x0e, 0x54,
+  0x45, 0x9c, 0x48, 0x1d, 0xf9, 0x86, 0xf5, 0x77, 0xf7, 0x4c, 0x83, 0x1b, 0xd9, 0x60, 0xb4, 0xb4,
+  0xc1, 0xbf, 0x9b, 0x06, 0x03, 0xaf, 0xc1, 0x4d, 0xa8, 0xc1, 0xde, 0xd3, 0x66, 0x03, 0x45, 0xd2,
+  0x28, 0xd4, 0xe0, 0xc9, 0xa0, 0x49, 0xd2, 0x20, 0xd0, 0xc0, 0xeb, 0xe6, 0xc0, 0x25, 0x22, 0xc8,
+  0x5b, 0x38, 0xee, 0x15, 0xbc, 0x10, 0x18, 0xc7, 0xd5, 0x2e, 0x79, 0x4c, 0x66, 0x09, 0xf9, 0x37,
+  0xb2, 0xf7, 0xec, 0x59, 0x22, 0xa7, 0x54, 0x96, 0x4d, 0x96, 0x94, 0x0d, 0x9d, 0xb2, 0x24, 0xb0,
+  0x7c, 0x85, 0xaa, 0xf3, 0x29, 0xbd, 0x05, 0xaf, 0x11, 0x3b, 0x83, 0xb9, 0xbc, 0xbe, 0x43, 0xa3,
+  0xde, 0x57, 0x78, 0xb3, 0x04, 0x5d, 0xf3, 0xf6, 0xc5, 0xc6, 0xd2, 0x21, 0xac, 0xfe, 0x58, 0xe8,
+  0x1f, 0xd3, 0xb4, 0x7e, 0x2d, 0x62, 0x85, 0xe4, 0x07, 0x19, 0x39, 0x84, 0x67, 0x93, 0xbb, 0x83,
+  0xad, 0x4e, 0x72, 0xe5, 0xc2, 0x62, 0xc8, 0x6d, 0x8f, 0x72, 0x08, 0x44, 0xed, 0x1e, 0x50, 0x6e,
+  0x6f, 0x37, 0x5f, 0x61, 0xb7, 0x91, 0x11, 0x5c, 0x3a, 0x4c, 0x4d, 0x77, 0x7c, 0xf8, 0x37, 0x37,
+  0xc8, 0x0c, 0x37, 0x48, 0x95, 0x76, 0x07, 0xe0, 0x41, 0x0d, 0xb8, 0x10, 0xbd, 0x9d, 0xd3, 0x72,
+  0x2c, 0xea, 0xc3, 0xc9, 0xab, 0xc4, 0x44, 0x40, 0x91, 0x9d, 0x64, 0x48, 0xd6, 0x06, 0xe4, 0x9c,
+  0xba, 0x51, 0x8e, 0x89, 0x93, 0x12, 0x48, 0xa2, 0x2e, 0xd4, 0x39, 0x4c, 0x1c, 0x42, 0x74, 0xd3,
+  0xe4, 0xc0, 0x4b, 0x1f, 0x54, 0x16, 0xd6, 0x6b, 0x91, 0x36, 0x20, 0x02, 0x3d, 0xef, 0xa9, 0x49,
+  0xf3, 0xf2, 0xc1, 0x9a, 0x0a, 0x30, 0x89, 0xe0, 0xe9, 0x51, 0xd8, 0x45, 0x77, 0x3b, 0xcd, 0xbf,
+  0x54, 0x0f, 0x70, 0x5e, 0x43, 0x34, 0x4f, 0xd1, 0xf5, 0xcc, 0x3d, 0x52, 0x98, 0x06, 0x3e, 0xdd,
+  0x53, 0x95, 0xb8, 0xa0, 0x41, 0x2f, 0xb6, 0x6c, 0xa5, 0x77, 0x24, 0x4b, 0xa7, 0xea, 0xf1, 0x8b,
+  0xe5, 0x14, 0x3f, 0x70, 0x80, 0x3e, 0x7a, 0x04, 0x93, 0xd4, 0xab, 0x26, 0xc3, 0x8b, 0x75, 0xba,
+  0xa1, 0xf6, 0x35, 0xb7, 0xcd, 0x3f, 0x53, 0x4f, 0xa6, 0xb5, 0x20, 0x0a, 0x7e, 0xbb, 0xfb, 0xad,
+  0x5d, 0x9a, 0xf8, 0xd5, 0xad, 0xfd, 0x77, 0xcf, 0xa5, 0x7d, 0x05, 0xe5, 0x0e, 0xdd, 0x72, 0x8f,
+  0x92, 0x3b, 0xb0, 0x0d, 0xdf, 0xd9, 0xab, 0x9d, 0x82, 0xdd, 0xf3, 0xc4, 0x1a, 0xc0, 0x3b, 0x37,
+  0x85, 0x95, 0xfb, 0xbe, 0xb4, 0xfd, 0xae, 0x96, 0xcd, 0xca, 0xae, 0xd7, 0x9d, 0xbf, 0x52, 0xac,
+  0x35, 0xda, 0xba, 0x3c, 0x96, 0x2c, 0x8c, 0xc0, 0x92, 0x08, 0x52, 0xf2, 0xda, 0x66, 0x9f, 0x76,
+  0xfe, 0xf7, 0xa8, 0x71, 0x58, 0x65, 0xc9, 0x50, 0x07, 0xd9, 0xc3, 0x0a, 0x02, 0x6f, 0xc8, 0xb1,
+  0x6a, 0x32, 0x8c, 0x23, 0x9c, 0x66, 0x2c, 0xa2, 0x45, 0x26, 0x0b, 0x12, 0x23, 0xe0, 0x2c, 0x3a,
+  0x3f, 0x4f, 0x86, 0x3e, 0x8f, 0x0b, 0x90, 0xe6, 0xc5, 0xae, 0x0e, 0xb1, 0x84, 0xa9, 0xd9, 0xe9,
+  0xad, 0x9e, 0x7c, 0x9e, 0x0c, 0x6d, 0xde, 0x59, 0xca, 0x39, 0x5e, 0x87, 0x3e, 0x4f, 0x86, 0x81,
+  0xec, 0x65, 0xc1, 0xd9, 0x46, 0xd6, 0x0d, 0x8c, 0x79, 0xeb, 0x1c, 0x5a, 0x33, 0xa8, 0x3e, 0x5a,
+  0xfb, 0x2b, 0xee, 0x06, 0x8d, 0xf8, 0x36, 0xb9, 0x03, 0x0a, 0x43, 0x9a, 0xf4, 0x3f, 0x67, 0x39,
+  0x66, 0xd6, 0xef, 0x90, 0xda, 0x30, 0x9d, 0x76, 0x48, 0x86, 0x92, 0x46, 0x1e, 0x2c, 0xac, 0xe8,
+  0x10, 0x6e, 0x3e, 0x49, 0xda, 0x7d, 0xd7, 0x18, 0x1d, 0xf0, 0xa5, 0x80, 0x86, 0x1d, 0x45, 0xfd,
+  0x0b, 0x74, 0x19, 0x31, 0xb1, 0xba, 0xa1, 0xa8, 0x18, 0xe9, 0xa7, 0xfb, 0xe4, 0xc0, 0x78, 0x94,
+  0x1e, 0xc9, 0x0f, 0x58, 0xba, 0x4f, 0x5c, 0xa2, 0x55, 0x53, 0x35, 0x7d, 0x9e, 0x06, 0x6d, 0x4c,
+  0x01, 0x1f, 0x8b, 0x44, 0x57, 0x72, 0x41, 0x68, 0x04, 0xa2, 0x78, 0xdf, 0xd3, 0xd3, 0x5b, 0xc2,
+  0xd7, 0xe4, 0x6b, 0x45, 0x12, 0xe2, 0x48, 0xd1, 0x62, 0x45, 0x90, 0xe8, 0x25, 0x6d, 0x08, 0x50,
+  0x25, 0xbe, 0xaf, 0x30, 0xab, 0xbb, 0xe6, 0x69, 0x04, 0x5c, 0x47, 0x81, 0x9a, 0xca, 0x9b, 0xd6,
+  0xa9, 0xac, 0x60, 0xa3, 0x9f, 0x92, 0x37, 0x9d, 0x1a, 0x86, 0xa0, 0xb5, 0xa6, 0xfc, 0x53, 0x55,
+  0xce, 0x69, 0xc5, 0x6f, 0xe3, 0xa8, 0x2b, 0x07, 0xbf, 0x5b, 0x16, 0x5d, 0xe9, 0x0a, 0x63, 0x8f,
+  0x42, 0x90, 0x14, 0x01, 0x46, 0x90, 0xb1, 0x0c, 0x52, 0x6b, 0x36, 0xd5, 0x96, 0x1b, 0x99, 0x4d,
+  0x52, 0xba, 0x2d, 0x73, 0x5e, 0xbb, 0x17, 0x5f, 0x89, 0xfb, 0xf1, 0x94, 0xb8, 0x5f, 0x3f, 0x89,
+  0xfb, 0xf7, 0x92, 0x40, 0x89, 0xe0, 0xde, 0x5c, 0xfa, 0x63, 0x2c, 0xdd, 0x2d, 0x0f, 0xdd, 0x2b,
+  0xcd, 0x2b, 0xfb, 0x91, 0x89, 0x07, 0xb6, 0xc3, 0xa6, 0x43, 0x26, 0x50, 0xb3, 0x84, 0xc0, 0x86,
+  0x97, 0x7d, 0x63, 0xe6, 0xa1, 0x14, 0x21, 0x45, 0xfe, 0x1d, 0x9c, 0x10, 0x6e, 0xee, 0xa6, 0x81,
+  0x41, 0x8a, 0x87, 0xd6, 0xac, 0x1d, 0x59, 0x57, 0x98, 0xc6, 0x2e, 0xae, 0xa4, 0xba, 0x86, 0xe3,
+  0x3e, 0x89, 0xd3, 0x45, 0x52, 0xf0, 0x1e, 0x14, 0x32, 0xcb, 0xfe, 0x00, 0xcf, 0x9d, 0x11, 0x5c,
+  0x7f, 0x87, 0x0f, 0x91, 0x52, 0x28, 0x79, 0xf8, 0x02, 0x2a, 0x61, 0x9d, 0xc7, 0x24, 0xfa, 0xa1,
+  0x0f, 0x95, 0x5e, 0x44, 0xb6, 0xd9, 0x5d, 0x46, 0x6c, 0x58, 0xcc, 0x0e, 0x93, 0xf6, 0x1a, 0xe0,
+  0x98, 0x1e, 0x74, 0x1a, 0xd3, 0x79, 0xd4, 0xb8, 0x51, 0xd4, 0x84, 0x0f, 0xa2, 0xc4, 0x4e, 0xf6,
+  0xe1, 0x86, 0x87, 0x7c, 0xaa, 0xca, 0x19, 0xab, 0x61, 0x5d, 0xd6, 0x65, 0x7e, 0x45, 0x63, 0xff,
+  0x41, 0x2f, 0xfb, 0x35, 0x87, 0x2b, 0xf9, 0xc4, 0xd7, 0x0b, 0x6f, 0xfc, 0x7e, 0xa7, 0x39, 0x6b,
+  0x9d, 0x35, 0x7f, 0x81, 0x00, 0x5a, 0x67, 0xad, 0x1c, 0x79, 0x77, 0xbe, 0xcd, 0x39, 0x14, 0x62,
+  0x5f, 0x39, 0x3f, 0xb6, 0x98, 0xeb, 0xeb, 0x33, 0xc1, 0xa1, 0xe7, 0xe4, 0xe8, 0x08, 0xe7, 0xd7,
+  0xb2, 0xdf, 0x1f, 0x78, 0xb4, 0x6c, 0xc8, 0x43, 0x6d, 0x5c, 0x24, 0x6a, 0xde, 0x0b, 0x1b, 0xfd,
+  0x8e, 0x8c, 0xa4, 0x4f, 0x36, 0xce, 0x73, 0x1a, 0xb4, 0xc2, 0x17, 0xa5, 0xbd, 0x97, 0x8d, 0xed,
+  0x47, 0x8b, 0xdf, 0xa7, 0xf0, 0x74, 0x20, 0xbc, 0xce, 0x68, 0xde, 0x9a, 0xab, 0xf1, 0xa1, 0xe3,
+  0xaa, 0x4a, 0x82, 0x99, 0x3b, 0xc5, 0xe1, 0xe5, 0x9f, 0x49, 0xe6, 0x87, 0xc3, 0x3e, 0xbf, 0x4d,
+  0x1a, 0x9a, 0x18, 0x9b, 0x6f, 0x5d, 0x45, 0x3e, 0x41, 0x32, 0xb8, 0xa3, 0x79, 0xa8, 0xbb, 0x8f,
+  0x75, 0x5f, 0xcb, 0xf3, 0x69, 0x9b, 0xa1, 0xc5, 0x5d, 0x3f, 0xbe, 0x80, 0x5b, 0x7d, 0x2c, 0x3d,
+  0xf8, 0x56, 0x26, 0x13, 0x27, 0x0b, 0x00, 0xbe, 0x68, 0x63, 0x33, 0x9d, 0x24, 0xde, 0x5b, 0x27,
+  0x4d, 0x53, 0xd1, 0x95, 0x67, 0xa0, 0x91, 0x11, 0xb2, 0xb6, 0x41, 0x39, 0xbe, 0x52, 0x69, 0xef,
+  0xd0, 0xf0, 0x63, 0x12, 0xa7, 0x1d, 0x91, 0x2b, 0xb1, 0x80, 0x5c, 0xe4, 0x13, 0xca, 0xdb, 0x97,
+  0xa7, 0x8f, 0x7b, 0x05, 0xa5, 0xda, 0x0a, 0x65, 0x32, 0xef, 0x29, 0x33, 0xb7, 0xd8, 0xc5, 0x85,
+  0x70, 0xc5, 0x37, 0x44, 0xbb, 0x7b, 0x26, 0xb2, 0xd7, 0xa2, 0x72, 0x49, 0xfd, 0xa7, 0x76, 0xb4,
+  0x41, 0xa0, 0x42, 0x26, 0xb2, 0x7e, 0x47, 0x21, 0xfd, 0x23, 0xd4, 0x43, 0x9a, 0x4b, 0xc9, 0x63,
+  0xe9, 0x1e, 0x6e, 0xb8, 0x11, 0x0d, 0x1d, 0x5e, 0x83, 0x3d, 0xe9, 0xb4, 0x50, 0xdc, 0x59, 0x46,
+  0x68, 0xd2, 0xc0, 0x01, 0x47, 0xe9, 0xe5, 0x13, 0x12, 0x7e, 0x59, 0xdd, 0xf3, 0x52, 0xb8, 0x2f,
+  0xd1, 0xd4, 0x1e, 0x53, 0xe8, 0x03, 0xde, 0x4c, 0x82, 0x88, 0x78, 0xc3, 0x83, 0x76, 0x85, 0xcf,
+  0xbc, 0x34, 0x90, 0xd6, 0x2f, 0x31, 0x0a, 0xd1, 0xd6, 0xc4, 0xcc, 0x78, 0x41, 0x8e, 0xf0, 0x94,
+  0x15, 0x75, 0x28, 0x56, 0x11, 0x8c, 0x86, 0x3f, 0xa7, 0xf5, 0xaa, 0x86, 0x62, 0x7a, 0xa2, 0x84,
+  0x10, 0xd8, 0xea, 0x76, 0x23, 0xb2, 0xef, 0x18, 0x92, 0xe4, 0x23, 0xe5, 0x4b, 0x21, 0x80, 0xf7,
+  0x11, 0x02, 0x00, 0x08, 0x7b, 0x5b, 0x40, 0xb8, 0xa4, 0xb7, 0xa2, 0x3d, 0x42, 0x78, 0xb2, 0x05,
+  0x04, 0xe5, 0x1a, 0x84, 0xeb, 0x3c, 0x7a, 0xba, 0x4d, 0x2f, 0xa4, 0x26, 0x2b, 0x68, 0x78, 0xb6,
+  0x05, 0x04, 0x74, 0x6f, 0xd0, 0xe3, 0xf0, 0x3c, 0x52, 0xd2, 0xc6, 0x0f, 0x5e, 0xdb, 0x2a, 0x01,
+  0xa9, 0xe7, 0xdc, 0xbe, 0xb9, 0x5f, 0x7b, 0x63, 0xa7, 0xc3, 0x2c, 0x7f, 0x5b, 0x25, 0x5b, 0xbd,
+  0x5f, 0x67, 0x7d, 0xcb, 0x3b, 0x69, 0x1b, 0xe7, 0x65, 0x37, 0x1f, 0x92, 0x9f, 0x52, 0x44, 0xcb,
+  0x90, 0xad, 0x75, 0xad, 0x35, 0xe0, 0xa3, 0x7c, 0x22, 0x87, 0xad, 0x5b, 0x89, 0x47, 0x8a, 0x31,
+  0x96, 0x8c, 0xca, 0x42, 0xbe, 0x82, 0x6e, 0x06, 0xf2, 0xc8, 0x72, 0x07, 0x76, 0xa2, 0x9f, 0x9c,
+  0xbb, 0x63, 0x79, 0x90, 0x15, 0xaf, 0x99, 0x7f, 0x50, 0xbb, 0x92, 0x78, 0xb4, 0x1d, 0x63, 0xdb,
+  0x62, 0x21, 0xae, 0xe1, 0x65, 0xf5, 0x7d, 0x78, 0xe4, 0x1c, 0x5e, 0x58, 0x97, 0x52, 0x2e, 0xb1,
+  0xcc, 0x21, 0xf8, 0x3c, 0xbd, 0x6d, 0xe8, 0x83, 0xfa, 0x60, 0xd2, 0xf3, 0x68, 0xfb, 0xe0, 0x86,
+  0xd2, 0x3d, 0x4d, 0x0e, 0xec, 0x6b, 0xaa, 0x36, 0x48, 0xdd, 0xf5, 0x20, 0xed, 0xf8, 0x0b, 0x4b,
+  0x3d, 0x0d, 0x8f, 0x91, 0xe2, 0x07, 0x76, 0xb1, 0x30, 0x60, 0xc0, 0x23, 0xc8, 0x13, 0xbc, 0x7e,
+  0x92, 0xef, 0x39, 0x59, 0xde, 0xc4, 0x62, 0x2b, 0x1d, 0x44, 0x76, 0x7a, 0x3e, 0x6f, 0xc9, 0xa2,
+  0xc1, 0x06, 0x5f, 0x77, 0xd7, 0x4f, 0x61, 0xab, 0x4a, 0xcd, 0x07, 0x56, 0x05, 0x64, 0x2d, 0x87,
+  0x93, 0x56, 0x80, 0xb6, 0x04, 0x76, 0x34, 0x3c, 0xcb, 0xac, 0x1a, 0x48, 0xca, 0xdb, 0x06, 0x4e,
+  0xc9, 0x65, 0x8f, 0xc0, 0xc0, 0x00, 0x84, 0xd3, 0x00, 0x07, 0xd1, 0xee, 0xad, 0x46, 0x2b, 0x84,
+  0xf9, 0x46, 0x58, 0x9f, 0x3c, 0x83, 0xff, 0xb5, 0x63, 0x7d, 0xb2, 0x12, 0x2b, 0x6e, 0x00, 0xf7,
+  0x8a, 0xf3, 0xe9, 0x4a, 0x9c, 0x66, 0xcb, 0xb8, 0x57, 0xc4, 0xcf, 0x56, 0x0f, 0xb1, 0x65, 0x33,
+  0x6d, 0xf8, 0x6c, 0x1a, 0xf6, 0x58, 0xde, 0xbc, 0xcb, 0xcb, 0xc9, 0x24, 0xbf, 0x6f, 0xe2, 0x9f,
+  0xaf, 0x24, 0x5e, 0x6e, 0x72, 0x5b, 0x63, 0xdd, 0x91, 0xb2, 0x6f, 0xca, 0x67, 0xb9, 0x59, 0xbc,
+  0xfd, 0x3e, 0x39, 0x06, 0xd1, 0x25, 0x63, 0xa3, 0xd3, 0xdc, 0x97, 0x51, 0x8a, 0x2c, 0x6c, 0xf6,
+  0xf8, 0x90, 0x44, 0x3f, 0x30, 0xa5, 0x90, 0xcf, 0x32, 0x86, 0xd2, 0x0d, 0x53, 0x3d, 0x28, 0x59,
+  0xf3, 0x98, 0x44, 0x44, 0x5b, 0xb6, 0x1f, 0xbe, 0xf8, 0xa1, 0xcf, 0x5e, 0x18, 0xfc, 0xf8, 0xb8,
+  0x3c, 0xec, 0xc5, 0x71, 0xb1, 0xa8, 0xc8, 0x35, 0x2d, 0x0a, 0x93, 0xc7, 0x23, 0xb1, 0x43, 0x44,
+  0x9a, 0x58, 0x33, 0x76, 0xe5, 0x18, 0x02, 0xb0, 0xda, 0x43, 0xc2, 0xb2, 0xc3, 0x87, 0xe8, 0xe1,
+  0x23, 0x0e, 0x8c, 0xe2, 0xa8, 0x08, 0x25, 0x2f, 0xc4, 0x57, 0x40, 0x86, 0x46, 0x82, 0x8c, 0x5d,
+  0x59, 0x84, 0x90, 0x56, 0xa9, 0x70, 0xcf, 0xc1, 0x63, 0xf7, 0x17, 0x3e, 0xb6, 0x54, 0x9b, 0x26,
+  0x47, 0x01, 0xe5, 0xda, 0xb1, 0xb9, 0x6c, 0x65, 0xa8, 0x69, 0x1f, 0x7e, 0x51, 0x37, 0xc2, 0x20,
+  0x64, 0x6f, 0x3b, 0x7e, 0x4c, 0xa2, 0xe0, 0xbc, 0x60, 0x93, 0x87, 0x2f, 0xa4, 0x13, 0xa4, 0x1d,
+  0x39, 0x91, 0x58, 0x88, 0x36, 0xb0, 0xf8, 0x34, 0xa9, 0x34, 0xb3, 0xac, 0x23, 0x2a, 0x1d, 0x2b,
+  0x6b, 0xeb, 0x8e, 0x03, 0x20, 0xec, 0x66, 0x1b, 0xef, 0x3a, 0x64, 0x45, 0xe0, 0x84, 0xac, 0x64,
+  0x36, 0x27, 0xef, 0x66, 0xcc, 0x16, 0x63, 0x78, 0x1f, 0x11, 0x12, 0x4c, 0xab, 0xd6, 0x84, 0x68,
+  0x14, 0x1c, 0x7c, 0x59, 0xf4, 0xa2, 0xa5, 0x4d, 0xf7, 0xb2, 0x28, 0x87, 0xb0, 0x5a, 0x61, 0x00,
+  0xfd, 0xc5, 0xb2, 0x74, 0xc4, 0xb6, 0x18, 0x2d, 0xd5, 0x5f, 0xd0, 0x91, 0x30, 0xcd, 0x10, 0xf4,
+  0xfd, 0xd1, 0x23, 0x62, 0x81, 0x59, 0x2e, 0x0a, 0xdd, 0xa1, 0x5f, 0x33, 0x41, 0x0c, 0x59, 0x27,
+  0x19, 0xcc, 0xd1, 0x1a, 0x19, 0x58, 0x9a, 0xbb, 0xce, 0x52, 0x6b, 0x9d, 0xab, 0x36, 0xb7, 0xa5,
+  0x6f, 0xc1, 0x1e, 0xdb, 0xef, 0x0d, 0x43, 0xdf, 0xeb, 0x23, 0x9e, 0x0e, 0x0f, 0x71, 0x26, 0x45,
+  0x87, 0x1e, 0x61, 0x8b, 0x43, 0x9d, 0x5b, 0x67, 0xed, 0xa7, 0x88, 0x21, 0xdd, 0x56, 0xd3, 0x84,
+  0xd5, 0x8c, 0x02, 0xdf, 0xfe, 0x0d, 0x08, 0x3b, 0xdd, 0xe7, 0xc0, 0x5d, 0x13, 0x8d, 0x87, 0x20,
+  0x36, 0xc2, 0xe3, 0x3f, 0x06, 0x11, 0x48, 0xb1, 0xb9, 0x09, 0x3c, 0xff, 0x4d, 0x08, 0x95, 0x41,
+  0xf3, 0x02, 0x0f, 0xef, 0x5b, 0x81, 0xf4, 0xdf, 0x87, 0x50, 0x9e, 0x5e, 0x38, 0xea, 0xbd, 0xe1,
+  0xe4, 0x42, 0xef, 0xc8, 0x83, 0x1b, 0x71, 0x4e, 0xb4, 0xc3, 0xb5, 0xf4, 0xc0, 0x01, 0x3b, 0xed,
+  0x5a, 0x4f, 0xaa, 0x7d, 0xc3, 0x9b, 0x11, 0x4b, 0xf2, 0x61, 0x7e, 0xdb, 0xc3, 0x11, 0xad, 0xc9,
+  0x2d, 0xef, 0xf3, 0xf5, 0x88, 0x25, 0xef, 0x47, 0xc4, 0xc1, 0x9c, 0x96, 0xcd, 0xd4, 0xf2, 0xa1,
+  0x5a, 0x2f, 0x0e, 0x21, 0xf5, 0xca, 0x51, 0xb8, 0xb0, 0xb9, 0x55, 0xde, 0xcb, 0x3b, 0x14, 0x4b,
+  0x5f, 0xa2, 0x88, 0x5b, 0x92, 0x61, 0x7a, 0x3e, 0x64, 0x47, 0x3a, 0x0f, 0x7e, 0xb0, 0x7a, 0x62,
+  0xac, 0x1d, 0xee, 0x73, 0x02, 0x0e, 0x63, 0x39, 0xce, 0x40, 0xdb, 0xbf, 0x61, 0xd1, 0x9a, 0x3a,
+  0x53, 0xfc, 0xdf, 0xd2, 0x00, 0x39, 0x75, 0x79, 0xd2, 0x46, 0xe2, 0x93, 0x0d, 0x49, 0x0c, 0xbe,
+  0x7a, 0xd1, 0x92, 0x68, 0x73, 0x29, 0xe2, 0xa7, 0xcd, 0xcb, 0xb5, 0x6f, 0x7f, 0x01, 0x63, 0xe9,
+  0x2b, 0x18, 0xdf, 0xc2, 0xc6, 0x3f, 0xe0, 0x64, 0xb6, 0xb3, 0xf1, 0x60, 0x75, 0x87, 0x9f, 0x6d,
+  0xca, 0x0c, 0x6d, 0x8f, 0x6a, 0xac, 0x90, 0x33, 0xf7, 0xf6, 0xb6, 0xc6, 0xca, 0xf7, 0x35, 0xe2,
+  0x66, 0x0a, 0xcf, 0xe5, 0xab, 0xc8, 0xaa, 0x99, 0xac, 0x39, 0x6a, 0xcf, 0x37, 0x1c, 0xb5, 0xf0,
+  0xb3, 0x1c, 0xed, 0x39, 0x3c, 0x7f, 0x97, 0x3c, 0x9e, 0xf7, 0x9a, 0xcb, 0x73, 0xcb, 0x7c, 0x9e,
+  0xeb, 0xe5, 0xf4, 0x34, 0x17, 0xab, 0xf7, 0xfa, 0x0a, 0x91, 0x9e, 0x42, 0xe0, 0x87, 0x5d, 0x5c,
+  0x55, 0xa1, 0x8d, 0xe5, 0x77, 0x7a, 0x83, 0x28, 0x80, 0xbe, 0x65, 0x33, 0xb0, 0x38, 0x70, 0xfb,
+  0x0b, 0x51, 0xa6, 0x6f, 0x41, 0xed, 0x5c, 0x83, 0xe2, 0x86, 0x63, 0x5d, 0x3d, 0x46, 0x8e, 0x3e,
+  0x84, 0xfd, 0xe1, 0xc2, 0xb2, 0xde, 0x1c, 0xfb, 0xf5, 0x57, 0xf2, 0xf5, 0x2e, 0x71, 0x5e, 0xf9,
+  0xb4, 0xde, 0x0c, 0xb5, 0x5f, 0x6c, 0x81, 0xdf, 0xd8, 0x6f, 0x11, 0x96, 0x66, 0x2f, 0x3d, 0xfc,
+  0x6a, 0x2f, 0xa5, 0xf0, 0xd3, 0x67, 0xde, 0x72, 0x74, 0xfd, 0xad, 0x35, 0x3e, 0x77, 0x85, 0x0e,
+  0xf4, 0xab, 0x68, 0x66, 0xcc, 0x0d, 0xce, 0x96, 0x87, 0x4f, 0x0d, 0x8f, 0x2e, 0x7b, 0x0f, 0xdb,
+  0x5c, 0xfa, 0xb7, 0x5d, 0x83, 0xe9, 0x13, 0xee, 0x5a, 0x69, 0x14, 0x75, 0x9a, 0xfc, 0x2d, 0x6f,
+  0x01, 0x96, 0xa4, 0xf9, 0xc4, 0xb8, 0x1e, 0xd3, 0x5e, 0x29, 0x41, 0x04, 0x47, 0xa1, 0xab, 0x5e,
+  0xc3, 0xd6, 0x89, 0x8b, 0xc6, 0xa0, 0x17, 0x8c, 0x43, 0xd7, 0x8d, 0xd3, 0xf2, 0xda, 0x8a, 0x08,
+  0xf4, 0x92, 0x20, 0x83, 0x3e, 0xba, 0xfe, 0xea, 0xd0, 0x58, 0x7d, 0x93, 0x1a, 0xe2, 0x70, 0x4c,
+  0xda, 0x1e, 0x9e, 0xbd, 0x35, 0xf1, 0xe0, 0xa1, 0x64, 0x7b, 0x34, 0x4f, 0xd6, 0x43, 0x03, 0x47,
+  0x8b, 0xed, 0x91, 0x3c, 0x5d, 0x0f, 0x89, 0x3e, 0x51, 0x6c, 0x8f, 0xe9, 0xd9, 0x9a, 0xa3, 0x26,
+  0xb6, 0xc1, 0xed, 0xf1, 0x6c, 0xf1, 0x4e, 0xd5, 0x6a, 0x64, 0xeb, 0xed, 0x16, 0x2a, 0x0c, 0x8c,
+  0x4f, 0x37, 0x4f, 0xba, 0x7d, 0xd4, 0x0c, 0x2c, 0x6f, 0xd9, 0xd7, 0xa0, 0x7e, 0xe8, 0xed, 0x62,
+  0x3f, 0xcf, 0xef, 0x8c, 0xd6, 0x75, 0x3a, 0xa1, 0x1d, 0x52, 0x2f, 0x46, 0x23, 0x8a, 0x97, 0x52,
+  0x18, 0x29, 0x6f, 0x09, 0x83, 0xc2, 0xaa, 0xbf, 0x84, 0xe4, 0xc8, 0xae, 0x27, 0x06, 0xc4, 0xfe,
+  0xe2, 0x3d, 0xe5, 0x2e, 0xf1, 0x36, 0x6a, 0x05, 0xec, 0xc2, 0x8a, 0xb2, 0x23, 0x12, 0x7d, 0xb7,
+  0x3b, 0x18, 0x7e, 0xff, 0xef, 0xbb, 0x78, 0x51, 0xfa, 0x1d, 0x1d, 0x3f, 0x7d, 0xfa, 0x54, 0xb8,
+  0x38, 0x38, 0x20, 0x5a, 0xe7, 0xa7, 0xa6, 0xfc, 0x94, 0xcd, 0x68, 0xb9, 0xe0, 0xb1, 0x8a, 0x15,
+  0x6f, 0x69, 0xe8, 0x8a, 0x92, 0x03, 0x72, 0xd7, 0x81, 0x98, 0xaa, 0x81, 0x90, 0xa1, 0xfd, 0x3e,
+  0xf9, 0x13, 0xad, 0x52, 0x0a, 0xf9, 0xa6, 0xf0, 0x71, 0x6f, 0x4e, 0x40, 0x8e, 0x76, 0x5f, 0xd2,
+  0x22, 0xa3, 0xd5, 0xa2, 0x98, 0xd0, 0x82, 0x5c, 0xd1, 0xea, 0x97, 0x92, 0x4e, 0x68, 0x05, 0x87,
+  0xa2, 0x9a, 0xbc, 0xcb, 0xd3, 0x7a, 0x7a, 0x20, 0x3c, 0x5d, 0x7e, 0xa2, 0x15, 0xe0, 0xa1, 0x05,
+  0xa9, 0xcb, 0x71, 0x59, 0x71, 0x32, 0xa6, 0x35, 0xd7, 0xcf, 0x84, 0xef, 0x5c, 0xb3, 0x22, 0x2b,
+  0xaf, 0x03, 0x61, 0xee, 0xf3, 0x74, 0x42, 0xa7, 0x2c, 0x73, 0xd3, 0x10, 0x88, 0x77, 0xb4, 0xe4,
+  0xc2, 0x2b, 0x2b, 0x38, 0xd4, 0x66, 0xaf, 0x68, 0x3a, 0x82, 0x0c, 0xce, 0x68, 0x8e, 0x19, 0x95,
+  0xc5, 0x98, 0x4d, 0xfa, 0xa3, 0x72, 0x36, 0x43, 0x93, 0xac, 0x1f, 0xd2, 0x80, 0xf9, 0xd8, 0xc0,
+  0xbc, 0x9e, 0xca, 0xd8, 0x78, 0x18, 0xa1, 0xca, 0x7e, 0x9f, 0x1b, 0x02, 0x15, 0xd4, 0x0b, 0xdd,
+  0xfa, 0xef, 0x3d, 0x13, 0x46, 0x65, 0x78, 0x2b, 0x14, 0x65, 0xaf, 0x1d, 0x2b, 0x5c, 0xf8, 0xf2,
+  0x69, 0x66, 0xdc, 0xd9, 0xd4, 0x9c, 0x84, 0x6a, 0xc0, 0xb4, 0x05, 0xbe, 0x8b, 0x64, 0xc6, 0xee,
+  0x64, 0xd6, 0x58, 0x25, 0xa7, 0x56, 0xba, 0x87, 0x0e, 0xd9, 0x7b, 0x36, 0xf0, 0xa3, 0x66, 0x29,
+  0xb6, 0x5c, 0x33, 0xc1, 0xf8, 0x6a, 0xbf, 0x8f, 0x2d, 0xed, 0x4e, 0xf2, 0xd8, 0xb4, 0xad, 0x35,
+  0xe9, 0x9b, 0xde, 0x13, 0xfd, 0xb6, 0x57, 0x44, 0x9d, 0x3b, 0xc3, 0xb3, 0x55, 0xe9, 0x13, 0xef,
+  0x27, 0x6f, 0xe2, 0x8a, 0x24, 0x89, 0x8e, 0x90, 0x3c, 0xd7, 0x27, 0x84, 0x7a, 0x31, 0xde, 0x2e,
+  0xb7, 0x61, 0xbd, 0x18, 0x37, 0x93, 0x1b, 0x6a, 0x95, 0x0d, 0xc1, 0xc2, 0x26, 0xe2, 0x52, 0x01,
+  0x42, 0xd9, 0x2a, 0x6a, 0x9e, 0xae, 0x41, 0x80, 0x0d, 0x22, 0x6d, 0xb1, 0xb9, 0xb3, 0x93, 0x96,
+  0xdd, 0x97, 0xe2, 0xb4, 0x86, 0xca, 0xa4, 0xd4, 0x22, 0x79, 0xb1, 0x52, 0x6d, 0x88, 0x54, 0xa7,
+  0x5b, 0xc3, 0x4b, 0x90, 0x0a, 0xb1, 0xe0, 0x3f, 0x1e, 0x7b, 0x89, 0x03, 0xa6, 0x4a, 0x05, 0xf2,
+  0x13, 0xab, 0xd9, 0x90, 0xe5, 0x26, 0x0d, 0x28, 0xf8, 0x79, 0x09, 0x38, 0x2d, 0x1b, 0x98, 0x2c,
+  0x6d, 0xb1, 0xc4, 0xde, 0x4b, 0xda, 0x7b, 0x67, 0x63, 0x74, 0xa4, 0x47, 0xcd, 0x72, 0xb1, 0x4d,
+  0x89, 0x8d, 0xfb, 0xbe, 0xbc, 0xc3, 0xc6, 0x32, 0x99, 0x3f, 0xf8, 0x05, 0xd2, 0x6b, 0xa2, 0x73,
+  0xfb, 0x23, 0x91, 0xaa, 0xb0, 0x97, 0xce, 0xe7, 0xb4, 0xc8, 0xe2, 0x88, 0xa7, 0xc3, 0xc8, 0xe4,
+  0x48, 0x6f, 0x14, 0xa3, 0x16, 0x10, 0x75, 0xc2, 0xce, 0xa4, 0x4d, 0x60, 0x98, 0xec, 0x74, 0x2b,
+  0x69, 0xd5, 0x02, 0x50, 0x64, 0x56, 0xdd, 0x4e, 0x82, 0xb5, 0xf4, 0x48, 0x99, 0xb3, 0x37, 0x00,
+  0x6b, 0x8b, 0xb6, 0x30, 0x54, 0x65, 0xc7, 0x8e, 0x3a, 0x10, 0xe7, 0x25, 0x02, 0x04, 0xb7, 0x92,
+  0x7d, 0x49, 0x72, 0xbf, 0xaa, 0x50, 0xab, 0x7a, 0xa2, 0x74, 0xc6, 0x46, 0x57, 0x3c, 0x51, 0xbb,
+  0xb5, 0xa9, 0x5d, 0xeb, 0x86, 0x6d, 0x18, 0x84, 0xec, 0xde, 0xd2, 0xde, 0xbe, 0x12, 0xba, 0xd9,
+  0x0a, 0xb6, 0x32, 0x92, 0xac, 0x89, 0xc5, 0xde, 0x5d, 0xb6, 0xb4, 0x87, 0x38, 0x98, 0xee, 0x96,
+  0xaa, 0x7a, 0x62, 0xce, 0x9a, 0xb4, 0xd8, 0x9b, 0xda, 0x96, 0xf6, 0xeb, 0x24, 0xe0, 0x7c, 0xe1,
+  0x69, 0x80, 0x2d, 0xd8, 0xad, 0x3d, 0x74, 0x2b, 0xc3, 0xf4, 0x0a, 0xcc, 0x81, 0xe7, 0x97, 0x4f,
+  0xd1, 0x96, 0x2c, 0xe1, 0x7f, 0x93, 0x1d, 0xda, 0x03, 0xa9, 0x16, 0x5b, 0x03, 0xc7, 0x51, 0xe3,
+  0x93, 0xf1, 0x07, 0x78, 0xfb, 0xfe, 0xed, 0x5f, 0xde, 0x7e, 0x38, 0xbd, 0xf8, 0xf0, 0xf1, 0xf4,
+  0xe2, 0xdd, 0xc7, 0x2f, 0x1f, 0xde, 0x58, 0xc6, 0x32, 0xf0, 0x43, 0xcf, 0xcb, 0x49, 0x1c, 0x9d,
+  0xbd, 0x79, 0xfb, 0xea, 0xcb, 0x9f, 0xce, 0xc9, 0x07, 0x49, 0x07, 0x11, 0xc0, 0x48, 0x97, 0x48,
+  0x78, 0xe0, 0x83, 0xee, 0xe3, 0xe8, 0x90, 0x08, 0x29, 0x72, 0xca, 0x7e, 0x12, 0xd9, 0xa2, 0xa2,
+  0x4f, 0xd8, 0x39, 0x28, 0x92, 0xee, 0x73, 0x07, 0xe1, 0xe9, 0x69, 0x64, 0x83, 0xf6, 0x40, 0xad,
+  0x64, 0xbc, 0x67, 0x4b, 0x85, 0x85, 0x7b, 0x66, 0xda, 0xda, 0x5e, 0xee, 0x19, 0xd8, 0xee, 0xc1,
+  0x26, 0xde, 0x46, 0xaa, 0x3c, 0xcd, 0x69, 0x14, 0x47, 0x9e, 0xb9, 0xdc, 0x89, 0x8a, 0x5a, 0x43,
+  0xb5, 0x37, 0x29, 0x61, 0x27, 0xdf, 0x96, 0xa1, 0xd6, 0x01, 0xf5, 0xa5, 0xda, 0xee, 0xbc, 0xe4,
+  0x00, 0xf9, 0xb4, 0x95, 0xfa, 0xaf, 0xc0, 0x80, 0xbe, 0x36, 0x66, 0x45, 0x9a, 0x4b, 0x30, 0x0a,
+  0xe0, 0x91, 0xfa, 0x2b, 0xe0, 0x12, 0x23, 0x52, 0xac, 0xa9, 0x81, 0x78, 0xf4, 0xc8, 0x8c, 0x4a,
+  0xcf, 0xe4, 0xba, 0x70, 0x92, 0xd2, 0xc9, 0x4a, 0xd0, 0x5f, 0xfd, 0x57, 0x28, 0xbd, 0xbe, 0xfb,
+  0x92, 0x35, 0xf1, 0x29, 0xf3, 0x5b, 0x79, 0xf6, 0x7d, 0x41, 0x70, 0xe2, 0x51, 0x7e, 0x68, 0xa0,
+  0xb8, 0x76, 0xcc, 0xd0, 0xb1, 0xc1, 0xca, 0x8c, 0x6e, 0x9a, 0xb5, 0x73, 0x5b, 0x30, 0x57, 0xfa,
+  0xd6, 0xa7, 0x6e, 0x77, 0x8f, 0x08, 0x39, 0x43, 0x44, 0x1d, 0x48, 0xe7, 0x48, 0xf9, 0xb4, 0xcc,
+  0xf6, 0xa3, 0x4f, 0x1f, 0x4f, 0x4e, 0xa3, 0x0e, 0x19, 0x96, 0xd9, 0xed, 0xbe, 0x3e, 0x0e, 0xde,
+  0x6d, 0xed, 0x0f, 0xa1, 0x6d, 0xf5, 0xd2, 0x48, 0xe2, 0x27, 0xf8, 0x78, 0x20, 0x4e, 0xb2, 0x49,
+  0xfb, 0x03, 0x4f, 0x13, 0x5a, 0xcf, 0x29, 0x1b, 0x4d, 0xc1, 0x54, 0xf1, 0x88, 0xbc, 0x61, 0xf5,
+  0x3c, 0x4f, 0x6f, 0x49, 0x7a, 0xc9, 0x17, 0x69, 0xce, 0x6a, 0x78, 0xba, 0xea, 0x81, 0x7d, 0x1f,
+  0xe2, 0xdb, 0xa2, 0x83, 0xa7, 0x4f, 0xc9, 0xa5, 0x65, 0x9a, 0xbd, 0x4f, 0x6f, 0x41, 0x43, 0x6f,
+  0xb7, 0x8a, 0x37, 0xe9, 0x12, 0x51, 0x41, 0xfb, 0xe8, 0xa3, 0x25, 0xfa, 0x86, 0xe1, 0x42, 0x68,
+  0xf3, 0xfa, 0x52, 0x0c, 0xe9, 0x65, 0x5a, 0xc0, 0xde, 0x1c, 0xbe, 0x82, 0x71, 0xc3, 0x8e, 0xa4,
+  0x61, 0xa0, 0x81, 0xe2, 0x03, 0xe5, 0xbf, 0x5c, 0xd3, 0xea, 0x72, 0x6c, 0x05, 0x20, 0x9d, 0xc8,
+  0x51, 0x30, 0xef, 0x72, 0xb5, 0xa4, 0xdb, 0x8a, 0x2b, 0xcc, 0x32, 0xe0, 0xa6, 0xa3, 0x8a, 0xa3,
+  0x01, 0xfe, 0x1f, 0xa6, 0xa6, 0x9a, 0x0c, 0x9d, 0x64, 0x56, 0x49, 0xaf, 0xce, 0xd9, 0x88, 0xc6,
+  0xdd, 0xe7, 0x60, 0x7e, 0xb1, 0x32, 0x2a, 0xa9, 0xd3, 0xa8, 0xc8, 0xc1, 0xa0, 0x00, 0xea, 0x6c,
+  0x4c, 0x53, 0x7a, 0x63, 0x12, 0xdd, 0x7d, 0x27, 0x14, 0xa6, 0x0e, 0xd9, 0x15, 0x50, 0x6c, 0x83,
+  0x06, 0x98, 0x9d, 0xf0, 0xad, 0xb0, 0xaa, 0xb4, 0xde, 0x0a, 0x53, 0x4e, 0x3a, 0x2c, 0x07, 0xeb,
+  0x9e, 0x1d, 0x24, 0x66, 0xd9, 0xf6, 0x96, 0xea, 0xc3, 0x4b, 0xae, 0x69, 0xc2, 0xa1, 0x3f, 0x30,
+  0x5b, 0x35, 0xe5, 0xe2, 0xb5, 0x15, 0xf5, 0xe8, 0x97, 0x19, 0x0b, 0xed, 0xc6, 0x3e, 0xc2, 0xe8,
+  0xcf, 0x33, 0xe1, 0xad, 0x7d, 0x6e, 0x5e, 0xbb, 0x80, 0x97, 0x74, 0x2c, 0x8f, 0x92, 0x51, 0x5e,
+  0xf7, 0xe6, 0x8b, 0x7a, 0xea, 0xba, 0x36, 0x1b, 0xb9, 0xef, 0xd4, 0xdf, 0x73, 0xea, 0x1b, 0x9f,
+  0xe4, 0x96, 0xea, 0x4f, 0xec, 0xea, 0xda, 0x99, 0xb8, 0xa5, 0xf2, 0x53, 0xbb, 0xb2, 0xeb, 0x05,
+  0xdc, 0xd2, 0x42, 0xdf, 0x54, 0x5b, 0x34, 0x35, 0x9c, 0x78, 0xb1, 0x89, 0x73, 0xf7, 0xdb, 0xec,
+  0x78, 0xd3, 0x75, 0xf7, 0xae, 0x0d, 0xe7, 0x73, 0xbb, 0xa1, 0xe5, 0x75, 0x8b, 0xd5, 0x4d, 0x89,
+  0xe5, 0xc6, 0xae, 0x22, 0xa9, 0xa4, 0xf7, 0x3c, 0xd4, 0xf9, 0x5b, 0xc9, 0x8a, 0x38, 0x22, 0xf6,
+  0x9b, 0xc1, 0x36, 0x8e, 0x01, 0x9a, 0x42, 0x42, 0x3e, 0xf5, 0xbc, 0x4a, 0x8b, 0x7a, 0x9e, 0x82,
+  0x30, 0x88, 0x96, 0x0c, 0xcc, 0x6e, 0x1b, 0x00, 0xac, 0xa6, 0x7d, 0x8e, 0x8e, 0x48, 0xdc, 0x5c,
+  0x58, 0x4e, 0x95, 0xb6, 0x25, 0x86, 0xb7, 0xe2, 0xb6, 0x89, 0x0a, 0x09, 0xf9, 0x23, 0x70, 0x5a,
+  0x4e, 0xcb, 0x5b, 0x84, 0x7c, 0x08, 0x66, 0x68, 0x38, 0xc9, 0x78, 0xdc, 0x62, 0x4f, 0xc4, 0x57,
+  0x82, 0x0f, 0x36, 0x39, 0xe1, 0x07, 0x52, 0x0c, 0x5a, 0x42, 0xb6, 0xe9, 0x28, 0x4d, 0xba, 0x26,
+  0x2a, 0xd1, 0xc4, 0x7f, 0xec, 0xa8, 0x83, 0x85, 0x15, 0x7d, 0x21, 0x70, 0x7a, 0x5e, 0x66, 0xed,
+  0x49, 0x25, 0xef, 0x29, 0x48, 0xe4, 0x5e, 0xc3, 0x44, 0x42, 0xbe, 0xe3, 0xd6, 0xa0, 0xb0, 0x31,
+  0xa1, 0x37, 0xac, 0xe6, 0x32, 0x72, 0x36, 0xe4, 0x40, 0xfe, 0xed, 0x2e, 0xe4, 0xda, 0x77, 0x7b,
+  0x95, 0x1b, 0xb9, 0x3d, 0xd1, 0x58, 0x0f, 0x9f, 0x36, 0x52, 0xbf, 0x74, 0x1a, 0xb1, 0xaf, 0x2b,
+  0xbd, 0x9c, 0x7d, 0x27, 0xf3, 0xa0, 0x20, 0x6f, 0x3a, 0x9d, 0x6b, 0xbc, 0x8f, 0x3d, 0x9f, 0x64,
+  0x43, 0xbf, 0xe0, 0x5d, 0x11, 0x05, 0xda, 0xc2, 0x9a, 0x96, 0x2f, 0xa0, 0x1d, 0xae, 0x1f, 0x79,
+  0x0e, 0xd4, 0x36, 0xc3, 0x2b, 0x6f, 0xe7, 0xf6, 0xd0, 0x7e, 0x7b, 0x03, 0x3b, 0x6b, 0x36, 0xb5,
+  0x82, 0xfd, 0xed, 0xc2, 0x46, 0xe0, 0xbf, 0xe3, 0x4d, 0x6e, 0xd7, 0x6c, 0x7a, 0x05, 0xde, 0x83,
+  0x0f, 0x79, 0xfb, 0xb0, 0x4b, 0x9f, 0x72, 0xf8, 0x78, 0x0f, 0xc9, 0x03, 0x02, 0xf3, 0x15, 0x9e,
+  0x9a, 0x67, 0x9a, 0xa3, 0x42, 0xdb, 0xce, 0x6a, 0xbe, 0x6a, 0x38, 0x6a, 0xb7, 0xf7, 0x70, 0x4b,
+  0xc7, 0x6d, 0xa2, 0x25, 0x58, 0xd0, 0x6b, 0xfb, 0xae, 0x69, 0x88, 0xc5, 0x57, 0x44, 0xc5, 0xa3,
+  0xaf, 0xd0, 0xbb, 0xa0, 0x89, 0x56, 0x1c, 0x5c, 0x9a, 0x91, 0xc3, 0x4d, 0xf7, 0xee, 0xb6, 0xe1,
+  0x72, 0xf9, 0xd4, 0xc9, 0x00, 0xde, 0x1e, 0x4f, 0xbf, 0x16, 0xd3, 0xaa, 0x13, 0x41, 0x5b, 0x7c,
+  0x3d, 0x04, 0x5d, 0x9b, 0xc8, 0xfa, 0x3b, 0x79, 0x03, 0x89, 0xea, 0x45, 0x8e, 0xa7, 0x6b, 0x92,
+  0xa7, 0xb4, 0x86, 0x34, 0xc0, 0x94, 0x56, 0xb4, 0xff, 0x46, 0x84, 0x4a, 0x77, 0xdf, 0xd1, 0x3c,
+  0xa3, 0x20, 0x64, 0x26, 0xfb, 0x24, 0x5d, 0x8c, 0x49, 0x96, 0xd6, 0x68, 0x70, 0x4e, 0x39, 0xb9,
+  0x2a, 0x0b, 0x62, 0xd4, 0x13, 0x28, 0x1d, 0x2f, 0x68, 0x9e, 0xd3, 0xc2, 0x1c, 0x2a, 0xe9, 0xcd,
+  0x3c, 0x2d, 0xe4, 0xe9, 0x5d, 0x98, 0xc5, 0xed, 0x53, 0x23, 0xb4, 0x23, 0x87, 0xe4, 0x23, 0x26,
+  0x15, 0xec, 0xa5, 0x75, 0xcd, 0x26, 0x45, 0x2c, 0x5d, 0xdf, 0x6f, 0xe7, 0x74, 0x1f, 0x32, 0x6b,
+  0xa2, 0x20, 0xd9, 0x47, 0x43, 0xbf, 0xde, 0x40, 0xc4, 0x4f, 0xb5, 0x9b, 0x62, 0x35, 0x67, 0x40,
+  0x44, 0xb9, 0xb5, 0x22, 0xf1, 0x83, 0x4c, 0x2b, 0xee, 0x2c, 0xe8, 0x7d, 0xd2, 0xdd, 0xd5, 0x35,
+  0xcd, 0x76, 0x29, 0x40, 0x1a, 0x13, 0x9a, 0x00, 0xa8, 0xed, 0x5a, 0x06, 0x9c, 0xd1, 0x19, 0x25,
+  0x89, 0x4d, 0xd5, 0x6e, 0x9f, 0xec, 0x0e, 0x60, 0xc0, 0x3b, 0x44, 0xec, 0xc2, 0x81, 0x65, 0xb3,
+  0x92, 0x5f, 0x9c, 0xf4, 0xd7, 0xbb, 0x70, 0x03, 0xb4, 0x4b, 0xf6, 0x85, 0x9b, 0xb9, 0xca, 0xa8,
+  0xcc, 0xfc, 0x07, 0xdc, 0x6c, 0xb5, 0xa9, 0xe1, 0x5d, 0x2f, 0x66, 0x3c, 0x82, 0xcd, 0x62, 0x89,
+  0xb6, 0x28, 0x8a, 0x24, 0x77, 0x78, 0x37, 0x60, 0x70, 0x7f, 0x3a, 0x80, 0x29, 0xad, 0xc5, 0xa5,
+  0xae, 0xf9, 0x73, 0x0f, 0xff, 0x3c, 0xc7, 0xb7, 0x20, 0xa1, 0x65, 0x6f, 0x52, 0xb1, 0xac, 0xee,
+  0xcd, 0xd2, 0x79, 0x0c, 0x7f, 0x01, 0x20, 0xf8, 0x17, 0x3f, 0xf8, 0xfc, 0xa1, 0x52, 0xb1, 0x69,
+  0xe0, 0xf2, 0x9a, 0x43, 0xff, 0xd6, 0xc5, 0xbb, 0x5e, 0xf1, 0xae, 0x5b, 0xbc, 0xe7, 0x15, 0xef,
+  0x59, 0xc5, 0x42, 0xd3, 0x79, 0x09, 0x5e, 0xba, 0x39, 0xad, 0xed, 0x33, 0x47, 0x63, 0xd1, 0xab,
+  0x77, 0x1d, 0x5d, 0x43, 0x10, 0xc7, 0x07, 0x87, 0x5d, 0xd9, 0xe1, 0x59, 0xb7, 0x56, 0x47, 0x63,
+  0xdc, 0x4b, 0x3c, 0x86, 0xc1, 0x28, 0x24, 0xd0, 0x29, 0x5b, 0x1a, 0xcb, 0xbc, 0x5e, 0x06, 0x11,
+  0x35, 0x1a, 0x06, 0x64, 0x62, 0x81, 0x5f, 0xee, 0x3f, 0x27, 0xde, 0x01, 0xd8, 0xd9, 0x2a, 0x63,
+  0x87, 0x60, 0x83, 0xb6, 0x5c, 0x1d, 0xfe, 0xac, 0x09, 0xbf, 0x05, 0x9b, 0x4f, 0xf4, 0x85, 0x6d,
+  0x2c, 0x94, 0x55, 0x96, 0xdd, 0x24, 0x82, 0xa9, 0x1b, 0x9a, 0x2d, 0x5c, 0x8a, 0x41, 0xee, 0x08,
+  0x96, 0x69, 0xd5, 0xb6, 0x91, 0x03, 0x45, 0xac, 0x56, 0x9b, 0xd3, 0x36, 0x44, 0xb0, 0xbb, 0x26,
+  0x82, 0xbd, 0x6d, 0x11, 0xec, 0xad, 0x46, 0x20, 0xa4, 0xfc, 0x87, 0x45, 0x25, 0xdf, 0x0d, 0x2f,
+  0x48, 0x41, 0x17, 0xe4, 0x17, 0xb0, 0x51, 0x14, 0xb4, 0x80, 0x94, 0x46, 0x15, 0x2d, 0x88, 0x78,
+  0x59, 0x91, 0xd4, 0x6c, 0x34, 0x25, 0x13, 0x9a, 0x22, 0x36, 0x4e, 0xa6, 0x29, 0x27, 0xf1, 0xf1,
+  0x9b, 0x9a, 0x5c, 0x96, 0xb3, 0x19, 0x2d, 0x44, 0x7e, 0xf8, 0x51, 0x5a, 0xd3, 0xc4, 0x4b, 0xf2,
+  0x01, 0x0f, 0x2d, 0x0a, 0x94, 0x32, 0xf5, 0x4b, 0x87, 0x48, 0x83, 0x83, 0xb9, 0xf2, 0x74, 0x3e,
+  0x90, 0x06, 0xad, 0x2a, 0xfb, 0xd1, 0xd2, 0x25, 0xea, 0x26, 0xaf, 0x72, 0xb7, 0x0d, 0x1f, 0xa0,
+  0xcc, 0x30, 0x52, 0xdb, 0x8f, 0xf3, 0xe1, 0xf3, 0x1b, 0x99, 0xbc, 0x35, 0x3d, 0xa1, 0x3c, 0x96,
+  0x20, 0x2e, 0xe9, 0xad, 0xa2, 0x5c, 0x4c, 0xca, 0xd9, 0x99, 0x62, 0x10, 0x87, 0xc1, 0xce, 0x3b,
+  0xe4, 0x4c, 0x4d, 0xac, 0xc3, 0x18, 0xaa, 0x60, 0x2f, 0xea, 0xb8, 0x13, 0x7a, 0x6e, 0xbc, 0x08,
+  0xe2, 0x33, 0xfd, 0xf4, 0x7a, 0x7d, 0x6e, 0x3d, 0x74, 0x81, 0x1f, 0xda, 0x26, 0xfe, 0xeb, 0xd2,
+  0x83, 0x2e, 0x9e, 0x53, 0x44, 0xa7, 0x20, 0x75, 0x5f, 0xa0, 0x86, 0xab, 0x5c, 0x39, 0x6e, 0xa7,
+  0xad, 0xf6, 0x9e, 0x25, 0x0c, 0xd5, 0xf4, 0x05, 0xd5, 0x1e, 0xa1, 0xfd, 0x3e, 0x79, 0x97, 0xe6,
+  0x39, 0xe8, 0xc5, 0xa4, 0x9c, 0x16, 0x94, 0xfc, 0x4c, 0x87, 0x27, 0xe5, 0xe8, 0x92, 0xf2, 0x7d,
+  0xe0, 0x9f, 0x79, 0x4e, 0x39, 0xa7, 0x15, 0x79, 0x39, 0xac, 0x16, 0x63, 0x92, 0xe6, 0x39, 0x25,
+  0xcf, 0x48, 0xed, 0xee, 0x56, 0x36, 0xaa, 0xc0, 0x9e, 0x65, 0xef, 0xd2, 0x75, 0xb4, 0xb6, 0xa9,
+  0xd3, 0xe4, 0x2f, 0x6a, 0xe3, 0x55, 0xf1, 0xaa, 0xe4, 0x76, 0x79, 0x86, 0x2a, 0x2b, 0x99, 0x15,
+  0x6d, 0x91, 0x5c, 0xa3, 0xb2, 0x28, 0xe8, 0x88, 0x5b, 0x98, 0x1d, 0x1f, 0x59, 0xf0, 0xdd, 0xb2,
+  0x44, 0x36, 0x98, 0x74, 0xb5, 0x05, 0x0c, 0x66, 0xe0, 0x53, 0x59, 0x71, 0x6d, 0x2b, 0xc3, 0xda,
+  0x90, 0xd6, 0x49, 0xfa, 0x77, 0xe9, 0x51, 0xb6, 0x13, 0x46, 0x3e, 0x10, 0xcd, 0x60, 0xf5, 0xcc,
+  0x68, 0x95, 0x10, 0xe7, 0xa7, 0xf0, 0x79, 0x52, 0x8f, 0xa1, 0xc4, 0xfe, 0xc0, 0x77, 0xc8, 0x33,
+  0xe1, 0xa1, 0xa6, 0x4c, 0xaf, 0xee, 0xac, 0x84, 0x16, 0x22, 0xb2, 0x09, 0x12, 0x21, 0x97, 0x96,
+  0x26, 0x2a, 0x8e, 0xae, 0xeb, 0xfd, 0x7e, 0x1f, 0x76, 0x9a, 0xbc, 0x94, 0xde, 0x71, 0xd3, 0xb2,
+  0xe6, 0x85, 0x54, 0x73, 0xf7, 0xd1, 0x55, 0x17, 0xba, 0xf4, 0x98, 0x44, 0x7d, 0x99, 0xcc, 0x53,
+  0x43, 0xeb, 0x95, 0x45, 0x39, 0xa7, 0xe0, 0x2b, 0x68, 0x3f, 0x0c, 0x83, 0x8f, 0x92, 0xb8, 0xfd,
+  0xfb, 0x2a, 0xcc, 0xc9, 0xa6, 0x4f, 0x4e, 0xf1, 0x41, 0xa3, 0xff, 0x98, 0xf5, 0x5e, 0x6c, 0x55,
+  0x0d, 0x8c, 0xd2, 0xa1, 0x10, 0x90, 0xd2, 0x2b, 0x0b, 0x2d, 0xa8, 0xa0, 0xb3, 0x7a, 0xa2, 0x5a,
+  0x9b, 0xc4, 0xda, 0xf2, 0xab, 0x95, 0x4c, 0x9b, 0x5e, 0xe1, 0xfc, 0xf9, 0x4e, 0x72, 0x6a, 0xd4,
+  0x2c, 0xad, 0xea, 0x01, 0xb4, 0x85, 0xd9, 0x9c, 0xd5, 0x93, 0x9e, 0x14, 0x40, 0x4e, 0x8c, 0xac,
+  0xcf, 0xb2, 0xa6, 0x5e, 0x07, 0xf0, 0x9a, 0x23, 0x63, 0x54, 0x17, 0xe9, 0xbc, 0x9e, 0x96, 0xf2,
+  0xa6, 0xa9, 0xd9, 0xaf, 0x51, 0x5e, 0xd6, 0xd4, 0x1b, 0x4a, 0x77, 0xe2, 0x74, 0xb7, 0x42, 0x2c,
+  0xa4, 0x35, 0xf1, 0x6d, 0x59, 0xa9, 0x9d, 0x99, 0xee, 0xd4, 0x7b, 0x3f, 0xca, 0x0f, 0xaf, 0xb1,
+  0x5e, 0x2c, 0x40, 0x77, 0xb8, 0xb4, 0x60, 0x32, 0xb2, 0x2a, 0x9d, 0x9c, 0x94, 0x8b, 0x6a, 0x44,
+  0x35, 0xf1, 0xea, 0xb3, 0xd4, 0x7b, 0xf4, 0x77, 0x6b, 0x29, 0x56, 0x54, 0x78, 0xf5, 0x4c, 0xb4,
+  0xbf, 0x0f, 0xcb, 0xa9, 0xfb, 0xd8, 0x45, 0x59, 0xa8, 0x9c, 0x47, 0xfe, 0xcb, 0xb3, 0xd6, 0xe3,
+  0x16, 0xe2, 0x16, 0x10, 0x2b, 0x4d, 0x28, 0x7f, 0x05, 0x86, 0x40, 0x56, 0x4c, 0x5e, 0xe7, 0x8c,
+  0x16, 0xfc, 0x33, 0xf8, 0xeb, 0x8a, 0xca, 0xd0, 0x5e, 0x5a, 0x0c, 0xe7, 0x65, 0xcd, 0xa4, 0xeb,
+  0x6b, 0x94, 0x0e, 0xeb, 0x32, 0x5f, 0x70, 0x91, 0x62, 0xc4, 0xae, 0xc4, 0xcb, 0x39, 0x9a, 0x38,
+  0xbe, 0xff, 0xfe, 0xfb, 0xef, 0xe7, 0x37, 0x8d, 0xe2, 0x9c, 0x62, 0x50, 0x42, 0x6b, 0xf9, 0x35,
+  0xcb, 0xf0, 0xba, 0x0c, 0xc8, 0x93, 0x3f, 0x1e, 0x93, 0x28, 0x50, 0x71, 0x4a, 0xd9, 0x64, 0xca,
+  0x55, 0x4d, 0xf9, 0x2b, 0x5c, 0xb5, 0x9c, 0xa7, 0x23, 0x11, 0x70, 0x1f, 0x0d, 0x7a, 0xdf, 0x47,
+  0xcd, 0x6e, 0xa1, 0x6f, 0x18, 0x3a, 0x99, 0xc2, 0x2e, 0x2e, 0xde, 0xfc, 0xf1, 0x6b, 0x0d, 0xcb,
+  0x9b, 0x93, 0x69, 0x9a, 0x95, 0xd7, 0x08, 0x86, 0xec, 0x0e, 0xe6, 0x37, 0xe4, 0x09, 0xfc, 0xa7,
+  0x9a, 0x0c, 0xd3, 0x78, 0xd0, 0xc1, 0xff, 0xf5, 0x9e, 0x3c, 0x4b, 0x9a, 0x2d, 0xb5, 0xa1, 0xf5,
+  0x75, 0xce, 0x70, 0x70, 0xe6, 0x69, 0x06, 0x63, 0xdd, 0x1d, 0x96, 0x4d, 0x62, 0x47, 0x39, 0x9b,
+  0xcb, 0x2b, 0xc3, 0x88, 0x15, 0x35, 0xe5, 0xf1, 0x80, 0x08, 0x2b, 0xed, 0xee, 0xee, 0xfc, 0xa6,
+  0x09, 0x3d, 0x93, 0xf7, 0x54, 0x87, 0x24, 0x1a, 0xe6, 0xe5, 0xe8, 0xd2, 0xf5, 0x68, 0x44, 0x51,
+  0x2c, 0xae, 0xfb, 0x5e, 0x4f, 0x59, 0x9e, 0xc5, 0xd8, 0xd4, 0xce, 0xf9, 0x86, 0x1f, 0x5c, 0x69,
+  0x4f, 0x0b, 0x78, 0x20, 0x09, 0x63, 0x9c, 0xab, 0x74, 0xe2, 0x47, 0x44, 0x08, 0x55, 0xf9, 0x70,
+  0x69, 0xfc, 0x02, 0x4f, 0x87, 0x78, 0x42, 0xaf, 0xbb, 0x96, 0x6d, 0x84, 0x60, 0xda, 0xe3, 0x48,
+  0xab, 0x90, 0xe6, 0xc8, 0x20, 0xb4, 0x68, 0xfb, 0x38, 0x11, 0xf0, 0xfa, 0x85, 0x65, 0x81, 0xc6,
+  0x4f, 0x70, 0xfb, 0xa5, 0xce, 0xd9, 0xc2, 0x59, 0x48, 0xe8, 0xad, 0x2b, 0x2f, 0x7d, 0xf6, 0xcd,
+  0x1d, 0x12, 0x42, 0x75, 0xae, 0x65, 0x12, 0x21, 0x63, 0xd0, 0xc6, 0x82, 0x25, 0xa7, 0x60, 0xb8,
+  0x1f, 0xd3, 0xaa, 0x47, 0xc7, 0x63, 0x3a, 0xe2, 0x2f, 0x73, 0x38, 0x2e, 0xa2, 0x49, 0x1f, 0xd4,
+  0x16, 0xc7, 0x64, 0xf7, 0x40, 0xbc, 0xae, 0x64, 0x10, 0x4b, 0x90, 0x89, 0x7c, 0x55, 0x0c, 0x2d,
+  0x05, 0x7e, 0xa9, 0x71, 0x61, 0xd3, 0xdd, 0xf4, 0x34, 0x11, 0x68, 0x31, 0x61, 0xc5, 0xc4, 0x0d,
+  0x3e, 0xf5, 0xa8, 0xab, 0x29, 0x87, 0x79, 0x41, 0x47, 0x41, 0x27, 0xa0, 0xcd, 0x91, 0x1b, 0x2d,
+  0x72, 0xc2, 0x5c, 0x4a, 0x2e, 0x81, 0x1a, 0x5b, 0xa0, 0x3a, 0x8a, 0x50, 0x90, 0x0b, 0x3f, 0xe3,
+  0x82, 0xec, 0x93, 0x3d, 0xe7, 0xeb, 0x8f, 0x62, 0xf1, 0xf5, 0xc9, 0x5e, 0xf0, 0x78, 0xb5, 0x74,
+  0x46, 0x69, 0x91, 0x79, 0xcf, 0xa6, 0x35, 0x46, 0x46, 0x69, 0x8d, 0xcd, 0xc1, 0xf1, 0xb8, 0x08,
+  0x60, 0xf0, 0x60, 0xc3, 0x72, 0xde, 0x55, 0x3e, 0x35, 0x89, 0x17, 0xf5, 0xa4, 0x87, 0x4c, 0x04,
+  0x1e, 0xa9, 0x9f, 0x3d, 0x71, 0x81, 0x03, 0x92, 0x33, 0x69, 0xf9, 0x2e, 0xe1, 0x8b, 0x75, 0x65,
+  0x55, 0x31, 0x01, 0xf2, 0x01, 0x41, 0x1e, 0x60, 0x58, 0x53, 0xb0, 0xd6, 0x78, 0x71, 0x5a, 0x59,
+  0x2b, 0x80, 0xd0, 0xde, 0xbc, 0xa2, 0x50, 0x4f, 0x9a, 0xbb, 0xe2, 0xe4, 0xa0, 0x85, 0xb5, 0xac,
+  0x41, 0x38, 0x58, 0x07, 0x55, 0x79, 0xf5, 0x47, 0x61, 0xca, 0x69, 0x7a, 0x65, 0xbf, 0x9f, 0xd8,
+  0xca, 0x00, 0x9b, 0x01, 0x2e, 0xe7, 0x4d, 0x51, 0x11, 0xe8, 0xc4, 0x2a, 0xae, 0xb3, 0x91, 0xda,
+  0x22, 0xc0, 0x4c, 0xa2, 0x7b, 0xe2, 0x31, 0x36, 0x16, 0x68, 0x24, 0x4d, 0xaf, 0x4b, 0x05, 0x91,
+  0xe3, 0x99, 0x82, 0x82, 0xc5, 0x6a, 0x9b, 0xf8, 0xd0, 0x15, 0xe3, 0xda, 0xa2, 0x45, 0xda, 0x7d,
+  0x4d, 0x23, 0xaf, 0x4d, 0x45, 0xcb, 0x4a, 0xea, 0x4a, 0xb5, 0xdd, 0x58, 0x44, 0x7e, 0x06, 0xe4,
+  0x94, 0x81, 0x74, 0xd0, 0xd4, 0x94, 0x2c, 0x8b, 0x86, 0x05, 0x56, 0xc4, 0xf7, 0x54, 0xe5, 0xec,
+  0x18, 0xf5, 0xaf, 0xf2, 0x38, 0xbb, 0x69, 0x49, 0x8a, 0xd1, 0x97, 0xed, 0xc0, 0x1f, 0x04, 0xa1,
+  0x4b, 0x9f, 0x10, 0x22, 0x9d, 0x42, 0x44, 0x92, 0x14, 0x9a, 0x66, 0xb4, 0xaa, 0xf7, 0xc9, 0x57,
+  0x12, 0xc9, 0x68, 0x99, 0x2e, 0x78, 0x3e, 0x47, 0xfb, 0x24, 0x82, 0x43, 0xa5, 0xf4, 0x61, 0xe8,
+  0xdf, 0x74, 0xaf, 0xaf, 0xaf, 0xbb, 0x70, 0x4f, 0xd2, 0x5d, 0x54, 0x39, 0x2d, 0x46, 0x65, 0x46,
+  0xb3, 0x88, 0xdc, 0x09, 0x28, 0xe8, 0x5e, 0x42, 0x22, 0x95, 0x85, 0x43, 0x14, 0x7f, 0xf9, 0x7c,
+  0xfc, 0xba, 0x9c, 0xcd, 0xcb, 0x82, 0x16, 0xc2, 0x35, 0x1a, 0x33, 0x73, 0x00, 0xe9, 0x6d, 0x95,
+  0x64, 0xb7, 0x44, 0x45, 0x5e, 0xb6, 0xc2, 0xc2, 0x4e, 0x6b, 0x03, 0xd2, 0x2a, 0xbb, 0xa4, 0xeb,
+  0xc3, 0xd2, 0xee, 0xc1, 0x82, 0xba, 0xb3, 0x34, 0xee, 0xbb, 0x36, 0x3b, 0xdf, 0xcb, 0x25, 0x68,
+  0xf3, 0xd7, 0xc4, 0x37, 0x4b, 0xc5, 0x34, 0x59, 0x9b, 0x82, 0xba, 0x6f, 0x0c, 0x02, 0x92, 0x73,
+  0x1a, 0x00, 0x23, 0x51, 0xf8, 0x1e, 0x4a, 0xf5, 0x75, 0x3a, 0x47, 0x17, 0x99, 0x30, 0x77, 0xa8,
+  0xea, 0x6d, 0x2e, 0x39, 0x18, 0x3d, 0x54, 0x8f, 0xa6, 0xe5, 0x10, 0x7c, 0xb0, 0x6c, 0x07, 0x1d,
+  0xcb, 0x13, 0xa7, 0xe9, 0x5c, 0xe3, 0xbf, 0xfc, 0xd9, 0xe2, 0x58, 0xa3, 0x83, 0x90, 0xea, 0xd1,
+  0x94, 0xd1, 0x21, 0x35, 0xfe, 0x2e, 0x61, 0x43, 0xe0, 0x26, 0x3e, 0x34, 0x21, 0xa8, 0x4b, 0xf2,
+  0xc8, 0xbc, 0x2c, 0x32, 0x3b, 0x48, 0x4e, 0x1e, 0x4f, 0xbe, 0xda, 0x87, 0x09, 0xfb, 0x04, 0x01,
+  0xb7, 0x90, 0xfa, 0xf8, 0xd5, 0x94, 0x7c, 0x6f, 0x3e, 0xfe, 0x45, 0x2e, 0x98, 0xf7, 0x65, 0x0a,
+  0x8b, 0xc1, 0xde, 0x60, 0xfb, 0x7d, 0x20, 0xee, 0x97, 0xdf, 0xfe, 0x07, 0x42, 0xb2, 0x28, 0x39,
+  0x2e, 0x18, 0x67, 0xd2, 0xbf, 0x69, 0x51, 0x4c, 0x20, 0x0c, 0x7c, 0xc6, 0x38, 0xc1, 0x74, 0x52,
+  0xea, 0xe6, 0xe4, 0xaa, 0x9c, 0x91, 0x57, 0x55, 0x79, 0x5d, 0xd3, 0x8a, 0x4c, 0xe8, 0xf8, 0xb7,
+  0xbf, 0xe7, 0x39, 0x27, 0xd7, 0xb4, 0xca, 0x68, 0x11, 0x8c, 0x25, 0x13, 0xdc, 0x5c, 0x30, 0x0e,
+  0x11, 0x06, 0xd9, 0x69, 0x3a, 0x94, 0xae, 0xfd, 0xe2, 0xda, 0x37, 0x1d, 0x76, 0xdf, 0xa4, 0x9c,
+  0x16, 0x58, 0x43, 0xa1, 0xa6, 0x90, 0x7c, 0x98, 0x56, 0x53, 0x26, 0xec, 0x76, 0xbf, 0xfd, 0xf7,
+  0x10, 0x07, 0x50, 0x44, 0x82, 0x25, 0xe2, 0xf2, 0x61, 0x57, 0x2a, 0x50, 0x30, 0x70, 0x82, 0xa9,
+  0x30, 0x3d, 0x05, 0x2f, 0x61, 0x5b, 0x8c, 0x75, 0x11, 0x8c, 0x16, 0x1c, 0xb4, 0x87, 0x65, 0x5a,
+  0x65, 0xe6, 0xb3, 0xcd, 0x22, 0x01, 0x73, 0x86, 0x72, 0xc8, 0xa9, 0x25, 0xc9, 0xd6, 0xbe, 0x2c,
+  0x74, 0x64, 0xab, 0x00, 0x0c, 0x01, 0xb9, 0xc4, 0x0b, 0xba, 0xd3, 0x31, 0xa7, 0x33, 0x65, 0x45,
+  0x7e, 0x99, 0xcd, 0x58, 0x71, 0x9a, 0x0e, 0x03, 0x01, 0x66, 0xee, 0xbe, 0x20, 0x40, 0x69, 0xa8,
+  0x70, 0xfa, 0x68, 0x33, 0xa6, 0xcb, 0x3a, 0x70, 0x69, 0xa2, 0xeb, 0x0b, 0x99, 0x26, 0x0f, 0xd9,
+  0x68, 0xe9, 0x3b, 0xf0, 0x10, 0xbc, 0xe2, 0xa0, 0xa8, 0x89, 0x87, 0x87, 0x60, 0xdd, 0xc5, 0x4b,
+  0x0e, 0xec, 0xb0, 0x0f, 0x74, 0x87, 0xbc, 0x88, 0x92, 0xa4, 0x37, 0x66, 0x45, 0x16, 0x0f, 0xa1,
+  0xf1, 0x0b, 0x32, 0xe4, 0x05, 0x50, 0xf3, 0x92, 0xf3, 0x8a, 0x0d, 0x17, 0x9c, 0xc6, 0x11, 0xa8,
+  0xe1, 0x6c, 0x74, 0x09, 0x01, 0x98, 0xfa, 0x69, 0x4b, 0xdd, 0xa1, 0x04, 0x1f, 0x8d, 0x0c, 0xe3,
+  0xb1, 0x91, 0xe8, 0x3b, 0x46, 0x45, 0x68, 0x62, 0x68, 0xee, 0x21, 0x7c, 0x31, 0x21, 0x9e, 0x22,
+  0x22, 0x2c, 0x9a, 0x6d, 0x25, 0xbb, 0xad, 0x25, 0x7b, 0x50, 0x82, 0xe1, 0x7d, 0xfd, 0x3e, 0x9a,
+  0xbd, 0x7e, 0xa1, 0x8c, 0x93, 0xb4, 0xc0, 0x9b, 0x40, 0x19, 0xc0, 0x38, 0x03, 0x56, 0x2f, 0x48,
+  0x8c, 0x9b, 0xd4, 0x9c, 0x56, 0x63, 0xd2, 0x7d, 0x41, 0x52, 0x98, 0xcc, 0x0b, 0x08, 0x37, 0x94,
+  0x27, 0xdd, 0x0b, 0xe0, 0xa4, 0x8b, 0x59, 0x9d, 0xb4, 0x07, 0x27, 0x42, 0x0d, 0x67, 0xc1, 0xb5,
+  0xac, 0x0f, 0xed, 0xd5, 0x0d, 0x67, 0x03, 0x5a, 0xe1, 0x3d, 0x7f, 0x31, 0x42, 0x7e, 0x7a, 0x5b,
+  0xf0, 0x8a, 0xd1, 0xfa, 0xd5, 0x2d, 0x6c, 0x77, 0xe4, 0x68, 0x69, 0xb1, 0xf6, 0xc2, 0xc2, 0x50,
+  0xd3, 0xb3, 0xc1, 0x39, 0xd9, 0xf7, 0xed, 0x20, 0x45, 0x7a, 0xe5, 0x1e, 0x07, 0xd4, 0x5b, 0xa9,
+  0x69, 0xf6, 0x97, 0x5a, 0xbd, 0x45, 0x28, 0x1e, 0xa4, 0x2b, 0xd2, 0xab, 0x1e, 0x7c, 0xc7, 0x3e,
+  0xbd, 0x2d, 0xf0, 0xfd, 0x37, 0xf8, 0x96, 0x95, 0x33, 0x47, 0xa2, 0xa8, 0x72, 0xc7, 0x43, 0x1d,
+  0x6e, 0xa6, 0x43, 0x00, 0x2b, 0x5a, 0xcf, 0xcb, 0xa2, 0xa6, 0x00, 0xaf, 0x4b, 0xc4, 0x97, 0xff,
+  0x5a, 0xd0, 0x9a, 0xe3, 0xbb, 0x96, 0x49, 0xc8, 0x11, 0x1d, 0x57, 0xd1, 0x39, 0x39, 0xa1, 0x8c,
+  0x53, 0x32, 0xa1, 0x39, 0x9a, 0x2a, 0x59, 0x41, 0x84, 0x19, 0x0e, 0xe9, 0x06, 0x85, 0x72, 0x56,
+  0x93, 0x18, 0xaf, 0xc5, 0xe1, 0xbb, 0x44, 0x2f, 0xbe, 0x27, 0xb6, 0x77, 0x59, 0x28, 0x28, 0xd4,
+  0x6c, 0x9c, 0x4b, 0x42, 0x46, 0x61, 0xe0, 0xfb, 0x30, 0xfd, 0x17, 0x72, 0x56, 0xc1, 0x34, 0xf8,
+  0x2a, 0x2f, 0x87, 0xf1, 0x19, 0x1a, 0xcb, 0x84, 0x83, 0x0d, 0x1b, 0xdf, 0xc6, 0x5f, 0x89, 0xe4,
+  0x8c, 0x7d, 0x49, 0x5f, 0x07, 0xe9, 0xc1, 0x0f, 0x92, 0xb0, 0xbb, 0xe4, 0x1c, 0xdc, 0x5f, 0xc5,
+  0xb5, 0xb0, 0x73, 0x82, 0x81, 0x63, 0x41, 0x44, 0xee, 0x12, 0x7b, 0xdf, 0xe9, 0x90, 0x81, 0x64,
+  0xda, 0xff, 0x07, 0x29, 0x50, 0x38, 0x72, 0x4e, 0xe8, 0x00, 0x00,
+};
+const WebAsset WEB_ASSET_ADMIN_JS = {
+  "/admin.js", "application/javascript", ADMIN_JS_GZ, sizeof(ADMIN_JS_GZ), 59470, "86a56cc9c274", "\"86a56cc9c274\""
+};
@@ -0,0 +1,21 @@
+#ifndef WEB_ADMIN_ASSETS_H
+#define WEB_ADMIN_ASSETS_H
+
+#include <Arduino.h>
+
+// Statische Web-Admin-Dateien, vorab gzip-komprimiert im Flash (PROGMEM).
+// Quelle und Generator: web-assets/ (npm run build erzeugt web_admin_assets.cpp)
+struct WebAsset {
+  const char* path;          // URL, z.B. "/admin.js"
+  const char* content_type;
+  const uint8_t* gz;         // gzip-Daten
+  size_t gz_len;
+  size_t raw_len;            // unkomprimiert (nur Statistik)
+  const char* version;       // Inhalts-Hash, fuer ?v= in der Seite
+  const char* etag;          // "version" inkl. Anfuehrungszeichen
+};
+
+extern const WebAsset WEB_ASSET_ADMIN_CSS;
+extern const WebAsset WEB_ASSET_ADMIN_JS;
+
+#endif // WEB_ADMIN_ASSETS_H
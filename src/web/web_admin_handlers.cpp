@@ -1,75 +1,92 @@
 #include "src/web/web_admin.h"
 #include "src/web/web_admin_utils.h"
+#include "src/web/web_live.h"
+#include "src/web/json_stream.h"
 #include "src/network/network_manager.h"
 #include "src/network/mqtt_handlers.h"
+#include "src/network/entity_table.h"
+#include "src/network/entity_snapshot.h"
+#include "src/core/display_manager.h"
 #include "src/ui/tab_settings.h"
 #include "src/game/game_controls_config.h"
 #include "src/game/key_parsing.h"
 #include "src/tiles/tile_config.h"
 #include "src/ui/tab_tiles_unified.h"
 #include "src/ui/ui_manager.h"
+#include "src/tiles/tile_render_bench.h"
+#include "src/ui/image_cache.h"
+#include "src/ui/image_popup.h"
+#include "src/ui/url_refresh_sched.h"
+#include "src/ui/sd_image_index.h"
+#include "src/core/sd_io.h"
+#include "src/core/config_store.h"
+#include "src/core/ui_loop.h"
+#include "src/core/metrics.h"
+#include "esp_rom_crc.h"
+#include <ArduinoJson.h>
 #include <algorithm>
 #include <vector>
 #include <SD.h>
 
+// Laufzeiten Einzel-Tile-Speichern vs. Layout-Import (/api/perf "layout").
+// Beide Pfade werden ohne Flash gemessen (*_ram_*); der Flash-Anteil kommt aus
+// den ConfigStore-Commits: der Import schreibt genau ein Image synchron, der
+// Einzel-Tile-Pfad per Write-Behind zwischen einem Image (alles in der Ruhezeit)
+// und einem Image pro Speichern (Abstand > CONFIG_STORE_QUIET_MS).
+struct LayoutPerfStats {
+  uint32_t tile_saves;
+  uint64_t tile_save_us_total;
+  uint32_t imports;
+  uint32_t last_import_us;
+  uint32_t last_parse_us;
+  uint32_t last_persist_us;
+  uint8_t last_changed_grids;
+};
+static LayoutPerfStats g_layout_perf = {};
+
+static constexpr uint8_t kLayoutVersion = 1;
+static constexpr size_t kLayoutMaxBody = 32 * 1024;
+static constexpr size_t kLayoutMaxString = 128;
+
 namespace {
 
-bool endsWithIgnoreCase(const String& value, const char* suffix) {
-  if (!suffix) return false;
-  String v = value;
-  v.toLowerCase();
-  String s = suffix;
-  s.toLowerCase();
-  return v.endsWith(s);
-}
-
-String joinPath(const String& dir, const String& name) {
-  if (name.startsWith("/")) return name;
-  if (dir == "/") return String("/") + name;
-  return dir + "/" + name;
-}
-
-void collectImageFiles(const String& dir, std::vector<String>& out, size_t max_entries, uint8_t depth, bool allow_bin, bool allow_jpeg) {
-  if (out.size() >= max_entries) return;
-  File root = SD.open(dir);
-  if (!root) return;
-
-  File file = root.openNextFile();
-  while (file) {
-    if (out.size() >= max_entries) break;
-    const char* name_c = file.name();
-    String name = name_c ? String(name_c) : String();
-    if (file.isDirectory()) {
-      if (depth > 0 && name.length()) {
-        collectImageFiles(joinPath(dir, name), out, max_entries, depth - 1, allow_bin, allow_jpeg);
-      }
-    } else if (name.length()) {
-      const bool is_bin = endsWithIgnoreCase(name, ".bin");
-      const bool is_jpeg = endsWithIgnoreCase(name, ".jpg") || endsWithIgnoreCase(name, ".jpeg");
-      if ((allow_bin && is_bin) || (allow_jpeg && is_jpeg)) {
-        out.push_back(joinPath(dir, name));
-      }
-    }
-    file = root.openNextFile();
-  }
+// Felder einer Kachel - gemeinsam fuer Einzel- und Listenabfrage (GET /api/tiles)
+void writeTileJson(JsonStreamWriter& json, const Tile& tile) {
+  json.beginObject();
+  json.field("type", static_cast<int>(tile.type));
+  json.field("title", tile.title);
+  json.field("icon_name", tile.icon_name);
+  json.field("bg_color", tile.bg_color);
+  json.field("sensor_entity", tile.sensor_entity);
+  json.field("sensor_unit", tile.sensor_unit);
+  json.field("sensor_decimals", tile.sensor_decimals == 0xFF ? -1 : static_cast<int>(tile.sensor_decimals));
+  json.field("sensor_value_font", tile.sensor_value_font);
+  json.field("scene_alias", tile.scene_alias);
+  json.field("key_macro", tile.key_macro);
+  json.field("key_code", tile.key_code);
+  json.field("key_modifier", tile.key_modifier);
+  json.field("switch_style", (tile.type == TILE_SWITCH && tile.sensor_decimals == 1) ? 1 : 0);
+  json.field("image_path", tile.image_path);
+  json.field("image_slideshow_sec", tile.image_slideshow_sec);
+  json.endObject();
 }
 
-void appendJsonEscaped(String& out, const String& value) {
-  for (size_t i = 0; i < value.length(); ++i) {
-    char c = value.charAt(i);
-    if (c == '\"' || c == '\\') {
-      out += '\\';
-      out += c;
-    } else if (c == '\n') {
-      out += "\\n";
-    } else if (c == '\r') {
-      out += "\\r";
-    } else if (c == '\t') {
-      out += "\\t";
-    } else {
-      out += c;
-    }
-  }
+// Entity-IDs sind interniert und bleiben gueltig; kopiert werden nur die Werte
+typedef std::vector<std::pair<const char*, String>> SensorValueList;
+
+// Nur im UI-Loop (Entity-Tabelle gehoert dem MQTT-Callback)
+void collectSensorValues(SensorValueList& out) {
+  out.reserve(entityTable.size());
+  entityTable.forEach([&](const EntityEntry& e) {
+    if (e.value.length()) out.emplace_back(e.id, e.value);
+  });
+}
+
+// Letzte Werte aus der Entity-Tabelle: {"entity":"wert",...}
+void writeSensorValuesJson(JsonStreamWriter& json, const SensorValueList& values) {
+  json.beginObject();
+  for (const auto& v : values) json.field(v.first, v.second);
+  json.endObject();
 }
 
 }  // namespace
@@ -112,18 +129,20 @@ void WebAdminServer::handleSaveMQTT() {
   }
 
   if (!cfg.mqtt_host[0]) {
-    server.send(400, "text/html", "<h1>Fehler: MQTT-Host ist erforderlich</h1>");
+    reply(400, "text/html", "<h1>Fehler: MQTT-Host ist erforderlich</h1>");
     return;
   }
 
   if (configManager.save(cfg)) {
-    settings_show_mqtt_warning(false);
+    {
+      LvglLock lock;
+      settings_show_mqtt_warning(false);
+    }
     // Reload grids im Loop (nicht im Web-Handler)
     tiles_request_reload_all();
-    server.sendHeader("Location", "/");
-    server.send(303, "text/plain", "");
+    replyRedirect("/");
   } else {
-    server.send(500, "text/html", "<h1>Speichern fehlgeschlagen</h1>");
+    reply(500, "text/html", "<h1>Speichern fehlgeschlagen</h1>");
   }
 }
 
@@ -216,8 +235,7 @@ void WebAdminServer::handleSaveBridge() {
   }
 
   if (!changed) {
-    server.sendHeader("Location", "/");
-    server.send(303, "text/plain", "");
+    replyRedirect("/");
     return;
   }
 
@@ -225,10 +243,9 @@ void WebAdminServer::handleSaveBridge() {
     // Reload grids im Loop (nicht im Web-Handler)
     tiles_request_reload_all();
     mqttReloadDynamicSlots();
-    server.sendHeader("Location", "/");
-    server.send(303, "text/plain", "");
+    replyRedirect("/");
   } else {
-    server.send(500, "text/html", "<h1>Speichern fehlgeschlagen</h1>");
+    reply(500, "text/html", "<h1>Speichern fehlgeschlagen</h1>");
   }
 }
 
@@ -289,41 +306,42 @@ void WebAdminServer::handleSaveGameControls() {
   }
 
   if (!changed) {
-    server.sendHeader("Location", "/");
-    server.send(303, "text/plain", "");
+    replyRedirect("/");
     return;
   }
 
   if (gameControlsConfig.save(updated)) {
     // Reload im Loop (nicht im Web-Handler)
     tiles_request_reload_if_loaded(GridType::TAB1);
-    server.sendHeader("Location", "/");
-    server.send(303, "text/plain", "");
+    replyRedirect("/");
   } else {
-    server.send(500, "text/html", "<h1>Speichern fehlgeschlagen</h1>");
+    reply(500, "text/html", "<h1>Speichern fehlgeschlagen</h1>");
   }
 }
 
 void WebAdminServer::handleBridgeRefresh() {
   if (!networkManager.isMqttConnected()) {
-    server.send(503, "text/html",
-                "<h1>MQTT ist nicht verbunden - bitte spaeter erneut versuchen.</h1>");
+    reply(503, "text/html",
+          "<h1>MQTT ist nicht verbunden - bitte spaeter erneut versuchen.</h1>");
     return;
   }
   networkManager.publishBridgeRequest();
-  server.sendHeader("Location", "/");
-  server.send(303, "text/plain", "");
+  replyRedirect("/");
 }
 
 void WebAdminServer::handleStatus() {
-  server.send(200, "application/json", getStatusJSON());
+  String body;
+  JsonStreamWriter json(&body);
+  writeStatusJSON(json);
+  json.finish();
+  reply(200, "application/json", body);
 }
 
 void WebAdminServer::handleRestart() {
-  server.sendHeader("Location", "/");
-  server.send(303, "text/plain", "");
-  delay(200);
-  ESP.restart();
+  configStore.flush();  // vorgemerkte Aenderungen nicht verlieren
+  entity_snapshot_flush();
+  replyRedirect("/");
+  restartAfterReply();
 }
 
 void WebAdminServer::handleGetTiles() {
@@ -350,86 +368,27 @@ void WebAdminServer::handleGetTiles() {
       return;
     }
 
-    const Tile& tile = grid.tiles[index];
-
-    // Build JSON response for single tile
-    String json = "{";
-    json += "\"type\":" + String((int)tile.type) + ",";
-    json += "\"title\":\"";
-    json += tile.title;
-    json += "\",\"icon_name\":\"";
-    json += tile.icon_name;
-    json += "\",\"bg_color\":" + String(tile.bg_color) + ",";
-    json += "\"sensor_entity\":\"";
-    json += tile.sensor_entity;
-    json += "\",\"sensor_unit\":\"";
-    json += tile.sensor_unit;
-    json += "\",\"sensor_decimals\":";
-    json += String(tile.sensor_decimals == 0xFF ? -1 : (int)tile.sensor_decimals);
-    json += ",\"sensor_value_font\":";
-    json += String(tile.sensor_value_font);
-    json += ",\"scene_alias\":\"";
-    json += tile.scene_alias;
-    json += "\",\"key_macro\":\"";
-    json += tile.key_macro;
-    json += "\",\"key_code\":" + String(tile.key_code) + ",";
-    json += "\"key_modifier\":" + String(tile.key_modifier);
-    json += ",\"switch_style\":";
-    json += String((tile.type == TILE_SWITCH && tile.sensor_decimals == 1) ? 1 : 0);
-    json += ",\"image_path\":\"";
-    json += tile.image_path;
-    json += "\",\"image_slideshow_sec\":";
-    json += String(tile.image_slideshow_sec);
-    json += "}";
-
-    server.send(200, "application/json", json);
+    JsonStreamWriter json(server);
+    writeTileJson(json, grid.tiles[index]);
+    json.finish();
     return;
   }
 
   // All tiles request - return array
-  String json = "[";
+  JsonStreamWriter json(server);
+  json.beginArray();
   for (uint8_t i = 0; i < TILES_PER_GRID; i++) {
-    const Tile& tile = grid.tiles[i];
-
-    if (i > 0) json += ",";
-    json += "{";
-    json += "\"type\":" + String((int)tile.type) + ",";
-    json += "\"title\":\"";
-    json += tile.title;
-    json += "\",\"icon_name\":\"";
-    json += tile.icon_name;
-    json += "\",\"bg_color\":" + String(tile.bg_color) + ",";
-    json += "\"sensor_entity\":\"";
-    json += tile.sensor_entity;
-    json += "\",\"sensor_unit\":\"";
-    json += tile.sensor_unit;
-    json += "\",\"sensor_decimals\":";
-    json += String(tile.sensor_decimals == 0xFF ? -1 : (int)tile.sensor_decimals);
-    json += ",\"sensor_value_font\":";
-    json += String(tile.sensor_value_font);
-    json += ",\"scene_alias\":\"";
-    json += tile.scene_alias;
-    json += "\",\"key_macro\":\"";
-    json += tile.key_macro;
-    json += "\",\"key_code\":" + String(tile.key_code) + ",";
-    json += "\"key_modifier\":" + String(tile.key_modifier);
-    json += ",\"switch_style\":";
-    json += String((tile.type == TILE_SWITCH && tile.sensor_decimals == 1) ? 1 : 0);
-    json += ",\"image_path\":\"";
-    json += tile.image_path;
-    json += "\",\"image_slideshow_sec\":";
-    json += String(tile.image_slideshow_sec);
-    json += "}";
-  }
-  json += "]";
-
-  server.send(200, "application/json", json);
+    writeTileJson(json, grid.tiles[i]);
+  }
+  json.endArray();
+  json.finish();
 }
 
 void WebAdminServer::handleSaveTiles() {
   // POST /api/tiles
+  const uint32_t start_us = micros();
   if (!server.hasArg("tab") || !server.hasArg("index") || !server.hasArg("type")) {
-    server.send(400, "application/json", "{\"success\":false,\"error\":\"Missing parameters\"}");
+    reply(400, "application/json", "{\"success\":false,\"error\":\"Missing parameters\"}");
     return;
   }
 
@@ -438,13 +397,15 @@ void WebAdminServer::handleSaveTiles() {
   int type = server.arg("type").toInt();
 
   if ((tab != "home" && tab != "game" && tab != "weather" && tab != "tab0" && tab != "tab1" && tab != "tab2") || index < 0 || index >= TILES_PER_GRID) {
-    server.send(400, "application/json", "{\"success\":false,\"error\":\"Invalid parameters\"}");
+    reply(400, "application/json", "{\"success\":false,\"error\":\"Invalid parameters\"}");
     return;
   }
 
   // Get current grid (mutable reference)
   TileGridConfig& grid = (tab == "home" || tab == "tab0") ? tileConfig.getTab0Grid() : ((tab == "game" || tab == "tab1") ? tileConfig.getTab1Grid() : tileConfig.getTab2Grid());
   Tile& tile = grid.tiles[index];
+  const String prev_entity = tile.sensor_entity;
+  const TileType prev_type = tile.type;
 
   // Update tile data
   tile.type = static_cast<TileType>(type);
@@ -540,26 +501,313 @@ void WebAdminServer::handleSaveTiles() {
   if (success) {
     Serial.printf("[WebAdmin] Tile %s[%d] gespeichert - Type: %d\n", tab.c_str(), index, type);
 
-    // Rebuild MQTT dynamic routes for new sensor entities
-    mqttReloadDynamicSlots();
-    Serial.println("[WebAdmin] MQTT Routes neu aufgebaut");
+    // Rebuild MQTT dynamic routes only if the entity binding changed (Auto-Save bei jedem Tastendruck)
+    if (tile.type != prev_type || tile.sensor_entity != prev_entity) {
+      mqttReloadDynamicSlots();
+      Serial.println("[WebAdmin] MQTT Routes neu aufgebaut");
+    }
 
     // Update only the changed tile on display to avoid flicker
     GridType gridType = (tab == "home" || tab == "tab0") ? GridType::TAB0 : ((tab == "game" || tab == "tab1") ? GridType::TAB1 : GridType::TAB2);
-    tiles_update_tile(gridType, static_cast<uint8_t>(index));
+    {
+      LvglLock lock;
+      tiles_update_tile(gridType, static_cast<uint8_t>(index));
+    }
     Serial.printf("[WebAdmin] Tile %s[%d] aktualisiert\n", tab.c_str(), index);
 
-    server.send(200, "application/json", "{\"success\":true}");
+    g_layout_perf.tile_saves++;
+    g_layout_perf.tile_save_us_total += micros() - start_us;
+    reply(200, "application/json", "{\"success\":true}");
   } else {
     Serial.printf("[WebAdmin] Fehler beim Speichern von Tile %s[%d]\n", tab.c_str(), index);
-    server.send(500, "application/json", "{\"success\":false,\"error\":\"Save failed\"}");
+    reply(500, "application/json", "{\"success\":false,\"error\":\"Save failed\"}");
   }
 }
 
+// ========== Layout (alle Grids + Tabs in einem Dokument) ==========
+// {"version":1,"tabs":[{"name":"","icon":""} x4],"grids":[[Tile x12] x3]}
+// Tile: Feldnamen wie /api/tiles, leere/Default-Felder werden weggelassen.
+
+// Kompakt: leere/Default-Felder entfallen (handlePutLayout setzt sie wieder)
+static void layout_tile_to_json(JsonStreamWriter& json, const Tile& tile) {
+  json.beginObject();
+  json.field("type", static_cast<int>(tile.type));
+  if (tile.type != TILE_EMPTY) {
+    if (tile.title.length()) json.field("title", tile.title);
+    if (tile.icon_name.length()) json.field("icon_name", tile.icon_name);
+    if (tile.bg_color) json.field("bg_color", tile.bg_color);
+    if (tile.sensor_entity.length()) json.field("sensor_entity", tile.sensor_entity);
+    if (tile.sensor_unit.length()) json.field("sensor_unit", tile.sensor_unit);
+    if (tile.sensor_decimals != 0xFF) json.field("sensor_decimals", static_cast<int>(tile.sensor_decimals));
+    if (tile.sensor_value_font) json.field("sensor_value_font", static_cast<int>(tile.sensor_value_font));
+    if (tile.scene_alias.length()) json.field("scene_alias", tile.scene_alias);
+    if (tile.key_macro.length()) json.field("key_macro", tile.key_macro);
+    if (tile.image_path.length()) json.field("image_path", tile.image_path);
+    if (tile.type == TILE_IMAGE) json.field("image_slideshow_sec", static_cast<int>(tile.image_slideshow_sec));
+  }
+  json.endObject();
+}
+
+static bool layout_read_string(JsonObjectConst in, const char* key, String& out, String& error) {
+  JsonVariantConst v = in[key];
+  if (v.isNull()) {
+    out = "";
+    return true;
+  }
+  if (!v.is<const char*>()) {
+    error = String(key) + ": kein String";
+    return false;
+  }
+  const char* s = v.as<const char*>();
+  if (strlen(s) > kLayoutMaxString) {
+    error = String(key) + ": zu lang";
+    return false;
+  }
+  out = s;
+  out.trim();
+  return true;
+}
+
+// Gleiche Normalisierung wie handleSaveTiles, aber ohne RAM-Zugriff auf die aktive Konfiguration
+static bool layout_tile_from_json(JsonObjectConst in, Tile& tile, String& error) {
+  if (in.isNull()) {
+    error = "kein Objekt";
+    return false;
+  }
+  // Pflichtfeld: fehlendes oder nicht-ganzzahliges type darf keine Kachel leeren
+  if (!in["type"].is<int>()) {
+    error = "type fehlt oder ist keine Zahl";
+    return false;
+  }
+  const int type = in["type"].as<int>();
+  if (type < TILE_EMPTY || type > TILE_IMAGE) {
+    error = "type ungueltig";
+    return false;
+  }
+  tile = Tile();
+  tile.type = static_cast<TileType>(type);
+  if (tile.type == TILE_EMPTY) return true;
+
+  if (!layout_read_string(in, "title", tile.title, error) ||
+      !layout_read_string(in, "icon_name", tile.icon_name, error) ||
+      !layout_read_string(in, "sensor_entity", tile.sensor_entity, error) ||
+      !layout_read_string(in, "sensor_unit", tile.sensor_unit, error) ||
+      !layout_read_string(in, "scene_alias", tile.scene_alias, error) ||
+      !layout_read_string(in, "key_macro", tile.key_macro, error) ||
+      !layout_read_string(in, "image_path", tile.image_path, error)) {
+    return false;
+  }
+  const uint32_t color = in["bg_color"] | 0u;
+  if (color > 0xFFFFFF) {
+    error = "bg_color ungueltig";
+    return false;
+  }
+  tile.bg_color = color;
+
+  const int decimals = in["sensor_decimals"] | -1;
+  const int value_font = in["sensor_value_font"] | 0;
+  tile.sensor_decimals = 0xFF;
+  tile.sensor_value_font = 0;
+  switch (tile.type) {
+    case TILE_SENSOR:
+      if (decimals >= 0) tile.sensor_decimals = static_cast<uint8_t>(std::min(decimals, 6));
+      tile.sensor_value_font = (value_font == 1 || value_font == 2) ? value_font : 0;
+      break;
+    case TILE_NAVIGATE:
+      // Element-Pool: sensor_decimals = Ziel-Tab
+      if (decimals < 0 || decimals > 2) {
+        error = "sensor_decimals (Ziel-Tab) ungueltig";
+        return false;
+      }
+      tile.sensor_decimals = static_cast<uint8_t>(decimals);
+      break;
+    case TILE_SWITCH:
+      tile.sensor_decimals = (decimals == 1) ? 1 : 0;  // Element-Pool: Stil
+      break;
+    case TILE_KEY:
+      parseKeyMacro(tile.key_macro, tile.key_code, tile.key_modifier);
+      break;
+    default:
+      break;
+  }
+  if (tile.type == TILE_IMAGE) {
+    int sec = in["image_slideshow_sec"] | 10;
+    if (sec <= 0) sec = 10;
+    if (sec > 3600) sec = 3600;
+    tile.image_slideshow_sec = static_cast<uint16_t>(sec);
+  }
+  return true;
+}
+
+static bool layout_same_tile(const Tile& a, const Tile& b) {
+  return a.type == b.type && a.bg_color == b.bg_color && a.sensor_decimals == b.sensor_decimals &&
+         a.sensor_value_font == b.sensor_value_font && a.key_code == b.key_code &&
+         a.key_modifier == b.key_modifier && a.image_slideshow_sec == b.image_slideshow_sec &&
+         a.title == b.title && a.icon_name == b.icon_name && a.sensor_entity == b.sensor_entity &&
+         a.sensor_unit == b.sensor_unit && a.scene_alias == b.scene_alias &&
+         a.key_macro == b.key_macro && a.image_path == b.image_path;
+}
+
+void WebAdminServer::handleGetLayout() {
+  // GET /api/layout - ersetzt 3x /api/tiles?tab= + /api/tabs
+  const TileGridConfig* grids[3] = {&tileConfig.getTab0Grid(), &tileConfig.getTab1Grid(), &tileConfig.getTab2Grid()};
+  JsonStreamWriter json(server);
+  json.beginObject();
+  json.field("version", static_cast<int>(kLayoutVersion));
+  json.key("tabs").beginArray();
+  for (uint8_t i = 0; i < 4; ++i) {
+    json.beginObject();
+    json.field("name", tileConfig.getTabName(i));
+    json.field("icon", tileConfig.getTabIcon(i));
+    json.endObject();
+  }
+  json.endArray();
+  json.key("grids").beginArray();
+  for (const TileGridConfig* grid : grids) {
+    json.beginArray();
+    for (size_t i = 0; i < TILES_PER_GRID; ++i) {
+      layout_tile_to_json(json, grid->tiles[i]);
+    }
+    json.endArray();
+  }
+  json.endArray();
+  json.endObject();
+  json.finish();
+  adminLiveServer.notePollBytes(json.bytes());
+}
+
+void WebAdminServer::handlePutLayout() {
+  // POST /api/layout - ganzes Layout pruefen, als ein Image speichern, jedes geaenderte Grid einmal neu laden
+  const uint32_t start_us = micros();
+  if (!server.hasArg("plain")) {
+    reply(400, "application/json", "{\"success\":false,\"error\":\"Missing body\"}");
+    return;
+  }
+  const String& body = server.arg("plain");
+  if (body.length() > kLayoutMaxBody) {
+    reply(413, "application/json", "{\"success\":false,\"error\":\"Body too large\"}");
+    return;
+  }
+
+  JsonDocument doc;
+  DeserializationError err = deserializeJson(doc, body);
+  if (err) {
+    String json = "{\"success\":false,\"error\":\"JSON: ";
+    json += err.c_str();
+    json += "\"}";
+    reply(400, "application/json", json);
+    return;
+  }
+
+  // Alles in Kopien parsen; die aktive Konfiguration bleibt bis zum Speichern unberuehrt
+  std::vector<TileGridConfig> grids(3);
+  TabConfig tabs[4];
+  for (uint8_t i = 0; i < 4; ++i) {
+    strlcpy(tabs[i].name, tileConfig.getTabName(i), sizeof(tabs[i].name));
+    strlcpy(tabs[i].icon_name, tileConfig.getTabIcon(i), sizeof(tabs[i].icon_name));
+  }
+
+  String error;
+  const int version = doc["version"] | kLayoutVersion;
+  JsonArrayConst in_grids = doc["grids"];
+  if (version != kLayoutVersion) {
+    error = "version nicht unterstuetzt";
+  } else if (in_grids.isNull() || in_grids.size() != 3) {
+    error = "grids: 3 Grids erwartet";
+  }
+  for (uint8_t g = 0; g < 3 && error.length() == 0; ++g) {
+    JsonArrayConst tiles = in_grids[g];
+    if (tiles.isNull() || tiles.size() != TILES_PER_GRID) {
+      error = "grids[" + String(g) + "]: " + String(TILES_PER_GRID) + " Tiles erwartet";
+      break;
+    }
+    for (uint8_t i = 0; i < TILES_PER_GRID; ++i) {
+      String tile_error;
+      if (!layout_tile_from_json(tiles[i], grids[g].tiles[i], tile_error)) {
+        error = "grids[" + String(g) + "][" + String(i) + "]: " + tile_error;
+        break;
+      }
+    }
+  }
+  JsonArrayConst in_tabs = doc["tabs"];  // optional
+  if (error.length() == 0 && !in_tabs.isNull()) {
+    if (in_tabs.size() > 4) {
+      error = "tabs: maximal 4";
+    }
+    for (uint8_t i = 0; i < in_tabs.size() && i < 4; ++i) {
+      JsonObjectConst tab = in_tabs[i];
+      if (!tab["name"].isNull()) strlcpy(tabs[i].name, tab["name"] | "", sizeof(tabs[i].name));
+      if (!tab["icon"].isNull()) strlcpy(tabs[i].icon_name, tab["icon"] | "", sizeof(tabs[i].icon_name));
+    }
+  }
+  if (error.length() > 0) {
+    JsonDocument resp;
+    resp["success"] = false;
+    resp["error"] = error;
+    String json;
+    serializeJson(resp, json);
+    reply(400, "application/json", json);
+    return;
+  }
+  const uint32_t parse_us = micros() - start_us;
+
+  // Geaenderte Grids/Tabs vor dem Speichern bestimmen
+  const TileGridConfig* current[3] = {&tileConfig.getTab0Grid(), &tileConfig.getTab1Grid(), &tileConfig.getTab2Grid()};
+  bool grid_changed[3] = {false, false, false};
+  bool tab_changed[4] = {false, false, false, false};
+  uint8_t changed_grids = 0;
+  for (uint8_t g = 0; g < 3; ++g) {
+    for (size_t i = 0; i < TILES_PER_GRID && !grid_changed[g]; ++i) {
+      grid_changed[g] = !layout_same_tile(grids[g].tiles[i], current[g]->tiles[i]);
+    }
+    if (grid_changed[g]) changed_grids++;
+  }
+  for (uint8_t i = 0; i < 4; ++i) {
+    tab_changed[i] = strcmp(tabs[i].name, tileConfig.getTabName(i)) != 0 ||
+                     strcmp(tabs[i].icon_name, tileConfig.getTabIcon(i)) != 0;
+  }
+
+  const uint32_t persist_start = micros();
+  if (!tileConfig.saveLayout(grids.data(), tabs)) {
+    reply(500, "application/json", "{\"success\":false,\"error\":\"Save failed\"}");
+    return;
+  }
+  const uint32_t persist_us = micros() - persist_start;
+
+  if (changed_grids > 0) {
+    mqttReloadDynamicSlots();
+  }
+  {
+    LvglLock lock;
+    for (uint8_t g = 0; g < 3; ++g) {
+      if (grid_changed[g]) tiles_request_reload_if_loaded(static_cast<GridType>(g));
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+      if (tab_changed[i]) uiManager.refreshTabButton(i);
+    }
+  }
+
+  const uint32_t total_us = micros() - start_us;
+  g_layout_perf.imports++;
+  g_layout_perf.last_import_us = total_us;
+  g_layout_perf.last_parse_us = parse_us;
+  g_layout_perf.last_persist_us = persist_us;
+  g_layout_perf.last_changed_grids = changed_grids;
+  Serial.printf("[WebAdmin] Layout importiert: %u Grids geaendert, parse %lu us, speichern %lu us, gesamt %lu us\n",
+                changed_grids, static_cast<unsigned long>(parse_us),
+                static_cast<unsigned long>(persist_us), static_cast<unsigned long>(total_us));
+
+  String json = "{\"success\":true,\"changed_grids\":" + String(changed_grids);
+  json += ",\"parse_us\":" + String(parse_us);
+  json += ",\"persist_us\":" + String(persist_us);
+  json += ",\"total_us\":" + String(total_us) + "}";
+  reply(200, "application/json", json);
+}
+
 void WebAdminServer::handleReorderTiles() {
   // POST /api/tiles/reorder with tab=home|game|weather, from, to
   if (!server.hasArg("tab") || !server.hasArg("from") || !server.hasArg("to")) {
-    server.send(400, "application/json", "{\"success\":false,\"error\":\"Missing parameters\"}");
+    reply(400, "application/json", "{\"success\":false,\"error\":\"Missing parameters\"}");
     return;
   }
 
@@ -568,7 +816,7 @@ void WebAdminServer::handleReorderTiles() {
   int to = server.arg("to").toInt();
 
   if ((tab != "home" && tab != "game" && tab != "weather" && tab != "tab0" && tab != "tab1" && tab != "tab2") || from < 0 || from >= TILES_PER_GRID || to < 0 || to >= TILES_PER_GRID) {
-    server.send(400, "application/json", "{\"success\":false,\"error\":\"Invalid parameters\"}");
+    reply(400, "application/json", "{\"success\":false,\"error\":\"Invalid parameters\"}");
     return;
   }
 
@@ -580,81 +828,87 @@ void WebAdminServer::handleReorderTiles() {
   if (success) {
     mqttReloadDynamicSlots();
     GridType gridType = (tab == "home" || tab == "tab0") ? GridType::TAB0 : ((tab == "game" || tab == "tab1") ? GridType::TAB1 : GridType::TAB2);
-    tiles_update_tile(gridType, static_cast<uint8_t>(from));
-    tiles_update_tile(gridType, static_cast<uint8_t>(to));
-    server.send(200, "application/json", "{\"success\":true}");
+    {
+      LvglLock lock;
+      tiles_update_tile(gridType, static_cast<uint8_t>(from));
+      tiles_update_tile(gridType, static_cast<uint8_t>(to));
+    }
+    reply(200, "application/json", "{\"success\":true}");
   } else {
-    server.send(500, "application/json", "{\"success\":false,\"error\":\"Save failed\"}");
+    reply(500, "application/json", "{\"success\":false,\"error\":\"Save failed\"}");
   }
 }
 
 void WebAdminServer::handleGetSensorValues() {
-  const HaBridgeConfigData& ha = haBridgeConfig.get();
-
-  Serial.println("[WebAdmin] /api/sensor_values Request");
-  Serial.print("[WebAdmin] sensor_values_map: ");
-  Serial.println(ha.sensor_values_map);
-
-  // Build JSON response with sensor values
-  String json = "{";
-  bool first = true;
-
-  // Parse sensor_values_map (format: "entity1=value1\nentity2=value2\n...")
-  const String& valuesMap = ha.sensor_values_map;
-  int start = 0;
-
-  while (start < valuesMap.length()) {
-    int eqPos = valuesMap.indexOf('=', start);
-    if (eqPos < 0) break;
-
-    int endPos = valuesMap.indexOf('\n', eqPos);
-    if (endPos < 0) endPos = valuesMap.length();
-
-    String entity = valuesMap.substring(start, eqPos);
-    String value = valuesMap.substring(eqPos + 1, endPos);
-
-    entity.trim();
-    value.trim();
-
-    if (entity.length() > 0 && value.length() > 0) {
-      if (!first) json += ",";
-      json += "\"";
-      json += entity;
-      json += "\":\"";
-
-      // Escape quotes in value
-      for (int i = 0; i < value.length(); i++) {
-        char c = value.charAt(i);
-        if (c == '"' || c == '\\') json += '\\';
-        json += c;
-      }
-
-      json += "\"";
-      first = false;
-    }
-
-    start = endPos + 1;
+  // Werte im Loop kopieren, gesendet wird hier im Web-Task
+  SensorValueList values;
+  if (!ui_loop_call([&]() { collectSensorValues(values); })) {
+    server.send(503, "application/json", "{\"error\":\"UI beschaeftigt\"}");
+    return;
   }
-
-  json += "}";
-  Serial.print("[WebAdmin] Sending JSON: ");
-  Serial.println(json);
-  server.send(200, "application/json", json);
+  JsonStreamWriter json(server);
+  writeSensorValuesJson(json, values);
+  json.finish();
+  Serial.printf("[WebAdmin] /api/sensor_values: %u Werte\n", static_cast<unsigned>(values.size()));
+  adminLiveServer.notePollBytes(json.bytes());
 }
 
 void WebAdminServer::handleGetSdImages() {
-  std::vector<String> files;
-  collectImageFiles("/", files, 200, 3, true, true);
+  // GET /api/sd_images                       -> ["pfad", ...] (max. 200, wie bisher)
+  // GET /api/sd_images?offset=&limit=&q=&type=bin|jpeg[&rescan=1]
+  //                                          -> {"total":n,"offset":o,"items":[{...}]}
+  const bool rescan = server.hasArg("rescan") && server.arg("rescan") == "1";
+
+  uint8_t mask = SD_IMAGE_MASK_ALL;
+  if (server.hasArg("type")) {
+    String type = server.arg("type");
+    if (type == "bin") mask = SD_IMAGE_MASK_BIN;
+    else if (type == "jpeg" || type == "jpg") mask = SD_IMAGE_MASK_JPEG;
+  }
+  const String query = server.hasArg("q") ? server.arg("q") : String();
+  const bool paged = server.hasArg("offset") || server.hasArg("limit") || server.hasArg("q") || server.hasArg("type");
+  long offset = server.hasArg("offset") ? server.arg("offset").toInt() : 0;
+  long limit = server.hasArg("limit") ? server.arg("limit").toInt() : 200;
+  if (offset < 0) offset = 0;
+  if (limit < 1) limit = 1;
+  if (limit > 500) limit = 500;
+
+  // Index und SD gehoeren dem Loop (sd_image_index_service); Ergebnis hier streamen
+  std::vector<SdImageInfo> files;
+  size_t total = 0;
+  if (!ui_loop_call([&]() {
+        sd_image_index_refresh(rescan);
+        total = sd_image_index_query(mask, query, static_cast<size_t>(offset), static_cast<size_t>(limit), files);
+      })) {
+    server.send(503, "application/json", "{\"error\":\"UI beschaeftigt\"}");
+    return;
+  }
 
-  String json = "[";
-  for (size_t i = 0; i < files.size(); ++i) {
-    if (i > 0) json += ",";
-    json += "\"";
-    appendJsonEscaped(json, files[i]);
-    json += "\"";
+  JsonStreamWriter json(server);
+  if (!paged) {
+    json.beginArray();
+    for (const SdImageInfo& f : files) json.value(f.path);
+    json.endArray();
+  } else {
+    static const char* kFormats[] = {"?", "bin", "bin_rle", "jpeg"};
+    json.beginObject();
+    json.field("total", static_cast<unsigned long>(total));
+    json.field("offset", offset);
+    json.key("items").beginArray();
+    for (const SdImageInfo& f : files) {
+      json.beginObject();
+      json.field("path", f.path);
+      json.field("size", f.size);
+      json.field("mtime", f.mtime);
+      json.field("w", f.w);
+      json.field("h", f.h);
+      json.field("format", kFormats[f.format < 4 ? f.format : 0]);
+      json.endObject();
+    }
+    json.endArray();
+    json.endObject();
   }
-  json += "]";
-  server.send(200, "application/json", json);
+  json.finish();
 }
 
 // ========== Tab Names API ==========
@@ -688,7 +942,7 @@ void WebAdminServer::handleGetTabs() {
 
 void WebAdminServer::handleRenameTab() {
   if (!server.hasArg("tab") || !server.hasArg("name")) {
-    server.send(400, "application/json", "{\"error\":\"Missing tab or name parameter\"}");
+    reply(400, "application/json", "{\"error\":\"Missing tab or name parameter\"}");
     return;
   }
 
@@ -708,7 +962,7 @@ void WebAdminServer::handleRenameTab() {
   }
 
   if (tab_index == 255) {
-    server.send(400, "application/json", "{\"error\":\"Invalid tab\"}");
+    reply(400, "application/json", "{\"error\":\"Invalid tab\"}");
     return;
   }
 
@@ -717,8 +971,395 @@ void WebAdminServer::handleRenameTab() {
   tileConfig.saveTabNames();
 
   // Display Live-Update: Tab-Button sofort aktualisieren
-  uiManager.refreshTabButton(tab_index);
+  {
+    LvglLock lock;
+    uiManager.refreshTabButton(tab_index);
+  }
 
-  server.send(200, "application/json", "{\"success\":true}");
+  reply(200, "application/json", "{\"success\":true}");
   Serial.printf("[WebAdmin] Tab %u renamed to: %s (icon: %s)\n", tab_index, name.c_str(), icon_name.c_str());
 }
+
+void WebAdminServer::handleGetRenderBench() {
+  if (tile_render_bench_is_pending()) {
+    reply(200, "application/json", "{\"pending\":true}");
+    return;
+  }
+  reply(200, "application/json", tile_render_bench_last_json());
+}
+
+void WebAdminServer::handleRunRenderBench() {
+  // POST /api/render_bench [record=1] [image=/pfad]
+  bool record = server.hasArg("record") && server.arg("record") == "1";
+  String image = server.hasArg("image") ? server.arg("image") : "";
+  image.trim();
+  tile_render_bench_request(record, image);
+  reply(202, "application/json", "{\"success\":true,\"pending\":true}");
+  Serial.printf("[WebAdmin] Render-Benchmark angefordert (record=%d)\n", record ? 1 : 0);
+}
+
+void WebAdminServer::handleGetPerf() {
+  // GET /api/perf[?reset_loop=1] - Laufzeitzaehler (SD-Durchsatz, Image-Cache, Config-Image, Layout)
+  ImageCacheStats img = image_cache_get_stats();
+  String json = "{\"sd\":" + sd_io_stats_json();
+  json += ",\"image_cache\":{\"entries\":" + String(img.entries);
+  json += ",\"bytes\":" + String(static_cast<unsigned long>(img.bytes));
+  json += ",\"hits\":" + String(img.hits);
+  json += ",\"misses\":" + String(img.misses);
+  json += ",\"evictions\":" + String(img.evictions) + "}";
+  json += ",\"url_cache\":" + image_popup_url_cache_stats_json();
+  SdImageIndexStats idx = sd_image_index_get_stats();
+  json += ",\"sd_index\":{\"entries\":" + String(idx.entries);
+  json += ",\"dirs\":" + String(idx.dirs);
+  json += ",\"refreshes\":" + String(idx.refreshes);
+  json += ",\"last_refresh_ms\":" + String(idx.last_refresh_ms);
+  json += ",\"last_cold\":" + String(idx.last_cold ? "true" : "false");
+  json += ",\"last_dirs_listed\":" + String(idx.last_dirs_listed);
+  json += ",\"last_files_stat\":" + String(idx.last_files_stat);
+  json += ",\"probe_pending\":" + String(idx.probe_pending) + "}";
+  json += ",\"config\":" + configStore.statsJson();
+  EntityTableStats ent = entityTable.stats();
+  json += ",\"entities\":{\"entries\":" + String(ent.entries);
+  json += ",\"capacity\":" + String(ent.capacity);
+  json += ",\"pool_bytes\":" + String(ent.pool_bytes);
+  json += ",\"lookups\":" + String(ent.lookups);
+  json += ",\"probes\":" + String(ent.probes);
+  json += ",\"updates\":" + String(ent.updates);
+  EntityStateStats est = entity_state_get_stats();
+  json += ",\"cache_hits\":" + String(est.hits);
+  json += ",\"cache_misses\":" + String(est.misses);
+  json += ",\"parses\":" + String(est.parses);
+  json += ",\"parse_avg_us\":" + String(est.parses ? static_cast<float>(est.parse_us_total) / est.parses : 0.0f, 1) + "}";
+  json += ",\"snapshot\":" + entity_snapshot_stats_json();
+  json += ",\"live\":" + adminLiveServer.statsJson();
+  const UiLoopStats ul = ui_loop_get_stats();
+  json += ",\"ui_loop\":{\"iterations\":" + String(ul.iterations);
+  json += ",\"iter_max_us\":" + String(ul.iter_max_us);
+  json += ",\"posted\":" + String(ul.posted);
+  json += ",\"calls\":" + String(ul.calls);
+  json += ",\"executed\":" + String(ul.executed);
+  json += ",\"abandoned\":" + String(ul.abandoned);
+  json += ",\"overflows\":" + String(ul.overflows);
+  json += ",\"wait_max_us\":" + String(ul.wait_max_us);
+  json += ",\"job_max_us\":" + String(ul.job_max_us) + "}";
+  json += ",\"web\":{\"task\":" + String(hasTask() ? "true" : "false");
+  json += ",\"stack_free\":" + String(taskStackFree()) + "}";
+  const JsonStreamStats& js = json_stream_stats();
+  json += ",\"json_stream\":{\"responses\":" + String(js.responses);
+  json += ",\"bytes\":" + String(js.bytes);
+  json += ",\"chunks\":" + String(js.chunks);
+  json += ",\"last_bytes\":" + String(js.last_bytes);
+  json += ",\"last_us\":" + String(js.last_us);
+  json += ",\"max_us\":" + String(js.max_us);
+  json += ",\"peak_heap_bytes\":" + String(js.peak_heap_bytes) + "}";
+  json += ",\"admin_page\":{\"requests\":" + String(page_perf.requests);
+  json += ",\"last_us\":" + String(page_perf.last_us);
+  json += ",\"max_us\":" + String(page_perf.max_us);
+  json += ",\"bytes\":" + String(page_perf.last_bytes);
+  json += ",\"chunks\":" + String(page_perf.last_chunks);
+  json += ",\"peak_heap_bytes\":" + String(page_perf.peak_heap_bytes);
+  json += ",\"asset_sent\":" + String(page_perf.asset_sent);
+  json += ",\"asset_not_modified\":" + String(page_perf.asset_not_modified);
+  json += ",\"asset_gzip_bytes\":" + String(static_cast<unsigned>(WEB_ASSET_ADMIN_CSS.gz_len + WEB_ASSET_ADMIN_JS.gz_len));
+  json += ",\"asset_raw_bytes\":" + String(static_cast<unsigned>(WEB_ASSET_ADMIN_CSS.raw_len + WEB_ASSET_ADMIN_JS.raw_len));
+  json += ",\"client_load_ms\":" + String(page_perf.client_load_ms);
+  json += ",\"client_html_ms\":" + String(page_perf.client_html_ms) + "}";
+  const ConfigStoreStats store = configStore.stats();
+  const uint32_t commit_avg_us = store.commits
+      ? static_cast<uint32_t>(store.commit_us_total / store.commits) : 0;
+#if CONFIG_STORE_QUIET_MS == 0
+  // Ohne Write-Behind schreibt saveSingleGrid selbst - die Messung enthaelt den Flash schon
+  const uint32_t tile_commit_us = 0;
+#else
+  const uint32_t tile_commit_us = commit_avg_us;
+#endif
+  const uint32_t tile_ram_avg_us = g_layout_perf.tile_saves
+      ? static_cast<uint32_t>(g_layout_perf.tile_save_us_total / g_layout_perf.tile_saves) : 0;
+  json += ",\"layout\":{\"tile_saves\":" + String(g_layout_perf.tile_saves);
+  json += ",\"tile_write_behind\":" + String(CONFIG_STORE_QUIET_MS > 0 ? "true" : "false");
+  json += ",\"tile_save_ram_avg_us\":" + String(tile_ram_avg_us);
+  json += ",\"commit_avg_us\":" + String(commit_avg_us);
+  json += ",\"tile_path_36_ram_est_us\":" + String(tile_ram_avg_us * 36UL);
+  json += ",\"tile_path_36_flash_min_est_us\":" + String(tile_ram_avg_us * 36UL + tile_commit_us);
+  json += ",\"tile_path_36_flash_max_est_us\":" + String((tile_ram_avg_us + tile_commit_us) * 36UL);
+  json += ",\"imports\":" + String(g_layout_perf.imports);
+  json += ",\"last_import_ram_us\":" + String(g_layout_perf.last_import_us - g_layout_perf.last_persist_us);
+  json += ",\"last_import_flash_us\":" + String(g_layout_perf.last_import_us);
+  json += ",\"last_parse_us\":" + String(g_layout_perf.last_parse_us);
+  json += ",\"last_persist_us\":" + String(g_layout_perf.last_persist_us);
+  json += ",\"last_changed_grids\":" + String(g_layout_perf.last_changed_grids) + "}";
+  json += "}";
+  reply(200, "application/json", json);
+  // Lastmessung: Maxima nach dem Auslesen zuruecksetzen (web-assets/loadgen.js)
+  if (server.hasArg("reset_loop") && server.arg("reset_loop") == "1") ui_loop_reset_max();
+}
+
+void WebAdminServer::handleEntityBench() {
+  // GET /api/perf/entity_bench [n=500] [rate=50] [s=60] - alte Key=Value-Strings vs. Entity-Tabelle.
+  // Laeuft im Web-Task auf einer Scratch-Tabelle; der UI-Loop bleibt frei.
+  long n = server.hasArg("n") ? server.arg("n").toInt() : 500;
+  long rate = server.hasArg("rate") ? server.arg("rate").toInt() : 50;
+  long sec = server.hasArg("s") ? server.arg("s").toInt() : 60;
+  if (n < 1) n = 1;
+  if (n > 2000) n = 2000;
+  if (rate < 1) rate = 1;
+  if (rate > 500) rate = 500;
+  if (sec < 1) sec = 1;
+  if (sec > 600) sec = 600;
+  server.send(200, "application/json",
+              entity_table_benchmark(static_cast<uint16_t>(n), static_cast<uint16_t>(rate),
+                                     static_cast<uint16_t>(sec)));
+}
+
+namespace {
+
+// Bisherige String-Antworten als Referenz fuer /api/perf/json_bench
+void legacyTileJson(String& json, const Tile& tile) {
+  json += "{";
+  json += "\"type\":" + String((int)tile.type) + ",";
+  json += "\"title\":\"";
+  json += tile.title;
+  json += "\",\"icon_name\":\"";
+  json += tile.icon_name;
+  json += "\",\"bg_color\":" + String(tile.bg_color) + ",";
+  json += "\"sensor_entity\":\"";
+  json += tile.sensor_entity;
+  json += "\",\"sensor_unit\":\"";
+  json += tile.sensor_unit;
+  json += "\",\"sensor_decimals\":";
+  json += String(tile.sensor_decimals == 0xFF ? -1 : (int)tile.sensor_decimals);
+  json += ",\"sensor_value_font\":";
+  json += String(tile.sensor_value_font);
+  json += ",\"scene_alias\":\"";
+  json += tile.scene_alias;
+  json += "\",\"key_macro\":\"";
+  json += tile.key_macro;
+  json += "\",\"key_code\":" + String(tile.key_code) + ",";
+  json += "\"key_modifier\":" + String(tile.key_modifier);
+  json += ",\"switch_style\":";
+  json += String((tile.type == TILE_SWITCH && tile.sensor_decimals == 1) ? 1 : 0);
+  json += ",\"image_path\":\"";
+  json += tile.image_path;
+  json += "\",\"image_slideshow_sec\":";
+  json += String(tile.image_slideshow_sec);
+  json += "}";
+}
+
+void legacySensorValuesJson(String& json) {
+  json = "{";
+  json.reserve(entityTable.size() * 40 + 2);
+  bool first = true;
+  entityTable.forEach([&](const EntityEntry& e) {
+    if (e.value.length() == 0) return;
+    if (!first) json += ",";
+    json += "\"";
+    json += e.id;
+    json += "\":\"";
+    for (size_t i = 0; i < e.value.length(); i++) {
+      char c = e.value.charAt(i);
+      if (c == '"' || c == '\\') json += '\\';
+      json += c;
+    }
+    json += "\"";
+    first = false;
+  });
+  json += "}";
+}
+
+// Zeichen, die der alte Pfad nicht (korrekt) escaped hat
+bool needsEscape(const String& s) {
+  for (size_t i = 0; i < s.length(); ++i) {
+    const uint8_t c = static_cast<uint8_t>(s.charAt(i));
+    if (c == '"' || c == '\\' || c < 0x20) return true;
+  }
+  return false;
+}
+
+struct JsonBenchCase {
+  uint32_t legacy_bytes;
+  uint32_t legacy_us;
+  uint32_t legacy_heap;   // Heap, den der fertige String belegt
+  uint32_t stream_bytes;
+  uint32_t stream_us;
+  uint32_t stream_heap;   // Spitze waehrend des Schreibens (ein Chunk)
+  bool identical;
+};
+
+template <typename LegacyFn, typename StreamFn>
+JsonBenchCase runJsonBenchCase(LegacyFn legacy, StreamFn stream) {
+  JsonBenchCase r = {};
+  uint32_t heap_before = ESP.getFreeHeap();
+  uint32_t start = micros();
+  String ref;
+  legacy(ref);
+  r.legacy_us = micros() - start;
+  const uint32_t heap_after = ESP.getFreeHeap();
+  r.legacy_heap = heap_before > heap_after ? heap_before - heap_after : 0;
+  r.legacy_bytes = ref.length();
+  const uint32_t ref_crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(ref.c_str()), ref.length());
+  ref = String();
+
+  start = micros();
+  JsonStreamWriter json(nullptr);  // nur zaehlen + CRC, nichts puffern
+  stream(json);
+  json.finish();
+  r.stream_us = micros() - start;
+  r.stream_bytes = json.bytes();
+  r.stream_heap = json.peakHeapBytes();
+  r.identical = (r.stream_bytes == r.legacy_bytes) && (json.crc() == ref_crc);
+  return r;
+}
+
+void writeBenchCase(JsonStreamWriter& json, const JsonBenchCase& r) {
+  json.beginObject();
+  json.field("identical", r.identical);
+  json.field("legacy_bytes", r.legacy_bytes);
+  json.field("legacy_us", r.legacy_us);
+  json.field("legacy_heap", r.legacy_heap);
+  json.field("stream_bytes", r.stream_bytes);
+  json.field("stream_us", r.stream_us);
+  json.field("stream_heap", r.stream_heap);
+  json.endObject();
+}
+
+}  // namespace
+
+void WebAdminServer::handleJsonBench() {
+  // GET /api/perf/json_bench - alte String-Antworten vs. JsonStreamWriter auf den echten Daten:
+  // Byte-Vergleich (Laenge + CRC) und Heap-Spitze. Abweichungen sind nur bei Texten mit
+  // Anfuehrungszeichen, Backslash oder Steuerzeichen zu erwarten (escape_fields).
+  const TileGridConfig* grids[] = {&tileConfig.getTab0Grid(), &tileConfig.getTab1Grid(), &tileConfig.getTab2Grid()};
+  JsonBenchCase tiles[3];
+  uint32_t escape_fields = 0;
+  for (uint8_t g = 0; g < 3; ++g) {
+    const TileGridConfig& grid = *grids[g];
+    tiles[g] = runJsonBenchCase(
+        [&](String& out) {
+          out = "[";
+          for (uint8_t i = 0; i < TILES_PER_GRID; i++) {
+            if (i > 0) out += ",";
+            legacyTileJson(out, grid.tiles[i]);
+          }
+          out += "]";
+        },
+        [&](JsonStreamWriter& w) {
+          w.beginArray();
+          for (uint8_t i = 0; i < TILES_PER_GRID; i++) writeTileJson(w, grid.tiles[i]);
+          w.endArray();
+        });
+    for (uint8_t i = 0; i < TILES_PER_GRID; i++) {
+      const Tile& t = grid.tiles[i];
+      const String* texts[] = {&t.title, &t.icon_name, &t.sensor_entity, &t.sensor_unit,
+                               &t.scene_alias, &t.key_macro, &t.image_path};
+      for (const String* text : texts) escape_fields += needsEscape(*text) ? 1 : 0;
+    }
+    yield();
+  }
+  const JsonBenchCase values = runJsonBenchCase(
+      [](String& out) { legacySensorValuesJson(out); },
+      [](JsonStreamWriter& w) {
+        SensorValueList list;
+        collectSensorValues(list);
+        writeSensorValuesJson(w, list);
+      });
+
+  // Escaping-Rundreise: Writer-Ausgabe mit ArduinoJson zurueckparsen
+  const char* kTricky = "Zitat \" Backslash \\ Zeile\nTab\tSteuer\x01 \xC3\xA4\xC3\xB6\xC3\xBC";
+  String captured;
+  {
+    JsonStreamWriter w(&captured);
+    w.beginObject().field("s", kTricky).endObject();
+    w.finish();
+  }
+  JsonDocument doc;
+  const bool roundtrip = !deserializeJson(doc, captured) && strcmp(doc["s"] | "", kTricky) == 0;
+
+  Serial.printf("[WebAdmin] JSON-Bench: Tiles %s/%s/%s, Werte %s, Escaping %s, Heap alt %lu / neu %lu\n",
+                tiles[0].identical ? "gleich" : "ABWEICHUNG", tiles[1].identical ? "gleich" : "ABWEICHUNG",
+                tiles[2].identical ? "gleich" : "ABWEICHUNG", values.identical ? "gleich" : "ABWEICHUNG",
+                roundtrip ? "ok" : "FEHLER",
+                static_cast<unsigned long>(values.legacy_heap), static_cast<unsigned long>(values.stream_heap));
+
+  String body;
+  JsonStreamWriter json(&body);
+  json.beginObject();
+  json.key("tiles").beginArray();
+  for (uint8_t g = 0; g < 3; ++g) writeBenchCase(json, tiles[g]);
+  json.endArray();
+  json.key("sensor_values");
+  writeBenchCase(json, values);
+  json.field("entities", static_cast<unsigned long>(entityTable.size()));
+  json.field("escape_fields", escape_fields);
+  json.field("escape_roundtrip", roundtrip);
+  json.field("chunk_size", static_cast<unsigned long>(JsonStreamWriter::kChunkSize));
+  json.endObject();
+  json.finish();
+  reply(200, "application/json", body);
+}
+
+void WebAdminServer::handleConfigCommit() {
+  // POST /api/config/commit - vorgemerkte Aenderungen sofort schreiben (Seite verlassen, Neustart)
+  bool was_pending = configStore.pending();
+  bool ok = configStore.flush();
+  String json = "{\"success\":" + String(ok ? "true" : "false");
+  json += ",\"written\":" + String(was_pending && ok ? "true" : "false") + "}";
+  reply(ok ? 200 : 500, "application/json", json);
+}
+
+void WebAdminServer::handleAsset(const WebAsset& asset) {
+  // GET /admin.css, /admin.js - gzip aus dem Flash; die Seite verlinkt mit ?v=<ETag>,
+  // daher darf der Browser unbegrenzt cachen
+  server.sendHeader("Cache-Control", "public, max-age=31536000, immutable");
+  server.sendHeader("ETag", asset.etag);
+  if (server.header("If-None-Match") == asset.etag) {
+    page_perf.asset_not_modified++;
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset.content_type, reinterpret_cast<PGM_P>(asset.gz), asset.gz_len);
+  page_perf.asset_sent++;
+}
+
+void WebAdminServer::handlePageLoadReport() {
+  // POST /api/perf/page_load {"load_ms":..,"html_ms":..} - Navigation Timing aus dem Browser
+  JsonDocument doc;
+  if (deserializeJson(doc, server.arg("plain"))) {
+    server.send(400, "application/json", "{\"success\":false}");
+    return;
+  }
+  page_perf.client_load_ms = doc["load_ms"] | 0;
+  page_perf.client_html_ms = doc["html_ms"] | 0;
+  Serial.printf("[WebAdmin] Seite im Browser geladen: %lu ms (HTML %lu ms)\n",
+                static_cast<unsigned long>(page_perf.client_load_ms),
+                static_cast<unsigned long>(page_perf.client_html_ms));
+  server.send(204);
+}
+
+void WebAdminServer::handleUrlSchedSim() {
+  // GET /api/perf/url_sched_sim [n=100] [s=3600] - virtuelle Uhr, blockiert nur wenige ms
+  long n = server.hasArg("n") ? server.arg("n").toInt() : 100;
+  long sec = server.hasArg("s") ? server.arg("s").toInt() : 3600;
+  if (n < 1) n = 1;
+  if (n > 1000) n = 1000;
+  if (sec < 60) sec = 60;
+  if (sec > 86400) sec = 86400;
+  server.send(200, "application/json",
+              url_refresh_sched_simulate(static_cast<uint16_t>(n), static_cast<uint32_t>(sec)));
+}
+
+void WebAdminServer::handleMetrics() {
+  // GET /api/metrics - Prometheus-Textformat. Werte im Loop einsammeln (Gauges lesen
+  // Loop-Objekte), senden hier im Web-Task: ein langsamer Scraper haelt die UI nicht auf.
+  std::vector<String> chunks;
+  if (!ui_loop_call([&chunks]() { metrics_render([&chunks](const String& chunk) { chunks.push_back(chunk); }); })) {
+    server.send(503, "text/plain", "UI beschaeftigt\n");
+    return;
+  }
+
+  server.sendHeader("Cache-Control", "no-cache");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4; charset=utf-8", "");
+  for (const String& chunk : chunks) server.sendContent(chunk);
+  server.sendContent("");
+}
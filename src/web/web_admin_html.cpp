@@ -8,18 +8,79 @@
 #include "src/core/config_manager.h"
 #include "src/network/ha_bridge_config.h"
 #include "src/game/game_controls_config.h"
-#include "src/web/web_admin_scripts.h"
-#include "src/web/web_admin_styles.h"
+#include "src/web/web_admin_assets.h"
+#include "src/web/web_live.h"
+#include "src/web/json_stream.h"
+#include "src/core/ui_loop.h"
 #include "src/tiles/tile_config.h"
+#include "src/ui/image_cache.h"
+
+// Chunked-Ausgabe der Admin-Seite: statt eines grossen Strings werden Stuecke
+// von ~1 TCP-Segment per sendContent verschickt (kein grosser zusammenhaengender Heap-Block)
+class ChunkedHtml {
+public:
+  static constexpr size_t kChunkSize = 1460;
+
+  ChunkedHtml(WebServer& server, AdminPagePerf& perf, uint32_t heap_base)
+      : server(server), perf(perf), heap_base(heap_base) {
+    buf.reserve(kChunkSize + 256);
+    server.sendHeader("Cache-Control", "no-cache");
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/html", "");
+  }
+
+  ChunkedHtml& operator+=(const String& s) { buf += s; check(); return *this; }
+  ChunkedHtml& operator+=(const char* s) { buf += s; check(); return *this; }
+  ChunkedHtml& operator+=(char c) { buf += c; check(); return *this; }
+
+  // Direkter Zugriff fuer String&-Helfer (appendHtmlEscaped); gesendet wird beim naechsten +=
+  String& buffer() { return buf; }
+
+  void finish() {
+    flush();
+    server.sendContent("");  // Ende der chunked-Uebertragung
+  }
+
+private:
+  void check() {
+    if (buf.length() >= kChunkSize) flush();
+  }
+
+  void flush() {
+    if (!buf.length()) return;
+    const uint32_t free_now = ESP.getFreeHeap();
+    if (heap_base > free_now && heap_base - free_now > perf.peak_heap_bytes) {
+      perf.peak_heap_bytes = heap_base - free_now;
+    }
+    server.sendContent(buf);
+    bytes += buf.length();
+    chunks++;
+    buf = "";
+  }
+
+  WebServer& server;
+  AdminPagePerf& perf;
+  uint32_t heap_base;
+  String buf;
+
+public:
+  uint32_t bytes = 0;
+  uint16_t chunks = 0;
+};
+
+static void appendHtmlEscaped(ChunkedHtml& out, const String& value) {
+  appendHtmlEscaped(out.buffer(), value);
+}
 
 // Helper function to generate tile tab HTML (unified for all 3 tabs)
 static void appendTileTabHTML(
-    String& html,
+    ChunkedHtml& html,
     uint8_t tab_index,
     const TileGridConfig& grid,
     const std::vector<String>& sensorOptions,
     const std::vector<SceneOption>& sceneOptions,
     const std::vector<String>& switchOptions,
+    const String* initialValues,  // Rohwerte je Kachel (im Loop kopiert)
     const std::function<String(const String&, uint8_t)>& formatSensorValue
 ) {
   String tab_id = "tab" + String(tab_index);
@@ -181,8 +242,7 @@ static void appendTileTabHTML(
 
       String sensorValue = "--";
       if (tile.sensor_entity.length()) {
-        sensorValue = haBridgeConfig.findSensorInitialValue(tile.sensor_entity);
-        sensorValue = formatSensorValue(sensorValue, tile.sensor_decimals);
+        sensorValue = formatSensorValue(initialValues[i], tile.sensor_decimals);
         if (sensorValue.length() == 0) {
           sensorValue = "--";
         }
@@ -418,13 +478,38 @@ static void appendTileTabHTML(
 )html";
 }
 
-String WebAdminServer::getAdminPage() {
+void WebAdminServer::sendAdminPage() {
+  const uint32_t start_us = micros();
+  const uint32_t heap_base = ESP.getFreeHeap();
+  page_perf.peak_heap_bytes = 0;
   const DeviceConfig& cfg = configManager.getConfig();
-  const HaBridgeConfigData& ha = haBridgeConfig.get();
-  const auto sensorOptions = parseSensorList(ha.sensors_text);
-  const auto sceneOptions = parseSceneList(ha.scene_alias_text);
-  const auto lightOptions = parseSensorList(ha.lights_text);
-  const auto switchOptionsRaw = parseSensorList(ha.switches_text);
+  const TileGridConfig* grids[3] = {&tileConfig.getTab0Grid(), &tileConfig.getTab1Grid(), &tileConfig.getTab2Grid()};
+
+  // Bridge-Listen und Startwerte gehoeren dem Loop (MQTT): einmal kopieren, dann
+  // ohne Lock streamen - ein langsamer Browser haelt so nur den Web-Task auf
+  std::vector<String> sensorOptions;
+  std::vector<SceneOption> sceneOptions;
+  std::vector<String> lightOptions;
+  std::vector<String> switchOptionsRaw;
+  std::vector<String> initialValues(3 * TILES_PER_GRID);
+  const bool copied = ui_loop_call([&]() {
+    const HaBridgeConfigData& ha = haBridgeConfig.get();
+    sensorOptions = parseSensorList(ha.sensors_text);
+    sceneOptions = parseSceneList(ha.scene_alias_text);
+    lightOptions = parseSensorList(ha.lights_text);
+    switchOptionsRaw = parseSensorList(ha.switches_text);
+    for (uint8_t g = 0; g < 3; ++g) {
+      for (uint8_t i = 0; i < TILES_PER_GRID; ++i) {
+        const Tile& tile = grids[g]->tiles[i];
+        if (tile.type != TILE_SENSOR || !tile.sensor_entity.length()) continue;
+        initialValues[g * TILES_PER_GRID + i] = haBridgeConfig.findSensorInitialValue(tile.sensor_entity);
+      }
+    }
+  });
+  if (!copied) {
+    server.send(503, "text/plain", "UI beschaeftigt - bitte neu laden");
+    return;
+  }
   std::vector<String> switchOptions;
   switchOptions.reserve(lightOptions.size() + switchOptionsRaw.size());
   auto addSwitchOption = [&](const String& entry) {
@@ -460,8 +545,7 @@ String WebAdminServer::getAdminPage() {
     return String(f, static_cast<unsigned int>(d));
   };
 
-  String html;
-  html.reserve(12000);
+  ChunkedHtml html(server, page_perf, heap_base);
   html += R"html(
 <!DOCTYPE html>
 <html lang="de">
@@ -471,12 +555,25 @@ String WebAdminServer::getAdminPage() {
   <title>Tab5 Admin</title>
 )html";
 
-  appendAdminStyles(html);
-  appendAdminScripts(html);
+  // Statische Dateien separat (gzip, gecacht); ?v= wechselt mit dem Inhalt
+  html += R"html(  <link rel="stylesheet" href="https://cdn.jsdelivr.net/npm/@mdi/font@7.4.47/css/materialdesignicons.min.css">
+  <link rel="stylesheet" href=")html";
+  html += WEB_ASSET_ADMIN_CSS.path;
+  html += "?v=";
+  html += WEB_ASSET_ADMIN_CSS.version;
+  html += R"html(">
+  <script src=")html";
+  html += WEB_ASSET_ADMIN_JS.path;
+  html += "?v=";
+  html += WEB_ASSET_ADMIN_JS.version;
+  html += R"html("></script>
+)html";
 
   html += R"html(
 </head>
-<body>
+<body data-live-port=")html";
+  html += String(ADMIN_LIVE_PORT);
+  html += R"html(">
   <div class="wrapper">
     <div class="card">
       <h1>Tab5 Admin-Panel</h1>
@@ -600,9 +697,10 @@ String WebAdminServer::getAdminPage() {
 )html";
 
   // Generate three unified tile tabs
-  appendTileTabHTML(html, 0, tileConfig.getTab0Grid(), sensorOptions, sceneOptions, switchOptions, formatSensorValue);
-  appendTileTabHTML(html, 1, tileConfig.getTab1Grid(), sensorOptions, sceneOptions, switchOptions, formatSensorValue);
-  appendTileTabHTML(html, 2, tileConfig.getTab2Grid(), sensorOptions, sceneOptions, switchOptions, formatSensorValue);
+  for (uint8_t g = 0; g < 3; ++g) {
+    appendTileTabHTML(html, g, *grids[g], sensorOptions, sceneOptions, switchOptions,
+                      &initialValues[g * TILES_PER_GRID], formatSensorValue);
+  }
 
   html += R"html(
       <!-- Tab 3: Settings (Network/MQTT Configuration) -->
@@ -695,7 +793,17 @@ String WebAdminServer::getAdminPage() {
 </html>
 )html";
 
-  return html;
+  html.finish();
+
+  const uint32_t elapsed_us = micros() - start_us;
+  page_perf.requests++;
+  page_perf.last_us = elapsed_us;
+  if (elapsed_us > page_perf.max_us) page_perf.max_us = elapsed_us;
+  page_perf.last_bytes = html.bytes;
+  page_perf.last_chunks = html.chunks;
+  Serial.printf("[WebAdmin] Seite gesendet: %lu Bytes in %u Chunks, %lu us, Heap-Spitze %lu Bytes\n",
+                static_cast<unsigned long>(html.bytes), html.chunks, static_cast<unsigned long>(elapsed_us),
+                static_cast<unsigned long>(page_perf.peak_heap_bytes));
 }
 
 String WebAdminServer::getSuccessPage() {
@@ -746,44 +854,50 @@ String WebAdminServer::getBridgeSuccessPage() {
 </html>)html";
 }
 
-String WebAdminServer::getStatusJSON() {
+void WebAdminServer::writeStatusJSON(JsonStreamWriter& json) {
   const DeviceConfig& cfg = configManager.getConfig();
   nvs_stats_t stats{};
   bool stats_ok = (nvs_get_stats(nullptr, &stats) == ESP_OK);
 
-  auto get_ns_used = [](const char* ns) -> size_t {
-    if (!ns) return static_cast<size_t>(-1);
+  // -1 = Namespace nicht lesbar
+  auto get_ns_used = [](const char* ns) -> long {
+    if (!ns) return -1;
     nvs_handle_t h = 0;
-    if (nvs_open(ns, NVS_READONLY, &h) != ESP_OK) return static_cast<size_t>(-1);
+    if (nvs_open(ns, NVS_READONLY, &h) != ESP_OK) return -1;
     size_t used = 0;
     esp_err_t err = nvs_get_used_entry_count(h, &used);
     nvs_close(h);
-    return (err == ESP_OK) ? used : static_cast<size_t>(-1);
+    return (err == ESP_OK) ? static_cast<long>(used) : -1;
   };
 
-  size_t tiles_used = get_ns_used("tab5_tiles");
-  size_t config_used = get_ns_used("tab5_config");
-
-  String json = "{";
-  json += "\"wifi_connected\":";
-  json += (WiFi.status() == WL_CONNECTED) ? "true" : "false";
-  json += ",\"wifi_ssid\":\"" + String(cfg.wifi_ssid) + "\"";
-  json += ",\"wifi_ip\":\"" + WiFi.localIP().toString() + "\"";
-  json += ",\"mqtt_host\":\"" + String(cfg.mqtt_host) + "\"";
-  json += ",\"mqtt_port\":" + String(cfg.mqtt_port);
-  json += ",\"mqtt_base\":\"" + String(cfg.mqtt_base_topic) + "\"";
-  json += ",\"ha_prefix\":\"" + String(cfg.ha_prefix) + "\"";
-  json += ",\"bridge_configured\":" + String(haBridgeConfig.hasData() ? "true" : "false");
-  json += ",\"free_heap\":" + String(ESP.getFreeHeap());
-  json += ",\"heap_total\":" + String(ESP.getHeapSize());
-  json += ",\"heap_min_free\":" + String(ESP.getMinFreeHeap());
-  json += ",\"psram_free\":" + String(ESP.getFreePsram());
-  json += ",\"psram_total\":" + String(ESP.getPsramSize());
-  json += ",\"nvs_used_entries\":" + String(stats_ok ? stats.used_entries : -1);
-  json += ",\"nvs_free_entries\":" + String(stats_ok ? stats.free_entries : -1);
-  json += ",\"nvs_namespace_count\":" + String(stats_ok ? stats.namespace_count : -1);
-  json += ",\"nvs_tab5_tiles_used\":" + String(tiles_used);
-  json += ",\"nvs_tab5_config_used\":" + String(config_used);
-  json += "}";
-  return json;
+  json.beginObject();
+  json.field("wifi_connected", WiFi.status() == WL_CONNECTED);
+  json.field("wifi_ssid", cfg.wifi_ssid);
+  json.field("wifi_ip", WiFi.localIP().toString());
+  json.field("mqtt_host", cfg.mqtt_host);
+  json.field("mqtt_port", cfg.mqtt_port);
+  json.field("mqtt_base", cfg.mqtt_base_topic);
+  json.field("ha_prefix", cfg.ha_prefix);
+  json.field("bridge_configured", haBridgeConfig.hasData());
+  json.field("free_heap", ESP.getFreeHeap());
+  json.field("heap_total", ESP.getHeapSize());
+  json.field("heap_min_free", ESP.getMinFreeHeap());
+  json.field("psram_free", ESP.getFreePsram());
+  json.field("psram_total", ESP.getPsramSize());
+  json.field("nvs_used_entries", stats_ok ? static_cast<long>(stats.used_entries) : -1L);
+  json.field("nvs_free_entries", stats_ok ? static_cast<long>(stats.free_entries) : -1L);
+  json.field("nvs_namespace_count", stats_ok ? static_cast<long>(stats.namespace_count) : -1L);
+  json.field("nvs_tab5_tiles_used", get_ns_used("tab5_tiles"));
+  json.field("nvs_tab5_config_used", get_ns_used("tab5_config"));
+  const ImageCacheStats img_cache = image_cache_get_stats();
+  json.key("image_cache").beginObject();
+  json.field("entries", img_cache.entries);
+  json.field("pinned", img_cache.pinned);
+  json.field("bytes", static_cast<unsigned long>(img_cache.bytes));
+  json.field("budget", static_cast<unsigned long>(img_cache.budget));
+  json.field("hits", img_cache.hits);
+  json.field("misses", img_cache.misses);
+  json.field("evictions", img_cache.evictions);
+  json.endObject();
+  json.endObject();
 }
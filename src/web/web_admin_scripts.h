@@ -1,9 +0,0 @@
-#ifndef WEB_ADMIN_SCRIPTS_H
-#define WEB_ADMIN_SCRIPTS_H
-
-#include <Arduino.h>
-
-// Append shared JavaScript for the Web Admin page to the provided HTML buffer.
-void appendAdminScripts(String& html);
-
-#endif // WEB_ADMIN_SCRIPTS_H
@@ -1,9 +0,0 @@
-#ifndef WEB_ADMIN_STYLES_H
-#define WEB_ADMIN_STYLES_H
-
-#include <Arduino.h>
-
-// Append shared CSS for the Web Admin page to the provided HTML buffer.
-void appendAdminStyles(String& html);
-
-#endif // WEB_ADMIN_STYLES_H
@@ -0,0 +1,178 @@
+#include "src/web/web_live.h"
+#include "src/web/json_stream.h"
+#include "src/network/entity_table.h"
+#include "src/core/metrics.h"
+
+// Globale Instanz
+AdminLiveServer adminLiveServer;
+static MetricCallback g_live_clients_metric("tab5_websocket_clients", "Verbundene WebSocket-Clients", MetricType::Gauge,
+                                            []() -> double { return adminLiveServer.clientCount(); },
+                                            "server=\"admin\"");
+// poll_rate: notePollBytes aus dem Web-Task, statsJson im Loop
+static portMUX_TYPE g_poll_rate_mux = portMUX_INITIALIZER_UNLOCKED;
+
+/* === ByteRate === */
+void ByteRate::advance() {
+  const uint32_t now_min = millis() / 60000UL;
+  if (!started) {
+    started = true;
+    minute = now_min;
+    first_minute = now_min;
+    return;
+  }
+  if (now_min - minute >= kBuckets) {
+    // Laenger als das Fenster nichts gezaehlt: alles verfallen
+    for (uint8_t i = 0; i < kBuckets; ++i) buckets[i] = 0;
+    minute = now_min;
+    return;
+  }
+  while (minute < now_min) {
+    minute++;
+    buckets[minute % kBuckets] = 0;
+  }
+}
+
+void ByteRate::add(uint32_t bytes) {
+  advance();
+  buckets[minute % kBuckets] += bytes;
+}
+
+uint32_t ByteRate::total() {
+  if (!started) return 0;
+  advance();
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < kBuckets; ++i) sum += buckets[i];
+  return sum;
+}
+
+uint32_t ByteRate::perMinute() {
+  if (!started) return 0;
+  const uint32_t sum = total();
+  uint32_t minutes = minute - first_minute + 1;
+  if (minutes > kBuckets) minutes = kBuckets;
+  return sum / minutes;
+}
+
+/* === Live-Server === */
+// {"type":"...","values":{...}}: full = alle Eintraege mit Wert, sonst nur seq > since.
+// Ids und Werte escapet derselbe Writer wie die HTTP-API (JsonStreamWriter).
+static String build_values_message(const char* type, bool full, uint32_t since, uint32_t& count) {
+  String json;
+  json.reserve(64 + (full ? entityTable.size() * 40 : 256));
+  JsonStreamWriter out(&json);
+  out.beginObject();
+  out.field("type", type);
+  out.key("values").beginObject();
+  count = 0;
+  entityTable.forEach([&](const EntityEntry& e) {
+    if (full ? e.value.length() == 0 : e.seq <= since) return;
+    out.field(e.id, e.value);
+    count++;
+  });
+  out.endObject();
+  out.endObject();
+  out.finish();
+  return json;
+}
+
+void AdminLiveServer::start(uint16_t port) {
+  if (running) return;
+  ws = new WebSocketsServer(port);
+  ws->begin();
+  ws->onEvent(onEvent);
+  ws->enableHeartbeat(25000, 3000, 2);
+  sent_seq = entityTable.changeSeq();
+  running = true;
+  Serial.printf("[LiveWS] Live-Werte auf Port %u\n", port);
+}
+
+void AdminLiveServer::stop() {
+  if (!running) return;
+  ws->close();
+  delete ws;
+  ws = nullptr;
+  running = false;
+  Serial.println("[LiveWS] Gestoppt");
+}
+
+uint8_t AdminLiveServer::clientCount() const {
+  if (!ws || !running) return 0;
+  return ws->connectedClients();
+}
+
+void AdminLiveServer::handle() {
+  if (!running) return;
+  ws->loop();
+  pushChanges();
+}
+
+void AdminLiveServer::sendSnapshot(uint8_t num) {
+  uint32_t count = 0;
+  String json = build_values_message("snapshot", true, 0, count);
+  ws->sendTXT(num, json);
+  snapshots++;
+  push_rate.add(json.length());
+  Serial.printf("[LiveWS] Client #%u: Snapshot %u Werte (%u Bytes)\n", num,
+                static_cast<unsigned>(count), static_cast<unsigned>(json.length()));
+}
+
+void AdminLiveServer::pushChanges() {
+  const uint32_t seq = entityTable.changeSeq();
+  if (seq == sent_seq) return;
+  const uint8_t clients = ws->connectedClients();
+  if (clients == 0) {
+    sent_seq = seq;  // neue Clients bekommen ohnehin einen Snapshot
+    return;
+  }
+  const uint32_t now = millis();
+  if (now - last_push_ms < ADMIN_LIVE_INTERVAL_MS) return;  // Aenderungen sammeln
+  last_push_ms = now;
+
+  uint32_t count = 0;
+  String json = build_values_message("delta", false, sent_seq, count);
+  sent_seq = seq;
+  if (count == 0) return;
+  ws->broadcastTXT(json);
+  deltas++;
+  entities_pushed += count;
+  push_rate.add(json.length() * clients);
+}
+
+void AdminLiveServer::onEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
+  (void)payload;
+  (void)length;
+  switch (type) {
+    case WStype_CONNECTED:
+      adminLiveServer.sendSnapshot(num);
+      break;
+    case WStype_DISCONNECTED:
+      Serial.printf("[LiveWS] Client #%u getrennt\n", num);
+      break;
+    default:
+      break;
+  }
+}
+
+void AdminLiveServer::notePollBytes(uint32_t bytes) {
+  portENTER_CRITICAL(&g_poll_rate_mux);
+  poll_rate.add(bytes);
+  portEXIT_CRITICAL(&g_poll_rate_mux);
+}
+
+String AdminLiveServer::statsJson() {
+  portENTER_CRITICAL(&g_poll_rate_mux);
+  const uint32_t poll_per_min = poll_rate.perMinute();
+  const uint32_t poll_total = poll_rate.total();
+  portEXIT_CRITICAL(&g_poll_rate_mux);
+  String json = "{\"clients\":" + String(clientCount());
+  json += ",\"snapshots\":" + String(snapshots);
+  json += ",\"deltas\":" + String(deltas);
+  json += ",\"entities_pushed\":" + String(entities_pushed);
+  json += ",\"interval_ms\":" + String(static_cast<unsigned long>(ADMIN_LIVE_INTERVAL_MS));
+  json += ",\"push_bytes_per_min\":" + String(push_rate.perMinute());
+  json += ",\"push_bytes_10min\":" + String(push_rate.total());
+  json += ",\"poll_bytes_per_min\":" + String(poll_per_min);
+  json += ",\"poll_bytes_10min\":" + String(poll_total);
+  json += "}";
+  return json;
+}
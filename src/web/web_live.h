@@ -0,0 +1,67 @@
+#ifndef WEB_LIVE_H
+#define WEB_LIVE_H
+
+#include <Arduino.h>
+#include <WebSocketsServer.h>
+
+// Live-Sensorwerte fuer das Web-Admin-Panel per WebSocket statt Polling:
+// beim Verbinden ein Snapshot aller Werte, danach gebuendelt nur geaenderte
+// Entities (hoechstens alle ADMIN_LIVE_INTERVAL_MS).
+// Nachrichten: {"type":"snapshot"|"delta","values":{"entity":"wert",...}}
+#ifndef ADMIN_LIVE_PORT
+#define ADMIN_LIVE_PORT 81
+#endif
+#ifndef ADMIN_LIVE_INTERVAL_MS
+#define ADMIN_LIVE_INTERVAL_MS 1000
+#endif
+
+// Gleitendes Byte-Fenster (10 x 1 Minute) fuer den Vorher/Nachher-Vergleich
+class ByteRate {
+public:
+  void add(uint32_t bytes);
+  uint32_t total();        // Summe im Fenster
+  uint32_t perMinute();    // Schnitt ueber die belegten Minuten
+
+private:
+  void advance();
+
+  static constexpr uint8_t kBuckets = 10;
+  uint32_t buckets[kBuckets] = {};
+  uint32_t minute = 0;     // aktuelle Minute seit Boot
+  uint32_t first_minute = 0;
+  bool started = false;
+};
+
+class AdminLiveServer {
+public:
+  void start(uint16_t port = ADMIN_LIVE_PORT);
+  void stop();
+  void handle();  // Loop: WebSocket bedienen, Aenderungen pushen
+
+  bool isRunning() const { return running; }
+  uint8_t clientCount() const;
+
+  // Polling-Antworten (/api/sensor_values, /api/layout) fuer den Vergleich zaehlen.
+  // Aufruf aus dem Web-Task, statsJson liest im Loop
+  void notePollBytes(uint32_t bytes);
+  String statsJson();
+
+private:
+  void sendSnapshot(uint8_t num);
+  void pushChanges();
+  static void onEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+
+  WebSocketsServer* ws = nullptr;
+  bool running = false;
+  uint32_t sent_seq = 0;       // bis hierhin an alle Clients verteilt
+  uint32_t last_push_ms = 0;
+  uint32_t snapshots = 0;
+  uint32_t deltas = 0;
+  uint32_t entities_pushed = 0;
+  ByteRate push_rate;
+  ByteRate poll_rate;
+};
+
+extern AdminLiveServer adminLiveServer;
+
+#endif // WEB_LIVE_H
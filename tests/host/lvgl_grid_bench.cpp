@@ -0,0 +1,116 @@
+// Render-Benchmark: volles 3x4-Tile-Grid off-screen rendern, Frame-Zeit messen.
+// Wird je einmal mit TAB5_LVGL_DRAW_UNITS=1 und =2 gebaut (pthread-OS-Layer);
+// ctest startet beide, der Vergleich steht in der Ausgabe.
+//
+//   lvgl_grid_bench_du1 [frames]
+//   lvgl_grid_bench_du2 [frames]
+
+#include "lvgl.h"
+#include "src/core/display_manager.h"  // SCREEN_WIDTH / SCREEN_HEIGHT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+static const int kCols = 3;
+static const int kRows = 4;
+static const int kGap = 24;
+static const int kCardRadius = 22;
+
+alignas(64) static uint8_t g_framebuf[SCREEN_WIDTH * SCREEN_HEIGHT * 2];
+static lv_obj_t* g_values[kCols * kRows];
+static uint32_t g_flushes = 0;
+
+static uint32_t tick_ms() {
+  using namespace std::chrono;
+  return static_cast<uint32_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+static void flush_cb(lv_display_t* disp, const lv_area_t*, uint8_t*) {
+  g_flushes++;
+  lv_display_flush_ready(disp);
+}
+
+// Karten wie tile_renderer: abgerundet, ohne Schatten/Rahmen, Titel + grosser Wert,
+// jede dritte Karte mit Schalter (Switch-Tile)
+static void build_grid(lv_obj_t* scr) {
+  static int32_t col_dsc[] = {LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+  static int32_t row_dsc[] = {LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+
+  lv_obj_set_style_bg_color(scr, lv_color_hex(0x000000), 0);
+  lv_obj_t* grid = lv_obj_create(scr);
+  lv_obj_set_size(grid, SCREEN_WIDTH, SCREEN_HEIGHT);
+  lv_obj_set_style_bg_opa(grid, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(grid, 0, 0);
+  lv_obj_set_style_pad_all(grid, kGap, 0);
+  lv_obj_set_style_pad_row(grid, kGap, 0);
+  lv_obj_set_style_pad_column(grid, kGap, 0);
+  lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
+
+  for (int i = 0; i < kCols * kRows; ++i) {
+    lv_obj_t* card = lv_obj_create(grid);
+    lv_obj_set_grid_cell(card, LV_GRID_ALIGN_STRETCH, i % kCols, 1, LV_GRID_ALIGN_STRETCH, i / kCols, 1);
+    lv_obj_set_style_bg_color(card, lv_color_hex(0x2A2A2A), 0);
+    lv_obj_set_style_radius(card, kCardRadius, 0);
+    lv_obj_set_style_border_width(card, 0, 0);
+    lv_obj_set_style_shadow_width(card, 0, 0);
+    lv_obj_set_style_pad_hor(card, 20, 0);
+    lv_obj_set_style_pad_ver(card, 24, 0);
+
+    lv_obj_t* title = lv_label_create(card);
+    lv_label_set_text_fmt(title, "Sensor %d", i + 1);
+    lv_obj_set_style_text_font(title, &lv_font_montserrat_24, 0);
+    lv_obj_set_style_text_color(title, lv_color_hex(0xA0A0A0), 0);
+    lv_obj_align(title, LV_ALIGN_TOP_LEFT, 0, 0);
+
+    lv_obj_t* value = lv_label_create(card);
+    lv_obj_set_style_text_font(value, &lv_font_montserrat_48, 0);
+    lv_obj_set_style_text_color(value, lv_color_hex(0xFFFFFF), 0);
+    lv_obj_align(value, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+    g_values[i] = value;
+
+    if (i % 3 == 2) {
+      lv_obj_t* sw = lv_switch_create(card);
+      lv_obj_align(sw, LV_ALIGN_TOP_RIGHT, 0, 0);
+      if (i % 2) lv_obj_add_state(sw, LV_STATE_CHECKED);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  const int frames = argc > 1 ? atoi(argv[1]) : 100;
+
+  lv_init();
+  lv_tick_set_cb(tick_ms);
+  lv_display_t* disp = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
+  lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_buffers(disp, g_framebuf, nullptr, sizeof(g_framebuf), LV_DISPLAY_RENDER_MODE_FULL);
+  lv_display_set_flush_cb(disp, flush_cb);
+
+  lv_obj_t* scr = lv_display_get_screen_active(disp);
+  build_grid(scr);
+  lv_refr_now(disp);  // Aufwaermen: Layout, Glyph-Cache
+
+  double total_ms = 0.0;
+  double max_ms = 0.0;
+  for (int f = 0; f < frames; ++f) {
+    // Werte wie bei Sensor-Updates aendern, dann den ganzen Screen neu zeichnen
+    for (int i = 0; i < kCols * kRows; ++i) {
+      lv_label_set_text_fmt(g_values[i], "%d.%d", 20 + (f + i) % 10, (f * 7 + i) % 10);
+    }
+    lv_obj_invalidate(scr);
+    const auto t0 = std::chrono::steady_clock::now();
+    lv_refr_now(disp);
+    const double ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    total_ms += ms;
+    if (ms > max_ms) max_ms = ms;
+  }
+
+  printf("[Bench] Tile-Grid %dx%d px, %d Frames, %d Draw-Unit(s): avg %.2f ms, max %.2f ms\n", SCREEN_WIDTH,
+         SCREEN_HEIGHT, frames, LV_DRAW_SW_DRAW_UNIT_CNT, frames ? total_ms / frames : 0.0, max_ms);
+
+  lv_deinit();
+  // Jeder Frame muss genau einmal geflusht worden sein (plus Aufwaermen)
+  return g_flushes == static_cast<uint32_t>(frames) + 1 ? 0 : 1;
+}
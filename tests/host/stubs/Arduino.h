@@ -0,0 +1,147 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimaler Arduino-Ersatz fuer die Host-Tests: String auf std::string,
+// Zeit ueber steady_clock, Serial nach stdout. Nur was die getesteten Module brauchen.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <math.h>
+#include <ctype.h>
+#include <string>
+#include <algorithm>
+
+class String {
+public:
+  String() = default;
+  String(const char* s) : s_(s ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  String(long long v) : s_(std::to_string(v)) {}
+  String(unsigned long long v) : s_(std::to_string(v)) {}
+  String(double v, unsigned decimals = 2) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", static_cast<int>(decimals), v);
+    s_ = buf;
+  }
+  String(float v, unsigned decimals = 2) : String(static_cast<double>(v), decimals) {}
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned length() const { return static_cast<unsigned>(s_.size()); }
+  bool isEmpty() const { return s_.empty(); }
+  bool reserve(unsigned n) { s_.reserve(n); return true; }
+  bool concat(const char* p, unsigned n) { s_.append(p, n); return true; }
+  bool concat(const String& o) { s_ += o.s_; return true; }
+  bool concat(const char* p) { if (p) s_ += p; return true; }
+  bool concat(char c) { s_ += c; return true; }
+
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* o) { if (o) s_ += o; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  String& operator+=(int v) { s_ += std::to_string(v); return *this; }
+  String& operator+=(unsigned v) { s_ += std::to_string(v); return *this; }
+  String& operator+=(long v) { s_ += std::to_string(v); return *this; }
+  String& operator+=(unsigned long v) { s_ += std::to_string(v); return *this; }
+
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String& a, const char* b) { return String(a.s_ + (b ? b : "")); }
+  friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b.s_); }
+  friend String operator+(const String& a, char c) { return String(a.s_ + c); }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == (o ? o : ""); }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return !(*this == o); }
+  bool operator<(const String& o) const { return s_ < o.s_; }
+  char operator[](unsigned i) const { return i < s_.size() ? s_[i] : 0; }
+  char& operator[](unsigned i) { return s_[i]; }
+
+  char charAt(unsigned i) const { return (*this)[i]; }
+  void setCharAt(unsigned i, char c) { if (i < s_.size()) s_[i] = c; }
+  bool equals(const String& o) const { return s_ == o.s_; }
+  bool equalsIgnoreCase(const String& o) const { return strcasecmp(s_.c_str(), o.s_.c_str()) == 0; }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool endsWith(const String& p) const {
+    return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+  int indexOf(char c, unsigned from = 0) const { return pos(s_.find(c, from)); }
+  int indexOf(const String& t, unsigned from = 0) const { return pos(s_.find(t.s_, from)); }
+  int indexOf(const char* t, unsigned from = 0) const { return pos(s_.find(t, from)); }
+  int lastIndexOf(char c) const { return pos(s_.rfind(c)); }
+  String substring(unsigned from) const { return from >= s_.size() ? String() : String(s_.substr(from)); }
+  String substring(unsigned from, unsigned to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from, to - from));
+  }
+  long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(s_.c_str(), nullptr); }
+  void toLowerCase() { for (auto& c : s_) c = static_cast<char>(tolower(static_cast<unsigned char>(c))); }
+  void toUpperCase() { for (auto& c : s_) c = static_cast<char>(toupper(static_cast<unsigned char>(c))); }
+  void trim() {
+    size_t a = 0, b = s_.size();
+    while (a < b && isspace(static_cast<unsigned char>(s_[a]))) a++;
+    while (b > a && isspace(static_cast<unsigned char>(s_[b - 1]))) b--;
+    s_ = s_.substr(a, b - a);
+  }
+  void remove(unsigned index) { if (index < s_.size()) s_.erase(index); }
+  void remove(unsigned index, unsigned count) { if (index < s_.size()) s_.erase(index, count); }
+  void replace(const String& from, const String& to) {
+    if (from.s_.empty()) return;
+    size_t p = 0;
+    while ((p = s_.find(from.s_, p)) != std::string::npos) {
+      s_.replace(p, from.s_.size(), to.s_);
+      p += to.s_.size();
+    }
+  }
+  void toCharArray(char* buf, unsigned size) const {
+    if (!size) return;
+    strncpy(buf, s_.c_str(), size - 1);
+    buf[size - 1] = 0;
+  }
+
+private:
+  static int pos(size_t p) { return p == std::string::npos ? -1 : static_cast<int>(p); }
+  std::string s_;
+};
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+inline void yield() {}
+
+struct HostSerial {
+  void print(const char* s) { fputs(s, stdout); }
+  void print(const String& s) { fputs(s.c_str(), stdout); }
+  void println(const char* s = "") { puts(s); }
+  void println(const String& s) { puts(s.c_str()); }
+  int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list ap;
+    va_start(ap, fmt);
+    const int n = vprintf(fmt, ap);
+    va_end(ap);
+    return n;
+  }
+};
+extern HostSerial Serial;
+
+struct HostEsp {
+  uint32_t getFreeHeap() const;
+  uint32_t getMinFreeHeap() const { return getFreeHeap(); }
+  uint32_t getMaxAllocHeap() const { return getFreeHeap(); }
+  uint32_t getHeapSize() const { return 512 * 1024; }
+  uint32_t getFreePsram() const { return 0; }
+  uint32_t getPsramSize() const { return 0; }
+};
+extern HostEsp ESP;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,43 @@
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Aufzeichnender Ersatz fuer den ESP32-WebServer: nur die Aufrufe, die eine
+// Antwort erzeugen. Jeder sendContent-Aufruf ist ein HTTP-Chunk.
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+public:
+  void sendHeader(const String& name, const String& value, bool first = false) {
+    (void)first;
+    headers.push_back(name + ": " + value);
+  }
+  void setContentLength(size_t len) { content_length = len; }
+  void send(int code, const char* content_type, const String& body) {
+    sent_code = code;
+    sent_type = content_type ? content_type : "";
+    sends++;
+    if (body.length()) this->body += body;
+  }
+  void sendContent(const String& chunk) {
+    if (!chunk.length()) {
+      terminated++;  // chunked: Null-Chunk beendet die Antwort
+      return;
+    }
+    chunks.push_back(chunk);
+    body += chunk;
+  }
+
+  std::vector<String> headers;
+  std::vector<String> chunks;
+  String body;
+  String sent_type;
+  size_t content_length = 0;
+  int sent_code = 0;
+  int sends = 0;
+  int terminated = 0;
+};
+
+#endif // HOST_WEBSERVER_H
@@ -0,0 +1,28 @@
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Ein Heap fuer alles: Capability-Flags werden ignoriert
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  return malloc(size);
+}
+
+inline void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+  (void)caps;
+  return realloc(ptr, size);
+}
+
+inline void heap_caps_free(void* ptr) {
+  free(ptr);
+}
+
+#endif // HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,27 @@
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+
+HostSerial Serial;
+HostEsp ESP;
+
+static const auto g_start = std::chrono::steady_clock::now();
+
+uint32_t millis() {
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - g_start).count());
+}
+
+uint32_t micros() {
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_start).count());
+}
+
+void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Kein Heap-Monitor auf dem Host: konstanter Wert, Differenzen sind 0
+uint32_t HostEsp::getFreeHeap() const {
+  return 256 * 1024;
+}
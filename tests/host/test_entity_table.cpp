@@ -0,0 +1,165 @@
+// Host-Tests fuer src/network/entity_table: Sondieren, Wachstum, stabile
+// internierte IDs, reset() und Wiederbelegung, changeSeq; dazu der Vergleich
+// alte Key=Value-Strings vs. Tabelle (500 Entities, 50 Updates/s).
+
+#include "test_util.h"
+#include "src/network/entity_table.h"
+
+#include <string.h>
+#include <vector>
+
+static String sensor_id(unsigned i) {
+  char buf[40];
+  snprintf(buf, sizeof(buf), "sensor.room_%u_temperature", i);
+  return String(buf);
+}
+
+static void test_case_insensitive_and_interned() {
+  EntityTable t;
+  CHECK(t.find("sensor.x") == nullptr);  // leere Tabelle
+  CHECK(t.find("") == nullptr);
+  CHECK(t.intern("") == nullptr);
+  CHECK(t.intern(nullptr) == nullptr);
+
+  EntityEntry& e = t.upsert("Sensor.Living_Room");
+  CHECK(strcmp(e.id, "sensor.living_room") == 0);
+  CHECK(t.find("SENSOR.LIVING_ROOM") == &e);
+  CHECK(t.intern("sensor.living_room") == e.id);
+  CHECK(&t.upsert("sensor.LIVING_room") == &e);
+  CHECK_EQ(t.size(), 1u);
+  CHECK(t.find("sensor.living_roo") == nullptr);
+  CHECK(t.find("sensor.living_room2") == nullptr);
+}
+
+static void test_growth_keeps_entries_and_ids() {
+  EntityTable t;
+  const unsigned n = 1500;
+  std::vector<const char*> ids;
+  for (unsigned i = 0; i < n; ++i) {
+    EntityEntry& e = t.setValue(sensor_id(i).c_str(), String(i));
+    ids.push_back(e.id);
+    const EntityTableStats st = t.stats();
+    // Zweierpotenz und Ladefaktor <= 0.7 nach jedem Einfuegen
+    CHECK((st.capacity & (st.capacity - 1)) == 0);
+    CHECK(st.entries * 10 <= st.capacity * 7);
+  }
+  CHECK_EQ(t.size(), n);
+  for (unsigned i = 0; i < n; ++i) {
+    const EntityEntry* e = t.find(sensor_id(i).c_str());
+    CHECK(e != nullptr);
+    if (!e) continue;
+    CHECK(e->id == ids[i]);  // Pool-Zeiger ueberleben jedes rehash
+    CHECK_STR(e->value, String(i));
+  }
+}
+
+static void test_probe_length() {
+  EntityTable t;
+  t.reserve(500);
+  const uint32_t cap = t.stats().capacity;
+  for (unsigned i = 0; i < 500; ++i) t.upsert(sensor_id(i).c_str());
+  CHECK_EQ(t.stats().capacity, cap);  // reserve: kein rehash beim Befuellen
+  const EntityTableStats before = t.stats();
+  for (unsigned i = 0; i < 500; ++i) CHECK(t.find(sensor_id(i).c_str()) != nullptr);
+  for (unsigned i = 500; i < 1000; ++i) CHECK(t.find(sensor_id(i).c_str()) == nullptr);
+  const EntityTableStats after = t.stats();
+  const double avg = 1.0 + static_cast<double>(after.probes - before.probes) / (after.lookups - before.lookups);
+  printf("  Kapazitaet %u, Schnitt %.2f Sondierungen (Treffer + Fehlschlag)\n",
+         static_cast<unsigned>(cap), avg);
+  CHECK(avg < 3.0);
+}
+
+static void test_long_ids() {
+  EntityTable t;
+  std::string long_id = "sensor.";
+  long_id.append(1000, 'A');  // eigener Pool-Block
+  EntityEntry& e = t.upsert(long_id.c_str());
+  CHECK_EQ(strlen(e.id), long_id.size());
+  CHECK(e.id[7] == 'a');
+  const char* short_id = t.intern("light.kitchen");
+  CHECK(short_id && strcmp(short_id, "light.kitchen") == 0);
+  CHECK(t.find(long_id.c_str()) == &e);
+}
+
+static void test_change_seq() {
+  EntityTable t;
+  t.setValue("sensor.a", "1");
+  t.setValue("sensor.b", "2");
+  const uint32_t mark = t.changeSeq();
+  t.setValue("sensor.b", "3");
+  t.setValue("sensor.c", "4");
+  CHECK_EQ(t.changeSeq(), mark + 2);
+  std::vector<String> changed;
+  t.forEach([&](const EntityEntry& e) {
+    if (e.seq > mark) changed.push_back(e.id);
+  });
+  CHECK_EQ(changed.size(), 2u);
+  for (const auto& id : changed) CHECK(id == "sensor.b" || id == "sensor.c");
+  // upsert allein ist keine Wertaenderung
+  t.upsert("sensor.d");
+  CHECK_EQ(t.changeSeq(), mark + 2);
+}
+
+static void test_reset_and_reinsert() {
+  EntityTable t;
+  EntityEntry& a = t.setValue("sensor.a", "21.5");
+  a.unit = "C";
+  a.has_number = true;
+  t.upsert("sensor.empty").unit = "W";
+  const char* id_a = a.id;
+  const uint32_t seq = t.changeSeq();
+
+  t.reset();
+  // Nur Eintraege mit Wert zaehlen als Aenderung (Web-Clients loeschen die Anzeige)
+  CHECK_EQ(t.changeSeq(), seq + 1);
+  CHECK_EQ(t.size(), 2u);
+  const EntityEntry* ra = t.find("sensor.a");
+  CHECK(ra != nullptr);
+  if (ra) {
+    CHECK(ra->id == id_a);
+    CHECK_STR(ra->value, "");
+    CHECK_STR(ra->unit, "");
+    CHECK(!ra->has_number);
+    CHECK_EQ(ra->updated_ms, 0u);
+  }
+
+  // Wiederbelegung nach reset: gleicher Slot, neue seq
+  EntityEntry& again = t.setValue("SENSOR.A", "22.0");
+  CHECK(&again == ra);
+  CHECK_STR(again.value, "22.0");
+  CHECK_EQ(again.seq, t.changeSeq());
+  CHECK_EQ(t.size(), 2u);
+}
+
+static double json_field(const String& json, const char* section, const char* key) {
+  const int at = json.indexOf(String("\"") + section + "\":");
+  if (at < 0) return -1.0;
+  const String k = String("\"") + key + "\":";
+  const int pos = json.indexOf(k, at);
+  if (pos < 0) return -1.0;
+  return json.substring(pos + k.length()).toFloat();
+}
+
+static void test_bench_legacy_vs_table() {
+  const String json = entity_table_benchmark(500, 50, 60);
+  const double legacy_update = json_field(json, "legacy", "update_us");
+  const double table_update = json_field(json, "table", "update_us");
+  const double legacy_lookup = json_field(json, "legacy", "lookup_us");
+  const double table_lookup = json_field(json, "table", "lookup_us");
+  CHECK(legacy_update > 0.0);
+  CHECK(table_update >= 0.0);
+  CHECK(table_update < legacy_update);
+  CHECK(table_lookup < legacy_lookup);
+  CHECK(json.indexOf("\"hits\":1000") > 0);  // alle Lookups in beiden Varianten gefunden
+}
+
+int main() {
+  RUN_TEST(test_case_insensitive_and_interned);
+  RUN_TEST(test_growth_keeps_entries_and_ids);
+  RUN_TEST(test_probe_length);
+  RUN_TEST(test_long_ids);
+  RUN_TEST(test_change_seq);
+  RUN_TEST(test_reset_and_reinsert);
+  RUN_TEST(test_bench_legacy_vs_table);
+  return g_test_failures ? 1 : 0;
+}
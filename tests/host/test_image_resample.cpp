@@ -0,0 +1,323 @@
+// Host-Tests fuer src/ui/image_resample: tjpgd-Ausgabegroesse, Achsen-Tabellen,
+// Box/Bilinear-Pfad und ein PSNR/Zeit-Vergleich gegen das alte Nearest-Neighbour-Verfahren
+// (12 MP und 4K nach 1280x720).
+
+#include "test_util.h"
+#include "src/ui/image_resample.h"
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+/* === tjpgd mcu_output nachgebildet === */
+// Liefert die Breite, die tjpgd bei dieser Skalierung tatsaechlich ausgibt, und zaehlt,
+// wie oft die Zeile-fertig-Bedingung aus tjpgd_output (right + 1 >= src_w) greift.
+static uint16_t tjpgd_emitted_width(uint16_t full, uint16_t mcu, uint8_t scale, uint16_t src_w, int* row_done_hits) {
+  uint16_t out = 0;
+  int hits = 0;
+  for (uint32_t x = 0; x < full; x += mcu) {
+    uint32_t rx = (x + mcu <= full) ? mcu : full - x;
+    rx >>= scale;
+    if (!rx) continue;  // tjpgd ueberspringt die MCU
+    const uint32_t left = x >> scale;
+    const uint32_t right = left + rx - 1;
+    if (right + 1 > out) out = static_cast<uint16_t>(right + 1);
+    if (right + 1 >= src_w) hits++;
+  }
+  if (row_done_hits) *row_done_hits = hits;
+  return out;
+}
+
+static void test_scaled_dim_matches_tjpgd() {
+  const uint16_t mcus[] = {8, 16};
+  for (uint16_t mcu : mcus) {
+    for (uint8_t scale = 0; scale <= 3; ++scale) {
+      for (uint32_t full = 1; full <= 4100; ++full) {
+        const uint16_t dim = jpeg_scaled_dim(static_cast<uint16_t>(full), mcu, scale);
+        int hits = 0;
+        const uint16_t emitted = tjpgd_emitted_width(static_cast<uint16_t>(full), mcu, scale, dim, &hits);
+        CHECK_EQ(dim, emitted);
+        // Zeile muss genau einmal (beim letzten ausgegebenen Block) als fertig erkannt werden
+        if (dim > 0) CHECK_EQ(hits, 1);
+      }
+    }
+  }
+  // Regression: 2561 px bei 1/2 war ein Pixel zu breit
+  CHECK_EQ(jpeg_scaled_dim(2561, 16, 1), 1280);
+  CHECK_EQ(jpeg_scaled_dim(0, 16, 1), 0);
+  CHECK_EQ(jpeg_scaled_dim(4, 16, 3), 0);
+}
+
+static void test_pick_scale() {
+  CHECK_EQ(jpeg_pick_scale(4000, 3000, 960, 720), 2);
+  CHECK_EQ(jpeg_pick_scale(3840, 2160, 1280, 720), 1);
+  CHECK_EQ(jpeg_pick_scale(10240, 5760, 1280, 720), 3);
+  CHECK_EQ(jpeg_pick_scale(1280, 720, 1280, 720), 0);
+  CHECK_EQ(jpeg_pick_scale(640, 480, 1280, 720), 0);
+}
+
+static void test_box_map_partitions_source() {
+  const uint16_t srcs[] = {1, 7, 100, 1000, 1920, 2001};
+  const uint16_t dsts[] = {1, 3, 99, 640, 1280};
+  for (uint16_t src : srcs) {
+    for (uint16_t dst : dsts) {
+      if (dst > src) continue;
+      std::vector<uint16_t> start(dst), end(dst);
+      image_resample_build_axis_map(src, dst, true, start.data(), end.data(), nullptr);
+      CHECK_EQ(start[0], 0);
+      CHECK_EQ(end[dst - 1], src);
+      for (uint16_t d = 0; d < dst; ++d) {
+        CHECK(end[d] > start[d]);
+        if (d + 1 < dst) CHECK_EQ(end[d], start[d + 1]);
+      }
+    }
+  }
+}
+
+static void test_bilinear_map_in_range() {
+  const uint16_t srcs[] = {1, 2, 80, 720};
+  const uint16_t dsts[] = {2, 81, 240, 1280};
+  for (uint16_t src : srcs) {
+    for (uint16_t dst : dsts) {
+      if (dst < src) continue;
+      std::vector<uint16_t> start(dst);
+      std::vector<uint8_t> frac(dst);
+      image_resample_build_axis_map(src, dst, false, start.data(), nullptr, frac.data());
+      for (uint16_t d = 0; d < dst; ++d) {
+        CHECK(start[d] < src);
+        if (start[d] == src - 1) CHECK_EQ(frac[d], 0);
+        if (d > 0) CHECK(start[d] >= start[d - 1]);
+      }
+    }
+  }
+}
+
+/* === Kompletter Durchlauf wie in decode_jpeg_source === */
+static std::vector<uint16_t> resample(const std::vector<uint8_t>& src, uint16_t src_w, uint16_t src_h, uint16_t dst_w,
+                                      uint16_t dst_h, uint16_t sentinel = 0) {
+  RowResampler rs{};
+  rs.src_w = src_w;
+  rs.src_h = src_h;
+  rs.dst_w = dst_w;
+  rs.dst_h = dst_h;
+  rs.h_box = src_w >= dst_w;
+  rs.v_box = src_h >= dst_h;
+  std::vector<uint16_t> dst(static_cast<size_t>(dst_w) * dst_h, sentinel);
+  std::vector<uint8_t> hrow(dst_w * 3U), hrow_prev(dst_w * 3U), x_frac(dst_w), y_frac(dst_h);
+  std::vector<uint16_t> x_start(dst_w), x_end(dst_w), y_start(dst_h);
+  std::vector<uint32_t> vacc(dst_w * 3U, 0);
+  rs.dst_buf = dst.data();
+  rs.hrow = hrow.data();
+  rs.hrow_prev = hrow_prev.data();
+  rs.x_start = x_start.data();
+  rs.x_end = rs.h_box ? x_end.data() : nullptr;
+  rs.x_frac = rs.h_box ? nullptr : x_frac.data();
+  rs.vacc = rs.v_box ? vacc.data() : nullptr;
+  rs.y_start = rs.v_box ? nullptr : y_start.data();
+  rs.y_frac = rs.v_box ? nullptr : y_frac.data();
+  image_resample_build_axis_map(src_w, dst_w, rs.h_box, rs.x_start, rs.x_end, rs.x_frac);
+  if (!rs.v_box) image_resample_build_axis_map(src_h, dst_h, false, rs.y_start, nullptr, rs.y_frac);
+  for (uint16_t y = 0; y < src_h; ++y) {
+    image_resample_push_row(&rs, src.data() + static_cast<size_t>(y) * src_w * 3U);
+  }
+  image_resample_finish(&rs);
+  return dst;
+}
+
+static uint16_t rgb565_swapped(uint8_t r, uint8_t g, uint8_t b) {
+  const uint16_t v = static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+  return static_cast<uint16_t>((v >> 8) | (v << 8));
+}
+
+static void test_constant_image_preserved() {
+  // Quelle in tjpgd-Reihenfolge B,G,R
+  const uint8_t r = 200, g = 120, b = 40;
+  const uint16_t expect = rgb565_swapped(r, g, b);
+  const struct {
+    uint16_t sw, sh, dw, dh;
+  } cases[] = {
+    {1000, 750, 960, 720},  // Box beide Achsen
+    {100, 80, 300, 240},    // Bilinear beide Achsen
+    {500, 100, 250, 300},   // Box x, Bilinear y
+    {100, 500, 300, 250},   // Bilinear x, Box y
+    {1, 1, 7, 5},
+  };
+  for (const auto& c : cases) {
+    std::vector<uint8_t> src(static_cast<size_t>(c.sw) * c.sh * 3U);
+    for (size_t i = 0; i < src.size(); i += 3) {
+      src[i] = b;
+      src[i + 1] = g;
+      src[i + 2] = r;
+    }
+    const std::vector<uint16_t> dst = resample(src, c.sw, c.sh, c.dw, c.dh, 0xDEAD);
+    size_t wrong = 0;
+    for (uint16_t px : dst) {
+      if (px != expect) wrong++;
+    }
+    CHECK_EQ(wrong, 0u);  // auch: jede Zielzeile wurde geschrieben (kein Sentinel uebrig)
+  }
+}
+
+static void test_ramp_stays_monotonic() {
+  // Horizontale Rampe: nach Box- und Bilinear-Skalierung darf der Gruenkanal nicht fallen
+  const uint16_t sw = 512, sh = 16;
+  std::vector<uint8_t> src(static_cast<size_t>(sw) * sh * 3U);
+  for (uint16_t y = 0; y < sh; ++y) {
+    for (uint16_t x = 0; x < sw; ++x) {
+      uint8_t* p = &src[(static_cast<size_t>(y) * sw + x) * 3U];
+      p[0] = 0;
+      p[1] = static_cast<uint8_t>(x / 2);
+      p[2] = 0;
+    }
+  }
+  const uint16_t widths[] = {100, 1000};
+  for (uint16_t dw : widths) {
+    const std::vector<uint16_t> dst = resample(src, sw, sh, dw, 8);
+    for (uint16_t x = 1; x < dw; ++x) {
+      const uint16_t a = static_cast<uint16_t>((dst[x - 1] >> 8) | (dst[x - 1] << 8));
+      const uint16_t c = static_cast<uint16_t>((dst[x] >> 8) | (dst[x] << 8));
+      CHECK(((c >> 5) & 0x3F) >= ((a >> 5) & 0x3F));
+    }
+  }
+}
+
+/* === PSNR/Zeit: 12 MP und 4K nach 1280x720 === */
+// Synthetisches "Foto": weicher Verlauf + Zonenplatte. Die Ortsfrequenz steigt nach aussen
+// bis ueber die Nyquist-Grenze des Zielbilds (-> Aliasing bei Nearest), die Amplitude faellt
+// dabei ab wie bei natuerlichen Bildern.
+static std::vector<uint8_t> make_photo(uint16_t w, uint16_t h) {
+  std::vector<uint8_t> img(static_cast<size_t>(w) * h * 3U);
+  const double cx = w / 2.0, cy = h / 2.0;
+  const double r_max = sqrt(cx * cx + cy * cy);
+  const double k = 1.2 / r_max;  // lokale Frequenz k*r: 1.2 rad/px in der Ecke
+  for (uint16_t y = 0; y < h; ++y) {
+    for (uint16_t x = 0; x < w; ++x) {
+      const double dx = x - cx, dy = y - cy;
+      const double r2 = dx * dx + dy * dy;
+      const double amp = 0.5 * (1.0 - 0.8 * sqrt(r2) / r_max);
+      const double zone = 0.5 + amp * cos(k * r2 / 2.0);
+      uint8_t* p = &img[(static_cast<size_t>(y) * w + x) * 3U];
+      p[0] = static_cast<uint8_t>(40 + 180.0 * y / h);
+      p[1] = static_cast<uint8_t>(255.0 * zone);
+      p[2] = static_cast<uint8_t>(40 + 180.0 * x / w);
+    }
+  }
+  return img;
+}
+
+// DCT-Skalierung von tjpgd naeherungsweise als Blockmittel 2^s x 2^s
+static std::vector<uint8_t> block_average(const std::vector<uint8_t>& img, uint16_t w, uint16_t h, uint8_t scale,
+                                          uint16_t out_w, uint16_t out_h) {
+  const uint16_t n = static_cast<uint16_t>(1U << scale);
+  std::vector<uint8_t> out(static_cast<size_t>(out_w) * out_h * 3U);
+  for (uint16_t y = 0; y < out_h; ++y) {
+    for (uint16_t x = 0; x < out_w; ++x) {
+      uint32_t acc[3] = {0, 0, 0};
+      uint32_t cnt = 0;
+      for (uint16_t j = 0; j < n && y * n + j < h; ++j) {
+        for (uint16_t i = 0; i < n && x * n + i < w; ++i) {
+          const uint8_t* p = &img[((static_cast<size_t>(y) * n + j) * w + x * n + i) * 3U];
+          acc[0] += p[0];
+          acc[1] += p[1];
+          acc[2] += p[2];
+          cnt++;
+        }
+      }
+      uint8_t* o = &out[(static_cast<size_t>(y) * out_w + x) * 3U];
+      for (int c = 0; c < 3; ++c) o[c] = static_cast<uint8_t>(acc[c] / cnt);
+    }
+  }
+  return out;
+}
+
+// Referenz: Flaechenmittel ueber alle Quellpixel, deren Mitte im Zielpixel liegt (double)
+static std::vector<double> area_reference(const std::vector<uint8_t>& img, uint16_t w, uint16_t h, uint16_t dw,
+                                          uint16_t dh) {
+  std::vector<double> acc(static_cast<size_t>(dw) * dh * 3U, 0.0);
+  std::vector<uint32_t> cnt(static_cast<size_t>(dw) * dh, 0);
+  for (uint16_t y = 0; y < h; ++y) {
+    const uint32_t ty = static_cast<uint32_t>((2U * y + 1U) * static_cast<uint64_t>(dh) / (2U * h));
+    for (uint16_t x = 0; x < w; ++x) {
+      const uint32_t tx = static_cast<uint32_t>((2U * x + 1U) * static_cast<uint64_t>(dw) / (2U * w));
+      const size_t t = static_cast<size_t>(ty) * dw + tx;
+      const uint8_t* p = &img[(static_cast<size_t>(y) * w + x) * 3U];
+      acc[t * 3U] += p[0];
+      acc[t * 3U + 1] += p[1];
+      acc[t * 3U + 2] += p[2];
+      cnt[t]++;
+    }
+  }
+  for (size_t t = 0; t < cnt.size(); ++t) {
+    for (int c = 0; c < 3; ++c) acc[t * 3U + c] /= cnt[t] ? cnt[t] : 1;
+  }
+  return acc;
+}
+
+static double psnr_565(const std::vector<uint16_t>& img, const std::vector<double>& ref) {
+  double se = 0.0;
+  for (size_t i = 0; i < img.size(); ++i) {
+    const uint16_t v = static_cast<uint16_t>((img[i] >> 8) | (img[i] << 8));
+    const double r = ((v >> 11) & 0x1F) * 255.0 / 31.0;
+    const double g = ((v >> 5) & 0x3F) * 255.0 / 63.0;
+    const double b = (v & 0x1F) * 255.0 / 31.0;
+    const double db = b - ref[i * 3U], dg = g - ref[i * 3U + 1], dr = r - ref[i * 3U + 2];
+    se += db * db + dg * dg + dr * dr;
+  }
+  const double mse = se / (img.size() * 3.0);
+  return mse > 0 ? 10.0 * log10(255.0 * 255.0 / mse) : 99.0;
+}
+
+// Altes Verfahren: volle Aufloesung, jedes Zielpixel aus genau einem Quellpixel
+static std::vector<uint16_t> nearest(const std::vector<uint8_t>& img, uint16_t w, uint16_t h, uint16_t dw, uint16_t dh) {
+  std::vector<uint16_t> out(static_cast<size_t>(dw) * dh);
+  for (uint16_t y = 0; y < dh; ++y) {
+    const uint32_t sy = static_cast<uint32_t>(y) * h / dh;
+    for (uint16_t x = 0; x < dw; ++x) {
+      const uint32_t sx = static_cast<uint32_t>(x) * w / dw;
+      const uint8_t* p = &img[(static_cast<size_t>(sy) * w + sx) * 3U];
+      out[static_cast<size_t>(y) * dw + x] = rgb565_swapped(p[2], p[1], p[0]);
+    }
+  }
+  return out;
+}
+
+// min_gain_db: Mindestabstand zu Nearest. Bei 1000 -> 960 (12 MP, 1/4) ist die Box fast
+// immer 1 Pixel breit, dort bringt erst die DCT-Skalierung den Gewinn.
+static void bench_case(const char* name, uint16_t w, uint16_t h, uint16_t dw, uint16_t dh, double min_gain_db) {
+  const std::vector<uint8_t> img = make_photo(w, h);
+  const std::vector<double> ref = area_reference(img, w, h, dw, dh);
+
+  double t0 = test_now_ms();
+  const std::vector<uint16_t> old_out = nearest(img, w, h, dw, dh);
+  const double old_ms = test_now_ms() - t0;
+
+  const uint8_t scale = jpeg_pick_scale(w, h, dw, dh);
+  const uint16_t sw = jpeg_scaled_dim(w, 16, scale);
+  const uint16_t sh = jpeg_scaled_dim(h, 16, scale);
+  const std::vector<uint8_t> scaled = block_average(img, w, h, scale, sw, sh);
+  t0 = test_now_ms();
+  const std::vector<uint16_t> new_out = resample(scaled, sw, sh, dw, dh);
+  const double new_ms = test_now_ms() - t0;
+
+  const double old_psnr = psnr_565(old_out, ref);
+  const double new_psnr = psnr_565(new_out, ref);
+  printf("  %s %ux%u -> 1/%u (%ux%u) -> %ux%u: nearest %.1f dB / %.1f ms, resampler %.1f dB / %.1f ms\n", name, w, h,
+         1U << scale, sw, sh, dw, dh, old_psnr, old_ms, new_psnr, new_ms);
+  CHECK(new_psnr > old_psnr + min_gain_db);
+}
+
+static void test_psnr_vs_nearest() {
+  bench_case("12MP", 4000, 3000, 960, 720, 0.5);
+  bench_case("4K", 3840, 2160, 1280, 720, 3.0);
+}
+
+int main() {
+  RUN_TEST(test_scaled_dim_matches_tjpgd);
+  RUN_TEST(test_pick_scale);
+  RUN_TEST(test_box_map_partitions_source);
+  RUN_TEST(test_bilinear_map_in_range);
+  RUN_TEST(test_constant_image_preserved);
+  RUN_TEST(test_ramp_stays_monotonic);
+  RUN_TEST(test_psnr_vs_nearest);
+  return g_test_failures ? 1 : 0;
+}
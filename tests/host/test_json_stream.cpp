@@ -0,0 +1,187 @@
+// Host-Tests fuer src/web/json_stream: Kommas/Verschachtelung, Escaping,
+// Chunk-Grenzen bei kChunkSize, Capture-/Zaehlmodus und Abschluss im Destruktor.
+
+#include "test_util.h"
+#include "src/web/json_stream.h"
+#include "esp_rom_crc.h"
+
+#include <math.h>
+
+static void test_structure_and_commas() {
+  String out;
+  {
+    JsonStreamWriter json(&out);
+    json.beginObject();
+    json.field("a", 1).field("b", true).field("c", "x");
+    json.key("arr").beginArray();
+    json.value(1).value(-2).null().value(3000000000UL);
+    json.beginObject().endObject();
+    json.beginArray().endArray();
+    json.endArray();
+    json.key("nested").beginObject().key("deep").beginArray().beginObject().field("k", false).endObject().endArray().endObject();
+    json.endObject();
+    json.finish();
+  }
+  CHECK_STR(out, "{\"a\":1,\"b\":true,\"c\":\"x\",\"arr\":[1,-2,null,3000000000,{},[]],"
+                 "\"nested\":{\"deep\":[{\"k\":false}]}}");
+}
+
+static void test_top_level_values() {
+  String out;
+  JsonStreamWriter json(&out);
+  json.beginArray().endArray();
+  json.finish();
+  CHECK_STR(out, "[]");
+}
+
+static void test_numbers() {
+  String out;
+  JsonStreamWriter json(&out);
+  json.beginArray();
+  json.value(21.456f).value(0.5f, 1).value(-3.0f, 0);
+  json.value(static_cast<float>(NAN)).value(static_cast<float>(INFINITY));
+  json.value(2147483647L).value(-2147483647L - 1);
+  json.endArray();
+  json.finish();
+  CHECK_STR(out, "[21.46,0.5,-3,null,null,2147483647,-2147483648]");
+}
+
+static void test_escaping() {
+  String out;
+  JsonStreamWriter json(&out);
+  json.beginObject();
+  json.field("q\"k", "a\"b\\c/d");
+  json.field("ws", "l1\nl2\r\t\b\f");
+  json.field("ctl", "\x01\x1f");
+  json.field("utf8", "Wohnzimmer \xc3\xa4\xc3\xb6\xc3\xbc \xe2\x82\xac");
+  json.field("null_str", static_cast<const char*>(nullptr));
+  json.endObject();
+  json.finish();
+  CHECK_STR(out, "{\"q\\\"k\":\"a\\\"b\\\\c/d\",\"ws\":\"l1\\nl2\\r\\t\\b\\f\",\"ctl\":\"\\u0001\\u001f\","
+                 "\"utf8\":\"Wohnzimmer \xc3\xa4\xc3\xb6\xc3\xbc \xe2\x82\xac\",\"null_str\":\"\"}");
+}
+
+static void test_depth_overflow() {
+  // Ueber JSON_STREAM_MAX_DEPTH hinaus bleiben die Klammern vollstaendig
+  String out;
+  JsonStreamWriter json(&out);
+  const int levels = JSON_STREAM_MAX_DEPTH + 3;
+  for (int i = 0; i < levels; ++i) json.beginArray();
+  for (int i = 0; i < levels; ++i) json.endArray();
+  json.value(1);  // Ebene 0: kein Komma
+  json.finish();
+  CHECK_EQ(out.length(), static_cast<size_t>(levels * 2 + 1));
+  CHECK(out.startsWith("[[[["));
+  CHECK(out.endsWith("]]]]1"));
+
+  // Bis genau MAX_DEPTH stimmen die Kommas
+  String ok;
+  JsonStreamWriter j2(&ok);
+  for (int i = 0; i < JSON_STREAM_MAX_DEPTH; ++i) j2.beginArray();
+  j2.value(1).value(2);
+  for (int i = 0; i < JSON_STREAM_MAX_DEPTH; ++i) j2.endArray();
+  j2.finish();
+  CHECK(ok.indexOf("[1,2]") > 0);
+}
+
+static String long_text(size_t n, char c) {
+  return String(std::string(n, c));
+}
+
+static void test_chunk_boundaries() {
+  WebServer server;
+  String expect = "[";
+  {
+    JsonStreamWriter json(server, 201);
+    json.beginArray();
+    // Werte, die ueber mehrere Chunk-Grenzen laufen, inkl. Escapes an der Grenze
+    for (int i = 0; i < 40; ++i) {
+      String v = long_text(static_cast<size_t>(97 + i * 13), static_cast<char>('a' + i % 26));
+      if (i % 3 == 0) v += "\"";
+      json.value(v);
+      if (i) expect += ",";
+      String esc = v;
+      esc.replace("\"", "\\\"");
+      expect += "\"" + esc + "\"";
+    }
+    json.endArray();
+    CHECK_EQ(json.bytes(), expect.length() + 1);
+    json.finish();
+    CHECK_EQ(json.chunks(), static_cast<uint16_t>(server.chunks.size()));
+  }
+  expect += "]";
+  CHECK_EQ(server.sent_code, 201);
+  CHECK_STR(server.sent_type, "application/json");
+  CHECK(server.content_length == CONTENT_LENGTH_UNKNOWN);
+  CHECK_EQ(server.terminated, 1);
+  CHECK_STR(server.body, expect);
+  CHECK(server.chunks.size() > 3);
+  // Alle Chunks ausser dem letzten sind voll: >= kChunkSize, hoechstens ein Token drueber
+  for (size_t i = 0; i + 1 < server.chunks.size(); ++i) {
+    CHECK(server.chunks[i].length() >= JsonStreamWriter::kChunkSize);
+    CHECK(server.chunks[i].length() < JsonStreamWriter::kChunkSize + 8);
+  }
+  CHECK(server.chunks.back().length() <= JsonStreamWriter::kChunkSize);
+}
+
+static void test_exact_chunk_size() {
+  // Genau kChunkSize Bytes: ein voller Chunk, kein leerer Rest-Chunk
+  WebServer server;
+  JsonStreamWriter json(server);
+  json.value(long_text(JsonStreamWriter::kChunkSize - 2, 'x'));
+  CHECK_EQ(server.chunks.size(), 1u);
+  json.finish();
+  CHECK_EQ(server.chunks.size(), 1u);
+  CHECK_EQ(server.terminated, 1);
+  CHECK_EQ(server.body.length(), JsonStreamWriter::kChunkSize);
+}
+
+static void test_destructor_finishes_once() {
+  WebServer server;
+  {
+    JsonStreamWriter json(server);
+    json.beginObject().field("early", "return");
+    // kein finish(): der Destruktor muss den Rest senden und die Antwort beenden
+  }
+  CHECK_STR(server.body, "{\"early\":\"return\"");
+  CHECK_EQ(server.terminated, 1);
+
+  WebServer twice;
+  {
+    JsonStreamWriter json(twice);
+    json.beginArray().endArray();
+    json.finish();
+    json.finish();
+  }
+  CHECK_EQ(twice.terminated, 1);
+  CHECK_EQ(twice.sends, 1);
+}
+
+static void test_count_mode_crc() {
+  // Ohne Client: nur Bytes und CRC, identisch zur Capture-Ausgabe
+  String captured;
+  JsonStreamWriter cap(&captured);
+  JsonStreamWriter count(nullptr);
+  for (JsonStreamWriter* w : {&cap, &count}) {
+    w->beginArray();
+    for (int i = 0; i < 500; ++i) w->beginObject().field("i", i).field("s", "wert").endObject();
+    w->endArray();
+    w->finish();
+  }
+  CHECK_EQ(count.bytes(), captured.length());
+  CHECK_EQ(count.crc(), esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(captured.c_str()), captured.length()));
+  CHECK(count.chunks() > 1);
+}
+
+int main() {
+  RUN_TEST(test_structure_and_commas);
+  RUN_TEST(test_top_level_values);
+  RUN_TEST(test_numbers);
+  RUN_TEST(test_escaping);
+  RUN_TEST(test_depth_overflow);
+  RUN_TEST(test_chunk_boundaries);
+  RUN_TEST(test_exact_chunk_size);
+  RUN_TEST(test_destructor_finishes_once);
+  RUN_TEST(test_count_mode_crc);
+  return g_test_failures ? 1 : 0;
+}
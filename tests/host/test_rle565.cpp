@@ -0,0 +1,169 @@
+// Host-Tests fuer src/ui/rle565: Zeilen-Codec des RLE-Containers, den der
+// URL-Stream-Pfad (user-036) und die SD-Konvertierung schreiben.
+
+#include "test_util.h"
+#include "src/ui/rle565.h"
+
+#include <string.h>
+#include <vector>
+
+static uint32_t g_rng = 1;
+static uint16_t rnd16() {
+  g_rng = g_rng * 1103515245u + 12345u;
+  return static_cast<uint16_t>(g_rng >> 8);
+}
+
+// Kodieren, Groesse gegen Zaehllauf und Schranke pruefen, dekodieren, vergleichen
+static size_t roundtrip(const std::vector<uint16_t>& row) {
+  const uint16_t w = static_cast<uint16_t>(row.size());
+  const size_t counted = rle565_encode_row(row.data(), w, nullptr);
+  std::vector<uint8_t> enc(rle565_row_bound(w) + 16, 0xEE);
+  const size_t n = rle565_encode_row(row.data(), w, enc.data());
+  CHECK_EQ(n, counted);
+  CHECK(n <= rle565_row_bound(w));
+  for (size_t i = n; i < enc.size(); ++i) CHECK_EQ(enc[i], 0xEE);  // kein Schreiben hinter n
+
+  std::vector<uint16_t> dec(w, 0xDEAD);
+  CHECK(rle565_decode_row(enc.data(), n, reinterpret_cast<uint8_t*>(dec.data()), w));
+  CHECK(memcmp(dec.data(), row.data(), static_cast<size_t>(w) * 2U) == 0);
+  return n;
+}
+
+static void test_roundtrip_patterns() {
+  const uint16_t widths[] = {1, 2, 3, 127, 128, 129, 255, 256, 257, 1280};
+  for (uint16_t w : widths) {
+    std::vector<uint16_t> row(w);
+    for (auto& p : row) p = rnd16();
+    roundtrip(row);                                   // Rauschen: nur Literale
+
+    for (auto& p : row) p = 0x1234;
+    roundtrip(row);                                   // einfarbig
+
+    for (uint16_t x = 0; x < w; ++x) row[x] = (x & 1) ? 0xFFFF : 0x0000;
+    roundtrip(row);                                   // alternierend
+
+    for (uint16_t x = 0; x < w; ++x) row[x] = static_cast<uint16_t>((x / 5) * 37);
+    roundtrip(row);                                   // kurze Laeufe der Laenge 5
+
+    for (uint16_t x = 0; x < w; ++x) row[x] = (x % 200 < 3) ? rnd16() : 0x8410;
+    roundtrip(row);                                   // UI-typisch: Flaeche mit Kanten
+  }
+}
+
+static void test_token_layout() {
+  // 300 gleiche Pixel -> Laeufe 128 + 128 + 44
+  std::vector<uint16_t> row(300, 0xABCD);
+  std::vector<uint8_t> enc(rle565_row_bound(300));
+  CHECK_EQ(rle565_encode_row(row.data(), 300, enc.data()), 9u);
+  CHECK_EQ(enc[0], 127);
+  CHECK_EQ(enc[3], 127);
+  CHECK_EQ(enc[6], 43);
+  uint16_t v;
+  memcpy(&v, &enc[7], 2);
+  CHECK_EQ(v, 0xABCD);
+
+  // Literal endet vor der naechsten Wiederholung: A B C C -> [lit 2][rep 2]
+  const uint16_t mixed[] = {1, 2, 3, 3};
+  CHECK_EQ(rle565_encode_row(mixed, 4, enc.data()), 1u + 4u + 3u);
+  CHECK_EQ(enc[0], 0x80 | 1);
+  CHECK_EQ(enc[5], 1);
+
+  // Literale werden ebenfalls bei 128 Pixeln geteilt
+  std::vector<uint16_t> noise(200);
+  for (uint16_t x = 0; x < 200; ++x) noise[x] = x;
+  CHECK_EQ(rle565_encode_row(noise.data(), 200, enc.data()), 1u + 256u + 1u + 144u);
+  CHECK_EQ(enc[0], 0xFF);
+  CHECK_EQ(enc[257], 0x80 | 71);
+}
+
+static void test_decode_rejects_bad_input() {
+  std::vector<uint16_t> row(64);
+  for (auto& p : row) p = rnd16();
+  row[10] = row[11] = row[12];
+  std::vector<uint8_t> enc(rle565_row_bound(64));
+  const size_t n = rle565_encode_row(row.data(), 64, enc.data());
+  std::vector<uint16_t> dec(64);
+  uint8_t* out = reinterpret_cast<uint8_t*>(dec.data());
+
+  // Jede Kuerzung muss erkannt werden
+  for (size_t cut = 0; cut < n; ++cut) CHECK(!rle565_decode_row(enc.data(), cut, out, 64));
+
+  // Token ueber die Zeilenbreite hinaus darf nicht in den Puffer schreiben
+  std::vector<uint16_t> guard(8 + 4, 0x5555);
+  const uint8_t too_long[] = {9, 0x11, 0x22};  // Wiederholung 10 Pixel bei w = 8
+  CHECK(!rle565_decode_row(too_long, sizeof(too_long), reinterpret_cast<uint8_t*>(guard.data()), 8));
+  CHECK_EQ(guard[8], 0x5555);
+  const uint8_t lit_too_long[] = {0x80 | 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  CHECK(!rle565_decode_row(lit_too_long, sizeof(lit_too_long), reinterpret_cast<uint8_t*>(guard.data()), 8));
+  CHECK_EQ(guard[8], 0x5555);
+}
+
+static void test_header_validation() {
+  Rle565Header hdr{};
+  hdr.magic = kRle565Magic;
+  hdr.version = kRle565Version;
+  hdr.w = 1280;
+  hdr.h = 720;
+  hdr.stride = 2560;
+  CHECK(rle565_header_valid(hdr));
+  Rle565Header bad = hdr;
+  bad.magic = 0x19;  // LVGL-.bin
+  CHECK(!rle565_header_valid(bad));
+  bad = hdr;
+  bad.version = kRle565Version + 1;
+  CHECK(!rle565_header_valid(bad));
+  bad = hdr;
+  bad.stride = 2558;
+  CHECK(!rle565_header_valid(bad));
+  bad = hdr;
+  bad.h = 0;
+  CHECK(!rle565_header_valid(bad));
+}
+
+// Kompression und Durchsatz fuer ein UI-Bild (Flaechen) und ein Foto (Rauschen)
+static void bench_frame(const char* name, bool photo) {
+  const uint16_t w = 1280, h = 720;
+  std::vector<uint16_t> img(static_cast<size_t>(w) * h);
+  for (uint16_t y = 0; y < h; ++y) {
+    for (uint16_t x = 0; x < w; ++x) {
+      uint16_t p = static_cast<uint16_t>(((y / 90) * 8 + x / 160) * 0x0821);
+      if (photo) p = static_cast<uint16_t>(p ^ (rnd16() & 0x0841));
+      img[static_cast<size_t>(y) * w + x] = p;
+    }
+  }
+  std::vector<uint8_t> enc(rle565_row_bound(w) * h);
+  std::vector<uint16_t> dec(img.size());
+  const double t0 = test_now_ms();
+  size_t total = 0;
+  std::vector<size_t> offs(h + 1);
+  for (uint16_t y = 0; y < h; ++y) {
+    offs[y] = total;
+    total += rle565_encode_row(&img[static_cast<size_t>(y) * w], w, enc.data() + total);
+  }
+  offs[h] = total;
+  const double t1 = test_now_ms();
+  for (uint16_t y = 0; y < h; ++y) {
+    CHECK(rle565_decode_row(enc.data() + offs[y], offs[y + 1] - offs[y],
+                            reinterpret_cast<uint8_t*>(&dec[static_cast<size_t>(y) * w]), w));
+  }
+  const double t2 = test_now_ms();
+  CHECK(dec == img);
+  if (!photo) CHECK(total * 10 < img.size() * 2);  // Flaechen: deutlich unter 10 %
+  printf("  %-6s %4u KB -> %4u KB (%3u%%), enc %.2f ms, dec %.2f ms\n", name,
+         static_cast<unsigned>(img.size() * 2 / 1024), static_cast<unsigned>(total / 1024),
+         static_cast<unsigned>(total * 100 / (img.size() * 2)), t1 - t0, t2 - t1);
+}
+
+static void test_bench_frames() {
+  bench_frame("ui", false);
+  bench_frame("photo", true);
+}
+
+int main() {
+  RUN_TEST(test_roundtrip_patterns);
+  RUN_TEST(test_token_layout);
+  RUN_TEST(test_decode_rejects_bad_input);
+  RUN_TEST(test_header_validation);
+  RUN_TEST(test_bench_frames);
+  return g_test_failures ? 1 : 0;
+}
@@ -0,0 +1,106 @@
+// Host-Tests fuer src/ui/url_cache_meta: Sidecar-Format, CRC ueber gestueckelte
+// Bodies und die Entscheidung "gleicher Inhalt -> keine Konvertierung".
+
+#include "test_util.h"
+#include "src/ui/url_cache_meta.h"
+
+#include <vector>
+
+static UrlCacheMeta meta_of(const std::vector<uint8_t>& body, size_t chunk) {
+  UrlCacheMeta m;
+  for (size_t pos = 0; pos < body.size(); pos += chunk) {
+    const size_t n = (body.size() - pos < chunk) ? body.size() - pos : chunk;
+    url_cache_meta_add(m, body.data() + pos, n);
+  }
+  m.valid = m.size > 0;
+  return m;
+}
+
+static void test_crc_matches_reference() {
+  const char* check = "123456789";
+  UrlCacheMeta m;
+  url_cache_meta_add(m, reinterpret_cast<const uint8_t*>(check), 9);
+  CHECK_EQ(m.crc, 0xCBF43926u);  // CRC-32/IEEE Pruefwert
+  CHECK_EQ(m.size, 9u);
+}
+
+static void test_crc_independent_of_chunking() {
+  std::vector<uint8_t> body(70000);
+  uint32_t x = 12345;
+  for (auto& b : body) {
+    x = x * 1103515245u + 12345u;
+    b = static_cast<uint8_t>(x >> 16);
+  }
+  const UrlCacheMeta whole = meta_of(body, body.size());
+  const size_t chunks[] = {1, 7, 1460, 4096, 65536};
+  for (size_t c : chunks) {
+    const UrlCacheMeta part = meta_of(body, c);
+    CHECK_EQ(part.crc, whole.crc);
+    CHECK_EQ(part.size, whole.size);
+  }
+}
+
+static void test_sidecar_roundtrip() {
+  UrlCacheMeta m;
+  m.etag = "W/\"5f3a-1a2b\"";
+  m.last_modified = "Wed, 21 Oct 2026 07:28:00 GMT";
+  m.crc = 0x0012ABCD;
+  m.size = 48213;
+  const String text = url_cache_meta_format(m);
+  CHECK_STR(text, "etag=W/\"5f3a-1a2b\"\nlm=Wed, 21 Oct 2026 07:28:00 GMT\ncrc=0012ABCD\nsize=48213\n");
+
+  UrlCacheMeta back;
+  CHECK(url_cache_meta_parse(text, back));
+  CHECK_STR(back.etag, m.etag);
+  CHECK_STR(back.last_modified, m.last_modified);
+  CHECK_EQ(back.crc, m.crc);
+  CHECK_EQ(back.size, m.size);
+  CHECK(back.valid);
+}
+
+static void test_sidecar_tolerant_parse() {
+  UrlCacheMeta m;
+  // CRLF, unbekannte Schluessel, Zeile ohne '=', fehlender Zeilenumbruch am Ende
+  CHECK(url_cache_meta_parse("etag=\"abc\"\r\nfoo=bar\ngarbage\ncrc=ff\r\nsize=10", m));
+  CHECK_STR(m.etag, "\"abc\"");
+  CHECK_EQ(m.crc, 0xFFu);
+  CHECK_EQ(m.size, 10u);
+
+  // Ohne Groesse ist der Eintrag nicht nutzbar -> unbedingter Request
+  CHECK(!url_cache_meta_parse("etag=\"abc\"\nlm=x\ncrc=12\n", m));
+  CHECK(!m.valid);
+  CHECK(!url_cache_meta_parse("", m));
+  // Alter Inhalt darf nicht durchsickern
+  CHECK_STR(m.etag, "");
+}
+
+static void test_same_content_decision() {
+  const std::vector<uint8_t> a(1000, 0x11);
+  std::vector<uint8_t> b = a;
+  b[500] = 0x12;
+  const UrlCacheMeta cached = meta_of(a, 256);
+
+  // Erster Abruf: kein Cache-Eintrag -> immer konvertieren
+  CHECK(!url_cache_meta_same_content(nullptr, meta_of(a, 100)));
+  // Server ohne Validatoren liefert 200 mit identischen Bytes -> Decode sparen
+  CHECK(url_cache_meta_same_content(&cached, meta_of(a, 100)));
+  // Gleiche Groesse, anderer Inhalt
+  CHECK(!url_cache_meta_same_content(&cached, meta_of(b, 100)));
+  // Andere Groesse
+  CHECK(!url_cache_meta_same_content(&cached, meta_of(std::vector<uint8_t>(999, 0x11), 100)));
+  // Leerer Body ist nie "gleich"
+  UrlCacheMeta empty;
+  CHECK(!url_cache_meta_same_content(&cached, empty));
+  UrlCacheMeta invalid_cached = cached;
+  invalid_cached.valid = false;
+  CHECK(!url_cache_meta_same_content(&invalid_cached, meta_of(a, 100)));
+}
+
+int main() {
+  RUN_TEST(test_crc_matches_reference);
+  RUN_TEST(test_crc_independent_of_chunking);
+  RUN_TEST(test_sidecar_roundtrip);
+  RUN_TEST(test_sidecar_tolerant_parse);
+  RUN_TEST(test_same_content_decision);
+  return g_test_failures ? 1 : 0;
+}
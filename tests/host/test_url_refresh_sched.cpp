@@ -0,0 +1,230 @@
+// Host-Tests fuer src/ui/url_refresh_sched: Termine, Sichtbarkeits-Vorrang,
+// Deduplizierung, Slot-Wiederverwendung und Konfig-Abgleich mit virtueller Uhr.
+
+#include "test_util.h"
+#include "src/ui/url_refresh_sched.h"
+
+static String url(int i) {
+  return "http://cam/" + String(i) + ".jpg";
+}
+
+// Alle faelligen Jobs holen und sofort abschliessen; liefert die Reihenfolge
+static std::vector<String> drain(UrlRefreshScheduler& s, uint32_t now) {
+  std::vector<String> order;
+  String u;
+  uint32_t wait_ms;
+  while (s.take(now, u, wait_ms)) {
+    order.push_back(u);
+    s.complete(u, now);
+  }
+  return order;
+}
+
+static void test_sync_initial_delay_and_interval() {
+  UrlRefreshScheduler s(1);
+  s.beginSync();
+  s.syncEntry(url(1), 60000, 1000, 30000);
+  s.endSync();
+
+  String u;
+  uint32_t wait_ms;
+  CHECK(!s.take(1000, u, wait_ms));
+  CHECK_EQ(wait_ms, 30000u);
+  CHECK(s.take(31000, u, wait_ms));
+  CHECK_STR(u, url(1));
+  CHECK(!s.take(31000, u, wait_ms));  // max_inflight = 1
+  s.complete(u, 33000);
+  // Naechster Termin zaehlt ab Start des Jobs
+  CHECK(!s.take(33000, u, wait_ms));
+  CHECK_EQ(wait_ms, 58000u);
+  CHECK(s.take(91000, u, wait_ms));
+  s.complete(u, 91000);
+  CHECK_EQ(s.stats().dispatched, 2u);
+}
+
+static void test_earliest_due_first() {
+  UrlRefreshScheduler s(1);
+  s.beginSync();
+  s.syncEntry(url(1), 60000, 0, 5000);
+  s.syncEntry(url(2), 60000, 0, 1000);
+  s.syncEntry(url(3), 60000, 0, 3000);
+  s.endSync();
+  const std::vector<String> order = drain(s, 10000);
+  CHECK_EQ(order.size(), 3u);
+  if (order.size() == 3) {
+    CHECK_STR(order[0], url(2));
+    CHECK_STR(order[1], url(3));
+    CHECK_STR(order[2], url(1));
+  }
+}
+
+static void test_visible_before_background() {
+  UrlRefreshScheduler s(1);
+  s.beginSync();
+  for (int i = 0; i < 5; ++i) s.syncEntry(url(i), 60000, 0, 1000 + i * 100);
+  s.endSync();
+  s.setVisible(url(4), true);  // spaetester Termin, aber sichtbar
+  std::vector<String> order = drain(s, 5000);
+  CHECK_EQ(order.size(), 5u);
+  if (!order.empty()) CHECK_STR(order[0], url(4));
+  CHECK_EQ(s.stats().dispatched_visible, 1u);
+
+  // Sichtbarkeit wieder weg -> wieder nach Termin sortiert
+  s.setVisible(url(4), false);
+  order = drain(s, 100000);
+  CHECK_EQ(order.size(), 5u);
+  if (!order.empty()) CHECK_STR(order[0], url(0));
+  CHECK_EQ(s.stats().visible, 0u);
+}
+
+static void test_background_waits_for_visible_job() {
+  UrlRefreshScheduler s(2);
+  s.beginSync();
+  s.syncEntry(url(1), 60000, 0, 0);
+  s.syncEntry(url(2), 60000, 0, 0);
+  s.endSync();
+  s.setVisible(url(1), true);
+  String u;
+  uint32_t wait_ms;
+  CHECK(s.take(0, u, wait_ms));
+  CHECK_STR(u, url(1));
+  // Zweiter Slot frei, aber sichtbarer Job laeuft: Hintergrund wird zurueckgestellt
+  CHECK(!s.take(0, u, wait_ms));
+  CHECK_EQ(s.stats().deferred, 1u);
+  s.complete(url(1), 500);
+  CHECK(s.take(500, u, wait_ms));
+  CHECK_STR(u, url(2));
+}
+
+static void test_request_now_dedupe() {
+  UrlRefreshScheduler s(1);
+  CHECK(s.requestNow(url(7), 100));
+  CHECK(!s.requestNow(url(7), 100));  // wartet bereits
+  CHECK(s.isPending(url(7), 100));
+  String u;
+  uint32_t wait_ms;
+  CHECK(s.take(100, u, wait_ms));
+  CHECK(!s.requestNow(url(7), 150));  // laeuft
+  CHECK_EQ(s.stats().deduped, 2u);
+  // Nicht in der Konfiguration: nach complete verschwindet der Eintrag
+  s.complete(u, 200);
+  CHECK_EQ(s.stats().entries, 0u);
+  CHECK(!s.isPending(url(7), 200));
+}
+
+static void test_erase_and_slot_reuse() {
+  UrlRefreshScheduler s(1);
+  s.beginSync();
+  s.syncEntry(url(1), 60000, 0, 1000);
+  s.syncEntry(url(2), 60000, 0, 2000);
+  s.endSync();
+  // url(1) faellt aus der Konfiguration, url(3) belegt den freien Slot neu
+  s.beginSync();
+  s.syncEntry(url(2), 60000, 0, 2000);
+  s.endSync();
+  CHECK_EQ(s.stats().entries, 1u);
+  s.beginSync();
+  s.syncEntry(url(2), 60000, 0, 2000);
+  s.syncEntry(url(3), 60000, 0, 50000);
+  s.endSync();
+
+  // Der alte Heap-Eintrag von url(1) (t=1000) darf url(3) nicht vorzeitig starten
+  String u;
+  uint32_t wait_ms;
+  CHECK(s.take(2000, u, wait_ms));
+  CHECK_STR(u, url(2));
+  s.complete(u, 2000);
+  CHECK(!s.take(10000, u, wait_ms));
+  CHECK_EQ(wait_ms, 40000u);
+  CHECK(s.take(50000, u, wait_ms));
+  CHECK_STR(u, url(3));
+}
+
+static void test_interval_change() {
+  UrlRefreshScheduler s(1);
+  s.beginSync();
+  s.syncEntry(url(1), 600000, 0, 0);
+  s.endSync();
+  drain(s, 0);  // naechster Termin t=600000
+  // Kuerzeres Intervall zieht vor
+  s.beginSync();
+  s.syncEntry(url(1), 60000, 1000, 0);
+  s.endSync();
+  String u;
+  uint32_t wait_ms;
+  CHECK(!s.take(1000, u, wait_ms));
+  CHECK_EQ(wait_ms, 60000u);
+  // Laengeres Intervall schiebt nach hinten
+  s.beginSync();
+  s.syncEntry(url(1), 120000, 2000, 0);
+  s.endSync();
+  CHECK(!s.take(2000, u, wait_ms));
+  CHECK_EQ(wait_ms, 120000u);
+}
+
+static void test_many_entries_growth() {
+  UrlRefreshScheduler s(1);
+  s.beginSync();
+  for (int i = 0; i < 300; ++i) s.syncEntry(url(i), 60000, 0, static_cast<uint32_t>(300 - i));
+  s.endSync();
+  CHECK_EQ(s.stats().entries, 300u);
+  const std::vector<String> order = drain(s, 1000);
+  CHECK_EQ(order.size(), 300u);
+  if (order.size() == 300) {
+    CHECK_STR(order.front(), url(299));
+    CHECK_STR(order.back(), url(0));
+  }
+  // Jeder Eintrag genau einmal
+  std::vector<int> seen(300, 0);
+  for (const auto& o : order) seen[o.substring(11).toInt()]++;
+  for (int c : seen) CHECK_EQ(c, 1);
+}
+
+static void test_due_wraparound() {
+  UrlRefreshScheduler s(1);
+  const uint32_t now = 0xFFFFF000u;
+  s.beginSync();
+  s.syncEntry(url(1), 60000, now, 0x2000);  // Termin nach dem Ueberlauf
+  s.syncEntry(url(2), 60000, now, 0x100);
+  s.endSync();
+  String u;
+  uint32_t wait_ms;
+  CHECK(!s.take(now, u, wait_ms));
+  CHECK_EQ(wait_ms, 0x100u);
+  const std::vector<String> order = drain(s, now + 0x3000);
+  CHECK_EQ(order.size(), 2u);
+  if (order.size() == 2) CHECK_STR(order[0], url(2));
+}
+
+// Zahl hinter "key": ab dem Abschnitt section
+static long json_num(const String& json, const char* section, const char* key) {
+  const int at = json.indexOf(String("\"") + section + "\":");
+  if (at < 0) return -1;
+  const String k = String("\"") + key + "\":";
+  const int pos = json.indexOf(k, at);
+  if (pos < 0) return -1;
+  return json.substring(pos + k.length()).toInt();
+}
+
+static void test_simulation_beats_fifo() {
+  const String json = url_refresh_sched_simulate(40, 3600);
+  const long jobs = json_num(json, "deadline", "jobs");
+  CHECK(jobs > 0);
+  CHECK(json_num(json, "deadline", "avg_lag_ms") < json_num(json, "fifo", "avg_lag_ms"));
+  CHECK(json_num(json, "deadline", "visible_avg_lag_ms") < json_num(json, "fifo", "visible_avg_lag_ms"));
+  CHECK(json_num(json, "deadline", "visible_max_lag_ms") < json_num(json, "fifo", "visible_max_lag_ms"));
+}
+
+int main() {
+  RUN_TEST(test_sync_initial_delay_and_interval);
+  RUN_TEST(test_earliest_due_first);
+  RUN_TEST(test_visible_before_background);
+  RUN_TEST(test_background_waits_for_visible_job);
+  RUN_TEST(test_request_now_dedupe);
+  RUN_TEST(test_erase_and_slot_reuse);
+  RUN_TEST(test_interval_change);
+  RUN_TEST(test_many_entries_growth);
+  RUN_TEST(test_due_wraparound);
+  RUN_TEST(test_simulation_beats_fifo);
+  return g_test_failures ? 1 : 0;
+}
@@ -0,0 +1,55 @@
+#ifndef HOST_TEST_UTIL_H
+#define HOST_TEST_UTIL_H
+
+// Kleinstes Test-Geruest fuer die Host-Tests: CHECK zaehlt Fehler und laeuft weiter,
+// main() gibt != 0 zurueck, sobald ein CHECK fehlschlug (ctest: fehlgeschlagen).
+
+#include <stdio.h>
+#include <stdint.h>
+#include <chrono>
+
+static int g_test_failures = 0;
+
+#define CHECK(cond)                                                           \
+  do {                                                                        \
+    if (!(cond)) {                                                            \
+      fprintf(stderr, "%s:%d: CHECK(%s) fehlgeschlagen\n", __FILE__, __LINE__, #cond); \
+      g_test_failures++;                                                      \
+    }                                                                         \
+  } while (0)
+
+#define CHECK_EQ(a, b)                                                        \
+  do {                                                                        \
+    const auto _va = (a);                                                     \
+    const auto _vb = (b);                                                     \
+    if (!(_va == _vb)) {                                                      \
+      fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) fehlgeschlagen: %lld != %lld\n", __FILE__, __LINE__, #a, #b, \
+              static_cast<long long>(_va), static_cast<long long>(_vb));      \
+      g_test_failures++;                                                      \
+    }                                                                         \
+  } while (0)
+
+#define CHECK_STR(a, b)                                                       \
+  do {                                                                        \
+    const String _sa = (a);                                                   \
+    const String _sb = (b);                                                   \
+    if (!(_sa == _sb)) {                                                      \
+      fprintf(stderr, "%s:%d: CHECK_STR(%s, %s) fehlgeschlagen:\n  '%s'\n  '%s'\n", __FILE__, __LINE__, #a, #b, \
+              _sa.c_str(), _sb.c_str());                                      \
+      g_test_failures++;                                                      \
+    }                                                                         \
+  } while (0)
+
+#define RUN_TEST(fn)                  \
+  do {                                \
+    const int _before = g_test_failures; \
+    fn();                             \
+    printf("%s %s\n", g_test_failures == _before ? "[ok]  " : "[FAIL]", #fn); \
+  } while (0)
+
+inline double test_now_ms() {
+  using namespace std::chrono;
+  return duration_cast<duration<double, std::milli>>(steady_clock::now().time_since_epoch()).count();
+}
+
+#endif // HOST_TEST_UTIL_H
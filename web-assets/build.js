@@ -0,0 +1,40 @@
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+const crypto = require('crypto');
+
+// Statische Web-Admin-Assets -> gzip-komprimierte PROGMEM-Arrays fuer den ESP32
+const assets = [
+  { file: 'admin.css', symbol: 'ADMIN_CSS', url: '/admin.css', type: 'text/css' },
+  { file: 'admin.js', symbol: 'ADMIN_JS', url: '/admin.js', type: 'application/javascript' },
+];
+
+const outPath = path.join(__dirname, '..', 'src', 'web', 'web_admin_assets.cpp');
+
+let out = '';
+out += '// AUTOMATISCH ERZEUGT von web-assets/build.js - nicht von Hand bearbeiten.\n';
+out += '// Quellen: web-assets/*.css, web-assets/*.js (cd web-assets && npm run build)\n';
+out += '#include "src/web/web_admin_assets.h"\n';
+
+for (const asset of assets) {
+  const raw = fs.readFileSync(path.join(__dirname, asset.file));
+  const gz = zlib.gzipSync(raw, { level: 9 });  // mtime = 0 -> reproduzierbar
+  const etag = crypto.createHash('sha1').update(raw).digest('hex').slice(0, 12);
+
+  const lines = [];
+  for (let i = 0; i < gz.length; i += 16) {
+    const row = Array.from(gz.subarray(i, i + 16), b => '0x' + b.toString(16).padStart(2, '0'));
+    lines.push('  ' + row.join(', ') + ',');
+  }
+
+  out += `\n// ${asset.file}: ${raw.length} Bytes -> ${gz.length} Bytes gzip\n`;
+  out += `static const uint8_t ${asset.symbol}_GZ[] PROGMEM = {\n${lines.join('\n')}\n};\n`;
+  out += `const WebAsset WEB_ASSET_${asset.symbol} = {\n`;
+  out += `  "${asset.url}", "${asset.type}", ${asset.symbol}_GZ, sizeof(${asset.symbol}_GZ), ${raw.length}, "${etag}", "\\"${etag}\\""\n`;
+  out += '};\n';
+
+  console.log(`${asset.file}: ${raw.length} -> ${gz.length} Bytes (ETag ${etag})`);
+}
+
+fs.writeFileSync(outPath, out);
+console.log(`Geschrieben: ${path.relative(process.cwd(), outPath)}`);
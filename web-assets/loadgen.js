@@ -0,0 +1,109 @@
+const http = require('http');
+
+// Lastgenerator fuer den Web-Admin: mehrere parallele Clients fragen die API ab,
+// danach meldet das Geraet die laengste UI-Loop-Iteration (/api/perf -> ui_loop).
+//   node loadgen.js <ip> [sekunden=30] [clients=4] [slow_ms=0]
+// slow_ms > 0: jeder Client liest die Antwort gedrosselt (langsamer Browser).
+const host = process.argv[2];
+const seconds = parseInt(process.argv[3] || '30', 10);
+const clients = parseInt(process.argv[4] || '4', 10);
+const slowMs = parseInt(process.argv[5] || '0', 10);
+
+if (!host) {
+  console.error('Aufruf: node loadgen.js <ip> [sekunden] [clients] [slow_ms]');
+  process.exit(1);
+}
+
+const paths = [
+  '/',
+  '/admin.js',
+  '/api/sensor_values',
+  '/api/tiles?tab=tab0',
+  '/api/layout',
+  '/api/status',
+  '/api/sd_images?limit=50',
+];
+
+const stats = {};
+for (const p of paths) stats[p] = { ok: 0, err: 0, bytes: 0, ms: [] };
+
+function request(path) {
+  return new Promise((resolve) => {
+    const start = Date.now();
+    const req = http.get({ host, path, agent: false, timeout: 15000 }, (res) => {
+      let bytes = 0;
+      res.on('data', (chunk) => {
+        bytes += chunk.length;
+        if (slowMs > 0) {
+          res.pause();
+          setTimeout(() => res.resume(), slowMs);
+        }
+      });
+      res.on('end', () => resolve({ ok: res.statusCode < 400, status: res.statusCode, bytes, ms: Date.now() - start }));
+    });
+    req.on('timeout', () => req.destroy(new Error('timeout')));
+    req.on('error', () => resolve({ ok: false, status: 0, bytes: 0, ms: Date.now() - start }));
+  });
+}
+
+function getJson(path) {
+  return new Promise((resolve, reject) => {
+    http.get({ host, path, agent: false }, (res) => {
+      let body = '';
+      res.on('data', (c) => { body += c; });
+      res.on('end', () => {
+        try { resolve(JSON.parse(body)); } catch (e) { reject(e); }
+      });
+    }).on('error', reject);
+  });
+}
+
+async function client(id, until) {
+  let i = id;
+  while (Date.now() < until) {
+    const path = paths[i++ % paths.length];
+    const r = await request(path);
+    const s = stats[path];
+    if (r.ok) s.ok++; else s.err++;
+    s.bytes += r.bytes;
+    s.ms.push(r.ms);
+  }
+}
+
+function percentile(values, p) {
+  if (!values.length) return 0;
+  const sorted = values.slice().sort((a, b) => a - b);
+  return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+async function main() {
+  // Maxima auf dem Geraet zuruecksetzen, damit nur dieser Lauf zaehlt
+  const before = await getJson('/api/perf?reset_loop=1');
+  console.log(`Ruhe: laengste Loop-Iteration ${before.ui_loop.iter_max_us} us (vor dem Reset)`);
+  console.log(`${clients} Clients, ${seconds} s${slowMs ? `, gedrosselt ${slowMs} ms/Chunk` : ''} -> http://${host}`);
+
+  const until = Date.now() + seconds * 1000;
+  await Promise.all(Array.from({ length: clients }, (_, id) => client(id, until)));
+
+  const after = await getJson('/api/perf');
+  let total = 0;
+  console.log('\nPfad                        ok  fehler   p50 ms   p95 ms     KB');
+  for (const p of paths) {
+    const s = stats[p];
+    total += s.ok;
+    console.log(
+      p.padEnd(26) + String(s.ok).padStart(5) + String(s.err).padStart(8) +
+      String(percentile(s.ms, 0.5)).padStart(9) + String(percentile(s.ms, 0.95)).padStart(9) +
+      String(Math.round(s.bytes / 1024)).padStart(7));
+  }
+  const ul = after.ui_loop;
+  console.log(`\n${total} Requests, ${(total / seconds).toFixed(1)}/s`);
+  console.log(`UI-Loop unter Last: laengste Iteration ${ul.iter_max_us} us, laengster Loop-Auftrag ${ul.job_max_us} us`);
+  console.log(`Auftraege: ${ul.executed} ausgefuehrt, ${ul.abandoned} verworfen, ${ul.overflows} Queue voll`);
+  console.log(`Web-Task: ${after.web.task ? 'aktiv' : 'aus (Loop)'}, Stack frei ${after.web.stack_free} Bytes`);
+}
+
+main().catch((e) => {
+  console.error('Fehler:', e.message);
+  process.exit(1);
+});